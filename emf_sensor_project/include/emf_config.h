@@ -37,9 +37,32 @@ constexpr int N_ON = (int)(5000UL / PERIOD_MS);  // ~5 seconds
 // ESP-NOW cooldown
 constexpr uint32_t NOW_COOLDOWN_MS = 30000;      // 30 second cooldown
 
+// Rendezvous with a duty-cycled camera: triggers wait for its next poll
+constexpr uint8_t  RDV_LOST_PERIODS   = 3;       // silent slots before sending at once again
+constexpr uint32_t RDV_MIN_PERIOD_MS  = 100;     // shortest slot period granted
+
+// Evidence thumbnails from the camera (/evidence/<bay>.jpg)
+constexpr int      EVIDENCE_MAX_BAYS  = 4;
+constexpr uint32_t EVIDENCE_NACK_MS   = 150;     // fragment gap before NACKing the missing ones
+constexpr uint8_t  EVIDENCE_MAX_NACKS = 4;       // then drop the partial image
+
 // Web interface timing
 constexpr uint32_t INTERACTIVE_MS = 5000;        // Interactive mode timeout
 
+// =================== ULP SAMPLING ===================
+// Battery mode: the ULP co-processor samples PIN_VOUT every PERIOD_MS into RTC
+// memory and keeps fast/slow averages there. The cores light-sleep and wake
+// on a rise, for a full batch or for the camera's next slot, then run the
+// float chain on every sample. Web pages only answer while awake.
+constexpr bool     ULP_SAMPLING      = false;
+constexpr int      ULP_ADC_CHANNEL   = 6;        // ADC1 channel of PIN_VOUT (GPIO34)
+constexpr int      ULP_BATCH         = 30;       // samples per routine wake (< 64)
+constexpr float    ULP_WAKE_DB       = 0.50f;    // |fast - slow| that wakes the cores
+constexpr uint32_t ULP_AWAKE_MS      = 10000;    // stay awake after a rise or a trigger
+constexpr uint32_t ULP_SLOT_GUARD_MS = 20;       // awake this early for a camera slot
+constexpr uint32_t ULP_SLOT_WAIT_MS  = 60;       // and until its poll, at most this long after
+constexpr uint32_t ULP_MIN_SLEEP_MS  = 50;       // shorter gaps are spent awake
+
 // =================== FILE PATHS ===================
 constexpr const char* CSV_PATH = "/ad8317_log.csv";
 
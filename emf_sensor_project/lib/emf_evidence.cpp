@@ -0,0 +1,176 @@
+#include "emf_evidence.h"
+
+// =================== GLOBAL VARIABLES ===================
+uint32_t evidence_images  = 0;
+uint32_t evidence_dropped = 0;   // incremented under evidence_mux
+
+// Fragments are written from the ESP-NOW RX callback (WiFi task); the
+// complete image is published and served from loop() only. Every decision
+// that reads or swaps buf, jpg or their ids is one evidence_mux section.
+typedef struct {
+  // Image being reassembled (RX callback)
+  uint8_t* buf;
+  uint16_t img_id;
+  uint16_t total_len;
+  uint8_t  frag_count;
+  uint32_t have;            // bit i = fragment i received
+  uint32_t last_rx_ms;
+  uint8_t  nacks;
+  bool     complete;        // buf is whole, waiting for emf_evidence_poll()
+  uint8_t  mac[6];
+  // Last complete image (loop only)
+  uint8_t* jpg;
+  size_t   jpg_len;
+  uint16_t jpg_id;
+  uint32_t jpg_ms;
+} evidence_slot_t;
+
+static evidence_slot_t slots[EVIDENCE_MAX_BAYS];
+static portMUX_TYPE evidence_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// =================== HELPERS ===================
+static uint32_t all_frags(uint8_t n) {
+  return (n >= 32) ? 0xFFFFFFFFu : ((1u << n) - 1);
+}
+
+static void send_ack(const uint8_t* mac, uint8_t bay, uint16_t img_id,
+                     uint8_t frag_count, bool done, uint32_t missing) {
+  evidence_ack_msg_t ack{ NOW_MSG_MAGIC, NOW_MSG_EVIDENCE_ACK, img_id, bay,
+                          frag_count, (uint8_t)(done ? 1 : 0), missing };
+  esp_now_send(mac, (const uint8_t*)&ack, sizeof(ack));
+}
+
+// =================== REASSEMBLY ===================
+// Called from the ESP-NOW RX callback
+void emf_evidence_on_frame(const uint8_t* mac, const uint8_t* data, int len) {
+  if (len < (int)sizeof(evidence_hdr_t)) return;
+  evidence_hdr_t hdr;
+  memcpy(&hdr, data, sizeof(hdr));
+  if (hdr.bay >= EVIDENCE_MAX_BAYS || hdr.frag_count == 0 || hdr.frag_count > EVIDENCE_MAX_FRAGS ||
+      hdr.frag_idx >= hdr.frag_count || hdr.total_len == 0 || hdr.total_len > EVIDENCE_MAX_BYTES) {
+    return;
+  }
+  if (!esp_now_is_peer_exist(mac)) return;
+
+  evidence_slot_t& s = slots[hdr.bay];
+  const size_t off = (size_t)hdr.frag_idx * EVIDENCE_FRAG_PAYLOAD;
+  const size_t n = min(EVIDENCE_FRAG_PAYLOAD, (size_t)hdr.total_len - off);
+  if (off >= hdr.total_len || (int)(sizeof(hdr) + n) > len) return;
+
+  // Late resend of an image we already have: the ACK was lost. A new image
+  // waits while a complete one is unpublished; the camera resends it.
+  portENTER_CRITICAL(&evidence_mux);
+  const bool late = s.jpg && s.jpg_id == hdr.img_id && !s.buf;
+  const bool blocked = s.buf && s.complete && s.img_id != hdr.img_id;
+  const bool want_fresh = !s.buf || s.img_id != hdr.img_id;
+  portEXIT_CRITICAL(&evidence_mux);
+  if (late) {
+    send_ack(mac, hdr.bay, hdr.img_id, hdr.frag_count, true, 0);
+    return;
+  }
+  if (blocked) return;
+
+  // New image replaces any partial one (allocate outside the lock)
+  uint8_t* fresh = nullptr;
+  if (want_fresh) {
+    fresh = (uint8_t*)malloc(hdr.total_len);
+    if (!fresh) return;
+  }
+
+  uint8_t* stale = nullptr;
+  bool done = false;
+  portENTER_CRITICAL(&evidence_mux);
+  // loop() may have published or dropped buf meanwhile
+  if (fresh && s.buf && s.complete) {
+    stale = fresh;          // never replace an unpublished image
+    fresh = nullptr;
+  } else if (fresh && s.buf && s.img_id == hdr.img_id) {
+    stale = fresh;          // not needed after all
+    fresh = nullptr;
+  } else if (fresh) {
+    if (s.buf) evidence_dropped++;   // partial image abandoned for a newer one
+    stale = s.buf;
+    s.buf = fresh;
+    s.img_id = hdr.img_id;
+    s.total_len = hdr.total_len;
+    s.frag_count = hdr.frag_count;
+    s.have = 0;
+    s.nacks = 0;
+    s.complete = false;
+    memcpy(s.mac, mac, 6);
+  }
+  if (s.buf && !s.complete && s.img_id == hdr.img_id && hdr.total_len == s.total_len) {
+    memcpy(s.buf + off, data + sizeof(hdr), n);
+    s.have |= (1u << hdr.frag_idx);
+    s.last_rx_ms = millis();
+    done = s.complete = (s.have == all_frags(s.frag_count));
+  } else if (s.buf && s.complete && s.img_id == hdr.img_id) {
+    done = true;   // duplicate before publish: re-ACK
+  }
+  portEXIT_CRITICAL(&evidence_mux);
+  free(stale);
+
+  if (done) send_ack(mac, hdr.bay, hdr.img_id, hdr.frag_count, true, 0);
+}
+
+// Publish complete images, NACK stalled ones with the missing-fragment
+// bitmap, drop hopeless ones. Call from loop().
+void emf_evidence_poll() {
+  const uint32_t now = millis();
+  for (int bay = 0; bay < EVIDENCE_MAX_BAYS; bay++) {
+    evidence_slot_t& s = slots[bay];
+    if (!s.buf) continue;
+
+    uint8_t* release = nullptr;
+    bool published = false, nack = false;
+    uint32_t missing = 0;
+    uint8_t mac[6];
+
+    portENTER_CRITICAL(&evidence_mux);
+    const uint16_t img_id = s.img_id;
+    const uint8_t frag_count = s.frag_count;
+    const uint32_t have = s.have;
+    memcpy(mac, s.mac, 6);
+    if (s.complete) {
+      release = s.jpg;
+      s.jpg = s.buf;
+      s.jpg_len = s.total_len;
+      s.jpg_id = s.img_id;
+      s.jpg_ms = now;
+      s.buf = nullptr;
+      s.complete = false;
+      published = true;
+    } else if (now - s.last_rx_ms >= EVIDENCE_NACK_MS) {
+      if (s.nacks >= EVIDENCE_MAX_NACKS) {
+        release = s.buf;
+        s.buf = nullptr;
+        evidence_dropped++;
+      } else {
+        s.nacks++;
+        s.last_rx_ms = now;
+        missing = all_frags(s.frag_count) & ~s.have;
+        nack = true;
+      }
+    }
+    portEXIT_CRITICAL(&evidence_mux);
+    free(release);
+
+    if (published) {
+      evidence_images++;
+      Serial.printf("EVIDENCE RX: bay %d #%u %u B (%u fragments)\n",
+                    bay, (unsigned)s.jpg_id, (unsigned)s.jpg_len, (unsigned)frag_count);
+    } else if (nack) {
+      send_ack(mac, (uint8_t)bay, img_id, frag_count, false, missing);
+    } else if (release) {
+      Serial.printf("EVIDENCE bay %d #%u dropped (have=0x%08X)\n", bay, (unsigned)img_id, (unsigned)have);
+    }
+  }
+}
+
+bool emf_evidence_get(int bay, const uint8_t** jpg, size_t* len, uint32_t* age_ms) {
+  if (bay < 0 || bay >= EVIDENCE_MAX_BAYS || !slots[bay].jpg) return false;
+  *jpg = slots[bay].jpg;
+  *len = slots[bay].jpg_len;
+  if (age_ms) *age_ms = millis() - slots[bay].jpg_ms;
+  return true;
+}
@@ -0,0 +1,18 @@
+#ifndef EMF_EVIDENCE_H
+#define EMF_EVIDENCE_H
+
+#include <Arduino.h>
+#include <esp_now.h>
+#include "emf_config.h"
+#include "esp_now_comm.h"  // Shared message formats
+
+// =================== EVIDENCE REASSEMBLY ===================
+void emf_evidence_on_frame(const uint8_t* mac, const uint8_t* data, int len);
+void emf_evidence_poll();
+bool emf_evidence_get(int bay, const uint8_t** jpg, size_t* len, uint32_t* age_ms);
+
+// =================== GLOBAL VARIABLES ===================
+extern uint32_t evidence_images;      // thumbnails completed since boot
+extern uint32_t evidence_dropped;     // partial thumbnails abandoned
+
+#endif // EMF_EVIDENCE_H
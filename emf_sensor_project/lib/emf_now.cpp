@@ -0,0 +1,360 @@
+#include "emf_now.h"
+#include "emf_sensor.h"
+#include "emf_evidence.h"
+#include <sys/time.h>
+
+// =================== GLOBAL VARIABLES ===================
+// ESP32-CAM MAC - where triggers are sent and statuses come from
+uint8_t CAM_MAC[6] = { 0x78, 0x42, 0x1C, 0x6D, 0xBD, 0x68 };
+
+volatile bool     cam_present = false;
+volatile float    cam_conf    = 0.0f;
+volatile uint32_t cam_last_change_ms = 0;   // our millis at change (sender's if unsynced)
+volatile uint32_t cam_last_recv_ms   = 0;   // our millis when received
+int64_t  cam_last_change_epoch_ms = 0;
+uint32_t cam_sync_accuracy_us = UINT32_MAX;
+
+uint32_t cam_heartbeats   = 0;
+
+uint32_t rdv_period_ms   = 0;
+uint32_t rdv_polls       = 0;
+uint32_t rdv_held        = 0;
+uint32_t rdv_hold_max_ms = 0;
+
+// Camera slot schedule: slots at rdv_anchor_ms + k * rdv_period_ms. Written
+// by the RX callback (poll) and loop() (camera gone), read by both; each
+// update together with the held-trigger decision is one rdv_mux section
+static uint32_t rdv_anchor_ms    = 0;
+static uint32_t rdv_last_poll_ms = 0;
+// Held trigger: set from loop(), taken by the RX callback (poll answer) or
+// by loop() (camera gone); every set / take is one rdv_mux section
+static portMUX_TYPE rdv_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool     rdv_pending      = false;   // trigger waiting for the next poll
+static float    rdv_pending_db   = 0.0f;
+static uint32_t rdv_pending_ms   = 0;
+
+// Last camera TX stamp, echoed on our next frame to the camera (time master
+// side). Set from the RX callback, taken from both it and loop().
+static portMUX_TYPE cam_stamp_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t cam_t1 = 0;
+static int64_t cam_t2 = 0;
+
+// Camera's last heartbeat: written by the RX callback, read by the web
+// server; both copy it whole under cam_mem_mux
+static portMUX_TYPE cam_mem_mux = portMUX_INITIALIZER_UNLOCKED;
+static memt_summary_t cam_mem = {};
+static uint32_t cam_mem_recv_ms = 0;
+
+static const uint32_t EPOCH_REFRESH_MS = 600000;   // re-read the wall clock every 10 min
+static const time_t   EPOCH_VALID_SEC  = 1600000000;
+
+// =================== TIME MASTER ===================
+// Epoch ms at master time 0; the master timebase is esp_timer (≈ millis()*1000)
+int64_t emf_epoch_base_ms() {
+  static int64_t base = 0;
+  static uint32_t base_read_ms = 0;
+  if (base == 0 || millis() - base_read_ms >= EPOCH_REFRESH_MS) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec >= EPOCH_VALID_SEC) {
+      base = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000 - time_sync_local_us() / 1000;
+      base_read_ms = millis();
+    }
+  }
+  return base;
+}
+
+static void note_cam_stamp(int64_t t1, int64_t t2) {
+  portENTER_CRITICAL(&cam_stamp_mux);
+  cam_t1 = t1;
+  cam_t2 = t2;
+  portEXIT_CRITICAL(&cam_stamp_mux);
+}
+
+// Answer the camera's last stamp (once) and stamp our TX time
+static void fill_sync_stamp(sync_stamp_t& st) {
+  st.epoch_base_ms = emf_epoch_base_ms();
+  portENTER_CRITICAL(&cam_stamp_mux);
+  st.t1_echo = cam_t1;
+  st.t2 = cam_t2;
+  cam_t1 = 0;
+  portEXIT_CRITICAL(&cam_stamp_mux);
+  st.t3 = time_sync_local_us();
+}
+
+// =================== RENDEZVOUS ===================
+// The camera polls at each of its slots and sleeps in between; triggers are
+// held for the next poll while it keeps to the schedule. Call under rdv_mux
+// with millis() read inside it, so a poll stamped on the other core is never
+// in our future.
+static bool rdv_camera_scheduled(uint32_t now) {
+  return rdv_period_ms && now - rdv_last_poll_ms < rdv_period_ms * RDV_LOST_PERIODS;
+}
+
+// Time to the camera's next slot, from a copy of the schedule taken under
+// rdv_mux (period never 0). The first poll anchors the schedule; one camera
+// per EMF node, so any phase will do.
+static uint32_t rdv_next_slot_ms(uint32_t now, uint32_t anchor, uint32_t period) {
+  const uint32_t into = (now - anchor) % period;
+  uint32_t next = period - into;
+  if (next < period / 2) next += period;   // this poll was early
+  return next;
+}
+
+static void rdv_answer(const uint8_t* mac, const rdv_poll_msg_t& poll) {
+  const uint32_t period = max(RDV_MIN_PERIOD_MS, poll.period_ms);
+  rdv_msg_t m{};
+  m.magic = NOW_MSG_MAGIC;
+  m.type  = NOW_MSG_RDV;
+  m.seq   = poll.seq;
+  m.period_ms = period;
+
+  portENTER_CRITICAL(&rdv_mux);
+  const uint32_t now = millis();
+  const bool joins = !rdv_camera_scheduled(now) || period != rdv_period_ms;
+  if (joins) rdv_anchor_ms = now;
+  rdv_period_ms = period;
+  rdv_last_poll_ms = now;
+  const uint32_t anchor = rdv_anchor_ms;
+  if (rdv_pending) {
+    m.trigger  = 1;
+    m.delta_db = rdv_pending_db;
+    m.held_ms  = now - rdv_pending_ms;
+    rdv_pending = false;
+  }
+  portEXIT_CRITICAL(&rdv_mux);
+  rdv_polls++;
+  if (joins) Serial.printf("RDV: camera joins, slot every %u ms\n", (unsigned)period);
+  if (m.trigger) {
+    rdv_hold_max_ms = max(rdv_hold_max_ms, m.held_ms);
+    Serial.printf("Trigger → CAM in slot: Δ=%.3f dB, held %u ms\n", m.delta_db, (unsigned)m.held_ms);
+  }
+  m.next_slot_ms = rdv_next_slot_ms(millis(), anchor, period);
+  fill_sync_stamp(m.sync);
+  esp_now_send(mac, (const uint8_t*)&m, sizeof(m));
+}
+
+// How long the cores may sleep before the camera's next slot (ULP sampling):
+// awake from ULP_SLOT_GUARD_MS before each slot until its poll is answered
+uint32_t emf_now_sleep_ms() {
+  portENTER_CRITICAL(&rdv_mux);
+  const uint32_t now = millis();
+  const bool scheduled = rdv_camera_scheduled(now);
+  const uint32_t anchor = rdv_anchor_ms, period = rdv_period_ms, last_poll = rdv_last_poll_ms;
+  portEXIT_CRITICAL(&rdv_mux);
+  if (!scheduled) return UINT32_MAX;
+  const uint32_t into = (now - anchor) % period;
+  if (into + ULP_SLOT_GUARD_MS >= period) return 0;
+  if (into < ULP_SLOT_WAIT_MS && now - last_poll > into + ULP_SLOT_GUARD_MS) return 0;
+  return period - ULP_SLOT_GUARD_MS - into;
+}
+
+bool emf_now_trigger_held() {
+  portENTER_CRITICAL(&rdv_mux);
+  const bool held = rdv_pending;
+  portEXIT_CRITICAL(&rdv_mux);
+  return held;
+}
+
+static esp_err_t send_trigger_now(float delta_db, uint32_t ms) {
+  trigger_v2_msg_t msg{};
+  msg.magic    = NOW_MSG_MAGIC;
+  msg.type     = NOW_MSG_TRIGGER_V2;
+  msg.delta_db = delta_db;
+  msg.ms       = ms;
+  fill_sync_stamp(msg.sync);
+  return esp_now_send(CAM_MAC, (uint8_t*)&msg, sizeof(msg));
+}
+
+// A camera that stopped polling gets its held trigger straight away
+void emf_now_poll() {
+  portENTER_CRITICAL(&rdv_mux);
+  const bool take = rdv_pending && !rdv_camera_scheduled(millis());
+  const float db = rdv_pending_db;
+  const uint32_t ms = rdv_pending_ms;
+  if (take) {
+    rdv_pending = false;
+    rdv_period_ms = 0;
+  }
+  portEXIT_CRITICAL(&rdv_mux);
+  if (take) {
+    Serial.println("RDV: camera stopped polling, sending trigger now");
+    send_trigger_now(db, ms);
+  }
+}
+
+// =================== FRAME PARSING ===================
+// Supports both 10B packed and 12B padded status layouts
+bool parse_status_frame(const uint8_t* data, int len, status_msg_t& out) {
+  if (len == 10) { // packed
+    out.version  = data[0];
+    out.occupied = data[1];
+    memcpy(&out.car_conf, data + 2, 4);
+    memcpy(&out.ms,       data + 6, 4);
+    return true;
+  } else if (len == 12) { // padded (2B after u8,u8)
+    out.version  = data[0];
+    out.occupied = data[1];
+    memcpy(&out.car_conf, data + 4, 4);
+    memcpy(&out.ms,       data + 8, 4);
+    return true;
+  }
+  return false;
+}
+
+// =================== ESP-NOW CALLBACKS ===================
+void emf_on_now_sent(const uint8_t* mac, esp_now_send_status_t status) {
+  Serial.printf("ESP-NOW sent: %s\n", status == ESP_NOW_SEND_SUCCESS ? "OK" : "FAIL");
+}
+
+static void handle_typed_frame(const uint8_t* mac, const uint8_t* data, int len, int64_t t2) {
+  if (data[1] == NOW_MSG_SYNC_REQ && len == (int)sizeof(sync_req_msg_t)) {
+    sync_req_msg_t req;
+    memcpy(&req, data, sizeof(req));
+    if (!esp_now_is_peer_exist(mac)) return;
+
+    note_cam_stamp(req.t1, t2);
+    sync_resp_msg_t resp{ NOW_MSG_MAGIC, NOW_MSG_SYNC_RESP, req.seq, {} };
+    fill_sync_stamp(resp.sync);
+    esp_now_send(mac, (const uint8_t*)&resp, sizeof(resp));
+    return;
+  }
+
+  if (data[1] == NOW_MSG_RDV_POLL && len == (int)sizeof(rdv_poll_msg_t)) {
+    rdv_poll_msg_t poll;
+    memcpy(&poll, data, sizeof(poll));
+    if (!esp_now_is_peer_exist(mac)) return;
+    note_cam_stamp(poll.t1, t2);
+    rdv_answer(mac, poll);
+    return;
+  }
+
+  if (data[1] == NOW_MSG_PROBE && len == (int)sizeof(probe_msg_t)) {
+    // Camera looking for our channel: answer on the channel we are on
+    probe_msg_t probe;
+    memcpy(&probe, data, sizeof(probe));
+    if (!esp_now_is_peer_exist(mac)) return;
+    probe_msg_t ack{ NOW_MSG_MAGIC, NOW_MSG_PROBE_ACK, probe.seq, (uint8_t)WiFi.channel() };
+    esp_now_send(mac, (const uint8_t*)&ack, sizeof(ack));
+    return;
+  }
+
+  if (data[1] == NOW_MSG_STATUS_V2 && len == (int)sizeof(status_v2_msg_t)) {
+    status_v2_msg_t st;
+    memcpy(&st, data, sizeof(st));
+    note_cam_stamp(st.t1, t2);
+
+    cam_present = (st.occupied != 0);
+    cam_conf    = st.car_conf;
+    cam_last_change_ms = st.synced ? (uint32_t)(st.event_us / 1000) : st.ms;
+    cam_last_change_epoch_ms = st.synced ? st.epoch_ms : 0;
+    cam_sync_accuracy_us = st.accuracy_us;
+    cam_last_recv_ms   = millis();
+    Serial.printf("CAM STATUS RX: %s (conf=%.2f) at=%ums ±%uus epoch_ms=%lld\n",
+                  cam_present ? "OCCUPIED" : "VACANT", cam_conf, (unsigned)cam_last_change_ms,
+                  (unsigned)st.accuracy_us, (long long)cam_last_change_epoch_ms);
+    return;
+  }
+  if (data[1] == NOW_MSG_HEARTBEAT && len == (int)sizeof(heartbeat_msg_t)) {
+    memt_summary_t mem;
+    memcpy(&mem, data + offsetof(heartbeat_msg_t, mem), sizeof(mem));
+    const uint32_t now = millis();
+    portENTER_CRITICAL(&cam_mem_mux);
+    cam_mem = mem;
+    cam_mem_recv_ms = now;
+    cam_heartbeats++;
+    portEXIT_CRITICAL(&cam_mem_mux);
+    return;
+  }
+  if (data[1] == NOW_MSG_EVIDENCE) {
+    emf_evidence_on_frame(mac, data, len);
+    return;
+  }
+  Serial.printf("ESP-NOW RX unknown type=0x%02X len=%d\n", data[1], len);
+}
+
+void emf_on_now_recv(const uint8_t* mac, const uint8_t* data, int len) {
+  const int64_t t2 = time_sync_local_us();
+  if (len >= 2 && data[0] == NOW_MSG_MAGIC) {
+    handle_typed_frame(mac, data, len, t2);
+    return;
+  }
+
+  status_msg_t st{};
+  if (parse_status_frame(data, len, st)) {
+    cam_present = (st.occupied != 0);
+    cam_conf    = st.car_conf;
+    cam_last_change_ms = st.ms;
+    cam_last_change_epoch_ms = 0;
+    cam_sync_accuracy_us = UINT32_MAX;
+    cam_last_recv_ms   = millis();
+    Serial.printf("CAM STATUS RX: %s (conf=%.2f) sender_ms=%u\n",
+                  cam_present ? "OCCUPIED" : "VACANT", cam_conf, (unsigned)st.ms);
+    return;
+  }
+  Serial.printf("ESP-NOW RX unknown len=%d\n", len);
+}
+
+bool cam_mem_get(memt_summary_t& mem, uint32_t& recv_ms) {
+  portENTER_CRITICAL(&cam_mem_mux);
+  const bool any = cam_heartbeats != 0;
+  mem = cam_mem;
+  recv_ms = cam_mem_recv_ms;
+  portEXIT_CRITICAL(&cam_mem_mux);
+  return any;
+}
+
+// =================== INITIALIZATION ===================
+bool init_emf_now() {
+  if (esp_now_init() != ESP_OK) {
+    Serial.println("ESP-NOW init failed");
+    return false;
+  }
+  esp_now_register_send_cb(emf_on_now_sent);
+  esp_now_register_recv_cb(emf_on_now_recv);   // receive status frames
+
+  esp_now_peer_info_t peer{};
+  memcpy(peer.peer_addr, CAM_MAC, 6);
+  peer.channel = 0;      // follow STA channel
+  peer.encrypt = false;
+  if (esp_now_add_peer(&peer) != ESP_OK) {
+    Serial.println("ESP-NOW add_peer failed");
+    return false;
+  }
+  Serial.println("ESP-NOW ready");
+  return true;
+}
+
+// =================== TRIGGER TRANSMISSION ===================
+bool send_camera_trigger(float delta_db) {
+  uint32_t now = millis();
+  if (now - last_now_ms < NOW_COOLDOWN_MS) return false;
+
+  // Duty-cycled camera: hold it for the next slot
+  portENTER_CRITICAL(&rdv_mux);
+  const bool scheduled = rdv_camera_scheduled(millis());
+  const uint32_t anchor = rdv_anchor_ms, period = rdv_period_ms;
+  if (scheduled && !rdv_pending) {
+    rdv_pending = true;
+    rdv_pending_db = delta_db;
+    rdv_pending_ms = now;
+    rdv_held++;
+  }
+  portEXIT_CRITICAL(&rdv_mux);
+  if (scheduled) {
+    last_now_ms = now;
+    Serial.printf("Trigger held for CAM slot: Δ=%.3f dB (thr=%.3f), next slot in %u ms\n",
+                  delta_db, get_dynamic_threshold(), (unsigned)rdv_next_slot_ms(now, anchor, period));
+    return true;
+  }
+
+  esp_err_t r = send_trigger_now(delta_db, now);
+  if (r == ESP_OK) {
+    last_now_ms = now;
+    Serial.printf("Trigger → CAM: Δ=%.3f dB (thr=%.3f)\n",
+                  delta_db, get_dynamic_threshold());
+    return true;
+  }
+  Serial.printf("Trigger send ERR=%d\n", r);
+  return false;
+}
@@ -0,0 +1,43 @@
+#ifndef EMF_NOW_H
+#define EMF_NOW_H
+
+#include <Arduino.h>
+#include <esp_now.h>
+#include "emf_config.h"
+#include "esp_now_comm.h"  // Shared message formats
+
+// =================== ESP-NOW (EMF SIDE) ===================
+bool init_emf_now();
+bool send_camera_trigger(float delta_db);
+void emf_now_poll();
+void emf_on_now_recv(const uint8_t* mac, const uint8_t* data, int len);
+void emf_on_now_sent(const uint8_t* mac, esp_now_send_status_t status);
+bool parse_status_frame(const uint8_t* data, int len, status_msg_t& out);
+int64_t emf_epoch_base_ms();
+uint32_t emf_now_sleep_ms();
+bool emf_now_trigger_held();    // trigger waiting for the camera's next poll
+
+// =================== GLOBAL VARIABLES ===================
+extern uint8_t CAM_MAC[6];
+
+// Camera status (received via ESP-NOW)
+extern volatile bool cam_present;
+extern volatile float cam_conf;
+extern volatile uint32_t cam_last_change_ms;
+extern volatile uint32_t cam_last_recv_ms;
+extern int64_t  cam_last_change_epoch_ms;   // 0 = camera unsynced or no wall clock
+extern uint32_t cam_sync_accuracy_us;       // UINT32_MAX = camera unsynced
+
+// Camera memory telemetry (heartbeats)
+extern uint32_t cam_heartbeats;             // 0 = none yet
+// Copy of the last heartbeat's summary and our millis when received;
+// false before the first one
+bool cam_mem_get(memt_summary_t& mem, uint32_t& recv_ms);
+
+// Rendezvous with the camera (0 period = camera listens all the time)
+extern uint32_t rdv_period_ms;
+extern uint32_t rdv_polls;                  // camera polls answered
+extern uint32_t rdv_held;                   // triggers held for a slot
+extern uint32_t rdv_hold_max_ms;            // longest a trigger waited
+
+#endif // EMF_NOW_H
@@ -63,15 +63,26 @@ void init_sensor() {
   Serial.println("EMF sensor initialized");
 }
 
-float read_filtered_voltage() {
-  // Oversample for noise reduction
-  const int N = 64;
-  uint32_t acc = 0;
-  for (int i = 0; i < N; ++i) {
-    acc += analogRead(PIN_VOUT);
-    delayMicroseconds(300);
+int read_adc_oversampled() {
+  // Oversample for noise reduction: 64 reads as four 16-read means, rounded
+  // as the ULP program does, so ULP_SAMPLING does not move any decision
+  uint32_t acc4 = 0;
+  for (int g = 0; g < 4; ++g) {
+    uint32_t acc = 0;
+    for (int i = 0; i < 16; ++i) {
+      acc += analogRead(PIN_VOUT);
+      delayMicroseconds(300);
+    }
+    acc4 += acc >> 4;
   }
-  int adc = acc / N;
+  return acc4 >> 2;
+}
+
+float read_filtered_voltage() {
+  return filter_voltage(read_adc_oversampled());
+}
+
+float filter_voltage(int adc) {
   float v = adcToVolts(adc);
 
   // Apply EMA filter to voltage
@@ -81,10 +92,7 @@ float read_filtered_voltage() {
   return v;
 }
 
-float read_dbm_median() {
-  float v = read_filtered_voltage();
-  float dbm_raw = voltsToDbm(v);
-
+static float median_dbm(float dbm_raw) {
   // Apply median filter on dBm
   ring_dbm[ring_i++] = dbm_raw;
   if (ring_i == 5) {
@@ -95,6 +103,15 @@ float read_dbm_median() {
   return ring_full ? median5(ring_dbm) : dbm_raw;
 }
 
+float read_dbm_median() {
+  return median_dbm(voltsToDbm(read_filtered_voltage()));
+}
+
+// Same chain for a sample the ULP took (already oversampled)
+float dbm_median_from_adc(int adc) {
+  return median_dbm(voltsToDbm(filter_voltage(adc)));
+}
+
 void update_signal_processing(float dbm_median) {
   // Fast/slow EMA on median dBm
   if (isnan(dbm_fast)) {
@@ -7,8 +7,11 @@
 
 // =================== SENSOR FUNCTIONS ===================
 void init_sensor();
+int read_adc_oversampled();
 float read_filtered_voltage();
+float filter_voltage(int adc);
 float read_dbm_median();
+float dbm_median_from_adc(int adc);
 void update_signal_processing(float dbm_median);
 float get_dynamic_threshold();
 bool check_trigger_condition();
@@ -0,0 +1,221 @@
+#include "emf_ulp.h"
+#include "emf_sensor.h"
+#include <esp32/ulp.h>
+#include <driver/adc.h>
+#include <esp_sleep.h>
+
+// =================== GLOBAL VARIABLES ===================
+float    ulp_wake_db     = ULP_WAKE_DB;
+uint32_t ulp_rise_wakes  = 0;
+uint32_t ulp_batch_wakes = 0;
+uint32_t ulp_timer_wakes = 0;
+uint32_t ulp_rise_ms     = 0;
+
+static uint32_t ulp_thr_counts = 1;      // ulp_wake_db in ADC counts x4
+
+static_assert(ULP_BATCH > 0 && ULP_BATCH < ULP_RING, "ULP_BATCH must fit the ring");
+static_assert((ULP_RING & (ULP_RING - 1)) == 0, "ULP_RING must be a power of two");
+
+// =================== ULP PROGRAM ===================
+// Runs every PERIOD_MS: 64 ADC reads (in groups of 16, so sums fit 16 bits),
+// the mean into the ring, fast/slow averages, then I_WAKE when exactly
+// ULP_BATCH samples wait or, while armed, when |fast - slow| reaches the
+// threshold. Flags are tested right after the ALU op that set them.
+enum {
+  L_GROUP, L_SLOW_DOWN, L_UP_CARRY, L_UP_STORE, L_DOWN_BORROW, L_DOWN_STORE,
+  L_DELTA, L_DELTA_NEG, L_DELTA_STORE, L_RISE, L_DONE,
+};
+
+#define ULP_READ    I_ADC(R0, 0, ULP_ADC_CHANNEL), I_ADDR(R2, R2, R0)
+#define ULP_READ4   ULP_READ, ULP_READ, ULP_READ, ULP_READ
+#define ULP_READ16  ULP_READ4, ULP_READ4, ULP_READ4, ULP_READ4
+
+static const ulp_insn_t ulp_program[] = {
+  // R3 = sum of four 16-read means = ADC counts x4
+  I_MOVI(R3, 0),
+  I_MOVI(R1, 4),
+  M_LABEL(L_GROUP),
+  I_MOVI(R2, 0),
+  ULP_READ16,
+  I_RSHI(R2, R2, 4),
+  I_ADDR(R3, R3, R2),
+  I_SUBI(R1, R1, 1),
+  I_MOVR(R0, R1),
+  M_BGE(L_GROUP, 1),
+
+  // Ring: ADC code at head, head + 1
+  I_MOVI(R1, ULP_DATA_ADDR),
+  I_LD(R2, R1, ULP_V_HEAD),
+  I_ADDR(R2, R2, R1),
+  I_RSHI(R0, R3, 2),
+  I_ST(R0, R2, ULP_V_RING),
+  I_LD(R2, R1, ULP_V_HEAD),
+  I_ADDI(R2, R2, 1),
+  I_ANDI(R2, R2, ULP_RING - 1),
+  I_ST(R2, R1, ULP_V_HEAD),
+
+  // Fast average: (fast + x) / 2
+  I_LD(R2, R1, ULP_V_FAST),
+  I_ADDR(R2, R2, R3),
+  I_RSHI(R2, R2, 1),
+  I_ST(R2, R1, ULP_V_FAST),
+
+  // Slow average in 32 bits: slow += (x - slow) >> ULP_SLOW_SHIFT, the step
+  // split into R0 (whole) and R3 (fraction); carry / borrow into the high word
+  I_LD(R2, R1, ULP_V_SLOW_HI),
+  I_SUBR(R0, R3, R2),
+  M_BXF(L_SLOW_DOWN),
+  I_LSHI(R3, R0, 16 - ULP_SLOW_SHIFT),
+  I_RSHI(R0, R0, ULP_SLOW_SHIFT),
+  I_LD(R2, R1, ULP_V_SLOW_LO),
+  I_ADDR(R2, R2, R3),
+  M_BXF(L_UP_CARRY),
+  M_BX(L_UP_STORE),
+  M_LABEL(L_UP_CARRY),
+  I_ADDI(R0, R0, 1),
+  M_LABEL(L_UP_STORE),
+  I_ST(R2, R1, ULP_V_SLOW_LO),
+  I_LD(R2, R1, ULP_V_SLOW_HI),
+  I_ADDR(R2, R2, R0),
+  I_ST(R2, R1, ULP_V_SLOW_HI),
+  M_BX(L_DELTA),
+
+  M_LABEL(L_SLOW_DOWN),
+  I_SUBR(R0, R2, R3),
+  I_LSHI(R3, R0, 16 - ULP_SLOW_SHIFT),
+  I_RSHI(R0, R0, ULP_SLOW_SHIFT),
+  I_LD(R2, R1, ULP_V_SLOW_LO),
+  I_SUBR(R2, R2, R3),
+  M_BXF(L_DOWN_BORROW),
+  M_BX(L_DOWN_STORE),
+  M_LABEL(L_DOWN_BORROW),
+  I_ADDI(R0, R0, 1),
+  M_LABEL(L_DOWN_STORE),
+  I_ST(R2, R1, ULP_V_SLOW_LO),
+  I_LD(R2, R1, ULP_V_SLOW_HI),
+  I_SUBR(R2, R2, R0),
+  I_ST(R2, R1, ULP_V_SLOW_HI),
+
+  // delta = |fast - slow|
+  M_LABEL(L_DELTA),
+  I_LD(R2, R1, ULP_V_FAST),
+  I_LD(R3, R1, ULP_V_SLOW_HI),
+  I_SUBR(R0, R2, R3),
+  M_BXF(L_DELTA_NEG),
+  M_BX(L_DELTA_STORE),
+  M_LABEL(L_DELTA_NEG),
+  I_SUBR(R0, R3, R2),
+  M_LABEL(L_DELTA_STORE),
+  I_ST(R0, R1, ULP_V_DELTA),
+
+  // Batch due: exactly ULP_BATCH samples waiting (the cores drain while awake)
+  I_LD(R0, R1, ULP_V_HEAD),
+  I_LD(R2, R1, ULP_V_TAIL),
+  I_SUBR(R0, R0, R2),
+  I_ANDI(R0, R0, ULP_RING - 1),
+  M_BL(L_RISE, ULP_BATCH),
+  M_BGE(L_RISE, ULP_BATCH + 1),
+  I_WAKE(),
+  I_HALT(),
+
+  // Rise while armed: disarm and wake
+  M_LABEL(L_RISE),
+  I_LD(R0, R1, ULP_V_ARMED),
+  M_BL(L_DONE, 1),
+  I_LD(R0, R1, ULP_V_DELTA),
+  I_LD(R2, R1, ULP_V_THR),
+  I_SUBR(R0, R0, R2),
+  M_BXF(L_DONE),
+  I_MOVI(R0, 0),
+  I_ST(R0, R1, ULP_V_ARMED),
+  I_WAKE(),
+  M_LABEL(L_DONE),
+  I_HALT(),
+};
+
+// =================== SHARED MEMORY ===================
+uint16_t ulp_var(int v) {
+  return RTC_SLOW_MEM[ULP_DATA_ADDR + v] & 0xFFFF;
+}
+
+static void ulp_set(int v, uint16_t x) {
+  RTC_SLOW_MEM[ULP_DATA_ADDR + v] = x;
+}
+
+// =================== SAMPLING ===================
+bool init_ulp_sampling() {
+  // Start both averages on a reading taken before the ULP owns ADC1
+  const int adc = read_adc_oversampled();
+  for (int v = 0; v < ULP_V_RING + ULP_RING; v++) ulp_set(v, 0);
+  ulp_set(ULP_V_FAST, adc * 4);
+  ulp_set(ULP_V_SLOW_HI, adc * 4);
+  const float counts_per_db = fabsf(slope_V_per_dB) / VREF * ADC_MAX;
+  ulp_thr_counts = (uint32_t)max(1.0f, ulp_wake_db * counts_per_db * 4 + 0.5f);
+  ulp_set(ULP_V_THR, ulp_thr_counts);
+
+  adc1_config_width(ADC_WIDTH_BIT_12);
+  adc1_config_channel_atten((adc1_channel_t)ULP_ADC_CHANNEL, ADC_ATTEN_DB_11);
+  adc1_ulp_enable();
+
+  size_t size = sizeof(ulp_program) / sizeof(ulp_insn_t);
+  if (ulp_process_macros_and_load(0, ulp_program, &size) != ESP_OK || size > ULP_DATA_ADDR) {
+    Serial.println("ULP program load failed");
+    return false;
+  }
+  if (ulp_set_wakeup_period(0, PERIOD_MS * 1000) != ESP_OK || ulp_run(0) != ESP_OK) {
+    Serial.println("ULP start failed");
+    return false;
+  }
+  Serial.printf("ULP sampling: %u words, wake at %.2f dB (%u counts x4), batch %d\n",
+                (unsigned)size, ulp_wake_db, (unsigned)ulp_thr_counts, ULP_BATCH);
+  return true;
+}
+
+uint32_t ulp_pending() {
+  return (ulp_var(ULP_V_HEAD) - ulp_var(ULP_V_TAIL)) & (ULP_RING - 1);
+}
+
+bool ulp_take_sample(int* adc) {
+  const uint16_t tail = ulp_var(ULP_V_TAIL);
+  if (tail == ulp_var(ULP_V_HEAD)) return false;
+  *adc = ulp_var(ULP_V_RING + tail);
+  ulp_set(ULP_V_TAIL, (tail + 1) & (ULP_RING - 1));
+  return true;
+}
+
+// =================== SLEEP ===================
+bool ulp_stay_awake() {
+  const uint32_t now = millis();
+  return on_streak > 0 || delta_db >= ulp_wake_db ||
+         (ulp_rise_ms && now - ulp_rise_ms < ULP_AWAKE_MS) ||
+         (last_now_ms && now - last_now_ms < ULP_AWAKE_MS);
+}
+
+void ulp_arm() {
+  // Wake on a rise of ulp_wake_db over the delta at sleep: while the baseline
+  // settles after a departure the delta hovers near the plain threshold
+  ulp_set(ULP_V_THR, min(0xFFFFu, ulp_thr_counts + ulp_var(ULP_V_DELTA)));
+  ulp_set(ULP_V_ARMED, 1);
+}
+
+void ulp_woke() {
+  if (!ulp_var(ULP_V_ARMED)) {
+    ulp_rise_wakes++;
+    ulp_rise_ms = millis();
+  } else if (ulp_pending() >= (uint32_t)ULP_BATCH) {
+    ulp_batch_wakes++;
+  } else {
+    ulp_timer_wakes++;
+  }
+  ulp_set(ULP_V_ARMED, 0);
+}
+
+void ulp_light_sleep(uint32_t max_ms) {
+  ulp_arm();
+  esp_sleep_enable_ulp_wakeup();
+  if (max_ms != UINT32_MAX) esp_sleep_enable_timer_wakeup((uint64_t)max_ms * 1000);
+  // A rise the ULP flagged since arming would not wake us again
+  if (ulp_var(ULP_V_ARMED)) esp_light_sleep_start();
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  ulp_woke();
+}
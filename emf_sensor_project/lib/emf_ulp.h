@@ -0,0 +1,41 @@
+#ifndef EMF_ULP_H
+#define EMF_ULP_H
+
+#include <Arduino.h>
+#include "emf_config.h"
+
+// =================== ULP SAMPLING ===================
+// RTC slow memory shared with the ULP program: code from word 0, data words
+// from ULP_DATA_ADDR. The ULP only uses the low 16 bits of a word.
+constexpr uint32_t ULP_DATA_ADDR  = 256;
+constexpr int      ULP_RING       = 64;   // samples; power of two
+constexpr int      ULP_SLOW_SHIFT = 8;    // slow average alpha 1/256 (A_SLOW 0.005)
+
+enum {
+  ULP_V_FAST,      // fast average, ADC counts x4 (alpha 1/2 = A_FAST)
+  ULP_V_SLOW_HI,   // slow average, ADC counts x4 ...
+  ULP_V_SLOW_LO,   // ... and its fraction in 1/65536
+  ULP_V_DELTA,     // |fast - slow| after the last sample
+  ULP_V_THR,       // delta that wakes the cores (set by ulp_arm())
+  ULP_V_ARMED,     // 1 = wake on a rise; the ULP clears it when it does
+  ULP_V_HEAD,      // ring slot the ULP writes next
+  ULP_V_TAIL,      // ring slot the cores read next
+  ULP_V_RING,      // ULP_RING oversampled ADC codes
+};
+
+bool init_ulp_sampling();
+uint32_t ulp_pending();                  // samples the cores have not taken yet
+bool ulp_take_sample(int* adc);          // oldest of them
+bool ulp_stay_awake();                   // RF activity or a trigger needs the cores
+void ulp_light_sleep(uint32_t max_ms);   // until the ULP wakes the cores or max_ms
+void ulp_arm();                          // before sleeping: wake on a rise
+void ulp_woke();                         // after waking: disarm, count the cause
+uint16_t ulp_var(int v);
+
+extern float    ulp_wake_db;             // ULP_WAKE_DB, read by init_ulp_sampling()
+extern uint32_t ulp_rise_wakes;
+extern uint32_t ulp_batch_wakes;
+extern uint32_t ulp_timer_wakes;
+extern uint32_t ulp_rise_ms;             // last wake on a rise
+
+#endif // EMF_ULP_H
@@ -0,0 +1,380 @@
+#include "emf_web.h"
+#include "emf_sensor.h"
+#include "emf_now.h"
+#include "emf_evidence.h"
+#include "mem_telemetry.h"
+#include <uri/UriBraces.h>
+#include <sys/time.h>
+#include <memory>
+
+// =================== GLOBAL VARIABLES ===================
+WebServer server(80);
+File logFile;
+uint32_t lineCounter = 0;
+String pendingNote = "";
+volatile uint32_t lastHttpMs = 0;
+
+// Time management
+uint32_t bootMs = 0;
+bool timeOK = false;
+uint32_t epochBase = 0;
+
+// Live JSON snapshot variables
+int      g_adc      = 0;
+float    g_v        = 0.0f;
+float    g_dbm      = 0.0f;   // median dBm
+float    g_emaDbm   = 0.0f;   // from emaV
+String   g_iso      = "";
+uint32_t g_epoch    = 0;
+uint32_t g_uptimeMs = 0;
+float    g_dyn_thr  = 0.0f;
+float    g_mad_est  = 0.0f;
+
+// =================== WEB PAGE ===================
+const char HTML_PAGE[] PROGMEM = R"HTML(
+<!doctype html><html><head><meta charset="utf-8">
+<meta name="viewport" content="width=device-width,initial-scale=1">
+<title>AD8317 Logger</title>
+<style>
+body{font-family:system-ui,Segoe UI,Roboto,Arial,sans-serif;margin:1rem;line-height:1.4}
+.card{border:1px solid #ddd;border-radius:12px;padding:1rem;margin-bottom:1rem;box-shadow:0 1px 3px rgba(0,0,0,.05)}
+h1{font-size:1.25rem;margin:0 0 .5rem}table{border-collapse:collapse;width:100%}
+td{padding:.25rem .4rem;border-bottom:1px solid #eee}
+.input{padding:.4rem .5rem;border:1px solid #ccc;border-radius:8px}
+.btn{padding:.4rem .8rem;border:1px solid #888;border-radius:10px;background:#f7f7f7;cursor:pointer}
+.row{display:flex;gap:.6rem;align-items:center;flex-wrap:wrap}
+.mono{font-family:ui-monospace,Menlo,Consolas,monospace}.small{font-size:.9rem;color:#555}
+.badge{display:inline-block;padding:.1rem .5rem;border-radius:999px;border:1px solid #aaa}
+.ok{background:#e6f6e6;border-color:#6c6}.err{background:#ffecec;border-color:#c66}
+</style></head><body>
+<div class="card"><h1>AD8317 Logger</h1>
+<div class="small">Time source: <span id="timeOK"></span></div></div>
+
+<div class="card"><h1>Live Sample</h1><table class="mono"><tbody id="live"></tbody></table>
+<div class="row"><a class="btn" href="/trigger">Send test trigger</a></div></div>
+
+<div class="card"><h1>Camera Status</h1>
+<table class="mono"><tbody id="cam"></tbody></table>
+<div class="small">Latest status received via ESP-NOW from ESP32-CAM.</div>
+<img id="evidence" alt="no evidence yet" width="192" height="192"
+ style="image-rendering:pixelated;border:1px solid #ddd;border-radius:8px;margin-top:.5rem">
+</div>
+
+<div class="card"><h1>Actions</h1><div class="row">
+<form action="/addnote" method="get" class="row">
+<label for="note">Add note:</label>
+<input class="input" id="note" name="note" placeholder="car passed">
+<button class="btn" type="submit">Add</button></form>
+<a class="btn" href="/tail?lines=200">View last 200</a>
+<a class="btn" href="/download">Download CSV</a>
+<a class="btn" href="/clear" onclick="return confirm('Clear CSV?')">Clear CSV</a>
+</div></div>
+
+<script>
+function fmtAge(ms){ if(ms<0) ms=0; const s=Math.floor(ms/1000); return s+'s'; }
+async function refresh(){
+  try{
+    const r=await fetch('/json'); const j=await r.json();
+    document.getElementById('timeOK').textContent=j.time_ok?'NTP (OK)':'Uptime (no NTP)';
+    const rows=[
+      ['iso_time',j.iso_time],['epoch_sec',j.epoch_sec],['uptime_ms',j.uptime_ms],
+      ['adc_code',j.adc_code],['vout_volts',Number(j.vout_volts).toFixed(4)],
+      ['dbm_med',Number(j.dbm_med).toFixed(2)],['dbm_ema',Number(j.dbm_ema).toFixed(2)],
+      ['minute_min_dbm',Number(j.minute_min_dbm).toFixed(2)],['minute_max_dbm',Number(j.minute_max_dbm).toFixed(2)],
+      ['minute_avg_dbm',Number(j.minute_avg_dbm).toFixed(2)],['delta_db',Number(j.delta_db).toFixed(3)],
+      ['dyn_thr',Number(j.dyn_thr).toFixed(3)],['mad_est',Number(j.mad_est).toFixed(3)],
+      ['trigger_ready',j.trigger_ready]
+    ];
+    let t=''; for(const [k,v] of rows){ t+=`<tr><td>${k}</td><td>${v}</td></tr>`; }
+    document.getElementById('live').innerHTML=t;
+
+    const badge = j.cam_present ? '<span class="badge ok">OCCUPIED</span>' :
+                                  '<span class="badge err">VACANT</span>';
+    const camRows = [
+      ['present', badge],
+      ['confidence', Number(j.cam_conf).toFixed(2)],
+      ['age_since_rx', fmtAge(j.cam_age_ms)],
+      ['changed_at_ms', j.cam_sender_ms],
+      ['changed_at_epoch_ms', j.cam_change_epoch_ms],
+      ['sync_accuracy_us', j.cam_sync_acc_us],
+      ['evidence_bytes', j.ev_bytes]
+    ];
+    let c=''; for(const [k,v] of camRows){ c+=`<tr><td>${k}</td><td>${v}</td></tr>`; }
+    document.getElementById('cam').innerHTML=c;
+    if (j.ev_bytes > 0 && j.ev_age_ms < 1500) document.getElementById('evidence').src='/evidence/0.jpg?t='+Date.now();
+  }catch(e){}
+}
+setInterval(refresh,1000); refresh();
+</script></body></html>
+)HTML";
+
+// =================== UTILITY FUNCTIONS ===================
+// Every handler starts here; handle_web_clients() closes the web memory scope
+void touchHttp() {
+  lastHttpMs = millis();
+  memt_scope_begin(MEMT_WEB);
+}
+
+// =================== TIME FUNCTIONS ===================
+void setup_time_sync() {
+  if (WiFi.status() == WL_CONNECTED) {
+    configTime(0, 0, "pool.ntp.org");    // UTC
+  }
+  bootMs = millis();
+}
+
+String isoTimeNow(uint32_t* epochOut) {
+  struct tm tminfo;
+  if (getLocalTime(&tminfo, 10)) {
+    timeOK = true;
+    time_t now = mktime(&tminfo);
+    if (epochOut) *epochOut = (uint32_t)now;
+    char buf[32];
+    strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tminfo);
+    return String(buf);
+  }
+  timeOK = false;
+  uint32_t sec = (epochBase == 0) ? 0 : (epochBase + (millis() - bootMs) / 1000);
+  if (epochOut) *epochOut = sec;
+  if (sec == 0) return String("1970-01-01T00:00:00+") + String(millis());
+  time_t tt = (time_t)sec;
+  struct tm* g = gmtime(&tt);
+  if (!g) return String("1970-01-01T00:00:00+") + String(millis());
+  char buf[32];
+  strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", g);
+  return String(buf);
+}
+
+// Wall clock of a sample taken age_ms ago (ULP batches)
+String isoTimeAgo(uint32_t age_ms, uint32_t* epochOut) {
+  uint32_t epoch;
+  String iso = isoTimeNow(&epoch);
+  if (age_ms == 0 || epoch == 0) {
+    if (epochOut) *epochOut = epoch;
+    return iso;
+  }
+  time_t tt = (time_t)(epoch - age_ms / 1000);
+  if (epochOut) *epochOut = (uint32_t)tt;
+  struct tm* g = gmtime(&tt);
+  if (!g) return iso;
+  char buf[32];
+  strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", g);
+  return String(buf);
+}
+
+// =================== LOGGING FUNCTIONS ===================
+void init_logging() {
+  if (!SPIFFS.begin(true)) Serial.println("SPIFFS mount failed.");
+  logFile = SPIFFS.open(CSV_PATH, FILE_APPEND);
+  if (logFile) writeHeaderIfEmpty(logFile);
+}
+
+void writeHeaderIfEmpty(File& f) {
+  if (!f) return;
+  if (f.size() == 0) {
+    f.println(F("iso_time,epoch_sec,uptime_ms,adc_code,vout_volts,dbm_med,dbm_ema,minute_min_dbm,minute_max_dbm,minute_avg_dbm,delta_db,dyn_thr,mad_est,trigger_ready,note"));
+    f.flush();
+  }
+}
+
+void writeCSVLine(const String& iso, uint32_t epoch, uint32_t uptimeMs, int adc,
+                  float v, float dbm_med, float emaDbm,
+                  float minDbm, float maxDbm, float avgDbm,
+                  float delta_db, float dyn_thr, float mad_est,
+                  const String& note, bool trigger_ready) {
+  memt_scope_begin(MEMT_LOG);
+  static char line[420];
+  snprintf(line, sizeof(line),
+           "%s,%u,%lu,%d,%.4f,%.2f,%.2f,%.2f,%.2f,%.2f,%.3f,%.3f,%.3f,%d,%s",
+           iso.c_str(), epoch, (unsigned long)uptimeMs, adc, v, dbm_med, emaDbm,
+           minDbm, maxDbm, avgDbm, delta_db, dyn_thr, mad_est,
+           trigger_ready ? 1 : 0, note.c_str());
+  if (logFile) {
+    logFile.println(line);
+    if ((++lineCounter % 10) == 0) logFile.flush();
+  }
+  Serial.println(line);
+  memt_scope_end(MEMT_LOG);
+}
+
+String tailFile(const char* path, size_t lines) {
+  File f = SPIFFS.open(path, FILE_READ);
+  if (!f) return String("ERROR: cannot open file\n");
+  size_t fsize = f.size();
+  if (fsize == 0) { f.close(); return String(""); }
+  const size_t CHUNK = 512;
+  long pos = (long)fsize;
+  size_t found = 0;
+  String out = "";
+  while (pos > 0 && found <= lines) {
+    size_t toRead = (pos >= (long)CHUNK) ? CHUNK : pos;
+    pos -= toRead;
+    f.seek(pos, SeekSet);
+    std::unique_ptr<char[]> buf(new char[toRead + 1]);
+    f.readBytes(buf.get(), toRead);
+    buf[toRead] = '\0';
+    for (int i = (int)toRead - 1; i >= 0; --i) {
+      if (buf[i] == '\n') { found++; if (found > lines) { pos += i + 1; goto done; } }
+    }
+  }
+done:
+  f.seek(pos, SeekSet);
+  while (f.available()) out += (char)f.read();
+  f.close();
+  return out;
+}
+
+// =================== HTTP HANDLERS ===================
+static void handleRoot() { touchHttp(); server.send_P(200, "text/html", HTML_PAGE); }
+
+static void handleDownload() {
+  touchHttp();
+  if (logFile) logFile.flush();
+  File f = SPIFFS.open(CSV_PATH, FILE_READ);
+  if (!f) { server.send(404, "text/plain", "No log file"); return; }
+  server.streamFile(f, "text/csv");
+  f.close();
+}
+
+static void handleTail() {
+  touchHttp();
+  size_t lines = 200;
+  if (server.hasArg("lines")) { lines = (size_t)server.arg("lines").toInt(); if (!lines) lines = 200; }
+  if (logFile) logFile.flush();
+  String tail = tailFile(CSV_PATH, lines);
+  memt_scope_mark(MEMT_WEB);
+  server.send(200, "text/plain", tail);
+}
+
+static void handleAddNote() {
+  touchHttp();
+  if (!server.hasArg("note")) { server.send(400, "text/plain", "Missing ?note=..."); return; }
+  pendingNote = server.arg("note");
+  server.sendHeader("Location", "/");
+  server.send(303);
+}
+
+static void handleClear() {
+  touchHttp();
+  if (logFile) { logFile.close(); }
+  SPIFFS.remove(CSV_PATH);
+  logFile = SPIFFS.open(CSV_PATH, FILE_APPEND);
+  if (logFile) writeHeaderIfEmpty(logFile);
+  server.sendHeader("Location", "/");
+  server.send(303);
+}
+
+// Manual wall clock (no NTP): also sets the system clock so ESP-NOW time
+// sync can hand epoch time to the camera
+static void handleEpoch() {
+  touchHttp();
+  if (!server.hasArg("sec")) { server.send(400, "text/plain", "Missing ?sec=<unix_epoch>"); return; }
+  uint32_t sec = (uint32_t)server.arg("sec").toInt();
+  if (sec < 100000000U) { server.send(400, "text/plain", "Bad epoch"); return; }
+  epochBase = sec - (millis() - bootMs) / 1000;
+  struct timeval tv = { (time_t)sec, 0 };
+  settimeofday(&tv, nullptr);
+  server.send(200, "text/plain", "OK");
+}
+
+static void handleTrigger() {
+  touchHttp();
+  bool ok = send_camera_trigger(delta_db);
+  server.send(200, "text/plain", ok ? "Trigger sent\n" : "Trigger blocked/failed\n");
+}
+
+// /evidence/<bay>.jpg - last thumbnail received from the camera
+static void handleEvidence() {
+  touchHttp();
+  String name = server.pathArg(0);
+  if (!name.endsWith(".jpg")) { server.send(404, "text/plain", "Not found"); return; }
+  int bay = name.substring(0, name.length() - 4).toInt();
+
+  const uint8_t* jpg;
+  size_t len;
+  if (!emf_evidence_get(bay, &jpg, &len, nullptr)) {
+    server.send(404, "text/plain", "No evidence for this bay");
+    return;
+  }
+  server.sendHeader("Cache-Control", "no-store");
+  server.send_P(200, "image/jpeg", (const char*)jpg, len);
+}
+
+static void handleJson() {
+  touchHttp();
+  double mAvg = (minuteCount ? minuteSumDbm / minuteCount : NAN);
+  uint32_t age_ms = (cam_last_recv_ms == 0) ? 0 : (millis() - cam_last_recv_ms);
+  const uint8_t* jpg = nullptr;
+  size_t ev_len = 0;
+  uint32_t ev_age = 0;
+  emf_evidence_get(0, &jpg, &ev_len, &ev_age);
+
+  static char buf[2560];   // room for both memory summaries
+  int n = snprintf(buf, sizeof(buf),
+    "{\"iso_time\":\"%s\",\"epoch_sec\":%u,\"uptime_ms\":%lu,"
+    "\"adc_code\":%d,\"vout_volts\":%.6f,\"dbm_med\":%.3f,"
+    "\"dbm_ema\":%.3f,\"minute_min_dbm\":%.3f,\"minute_max_dbm\":%.3f,"
+    "\"minute_avg_dbm\":%.3f,\"delta_db\":%.3f,\"dyn_thr\":%.3f,\"mad_est\":%.3f,"
+    "\"trigger_ready\":%s,\"time_ok\":%s,"
+    "\"cam_present\":%s,\"cam_conf\":%.3f,\"cam_age_ms\":%u,\"cam_sender_ms\":%u,"
+    "\"cam_change_epoch_ms\":%lld,\"cam_sync_acc_us\":%u,"
+    "\"ev_bytes\":%u,\"ev_age_ms\":%u,\"ev_images\":%u,\"ev_dropped\":%u,",
+    g_iso.c_str(), g_epoch, (unsigned long)g_uptimeMs,
+    g_adc, g_v, g_dbm, g_emaDbm, minuteMinDbm, minuteMaxDbm,
+    (float)mAvg, delta_db, g_dyn_thr, g_mad_est,
+    (on_streak >= N_ON) ? "true" : "false",
+    timeOK ? "true" : "false",
+    cam_present ? "true" : "false", cam_conf, age_ms, cam_last_change_ms,
+    (long long)cam_last_change_epoch_ms, (unsigned)cam_sync_accuracy_us,
+    (unsigned)ev_len, (unsigned)ev_age, (unsigned)evidence_images, (unsigned)evidence_dropped);
+
+  // Memory telemetry: ours, and the camera's last heartbeat (null before one)
+  memt_summary_t mem;
+  memt_fill(mem);
+  n += snprintf(buf + n, sizeof(buf) - n, "\"mem\":");
+  n += memt_json(mem, buf + n, sizeof(buf) - n);
+  memt_summary_t cam_mem;
+  uint32_t cam_mem_recv_ms;
+  if (cam_mem_get(cam_mem, cam_mem_recv_ms)) {
+    n += snprintf(buf + n, sizeof(buf) - n, ",\"cam_mem_age_ms\":%u,\"cam_mem\":",
+                  (unsigned)(millis() - cam_mem_recv_ms));
+    n += memt_json(cam_mem, buf + n, sizeof(buf) - n);
+  } else {
+    n += snprintf(buf + n, sizeof(buf) - n, ",\"cam_mem_age_ms\":null,\"cam_mem\":null");
+  }
+  snprintf(buf + n, sizeof(buf) - n, "}");
+  memt_scope_mark(MEMT_WEB);
+  server.send(200, "application/json", buf);
+}
+
+// =================== WEB SERVER FUNCTIONS ===================
+void init_web_server() {
+  server.on("/",        HTTP_GET, handleRoot);
+  server.on("/download",HTTP_GET, handleDownload);
+  server.on("/tail",    HTTP_GET, handleTail);
+  server.on("/addnote", HTTP_GET, handleAddNote);
+  server.on("/clear",   HTTP_GET, handleClear);
+  server.on("/epoch",   HTTP_GET, handleEpoch);
+  server.on("/trigger", HTTP_GET, handleTrigger);
+  server.on("/json",    HTTP_GET, handleJson);
+  server.on(UriBraces("/evidence/{}"), HTTP_GET, handleEvidence);
+  server.begin();
+}
+
+void handle_web_clients() {
+  server.handleClient();
+  memt_scope_end(MEMT_WEB);
+}
+
+void update_json_snapshot(int adc, float v, float dbm_med, float emaDbm,
+                          const String& iso, uint32_t epoch, uint32_t uptimeMs) {
+  g_adc = adc;
+  g_v = v;
+  g_dbm = dbm_med;
+  g_emaDbm = emaDbm;
+  g_iso = iso;
+  g_epoch = epoch;
+  g_uptimeMs = uptimeMs;
+  g_dyn_thr = get_dynamic_threshold();
+  g_mad_est = mad_est;
+}
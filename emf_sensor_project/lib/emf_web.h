@@ -24,6 +24,7 @@ String tailFile(const char* path, size_t lines);
 
 // =================== TIME FUNCTIONS ===================
 String isoTimeNow(uint32_t* epochOut = nullptr);
+String isoTimeAgo(uint32_t age_ms, uint32_t* epochOut = nullptr);
 void setup_time_sync();
 
 // =================== GLOBAL VARIABLES ===================
@@ -49,12 +50,6 @@ extern uint32_t g_uptimeMs;
 extern float g_dyn_thr;
 extern float g_mad_est;
 
-// Camera status (received via ESP-NOW)
-extern volatile bool cam_present;
-extern volatile float cam_conf;
-extern volatile uint32_t cam_last_change_ms;
-extern volatile uint32_t cam_last_recv_ms;
-
 // =================== UTILITY FUNCTIONS ===================
 void touchHttp();
 
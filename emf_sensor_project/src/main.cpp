@@ -7,6 +7,13 @@
  * 2. Triggers ESP32-CAM via ESP-NOW when RF activity detected
  * 3. Receives car detection status from ESP32-CAM
  * 4. Provides web interface for monitoring
+ *
+ * With ULP_SAMPLING the ULP co-processor takes the RF samples and the cores
+ * light-sleep until it sees a rise, has a batch ready or the camera's slot
+ * is due; the samples then go through the same processing in order.
+ *
+ * Heap / stack low-water marks and the heap the web server and the CSV log
+ * hold are on /json, next to the camera's from its heartbeats.
  */
 
 #include <Arduino.h>
@@ -22,15 +29,21 @@
 #include "emf_config.h"
 #include "emf_sensor.h"
 #include "emf_web.h"
-#include "esp_now_comm.h"  // Shared library
+#include "emf_now.h"       // ESP-NOW trigger TX + status RX
+#include "emf_evidence.h"  // Camera evidence thumbnails
+#include "emf_ulp.h"       // ULP co-processor sampling
+#include "mem_telemetry.h" // Heap / stack telemetry (shared library)
 
 // =================== FUNCTION DECLARATIONS =================
 void setup_wifi();
 void print_connection_info();
-void send_camera_trigger(float delta_db);
 void print_debug_status();
 void manage_power_modes();
-void handle_minute_summary(uint32_t epochNow, uint32_t uptimeMs, float dbm_median);
+void process_sample(float dbm_median, int adc, float v, uint32_t age_ms);
+bool emf_may_sleep();
+void handle_minute_summary();
+
+static bool use_ulp = false;
 
 // =================== MAIN SYSTEM LOGIC ===================
 void setup() {
@@ -39,6 +52,8 @@ void setup() {
   delay(100);
   Serial.println("\nEMF RF Sensor + ESP32-CAM System (PlatformIO VERSION)");
 
+  init_mem_telemetry();
+
   // Initialize sensor
   init_sensor();
 
@@ -52,13 +67,19 @@ void setup() {
   setup_time_sync();
 
   // Initialize ESP-NOW for camera communication
-  if (!init_now_rx_tx()) {
+  if (!init_emf_now()) {
     Serial.println("ESP-NOW unavailable; continuing without camera communication");
   }
 
   // Initialize web server
   init_web_server();
 
+  // Battery mode: hand RF sampling to the ULP
+  if (ULP_SAMPLING) {
+    use_ulp = init_ulp_sampling();
+    if (!use_ulp) Serial.println("ULP unavailable; sampling on the main CPU");
+  }
+
   Serial.println("EMF system ready!");
   print_connection_info();
 }
@@ -67,7 +88,49 @@ void loop() {
   uint32_t t0 = millis();
 
   // Read and process RF sensor data
-  float dbm_median = read_dbm_median();
+  if (use_ulp) {
+    // Samples the ULP took since the last pass, oldest first
+    int adc;
+    for (uint32_t n = ulp_pending(); n && ulp_take_sample(&adc); n--) {
+      process_sample(dbm_median_from_adc(adc), adc, adcToVolts(adc), (n - 1) * PERIOD_MS);
+    }
+  } else {
+    process_sample(read_dbm_median(), g_adc, g_v, 0);
+  }
+
+  // Debug output every 5 seconds
+  print_debug_status();
+
+  // Handle power management based on web activity
+  manage_power_modes();
+  memt_poll();
+
+  // Every pass, so a held trigger or image is dealt with before the cores sleep
+  emf_evidence_poll();
+  emf_now_poll();
+
+  if (use_ulp && emf_may_sleep()) {
+    ulp_light_sleep(emf_now_sleep_ms());
+  } else {
+    // Handle web clients until next sample period
+    uint32_t targetEnd = t0 + PERIOD_MS;
+    while ((int32_t)(millis() - targetEnd) < 0) {
+      handle_web_clients();
+      emf_evidence_poll();
+      emf_now_poll();
+      if (use_ulp && emf_may_sleep()) break;
+      delay(1);
+    }
+  }
+
+  // Handle minute summary logging
+  handle_minute_summary();
+}
+
+// =================== HELPER FUNCTIONS ===================
+// One RF sample through the trigger logic, CSV log and live snapshot;
+// age_ms > 0 for samples the ULP took while the cores slept
+void process_sample(float dbm_median, int adc, float v, uint32_t age_ms) {
   update_signal_processing(dbm_median);
 
   // Check for trigger condition
@@ -79,8 +142,8 @@ void loop() {
 
   // Generate time and logging data
   uint32_t epochNow;
-  String iso = isoTimeNow(&epochNow);
-  uint32_t uptimeMs = millis() - bootMs;
+  String iso = isoTimeAgo(age_ms, &epochNow);
+  uint32_t uptimeMs = millis() - age_ms - bootMs;
 
   // Calculate minute statistics
   double minuteAvg = (minuteCount ? minuteSumDbm / minuteCount : NAN);
@@ -90,33 +153,25 @@ void loop() {
   String noteToWrite = pendingNote;
   pendingNote = "";
 
-  writeCSVLine(iso, epochNow, uptimeMs, g_adc, g_v, dbm_median, voltsToDbm(emaV),
+  writeCSVLine(iso, epochNow, uptimeMs, adc, v, dbm_median, voltsToDbm(emaV),
                minuteMinDbm, minuteMaxDbm, (float)minuteAvg,
                delta_db, get_dynamic_threshold(), mad_est,
                noteToWrite, trigger_ready);
 
   // Update web interface snapshot
-  update_json_snapshot(g_adc, g_v, dbm_median, voltsToDbm(emaV),
+  update_json_snapshot(adc, v, dbm_median, voltsToDbm(emaV),
                       iso, epochNow, uptimeMs);
+}
 
-  // Debug output every 5 seconds
-  print_debug_status();
-
-  // Handle power management based on web activity
-  manage_power_modes();
-
-  // Handle web clients until next sample period
-  uint32_t targetEnd = t0 + PERIOD_MS;
-  while ((int32_t)(millis() - targetEnd) < 0) {
-    handle_web_clients();
-    delay(1);
-  }
-
-  // Handle minute summary logging
-  handle_minute_summary(epochNow, uptimeMs, dbm_median);
+// ULP mode: sleep when no web client, RF activity, trigger, held trigger or
+// camera slot needs the cores
+bool emf_may_sleep() {
+  if (millis() - lastHttpMs < INTERACTIVE_MS) return false;
+  if (ulp_stay_awake()) return false;
+  if (emf_now_trigger_held()) return false;
+  return emf_now_sleep_ms() >= ULP_MIN_SLEEP_MS;
 }
 
-// =================== HELPER FUNCTIONS ===================
 void setup_wifi() {
   WiFi.mode(WIFI_STA);
   WiFi.begin(WIFI_SSID, WIFI_PASS);
@@ -155,22 +210,6 @@ void print_connection_info() {
   }
 }
 
-void send_camera_trigger(float delta_db) {
-  uint32_t now = millis();
-  if (now - last_now_ms < NOW_COOLDOWN_MS) return;
-
-  trigger_msg_t msg{delta_db, now};
-  esp_err_t r = esp_now_send(EMF_SENSOR_MAC, (uint8_t*)&msg, sizeof(msg));
-
-  if (r == ESP_OK) {
-    last_now_ms = now;
-    Serial.printf("Trigger → CAM: Δ=%.3f dB (thr=%.3f)\n",
-                  delta_db, get_dynamic_threshold());
-  } else {
-    Serial.printf("Trigger send ERR=%d\n", r);
-  }
-}
-
 void print_debug_status() {
   static uint32_t lastDbg = 0;
   if (millis() - lastDbg > 5000) {
@@ -193,12 +232,13 @@ void manage_power_modes() {
   }
 }
 
-void handle_minute_summary(uint32_t epochNow, uint32_t uptimeMs, float dbm_median) {
+void handle_minute_summary() {
   if (millis() - lastMinuteTick >= 60000UL) {
     double minuteAvg = (minuteCount ? minuteSumDbm / minuteCount : NAN);
+    uint32_t epochNow;
 
-    writeCSVLine(isoTimeNow(&epochNow), epochNow, uptimeMs,
-                 g_adc, g_v, dbm_median, voltsToDbm(emaV),
+    writeCSVLine(isoTimeNow(&epochNow), epochNow, g_uptimeMs,
+                 g_adc, g_v, g_dbm, voltsToDbm(emaV),
                  minuteMinDbm, minuteMaxDbm, (float)minuteAvg,
                  delta_db, get_dynamic_threshold(), mad_est,
                  "MINUTE_SUMMARY", check_trigger_condition());
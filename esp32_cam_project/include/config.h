@@ -15,15 +15,145 @@
 #define CAM_FRAMESIZE         FRAMESIZE_96X96  // Matches Edge Impulse model exactly
 #define CAM_FB_COUNT          1
 
-// Power management: 0 = safe modem-sleep (recommended)
+// Bay window: the part of the sensor's field of view the model sees, in
+// 1/1000 of its width / height (CAM_ROI_W = 0 -> full field of view).
+// An OV2640 crops and scales on the sensor, so only the EI input size is
+// DMA'd; other sensors capture CAM_ROI_SW_FRAMESIZE and crop in software.
+#define CAM_ROI_X             0
+#define CAM_ROI_Y             0
+#define CAM_ROI_W             0
+#define CAM_ROI_H             0
+#define CAM_ROI_SW_FRAMESIZE  FRAMESIZE_QVGA   // software-crop fallback capture size
+
+// Power management: 0 = safe modem-sleep (recommended), 1 = light sleep,
+// 2 = deep sleep through long rendezvous gaps (see FAST RESUME)
 #define SLEEP_MODE            0
 
+// Keep the EI tensor arena and prepared ops for the whole camera session
+// (freed when the camera turns off); 0 = init/free around every frame
+#define EI_PERSISTENT_SESSION 1
+
 // =================== CAR DETECTION THRESHOLDS ===================
 #define CAR_ON_THRESH         0.70f        // 70% confidence to set OCCUPIED
 #define CAR_ON_HOLD_MS        5000         // hold 5 seconds to set OCCUPIED
 #define CAR_OFF_THRESH        0.50f        // <=50% confidence to clear to VACANT
 #define CAR_OFF_HOLD_MS       3000         // hold 3 seconds to clear
 
+// =================== OCCUPANCY GRID ===================
+// FOMO car evidence fused over frames per output cell; the thresholds above
+// apply to the fused bay confidence instead of each frame's best box
+#define OCC_ENABLE            1            // 0 = thresholds on each frame's best box
+#define OCC_TAU_MS            1500         // time constant of a cell's evidence; bridges single glitches
+#define OCC_CELL              8            // FOMO output cell in input pixels (96 / 12)
+
+// =================== ADAPTIVE ACTIVE WINDOW ===================
+// ACTIVE_WINDOW_MS is the window opened by a trigger; the controller may
+// end it early once a decision is confirmed, or extend it while the scene moves.
+#define ADAPTIVE_WINDOW       1            // 0 = fixed ACTIVE_WINDOW_MS
+#define WINDOW_CONFIRM_MS     2000         // stable time after a transition before stopping
+#define WINDOW_EXTEND_MS      5000         // keep running this long after last motion
+#define WINDOW_MAX_MS         60000        // hard cap on one camera session
+#define WINDOW_MOTION_PX      8            // box centroid shift counted as motion (1 FOMO cell)
+
+// =================== CASCADE INFERENCE ===================
+// Reuse the last confident FOMO result while the scene has not changed;
+// FOMO reports 0 for a bay with no box above its 0.5 threshold
+#define CASCADE_ENABLE        1            // 0 = full FOMO on every frame
+#define CASCADE_CELL_DIFF     12           // max 8x8 cell mean change (gray levels) to skip FOMO
+#define CASCADE_EMPTY_CONF    0.30f        // car_conf at or below = confidently empty
+#define CASCADE_FULL_CONF     0.85f        // car_conf at or above = confidently occupied
+#define CASCADE_MAX_SKIP      8            // full FOMO at least every 9th frame
+
+// =================== FRAME QUALITY GATE ===================
+// Drop frames before inference while auto exposure settles after camera
+// init, and single bad frames after that; flag scenes that stay unusable
+#define GATE_ENABLE           1            // 0 = every frame goes to inference
+#define GATE_MEAN_MIN         40           // mean gray level below = dark
+#define GATE_MEAN_MAX         200          // mean gray level above = bright
+#define GATE_CLIP_PCT         20           // % of pixels at 252+ counted blown out
+#define GATE_MIN_SPREAD       24           // 5th..95th percentile gray levels below = flat
+#define GATE_MIN_SHARP        30           // per mille of pixel steps above spread/4; below = blurred
+#define GATE_SETTLE_DELTA     6            // mean change between frames still counted steady
+#define GATE_SETTLE_FRAMES    2            // steady usable frames that end the settling
+#define GATE_SETTLE_MAX_MS    4000         // not settled by then -> scene unusable
+#define GATE_BAD_FRAMES       20           // consecutive drops after settling -> scene unusable
+
+// =================== MEMORY PLACEMENT ===================
+// Pool per buffer class: MEM_POOL_INTERNAL (SRAM) or MEM_POOL_PSRAM (large,
+// several times slower). A buffer that does not fit its pool goes to the
+// other one; the [MEM] report at boot and at the first Camera OFF says where
+// everything landed and how much of each pool is left.
+#define MEM_PLACE_ARENA       MEM_POOL_INTERNAL  // tensor arena: activations every node touches
+#define MEM_PLACE_EI_HEAP     MEM_POOL_INTERNAL  // EI feature / result matrices, per inference
+#define MEM_PLACE_EI_INPUT    MEM_POOL_INTERNAL  // 96x96 gray input, written once per frame
+#define MEM_PLACE_FRAME       MEM_POOL_PSRAM     // camera frame buffers (bulk, DMA'd)
+#define MEM_BENCH_RUNS        0                  // >0: time every placement at boot, this many runs each
+
+// =================== MEMORY TELEMETRY ===================
+// Heap low-water marks per pool, task stack high-water marks and the heap
+// each EI stage holds; [MEMT] report on Serial, summary to the EMF node
+#define MEMT_SAMPLE_MS        10000        // sample interval
+#define MEMT_REPORT_MS        600000       // [MEMT] report interval (0 = at the first Camera OFF only)
+#define MEMT_HEARTBEAT_MS     60000        // heartbeat to the EMF node (0 = none)
+
+// =================== MODEL BLOB ===================
+// Model weights from the model_a / model_b partitions (partitions_model.csv),
+// read in place. A slot that is empty, corrupt or made for another graph is
+// skipped; with neither valid the weights compiled into the firmware are used.
+// Serial console: "model a|b|builtin|auto|list".
+#define MODEL_BLOB_ENABLE     1
+#define MODEL_BLOB_SLOT       MODEL_SLOT_AUTO    // boot slot: MODEL_SLOT_A / _B / _BUILTIN / _AUTO (newest valid)
+#define MODEL_BLOB_SUBTYPE    0x40               // data partition subtype of both slots
+#define MODEL_BLOB_LABEL_A    "model_a"
+#define MODEL_BLOB_LABEL_B    "model_b"
+
+// =================== CLOCK SYNC ===================
+// EMF node is the time master; stamps also ride on triggers and statuses
+#define SYNC_PERIOD_MS        300000       // explicit resync when no fresh sample for 5 min
+#define SYNC_RETRY_MS         2000         // retry interval until the first sample
+
+// =================== RENDEZVOUS LISTENING ===================
+// Idle camera listens only in a short slot every RDV_PERIOD_MS, told by the
+// EMF node, which holds triggers until then; light sleep in between.
+// Trigger latency <= RDV_PERIOD_MS + RDV_SLOT_MS (one period more per missed poll)
+#define RDV_ENABLE            1            // 0 = radio listens all the time
+#define RDV_PERIOD_MS         1000         // slot period
+#define RDV_SLOT_MS           20           // wait for the EMF answer per slot
+#define RDV_GUARD_MS          5            // wake this early for a slot
+#define RDV_MISS_MAX          3            // unanswered slots before listening all the time
+#define RDV_MIN_SLEEP_MS      20           // shorter gaps are spent in modem sleep
+
+// =================== FAST RESUME ===================
+// With SLEEP_MODE 2, idle gaps of DEEP_SLEEP_MIN_MS or more are spent in deep
+// sleep; occupancy, hold timers, channel, sequence numbers and the clock
+// estimate stay in RTC memory, so a timer wake skips the cold-boot delays.
+// Worth it only with RDV_PERIOD_MS well above DEEP_SLEEP_MIN_MS.
+#define DEEP_SLEEP_MIN_MS     5000         // shorter gaps use light sleep
+#define DEEP_SLEEP_WAKE_MS    150          // wake this early for a slot (boot + WiFi start)
+#define RESUME_RTC_ERR_PPM    500          // RTC slow clock error assumed over a sleep
+
+// =================== CHANNEL DISCOVERY ===================
+// Find the EMF node's channel by probing 1-13, cache it in RTC memory and
+// rescan when sends keep failing (AP channel change, EMF SoftAP fallback)
+#define NOW_CHANNEL_SCAN      1            // 0 = stay on NOW_CHANNEL / STA channel
+#define NOW_REPROBE_FAILS     3            // consecutive failed sends before rescanning
+#define NOW_PROBE_RETRY_MS    1000         // probe interval while sends are failing
+#define NOW_SCAN_DWELL_MS     30           // wait per channel for an answer
+#define NOW_SCAN_BACKOFF_MS   5000         // pause after a sweep with no answer
+#define NOW_LINK_CHECK_MS     10000        // probe if nothing heard from the EMF node this long
+
+// =================== EVIDENCE THUMBNAILS ===================
+// JPEG of the frame that confirmed OCCUPIED, sent to the EMF node in fragments
+#define EVIDENCE_ENABLE       1            // 0 = no thumbnails
+#define EVIDENCE_BAY_ID       0            // served as /evidence/<bay>.jpg
+#define EVIDENCE_JPEG_QUALITY 40           // fmt2jpg quality (1-100)
+#define EVIDENCE_ROI_X        0            // crop inside the 96x96 EI frame;
+#define EVIDENCE_ROI_Y        0            //   EVIDENCE_ROI_W = 0 sends the full frame
+#define EVIDENCE_ROI_W        0
+#define EVIDENCE_ROI_H        0
+#define EVIDENCE_ACK_TIMEOUT_MS 500        // resend everything if no ACK/NACK arrives
+#define EVIDENCE_MAX_ROUNDS   4            // send rounds before giving up
+
 // =================== ESP-NOW ADDRESSING ===================
 // EMF RF Sensor MAC address (where we send status updates)
 extern uint8_t EMF_SENSOR_MAC[6];
@@ -0,0 +1,136 @@
+#include "active_window.h"
+
+// =================== GLOBAL VARIABLES ===================
+bool window_adaptive = (ADAPTIVE_WINDOW != 0);
+uint32_t window_sessions  = 0;
+uint32_t window_decisions = 0;
+uint32_t window_cam_on_ms = 0;
+
+// Current session
+static uint32_t win_start_ms      = 0;
+static uint32_t win_transition_ms = 0;   // 0 = no decision yet this session
+static uint32_t win_motion_ms     = 0;
+static uint32_t win_frames        = 0;
+static uint32_t win_decisions     = 0;
+static bool     win_last_present  = false;
+static const char* win_end_reason = "timeout";
+
+// Previous FOMO frame, for motion detection
+static int win_prev_count = -1;
+static int win_prev_cx = 0;
+static int win_prev_cy = 0;
+
+// =================== MOTION DETECTION ===================
+// Motion = the number of boxes changed or the strongest box moved a cell
+static bool detections_moved(const ei_impulse_result_t& result) {
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+  int count = 0, cx = 0, cy = 0;
+  float best = 0.f;
+  for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+    const auto &bb = result.bounding_boxes[i];
+    if (bb.value == 0) continue;
+    count++;
+    if (bb.value > best) {
+      best = bb.value;
+      cx = bb.x + bb.width / 2;
+      cy = bb.y + bb.height / 2;
+    }
+  }
+
+  bool moved = false;
+  if (win_prev_count >= 0) {
+    moved = (count != win_prev_count) ||
+            (count > 0 && abs(cx - win_prev_cx) + abs(cy - win_prev_cy) >= WINDOW_MOTION_PX);
+  }
+  win_prev_count = count;
+  win_prev_cx = cx;
+  win_prev_cy = cy;
+  return moved;
+#else
+  return false;
+#endif
+}
+
+// Deadline by which a running ON/OFF hold timer completes and is confirmed
+static uint32_t pending_hold_end_ms() {
+  if (!car_present && car_above_since_ms != 0) return car_above_since_ms + CAR_ON_HOLD_MS + WINDOW_CONFIRM_MS;
+  if (car_present && car_below_since_ms != 0) return car_below_since_ms + CAR_OFF_HOLD_MS + WINDOW_CONFIRM_MS;
+  return 0;
+}
+
+// =================== SESSION CONTROL ===================
+void active_window_begin() {
+  win_start_ms      = millis();
+  win_transition_ms = 0;
+  win_motion_ms     = win_start_ms;
+  win_frames        = 0;
+  win_decisions     = 0;
+  win_last_present  = car_present;
+  win_end_reason    = "timeout";
+  win_prev_count    = -1;
+}
+
+void active_window_update(const ei_impulse_result_t& result) {
+  const uint32_t now = millis();
+  win_frames++;
+
+  // Did update_car_detection() just make a decision?
+  if (car_present != win_last_present) {
+    win_last_present = car_present;
+    win_transition_ms = now;
+    win_decisions++;
+  }
+
+  bool moved = detections_moved(result);
+  if (moved) win_motion_ms = now;
+  if (!window_adaptive) return;
+
+  const uint32_t seen_until = g_trigger_until_ms;
+  uint32_t until = seen_until;
+
+  // Extend while the scene is moving or a hold timer is still running
+  if (moved && (int32_t)(now + WINDOW_EXTEND_MS - until) > 0) until = now + WINDOW_EXTEND_MS;
+  uint32_t hold_end = pending_hold_end_ms();
+  if (hold_end && (int32_t)(hold_end - until) > 0) until = hold_end;
+
+  const uint32_t cap = win_start_ms + WINDOW_MAX_MS;
+  if ((int32_t)(until - cap) >= 0) {
+    until = cap;
+    win_end_reason = "cap";
+  }
+
+  // End early once the decision has held with nothing moving or pending
+  if (win_transition_ms != 0 && hold_end == 0 &&
+      now - win_transition_ms >= WINDOW_CONFIRM_MS &&
+      now - win_motion_ms >= WINDOW_CONFIRM_MS) {
+    until = now;
+    win_end_reason = "confirmed";
+  }
+
+  // Skip the write if a fresh trigger landed meanwhile (RX callback owns it too)
+  if (until != seen_until) now_trigger_window_replace(seen_until, until);
+}
+
+void active_window_stop(const char* reason) {
+  const uint32_t seen_until = g_trigger_until_ms;
+  const uint32_t now = millis();
+  if ((int32_t)(seen_until - now) <= 0) return;
+  win_end_reason = reason;
+  now_trigger_window_replace(seen_until, now);
+}
+
+void active_window_end() {
+  const uint32_t on_ms = millis() - win_start_ms;
+  window_sessions++;
+  window_decisions += win_decisions;
+  window_cam_on_ms += on_ms;
+
+  Serial.printf("[WIN] session #%lu: camera on %.1fs, %lu frames, %lu decision(s), end=%s\n",
+                (unsigned long)window_sessions, on_ms / 1000.0f, (unsigned long)win_frames,
+                (unsigned long)win_decisions, win_end_reason);
+  if (window_decisions) {
+    Serial.printf("[WIN] total camera on %.1fs over %lu decision(s) = %.1fs/decision\n",
+                  window_cam_on_ms / 1000.0f, (unsigned long)window_decisions,
+                  window_cam_on_ms / 1000.0f / window_decisions);
+  }
+}
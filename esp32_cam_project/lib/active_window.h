@@ -0,0 +1,25 @@
+#ifndef ACTIVE_WINDOW_H
+#define ACTIVE_WINDOW_H
+
+#include <Arduino.h>
+#include <model-parameters/model_metadata.h>
+#include <edge-impulse-sdk/classifier/ei_classifier_types.h>
+#include "config.h"
+#include "esp_now_comm.h"  // From shared library
+#include "car_detection.h"
+
+// =================== ACTIVE WINDOW CONTROLLER ===================
+// Owns g_trigger_until_ms while the camera is on: ends the session once a
+// transition is confirmed, extends it while detections move (up to a cap).
+void active_window_begin();
+void active_window_update(const ei_impulse_result_t& result);
+void active_window_stop(const char* reason);   // end the session now
+void active_window_end();
+
+// =================== GLOBAL VARIABLES ===================
+extern bool window_adaptive;          // false = fixed ACTIVE_WINDOW_MS
+extern uint32_t window_sessions;      // camera sessions since boot
+extern uint32_t window_decisions;     // OCCUPIED/VACANT transitions since boot
+extern uint32_t window_cam_on_ms;     // total camera-on time since boot
+
+#endif // ACTIVE_WINDOW_H
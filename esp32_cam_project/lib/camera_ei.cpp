@@ -1,9 +1,16 @@
 #include "camera_ei.h"
+#include "mem_place.h"
 
 // =================== GLOBAL VARIABLES ===================
 bool cam_inited = false;
 bool ei_debug_nn = false;
 uint8_t* ei_input_gray = nullptr;
+cam_roi_t cam_roi = { CAM_ROI_X, CAM_ROI_Y, CAM_ROI_W, CAM_ROI_H };
+cam_window_t cam_window_mode = CAM_WINDOW_FULL;
+uint32_t cam_frames = 0;
+uint32_t cam_fb_us = 0;
+uint32_t cam_copy_us = 0;
+uint32_t cam_frame_bytes = 0;
 
 // Camera configuration (GRAYSCALE + small frame)
 camera_config_t camcfg = {
@@ -24,20 +31,98 @@ camera_config_t camcfg = {
   .frame_size   = CAM_FRAMESIZE,        // small frame
   .jpeg_quality = 12,                   // ignored for GRAYSCALE
   .fb_count     = CAM_FB_COUNT,
-  .fb_location  = CAMERA_FB_IN_PSRAM,
+  .fb_location  = MEM_PLACE_FRAME == MEM_POOL_PSRAM ? CAMERA_FB_IN_PSRAM : CAMERA_FB_IN_DRAM,
   .grab_mode    = CAMERA_GRAB_WHEN_EMPTY,
 };
 
+// =================== SENSOR WINDOW ===================
+// OV2640 sensor modes as esp32-camera's set_res_raw() takes them (startX),
+// with the size its DSP window offsets and sizes are counted in
+#define OV2640_MODE_UXGA  0
+#define OV2640_MODE_SVGA  1
+#define OV2640_MODE_CIF   2
+static const uint16_t ov2640_mode_w[3] = { 1600, 800, 400 };
+static const uint16_t ov2640_mode_h[3] = { 1200, 600, 296 };
+
+static bool roi_enabled() {
+  return cam_roi.w > 0 && cam_roi.h > 0;
+}
+
+// Window [*x, *x + *n) of a span of `size` pixels for the ROI edge `pos`
+// and length `len` (1/1000). Grown around its centre to at least `min_len`;
+// `align` keeps offset and length on the register grid.
+static bool roi_span(int pos, int len, int size, int min_len, int align, int* x, int* n) {
+  pos = min(pos, 1000);
+  len = min(len, 1000 - pos);
+  int start = pos * size / 1000;
+  int count = len * size / 1000;
+  const bool grown = count < min_len;
+  if (grown) {
+    start -= (min_len - count) / 2;
+    count = min_len;
+  }
+  count = min(size, (count + align - 1) / align * align);
+  start = max(0, min(size - count, start)) / align * align;
+  *x = start;
+  *n = count;
+  return !grown;
+}
+
+// OV2640: window the DSP on the bay and zoom it to the EI input size. The
+// cheapest sensor mode (CIF, then SVGA, then UXGA) that still has at least
+// one sensor pixel per output pixel is used.
+static bool cam_set_sensor_window() {
+  sensor_t* s = esp_camera_sensor_get();
+  if (!s || s->id.PID != OV2640_PID || !s->set_res_raw) return false;
+
+  const int dw = (int)EI_CLASSIFIER_INPUT_WIDTH;
+  const int dh = (int)EI_CLASSIFIER_INPUT_HEIGHT;
+  for (int mode = OV2640_MODE_CIF; mode >= OV2640_MODE_UXGA; mode--) {
+    int x, y, w, h;
+    const bool fits_x = roi_span(cam_roi.x, cam_roi.w, ov2640_mode_w[mode], dw, 4, &x, &w);
+    const bool fits_y = roi_span(cam_roi.y, cam_roi.h, ov2640_mode_h[mode], dh, 4, &y, &h);
+    if ((!fits_x || !fits_y) && mode != OV2640_MODE_UXGA) continue;
+    if (s->set_res_raw(s, mode, 0, 0, 0, x, y, w, h, dw, dh, false, false) != 0) return false;
+    Serial.printf("[CAM] sensor window %dx%d+%d+%d of %ux%u -> %dx%d\n", w, h, x, y,
+                  ov2640_mode_w[mode], ov2640_mode_h[mode], dw, dh);
+    return true;
+  }
+  return false;
+}
+
 // =================== CAMERA CONTROL ===================
 bool ei_camera_init() {
   if (cam_inited) return true;
   delay(3000);  // settle before init
+  // A sensor already found to lack windowing goes straight to the larger frame
+  const bool software = roi_enabled() && cam_window_mode == CAM_WINDOW_SOFTWARE;
+  camcfg.frame_size = software ? CAM_ROI_SW_FRAMESIZE : CAM_FRAMESIZE;
   esp_err_t err = esp_camera_init(&camcfg);
   if (err != ESP_OK) {
     Serial.printf("esp_camera_init err=0x%x\n", err);
     return false;
   }
   cam_inited = true;
+
+  if (!roi_enabled()) {
+    cam_window_mode = CAM_WINDOW_FULL;
+  } else if (!software) {
+    if (cam_set_sensor_window()) {
+      cam_window_mode = CAM_WINDOW_SENSOR;
+    } else {
+      // No sensor windowing: capture more pixels and crop them in software
+      Serial.println("[CAM] sensor cannot window, cropping in software");
+      esp_camera_deinit();
+      camcfg.frame_size = CAM_ROI_SW_FRAMESIZE;
+      err = esp_camera_init(&camcfg);
+      if (err != ESP_OK) {
+        Serial.printf("esp_camera_init err=0x%x\n", err);
+        cam_inited = false;
+        return false;
+      }
+      cam_window_mode = CAM_WINDOW_SOFTWARE;
+    }
+  }
   return true;
 }
 
@@ -46,32 +131,47 @@ void ei_camera_deinit() {
   esp_err_t err = esp_camera_deinit();
   if (err != ESP_OK) Serial.println("Camera deinit failed");
   cam_inited = false;
+  if (cam_frames) {
+    static const char* const mode_names[] = { "full view", "sensor window", "software crop" };
+    Serial.printf("[CAM] %s, %lu B/frame, frame wait %.2f ms, copy %.2f ms (avg of %lu)\n",
+                  mode_names[cam_window_mode], (unsigned long)cam_frame_bytes,
+                  cam_fb_us / 1000.0f / cam_frames, cam_copy_us / 1000.0f / cam_frames,
+                  (unsigned long)cam_frames);
+  }
 }
 
 // =================== IMAGE PROCESSING ===================
-void resize_gray_nn(const uint8_t* src, int sw, int sh, uint8_t* dst, int dw, int dh) {
+void crop_resize_gray_nn(const uint8_t* src, int sw, int rx, int ry, int rw, int rh,
+                         uint8_t* dst, int dw, int dh) {
   for (int y = 0; y < dh; ++y) {
-    int sy = (int)((uint32_t)y * sh / dh);
-    const uint8_t* srow = src + sy * sw;
+    int sy = ry + (int)((uint32_t)y * rh / dh);
+    const uint8_t* srow = src + sy * sw + rx;
     uint8_t* drow = dst + y * dw;
     for (int x = 0; x < dw; ++x) {
-      int sx = (int)((uint32_t)x * sw / dw);
+      int sx = (int)((uint32_t)x * rw / dw);
       drow[x] = srow[sx];
     }
   }
 }
 
+void resize_gray_nn(const uint8_t* src, int sw, int sh, uint8_t* dst, int dw, int dh) {
+  crop_resize_gray_nn(src, sw, 0, 0, sw, sh, dst, dw, dh);
+}
+
 /*
  * Capture one frame (GRAYSCALE small):
  *  - fb = GRAYSCALE (Wsrc x Hsrc, 1 Bpp)
- *  - If (Wsrc,Hsrc) == (EI_W,EI_H) copy directly.
- *  - Else resize (nearest) fb->buf → ei_input_gray.
+ *  - If (Wsrc,Hsrc) == (EI_W,EI_H) copy directly (full view or sensor window).
+ *  - Else crop the bay window (software fallback) or take the whole frame,
+ *    and resize (nearest) fb->buf → ei_input_gray.
  */
 bool ei_camera_capture() {
   if (!cam_inited || !ei_input_gray) return false;
 
+  const uint32_t t0 = micros();
   camera_fb_t* fb = esp_camera_fb_get();
   if (!fb) return false;
+  const uint32_t t1 = micros();
 
   bool ok = false;
 
@@ -86,7 +186,14 @@ bool ei_camera_capture() {
       return false;
     }
 
-    if (sw == dw && sh == dh) {
+    if (cam_window_mode == CAM_WINDOW_SOFTWARE) {
+      // Bay window in this frame's pixels
+      int rx, ry, rw, rh;
+      roi_span(cam_roi.x, cam_roi.w, sw, 1, 1, &rx, &rw);
+      roi_span(cam_roi.y, cam_roi.h, sh, 1, 1, &ry, &rh);
+      crop_resize_gray_nn((const uint8_t*)fb->buf, sw, rx, ry, rw, rh, ei_input_gray, dw, dh);
+      ok = true;
+    } else if (sw == dw && sh == dh) {
       // Direct copy, no resize
       memcpy(ei_input_gray, fb->buf, (size_t)sw * sh);
       ok = true;
@@ -97,7 +204,13 @@ bool ei_camera_capture() {
     }
   }
 
+  cam_frame_bytes = fb->len;
+  mem_place_note(MEM_BUF_FRAME, (size_t)fb->len * CAM_FB_COUNT,
+                 camcfg.fb_location == CAMERA_FB_IN_PSRAM ? MEM_POOL_PSRAM : MEM_POOL_INTERNAL);
   esp_camera_fb_return(fb);
+  cam_frames++;
+  cam_fb_us += t1 - t0;
+  cam_copy_us += micros() - t1;
   return ok;
 }
 
@@ -3,18 +3,31 @@
 
 #include <Arduino.h>
 #include "esp_camera.h"
-#include <parkingpal5478069-project-1_inferencing.h>
-#include <edge-impulse-sdk/dsp/image/image.hpp>
+#include <model-parameters/model_metadata.h>
 // #include "dummy_ei.h"  // Temporary dummy - now using real Edge Impulse
 #include "config.h"
 
 // =================== CAMERA CONTROL ===================
+// How the bay window reaches the EI input
+typedef enum {
+  CAM_WINDOW_FULL = 0,     // no window: whole field of view, resized if needed
+  CAM_WINDOW_SENSOR,       // sensor crops and scales; frames arrive at EI size
+  CAM_WINDOW_SOFTWARE      // larger frame, cropped and resized in software
+} cam_window_t;
+
+// Bay window in 1/1000 of the sensor's field of view (w = 0 -> full view)
+typedef struct {
+  uint16_t x, y, w, h;
+} cam_roi_t;
+
 bool ei_camera_init();
 void ei_camera_deinit();
 bool ei_camera_capture();
 
 // =================== IMAGE PROCESSING ===================
 void resize_gray_nn(const uint8_t* src, int sw, int sh, uint8_t* dst, int dw, int dh);
+void crop_resize_gray_nn(const uint8_t* src, int sw, int rx, int ry, int rw, int rh,
+                         uint8_t* dst, int dw, int dh);
 int ei_camera_get_data(size_t offset, size_t length, float* out_ptr);
 
 // =================== GLOBAL VARIABLES ===================
@@ -22,6 +35,12 @@ extern bool cam_inited;
 extern bool ei_debug_nn;
 extern uint8_t* ei_input_gray;
 extern camera_config_t camcfg;
+extern cam_roi_t cam_roi;             // bay window, from CAM_ROI_*
+extern cam_window_t cam_window_mode;  // how the last camera session applied it
+extern uint32_t cam_frames;           // frames captured since boot
+extern uint32_t cam_fb_us;            // time waiting for frames since boot
+extern uint32_t cam_copy_us;          // time copying / cropping frames since boot
+extern uint32_t cam_frame_bytes;      // bytes DMA'd for the last frame
 
 // =================== LED CONTROL ===================
 static inline void led_on()  { digitalWrite(LED_PIN, LED_ACTIVE_HIGH ? HIGH : LOW); }
@@ -1,5 +1,10 @@
 #include "car_detection.h"
 
+#if EI_CLASSIFIER_OBJECT_DETECTION != 1
+// Defined in model-parameters/model_variables.h
+extern const char* ei_classifier_inferencing_categories[];
+#endif
+
 // =================== GLOBAL VARIABLES ===================
 volatile bool car_present = false;   // public flag you can read elsewhere
 uint32_t car_above_since_ms = 0;     // first time we saw >= ON threshold
@@ -2,10 +2,13 @@
 #define CAR_DETECTION_H
 
 #include <Arduino.h>
-#include <parkingpal5478069-project-1_inferencing.h>
+// Result types only - the full inferencing header defines the classifier
+// entry points and must be included by exactly one translation unit.
+#include <model-parameters/model_metadata.h>
+#include <edge-impulse-sdk/classifier/ei_classifier_types.h>
 // #include "dummy_ei.h"  // Temporary dummy - now using real Edge Impulse
 #include "config.h"
-#include "../shared/esp_now_comm.h"
+#include "esp_now_comm.h"  // From shared library
 
 // =================== CAR PRESENCE STATE MACHINE ===================
 void init_car_detection();
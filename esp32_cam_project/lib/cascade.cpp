@@ -0,0 +1,122 @@
+#include "cascade.h"
+
+// =================== GLOBAL VARIABLES ===================
+bool cascade_enabled = (CASCADE_ENABLE != 0);
+uint8_t cascade_cell_diff = CASCADE_CELL_DIFF;
+uint32_t cascade_frames     = 0;
+uint32_t cascade_hits_empty = 0;
+uint32_t cascade_hits_full  = 0;
+uint32_t cascade_stage1_us  = 0;
+
+// One thumbnail cell per FOMO output cell (8x8 pixels)
+#define CASC_CELL  8
+#define CASC_GW    (EI_CLASSIFIER_INPUT_WIDTH / CASC_CELL)
+#define CASC_GH    (EI_CLASSIFIER_INPUT_HEIGHT / CASC_CELL)
+
+// Reference: thumbnail and result of the last confident FOMO run
+static uint8_t casc_ref[CASC_GW * CASC_GH];
+static bool    casc_ref_valid = false;
+static bool    casc_ref_full  = false;
+static ei_impulse_result_t casc_ref_result;
+static uint32_t casc_skips = 0;          // consecutive frames reused
+
+// Thumbnail of the frame stage 1 just looked at
+static uint8_t casc_cur[CASC_GW * CASC_GH];
+static bool    casc_cur_fresh = false;
+
+// Current session
+static uint32_t casc_sess_frames = 0;
+static uint32_t casc_sess_hits   = 0;
+
+// =================== STAGE 1 ===================
+static void cell_means(const uint8_t* gray, uint8_t* cells) {
+  for (int cy = 0; cy < CASC_GH; cy++) {
+    for (int cx = 0; cx < CASC_GW; cx++) {
+      const uint8_t* p = gray + (cy * CASC_CELL) * EI_CLASSIFIER_INPUT_WIDTH + cx * CASC_CELL;
+      uint32_t sum = 0;
+      for (int y = 0; y < CASC_CELL; y++, p += EI_CLASSIFIER_INPUT_WIDTH) {
+        for (int x = 0; x < CASC_CELL; x++) sum += p[x];
+      }
+      cells[cy * CASC_GW + cx] = (uint8_t)(sum / (CASC_CELL * CASC_CELL));
+    }
+  }
+}
+
+// Largest cell change against the reference once a global shift
+// (auto exposure, clouds) is taken out
+static int scene_change() {
+  const int n = CASC_GW * CASC_GH;
+  int shift = 0;
+  for (int i = 0; i < n; i++) shift += (int)casc_cur[i] - (int)casc_ref[i];
+  shift /= n;
+  int worst = 0;
+  for (int i = 0; i < n; i++) {
+    const int d = abs((int)casc_cur[i] - (int)casc_ref[i] - shift);
+    if (d > worst) worst = d;
+  }
+  return worst;
+}
+
+// =================== SESSION CONTROL ===================
+void cascade_begin() {
+  casc_ref_valid   = false;   // the bay may have changed while the camera was off
+  casc_skips       = 0;
+  casc_cur_fresh   = false;
+  casc_sess_frames = 0;
+  casc_sess_hits   = 0;
+}
+
+// True if result was filled from the reference and FOMO can be skipped
+bool cascade_skip(const uint8_t* gray, ei_impulse_result_t* result) {
+  if (!cascade_enabled || !gray) return false;
+  const uint32_t t0 = micros();
+  cascade_frames++;
+  casc_sess_frames++;
+
+  cell_means(gray, casc_cur);
+  casc_cur_fresh = true;
+  const bool hit = casc_ref_valid && casc_skips < CASCADE_MAX_SKIP &&
+                   scene_change() <= cascade_cell_diff;
+  cascade_stage1_us += micros() - t0;
+  if (!hit) return false;
+
+  *result = casc_ref_result;
+  result->timing.dsp = 0;
+  result->timing.classification = 0;
+  result->timing.anomaly = 0;
+  casc_skips++;
+  casc_sess_hits++;
+  if (casc_ref_full) cascade_hits_full++;
+  else cascade_hits_empty++;
+  return true;
+}
+
+// After a full FOMO run: keep it as the reference if it was confident
+void cascade_update(const uint8_t* gray, const ei_impulse_result_t& result) {
+  if (!cascade_enabled || !gray) return;
+  const bool fresh = casc_cur_fresh;
+  casc_cur_fresh = false;
+  const float car_conf = extract_car_confidence(result);
+  casc_skips = 0;
+  casc_ref_valid = (car_conf <= CASCADE_EMPTY_CONF || car_conf >= CASCADE_FULL_CONF);
+  if (!casc_ref_valid) return;
+
+  if (!fresh) cell_means(gray, casc_cur);
+  memcpy(casc_ref, casc_cur, sizeof(casc_ref));
+  casc_ref_full = (car_conf >= CASCADE_FULL_CONF);
+  // Boxes point into the post-processing's static array, which stays put
+  // until the next full run replaces this reference
+  casc_ref_result = result;
+  casc_ref_result._raw_outputs = nullptr;
+}
+
+void cascade_end() {
+  if (!cascade_enabled) return;
+  Serial.printf("[CASC] session: %lu/%lu frames answered by stage 1\n",
+                (unsigned long)casc_sess_hits, (unsigned long)casc_sess_frames);
+  if (cascade_frames) {
+    Serial.printf("[CASC] total %lu frames, %lu empty + %lu occupied skipped, stage 1 %.2f ms/frame\n",
+                  (unsigned long)cascade_frames, (unsigned long)cascade_hits_empty,
+                  (unsigned long)cascade_hits_full, cascade_stage1_us / 1000.0f / cascade_frames);
+  }
+}
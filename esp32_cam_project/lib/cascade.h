@@ -0,0 +1,28 @@
+#ifndef CASCADE_H
+#define CASCADE_H
+
+#include <Arduino.h>
+#include <model-parameters/model_metadata.h>
+#include <edge-impulse-sdk/classifier/ei_classifier_types.h>
+#include "config.h"
+#include "car_detection.h"
+
+// =================== CASCADE INFERENCE ===================
+// Stage 1 compares a 12x12 cell-mean thumbnail of the frame with the one the
+// last confident FOMO result was computed on. While the scene is unchanged
+// and that result said clearly empty or clearly occupied, the FOMO network
+// is skipped and the result reused; anything else runs the full model.
+void cascade_begin();
+bool cascade_skip(const uint8_t* gray, ei_impulse_result_t* result);
+void cascade_update(const uint8_t* gray, const ei_impulse_result_t& result);
+void cascade_end();
+
+// =================== GLOBAL VARIABLES ===================
+extern bool cascade_enabled;          // false = FOMO on every frame
+extern uint8_t cascade_cell_diff;     // largest cell change (gray levels) still "unchanged"
+extern uint32_t cascade_frames;       // frames seen by stage 1 since boot
+extern uint32_t cascade_hits_empty;   // frames answered as empty without FOMO
+extern uint32_t cascade_hits_full;    // frames answered as occupied without FOMO
+extern uint32_t cascade_stage1_us;    // time spent in stage 1 since boot
+
+#endif // CASCADE_H
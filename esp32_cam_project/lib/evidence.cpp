@@ -0,0 +1,191 @@
+#include "evidence.h"
+
+// =================== GLOBAL VARIABLES ===================
+uint32_t evidence_sent   = 0;
+uint32_t evidence_failed = 0;
+uint32_t evidence_bytes  = 0;
+uint32_t evidence_frames = 0;
+uint32_t evidence_airtime_us = 0;
+
+// Thumbnail in flight (one at a time)
+static uint8_t* ev_jpg       = nullptr;
+static size_t   ev_len       = 0;
+static uint16_t ev_id        = 0;
+static uint8_t  ev_frags     = 0;
+static uint32_t ev_pending   = 0;     // fragments still to (re)send
+static uint8_t  ev_rounds    = 0;
+static uint32_t ev_sent_ms   = 0;
+static uint32_t ev_frames    = 0;     // fragments put on air, incl. resends
+static uint32_t ev_airtime_us = 0;
+static uint32_t ev_encode_us = 0;
+
+// Latest ACK/NACK, written from the ESP-NOW RX callback
+static volatile bool     ev_ack_rx      = false;
+static volatile uint16_t ev_ack_id      = 0;
+static volatile uint8_t  ev_ack_done    = 0;
+static volatile uint32_t ev_ack_missing = 0;
+
+// =================== HELPERS ===================
+static void evidence_release() {
+  free(ev_jpg);
+  ev_jpg = nullptr;
+  ev_len = 0;
+  ev_pending = 0;
+}
+
+static bool evidence_send_fragment(uint8_t idx) {
+  uint8_t frame[ESP_NOW_MAX_DATA_LEN];
+  evidence_hdr_t hdr{ NOW_MSG_MAGIC, NOW_MSG_EVIDENCE, ev_id, EVIDENCE_BAY_ID,
+                      idx, ev_frags, (uint16_t)ev_len };
+  size_t off = (size_t)idx * EVIDENCE_FRAG_PAYLOAD;
+  size_t n = min(EVIDENCE_FRAG_PAYLOAD, ev_len - off);
+  memcpy(frame, &hdr, sizeof(hdr));
+  memcpy(frame + sizeof(hdr), ev_jpg + off, n);
+  size_t len = sizeof(hdr) + n;
+  if (len < EVIDENCE_FRAG_MIN_LEN) {
+    memset(frame + len, 0, EVIDENCE_FRAG_MIN_LEN - len);
+    len = EVIDENCE_FRAG_MIN_LEN;
+  }
+
+  // Back-to-back sends can fill the ESP-NOW TX queue; give it a moment
+  for (int tries = 0; tries < 20; tries++) {
+    esp_err_t rc = esp_now_send(EMF_SENSOR_MAC, frame, len);
+    if (rc == ESP_OK) {
+      ev_frames++;
+      ev_airtime_us += now_airtime_us(len);
+      evidence_frames++;
+      evidence_airtime_us += now_airtime_us(len);
+      return true;
+    }
+    if (rc != ESP_ERR_ESPNOW_NO_MEM) {
+      Serial.printf("[EVID] frag %u rc=%d\n", (unsigned)idx, (int)rc);
+      return false;
+    }
+    delay(2);
+  }
+  return false;
+}
+
+// Crop the ROI (if any) out of the EI frame
+static uint8_t* evidence_crop(const uint8_t* gray, int width, int height, int& w, int& h) {
+  int x0 = 0, y0 = 0;
+  w = width;
+  h = height;
+  if (EVIDENCE_ROI_W > 0 && EVIDENCE_ROI_H > 0) {
+    x0 = min(EVIDENCE_ROI_X, width - 1);
+    y0 = min(EVIDENCE_ROI_Y, height - 1);
+    w = min(EVIDENCE_ROI_W, width - x0);
+    h = min(EVIDENCE_ROI_H, height - y0);
+  }
+  uint8_t* roi = (uint8_t*)malloc((size_t)w * h);
+  if (!roi) return nullptr;
+  for (int y = 0; y < h; y++) memcpy(roi + y * w, gray + (y0 + y) * width + x0, w);
+  return roi;
+}
+
+// =================== PUBLIC INTERFACE ===================
+void init_evidence() {
+  now_set_rx_hook(evidence_on_frame);
+}
+
+bool evidence_begin(const uint8_t* gray, int width, int height) {
+#if EVIDENCE_ENABLE
+  if (!gray) return false;
+  if (ev_jpg) {
+    Serial.println("[EVID] previous thumbnail dropped");
+    evidence_failed++;
+    evidence_release();
+  }
+
+  int w, h;
+  uint32_t t0 = micros();
+  uint8_t* roi = evidence_crop(gray, width, height, w, h);
+  if (!roi) return false;
+  bool ok = fmt2jpg(roi, (size_t)w * h, w, h, PIXFORMAT_GRAYSCALE,
+                    EVIDENCE_JPEG_QUALITY, &ev_jpg, &ev_len);
+  free(roi);
+  ev_encode_us = micros() - t0;
+
+  if (!ok || ev_len == 0 || ev_len > EVIDENCE_MAX_BYTES) {
+    Serial.printf("[EVID] encode failed (ok=%d len=%u)\n", (int)ok, (unsigned)ev_len);
+    evidence_release();
+    return false;
+  }
+
+  ev_id++;
+  ev_frags = (uint8_t)((ev_len + EVIDENCE_FRAG_PAYLOAD - 1) / EVIDENCE_FRAG_PAYLOAD);
+  ev_pending = (ev_frags == 32) ? 0xFFFFFFFFu : ((1u << ev_frags) - 1);
+  ev_rounds = 0;
+  ev_frames = 0;
+  ev_airtime_us = 0;
+  ev_ack_rx = false;
+  Serial.printf("[EVID] #%u %dx%d → %u B JPEG in %.1f ms, %u fragments\n",
+                (unsigned)ev_id, w, h, (unsigned)ev_len, ev_encode_us / 1000.0f, (unsigned)ev_frags);
+  evidence_poll();
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint16_t evidence_id() {
+  return ev_id;
+}
+
+// Numbering carries on after a deep sleep, so the EMF node takes the next
+// thumbnail as a new one
+void evidence_resume(uint16_t id) {
+  ev_id = id;
+}
+
+bool evidence_busy() {
+  return ev_jpg != nullptr;
+}
+
+void evidence_poll() {
+  if (!ev_jpg) return;
+  const uint32_t now = millis();
+
+  if (ev_ack_rx && ev_ack_id == ev_id) {
+    ev_ack_rx = false;
+    if (ev_ack_done) {
+      evidence_sent++;
+      evidence_bytes += ev_len;
+      Serial.printf("[EVID] #%u delivered: %u B, %u frames in %u round(s), airtime %.1f ms, encode %.1f ms\n",
+                    (unsigned)ev_id, (unsigned)ev_len, (unsigned)ev_frames, (unsigned)ev_rounds,
+                    ev_airtime_us / 1000.0f, ev_encode_us / 1000.0f);
+      evidence_release();
+      return;
+    }
+    ev_pending = ev_ack_missing;
+  } else if (ev_pending == 0 && now - ev_sent_ms >= EVIDENCE_ACK_TIMEOUT_MS) {
+    // Nothing heard back: the tail (or everything) was lost
+    ev_pending = (ev_frags == 32) ? 0xFFFFFFFFu : ((1u << ev_frags) - 1);
+  }
+
+  if (ev_pending == 0) return;
+  if (ev_rounds >= EVIDENCE_MAX_ROUNDS) {
+    evidence_failed++;
+    Serial.printf("[EVID] #%u gave up after %u rounds\n", (unsigned)ev_id, (unsigned)ev_rounds);
+    evidence_release();
+    return;
+  }
+
+  ev_rounds++;
+  for (uint8_t i = 0; i < ev_frags; i++) {
+    if (ev_pending & (1u << i)) evidence_send_fragment(i);
+  }
+  ev_pending = 0;
+  ev_sent_ms = millis();
+}
+
+// RX hook: ACK/NACK from the EMF node
+void evidence_on_frame(const uint8_t* mac, const uint8_t* data, int len) {
+  if (data[1] != NOW_MSG_EVIDENCE_ACK || len != (int)sizeof(evidence_ack_msg_t)) return;
+  evidence_ack_msg_t ack;
+  memcpy(&ack, data, sizeof(ack));
+  ev_ack_id      = ack.img_id;
+  ev_ack_done    = ack.done;
+  ev_ack_missing = ack.missing;
+  ev_ack_rx      = true;
+}
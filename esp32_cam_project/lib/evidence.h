@@ -0,0 +1,25 @@
+#ifndef EVIDENCE_H
+#define EVIDENCE_H
+
+#include <Arduino.h>
+#include "img_converters.h"   // esp32-camera fmt2jpg
+#include "config.h"
+#include "esp_now_comm.h"     // From shared library
+
+// =================== EVIDENCE THUMBNAILS ===================
+void init_evidence();
+bool evidence_begin(const uint8_t* gray, int width, int height);
+void evidence_poll();
+bool evidence_busy();                 // thumbnail still being sent
+uint16_t evidence_id();               // last thumbnail number
+void evidence_resume(uint16_t id);
+void evidence_on_frame(const uint8_t* mac, const uint8_t* data, int len);
+
+// =================== GLOBAL VARIABLES ===================
+extern uint32_t evidence_sent;        // thumbnails confirmed by the EMF node
+extern uint32_t evidence_failed;      // thumbnails given up after EVIDENCE_MAX_ROUNDS
+extern uint32_t evidence_bytes;       // JPEG bytes of delivered thumbnails
+extern uint32_t evidence_frames;      // fragments put on air, incl. resends
+extern uint32_t evidence_airtime_us;  // on-air time of those fragments
+
+#endif // EVIDENCE_H
@@ -0,0 +1,122 @@
+#include "fast_resume.h"
+#include "esp_camera.h"   // FRAMESIZE_* in config.h
+
+#define RESUME_MAGIC  0x43524553u   // "SERC"
+
+// =================== RTC STATE ===================
+typedef struct {
+  uint32_t magic;
+  uint32_t config_sum;       // camera config + model the state was saved under
+  uint32_t sleep_ms;
+  int64_t  rtc_us;           // RTC clock at the save
+  uint8_t  bay;
+  uint8_t  car_present;
+  uint32_t above_age_ms;     // hold timers running at the save, age + 1 (0 = idle)
+  uint32_t below_age_ms;
+  uint16_t evidence_id;
+  now_resume_t link;
+  uint32_t sum;              // over everything above
+} resume_block_t;
+
+RTC_DATA_ATTR static resume_block_t rtc_block;
+RTC_DATA_ATTR uint32_t resume_warm_boots = 0;
+RTC_DATA_ATTR uint32_t resume_cold_boots = 0;
+RTC_DATA_ATTR uint32_t resume_warm_ready_ms = 0;
+RTC_DATA_ATTR uint32_t resume_cold_ready_ms = 0;
+
+bool resume_warm = false;
+static resume_block_t resume;     // validated copy for this boot
+
+// =================== CHECKSUMS ===================
+static uint32_t fnv1a(const void* data, size_t len, uint32_t h = 2166136261u) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (size_t i = 0; i < len; i++) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+// Anything that changes what the saved state means
+// (what the camera sees and how frames become the fused bay confidence included)
+static uint32_t config_sum() {
+  const float thresh[2] = { CAR_ON_THRESH, CAR_OFF_THRESH };
+  const uint32_t cfg[] = { CAR_ON_HOLD_MS, CAR_OFF_HOLD_MS, NOW_CHANNEL, NOW_CHANNEL_SCAN,
+                           EVIDENCE_BAY_ID, RDV_SLOT_MS, EI_CLASSIFIER_PROJECT_ID,
+                           EI_CLASSIFIER_PROJECT_DEPLOY_VERSION, (uint32_t)sizeof(resume_block_t),
+                           (uint32_t)CAM_FRAMESIZE, (uint32_t)CAM_ROI_SW_FRAMESIZE,
+                           CAM_ROI_X, CAM_ROI_Y, CAM_ROI_W, CAM_ROI_H,
+                           GATE_ENABLE, GATE_MEAN_MIN, GATE_MEAN_MAX, GATE_CLIP_PCT, GATE_MIN_SPREAD,
+                           GATE_MIN_SHARP, GATE_SETTLE_DELTA, GATE_SETTLE_FRAMES, GATE_SETTLE_MAX_MS,
+                           GATE_BAD_FRAMES, OCC_ENABLE, OCC_TAU_MS, OCC_CELL };
+  return fnv1a(cfg, sizeof(cfg), fnv1a(thresh, sizeof(thresh)));
+}
+
+static uint32_t block_sum(const resume_block_t& b) {
+  return fnv1a(&b, offsetof(resume_block_t, sum));
+}
+
+// Hold timer start on this boot's millis() from its age at the save
+static uint32_t since_from_age(uint32_t age_ms, uint32_t asleep_ms) {
+  if (!age_ms) return 0;
+  const uint32_t since = 0u - (age_ms - 1) - asleep_ms;
+  return since ? since : 1;
+}
+
+// =================== PUBLIC INTERFACE ===================
+bool fast_resume_begin() {
+  resume = rtc_block;
+  rtc_block.magic = 0;   // used once
+  resume_warm = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER &&
+                resume.magic == RESUME_MAGIC && resume.sum == block_sum(resume) &&
+                resume.config_sum == config_sum();
+  if (resume_warm) {
+    // Save to this boot's local time 0 (millis() / esp_timer start)
+    resume.link.asleep_us = (int64_t)esp_rtc_get_time_us() - resume.rtc_us - esp_timer_get_time();
+    resume.link.asleep_err_us = (uint32_t)(resume.link.asleep_us * RESUME_RTC_ERR_PPM / 1000000);
+  }
+  return resume_warm;
+}
+
+const now_resume_t* fast_resume_link() {
+  return resume_warm ? &resume.link : nullptr;
+}
+
+void fast_resume_restore() {
+  if (!resume_warm) return;
+  const uint32_t asleep_ms = (uint32_t)(resume.link.asleep_us / 1000);
+  car_present = resume.car_present;
+  car_above_since_ms = since_from_age(resume.above_age_ms, asleep_ms);
+  car_below_since_ms = since_from_age(resume.below_age_ms, asleep_ms);
+  evidence_resume(resume.evidence_id);
+}
+
+void fast_resume_ready() {
+  const uint32_t ready_ms = millis();
+  if (resume_warm) {
+    resume_warm_boots++;
+    resume_warm_ready_ms = ready_ms;
+    Serial.printf("[BOOT] warm: %u ms asleep, bay %u %s, ready in %u ms (cold boot: %u ms)\n",
+                  (unsigned)(resume.link.asleep_us / 1000), (unsigned)resume.bay,
+                  resume.car_present ? "OCCUPIED" : "VACANT", (unsigned)ready_ms,
+                  (unsigned)resume_cold_ready_ms);
+  } else {
+    resume_cold_boots++;
+    resume_cold_ready_ms = ready_ms;
+    Serial.printf("[BOOT] cold: ready in %u ms\n", (unsigned)ready_ms);
+  }
+}
+
+void fast_resume_save(uint32_t sleep_ms) {
+  const uint32_t now = millis();
+  resume_block_t& b = rtc_block;
+  memset(&b, 0, sizeof(b));
+  b.magic        = RESUME_MAGIC;
+  b.config_sum   = config_sum();
+  b.sleep_ms     = sleep_ms;
+  b.bay          = EVIDENCE_BAY_ID;
+  b.car_present  = car_present ? 1 : 0;
+  b.above_age_ms = car_above_since_ms ? now - car_above_since_ms + 1 : 0;
+  b.below_age_ms = car_below_since_ms ? now - car_below_since_ms + 1 : 0;
+  b.evidence_id  = evidence_id();
+  now_resume_save(b.link);
+  b.rtc_us       = (int64_t)esp_rtc_get_time_us();
+  b.sum          = block_sum(b);
+}
@@ -0,0 +1,32 @@
+#ifndef FAST_RESUME_H
+#define FAST_RESUME_H
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <esp32/rtc.h>      // esp_rtc_get_time_us(), keeps counting in deep sleep
+#include <model-parameters/model_metadata.h>
+#include "config.h"
+#include "esp_now_comm.h"   // From shared library
+#include "car_detection.h"
+#include "evidence.h"
+
+// =================== FAST RESUME ===================
+// State kept in RTC slow memory across deep sleep: occupancy of the bay,
+// hold timers, sequence numbers, channel and clock estimate. A timer wake
+// with a valid block (magic, checksum, same camera config and model) is a
+// warm boot: setup() skips the cold-boot delays, the channel search and the
+// first clock sync.
+bool fast_resume_begin();                 // first thing in setup(); true = warm
+const now_resume_t* fast_resume_link();   // for init_now_rx_tx(), nullptr when cold
+void fast_resume_restore();               // after module init: occupancy, timers, ids
+void fast_resume_ready();                 // end of setup(): logs wake-to-ready
+void fast_resume_save(uint32_t sleep_ms); // right before deep sleep
+
+// =================== GLOBAL VARIABLES ===================
+extern bool     resume_warm;              // this boot resumed from RTC state
+extern uint32_t resume_warm_boots;        // kept in RTC memory
+extern uint32_t resume_cold_boots;
+extern uint32_t resume_warm_ready_ms;     // app start to ready, last boot of each kind
+extern uint32_t resume_cold_ready_ms;
+
+#endif // FAST_RESUME_H
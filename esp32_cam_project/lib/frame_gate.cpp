@@ -0,0 +1,169 @@
+#include "frame_gate.h"
+
+// =================== GLOBAL VARIABLES ===================
+bool gate_enabled = (GATE_ENABLE != 0);
+gate_verdict_t gate_last = GATE_OK;
+uint8_t gate_last_mean   = 0;
+uint8_t gate_last_spread = 0;
+uint8_t gate_last_sharp  = 0;
+uint32_t gate_frames         = 0;
+uint32_t gate_rejected       = 0;
+uint32_t gate_first_valid_ms = 0;
+uint32_t gate_bad_scenes     = 0;
+uint32_t gate_us             = 0;
+
+#define GATE_W  EI_CLASSIFIER_INPUT_WIDTH
+#define GATE_H  EI_CLASSIFIER_INPUT_HEIGHT
+#define GATE_EDGE_DIV  4   // a step above spread / 4 counts as an edge
+
+static const char* const verdict_names[GATE_VERDICTS] = {
+  "ok", "settling", "dark", "bright", "flat", "blurred"
+};
+
+// Current session
+static uint32_t gate_start_ms    = 0;
+static bool     gate_settled     = false;
+static uint8_t  gate_stable      = 0;     // consecutive usable frames with a steady mean
+static int      gate_prev_mean   = -1;
+static uint16_t gate_bad_run     = 0;     // consecutive drops since settling
+static bool     gate_bad         = false;
+static uint32_t gate_sess_frames = 0;
+static uint32_t gate_sess_drops  = 0;
+static uint16_t gate_sess_count[GATE_VERDICTS];
+
+// =================== FRAME STATS ===================
+// 64-bin histogram for mean, clipping and percentiles; edge steps on
+// every other row
+static gate_verdict_t frame_verdict(const uint8_t* gray) {
+  uint16_t hist[64] = { 0 };
+  uint32_t sum = 0;
+  for (int i = 0; i < GATE_W * GATE_H; i++) {
+    sum += gray[i];
+    hist[gray[i] >> 2]++;
+  }
+  const int n = GATE_W * GATE_H;
+  const int mean = sum / n;
+
+  // 5th and 95th percentile, in 4-level bins
+  const int tail = n / 20;
+  int lo = 0, hi = 63, acc = 0;
+  while (lo < 63 && (acc += hist[lo]) <= tail) lo++;
+  acc = 0;
+  while (hi > 0 && (acc += hist[hi]) <= tail) hi--;
+  const int spread = max(0, hi - lo) * 4;
+
+  // Sharpness: share of neighbour steps larger than a quarter of the
+  // spread; blur spreads edges over more pixels than that allows
+  const int edge = max(4, spread / GATE_EDGE_DIV);
+  uint32_t edges = 0;
+  for (int y = 0; y < GATE_H - 1; y += 2) {
+    const uint8_t* p = gray + y * GATE_W;
+    for (int x = 0; x < GATE_W - 1; x++) {
+      edges += (abs((int)p[x + 1] - (int)p[x]) > edge) + (abs((int)p[x + GATE_W] - (int)p[x]) > edge);
+    }
+  }
+  const uint32_t steps = (uint32_t)(GATE_H / 2) * (GATE_W - 1) * 2;
+  const int sharp = (int)(edges * 1000 / steps);   // per mille
+
+  gate_last_mean   = (uint8_t)mean;
+  gate_last_spread = (uint8_t)min(255, spread);
+  gate_last_sharp  = (uint8_t)min(255, sharp);
+
+  if (mean < GATE_MEAN_MIN) return GATE_DARK;
+  if (mean > GATE_MEAN_MAX || (uint32_t)hist[63] * 100 >= (uint32_t)n * GATE_CLIP_PCT) return GATE_BRIGHT;
+  if (spread < GATE_MIN_SPREAD) return GATE_FLAT;
+  if (sharp < GATE_MIN_SHARP) return GATE_BLUR;
+  return GATE_OK;
+}
+
+// Most frequent reason for drops this session
+static gate_verdict_t worst_reason() {
+  gate_verdict_t r = GATE_SETTLING;
+  for (int v = GATE_DARK; v < GATE_VERDICTS; v++) {
+    if (gate_sess_count[v] > gate_sess_count[r]) r = (gate_verdict_t)v;
+  }
+  return r;
+}
+
+static void flag_bad_scene(const char* why) {
+  if (gate_bad) return;
+  gate_bad = true;
+  gate_bad_scenes++;
+  Serial.printf("[GATE] scene unusable (%s): %s, mean=%u spread=%u sharp=%u\n", why,
+                verdict_names[worst_reason()], gate_last_mean, gate_last_spread, gate_last_sharp);
+}
+
+// =================== SESSION CONTROL ===================
+void frame_gate_begin() {
+  gate_start_ms    = millis();
+  gate_settled     = false;   // auto exposure restarts with the sensor
+  gate_stable      = 0;
+  gate_prev_mean   = -1;
+  gate_bad_run     = 0;
+  gate_bad         = false;
+  gate_sess_frames = 0;
+  gate_sess_drops  = 0;
+  gate_first_valid_ms = 0;
+  memset(gate_sess_count, 0, sizeof(gate_sess_count));
+}
+
+bool frame_gate_check(const uint8_t* gray) {
+  if (!gate_enabled || !gray) return true;
+  const uint32_t t0 = micros();
+  gate_frames++;
+  gate_sess_frames++;
+
+  gate_verdict_t v = frame_verdict(gray);
+  const int mean = gate_last_mean;
+  if (!gate_settled) {
+    // Settled once the mean holds still on enough usable frames in a row
+    const bool steady = gate_prev_mean >= 0 && abs(mean - gate_prev_mean) <= GATE_SETTLE_DELTA;
+    gate_stable = (v == GATE_OK && steady) ? gate_stable + 1 : 0;
+    if (v == GATE_OK && gate_stable < GATE_SETTLE_FRAMES) v = GATE_SETTLING;
+    gate_settled = (v == GATE_OK);
+    if (!gate_settled && millis() - gate_start_ms >= GATE_SETTLE_MAX_MS) flag_bad_scene("never settled");
+  }
+  gate_prev_mean = mean;
+  gate_last = v;
+  gate_sess_count[v]++;
+
+  const bool pass = (v == GATE_OK);
+  if (pass) {
+    gate_bad_run = 0;
+    if (!gate_first_valid_ms) gate_first_valid_ms = max(1UL, (unsigned long)(millis() - gate_start_ms));
+  } else {
+    gate_rejected++;
+    gate_sess_drops++;
+    if (gate_settled && ++gate_bad_run >= GATE_BAD_FRAMES) flag_bad_scene("stayed bad");
+  }
+  gate_us += micros() - t0;
+  return pass;
+}
+
+bool frame_gate_bad_scene() {
+  return gate_bad;
+}
+
+const char* frame_gate_verdict_name(gate_verdict_t v) {
+  return v < GATE_VERDICTS ? verdict_names[v] : "?";
+}
+
+void frame_gate_end() {
+  if (!gate_enabled) return;
+  if (gate_first_valid_ms) {
+    Serial.printf("[GATE] session: first valid frame after %lu ms, %lu/%lu frames dropped",
+                  (unsigned long)gate_first_valid_ms, (unsigned long)gate_sess_drops,
+                  (unsigned long)gate_sess_frames);
+  } else {
+    Serial.printf("[GATE] session: no valid frame, %lu/%lu frames dropped",
+                  (unsigned long)gate_sess_drops, (unsigned long)gate_sess_frames);
+  }
+  Serial.printf(" (settling %u, dark %u, bright %u, flat %u, blurred %u)\n",
+                gate_sess_count[GATE_SETTLING], gate_sess_count[GATE_DARK], gate_sess_count[GATE_BRIGHT],
+                gate_sess_count[GATE_FLAT], gate_sess_count[GATE_BLUR]);
+  if (gate_frames) {
+    Serial.printf("[GATE] total %lu/%lu frames dropped, %lu unusable sessions, %.3f ms/frame\n",
+                  (unsigned long)gate_rejected, (unsigned long)gate_frames,
+                  (unsigned long)gate_bad_scenes, gate_us / 1000.0f / gate_frames);
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef FRAME_GATE_H
+#define FRAME_GATE_H
+
+#include <Arduino.h>
+#include <model-parameters/model_metadata.h>
+#include "config.h"
+
+// =================== FRAME QUALITY GATE ===================
+// Checks each 96x96 gray frame before inference: mean luminance, histogram
+// spread (5th..95th percentile) and sharpness (share of neighbour pixel
+// steps larger than a quarter of the spread). After camera init every frame is dropped until
+// auto exposure has settled; after that single bad frames are dropped.
+// A scene that never settles or stays bad is flagged as unusable.
+typedef enum {
+  GATE_OK = 0,
+  GATE_SETTLING,      // usable on its own, exposure still moving
+  GATE_DARK,
+  GATE_BRIGHT,
+  GATE_FLAT,          // little contrast (fog, covered lens)
+  GATE_BLUR,          // contrast but no edges (fouled / misted lens)
+  GATE_VERDICTS
+} gate_verdict_t;
+
+void frame_gate_begin();
+bool frame_gate_check(const uint8_t* gray);   // true = run inference on it
+bool frame_gate_bad_scene();                  // flagged this session
+void frame_gate_end();
+const char* frame_gate_verdict_name(gate_verdict_t v);
+
+// =================== GLOBAL VARIABLES ===================
+extern bool gate_enabled;               // false = every frame goes to inference
+extern gate_verdict_t gate_last;        // verdict on the last frame
+extern uint8_t gate_last_mean;          // stats of the last frame
+extern uint8_t gate_last_spread;
+extern uint8_t gate_last_sharp;
+extern uint32_t gate_frames;            // frames checked since boot
+extern uint32_t gate_rejected;          // frames dropped since boot
+extern uint32_t gate_first_valid_ms;    // last session: camera on -> first frame passed (0 = none)
+extern uint32_t gate_bad_scenes;        // sessions flagged unusable since boot
+extern uint32_t gate_us;                // time spent in the gate since boot
+
+#endif // FRAME_GATE_H
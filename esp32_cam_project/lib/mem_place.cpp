@@ -0,0 +1,182 @@
+#include "mem_place.h"
+#include "camera_ei.h"
+#include "mem_telemetry.h"
+#include <esp_heap_caps.h>
+
+// =================== GLOBAL VARIABLES ===================
+mem_buf_stats_t mem_stats[MEM_BUF_COUNT];
+const char* const mem_pool_names[MEM_POOL_COUNT] = { "internal", "psram" };
+const char* const mem_buf_names[MEM_BUF_COUNT] = { "arena", "EI heap", "EI input", "frame" };
+
+static const uint32_t pool_caps[MEM_POOL_COUNT] = {
+  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+  MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+};
+
+// Live allocations, so a free knows its size and pool. The arena, the input
+// and a handful of EI matrices per inference are all there ever is at once.
+#define MEM_TRACK_SLOTS 32
+typedef struct {
+  void* p;
+  uint32_t bytes;
+  uint8_t buf;
+  uint8_t pool;
+  uint8_t sys;          // memt_sys_t counted to, MEMT_NONE = none
+} mem_track_t;
+static mem_track_t mem_track[MEM_TRACK_SLOTS];
+static bool mem_track_full_warned = false;
+
+// =================== POLICY ===================
+// Counters are not cleared: the EI SDK allocates from static constructors,
+// before setup(), and those buffers are freed through the same table.
+void init_mem_place() {
+  mem_stats[MEM_BUF_ARENA].pool    = (mem_pool_t)MEM_PLACE_ARENA;
+  mem_stats[MEM_BUF_EI_HEAP].pool  = (mem_pool_t)MEM_PLACE_EI_HEAP;
+  mem_stats[MEM_BUF_EI_INPUT].pool = (mem_pool_t)MEM_PLACE_EI_INPUT;
+  mem_stats[MEM_BUF_FRAME].pool    = (mem_pool_t)MEM_PLACE_FRAME;
+}
+
+void mem_place_set(mem_buf_t buf, mem_pool_t pool) {
+  mem_stats[buf].pool = pool;
+}
+
+// =================== ALLOCATION ===================
+static void account(mem_buf_t buf, mem_pool_t pool, int32_t bytes) {
+  mem_buf_stats_t& s = mem_stats[buf];
+  s.live[pool] += bytes;
+  s.peak = max(s.peak, s.live[MEM_POOL_INTERNAL] + s.live[MEM_POOL_PSRAM]);
+}
+
+void* mem_place_alloc(mem_buf_t buf, size_t bytes, size_t align, bool zero) {
+  if (!bytes) bytes = 1;
+  mem_buf_stats_t& s = mem_stats[buf];
+  const mem_pool_t want = s.pool;
+  mem_pool_t pool = want;
+  void* p = heap_caps_aligned_alloc(align, bytes, pool_caps[pool]);
+  if (!p) {
+    pool = want == MEM_POOL_INTERNAL ? MEM_POOL_PSRAM : MEM_POOL_INTERNAL;
+    p = heap_caps_aligned_alloc(align, bytes, pool_caps[pool]);
+    if (!p) {
+      s.failures++;
+      return nullptr;
+    }
+    s.fallbacks++;
+  }
+  if (zero) memset(p, 0, bytes);
+  s.allocs++;
+
+  // EI heap buffers count to the impulse stage that allocated them
+  const memt_sys_t sys = buf == MEM_BUF_ARENA ? MEMT_NN : buf == MEM_BUF_EI_HEAP ? memt_stage : MEMT_NONE;
+  for (int i = 0; i < MEM_TRACK_SLOTS; i++) {
+    if (!mem_track[i].p) {
+      mem_track[i] = { p, (uint32_t)bytes, (uint8_t)buf, (uint8_t)pool, (uint8_t)sys };
+      account(buf, pool, (int32_t)bytes);
+      memt_account(sys, (int32_t)bytes);
+      return p;
+    }
+  }
+  // Cannot be taken back on free: counted apart, once
+  s.untracked += (uint32_t)bytes;
+  if (!mem_track_full_warned) {
+    Serial.println("[MEM] tracking table full; later buffers count as untracked");
+    mem_track_full_warned = true;
+  }
+  return p;
+}
+
+void mem_place_free(void* p) {
+  if (!p) return;
+  for (int i = 0; i < MEM_TRACK_SLOTS; i++) {
+    if (mem_track[i].p == p) {
+      account((mem_buf_t)mem_track[i].buf, (mem_pool_t)mem_track[i].pool, -(int32_t)mem_track[i].bytes);
+      memt_account((memt_sys_t)mem_track[i].sys, -(int32_t)mem_track[i].bytes);
+      mem_track[i].p = nullptr;
+      break;
+    }
+  }
+  heap_caps_free(p);
+}
+
+void mem_place_note(mem_buf_t buf, size_t bytes, mem_pool_t pool) {
+  mem_buf_stats_t& s = mem_stats[buf];
+  s.live[0] = s.live[1] = 0;
+  s.live[pool] = bytes;
+  s.peak = max(s.peak, (uint32_t)bytes);
+}
+
+void* mem_place_arena_alloc(size_t align, size_t bytes) {
+  return mem_place_alloc(MEM_BUF_ARENA, bytes, max(align, (size_t)4));
+}
+
+void mem_place_arena_free(void* p) {
+  mem_place_free(p);
+}
+
+// =================== REPORT ===================
+void mem_place_report() {
+  Serial.println("[MEM] pool          free   largest  min free");
+  for (int pool = 0; pool < MEM_POOL_COUNT; pool++) {
+    Serial.printf("[MEM] %-9s %9u %9u %9u\n", mem_pool_names[pool],
+                  (unsigned)heap_caps_get_free_size(pool_caps[pool]),
+                  (unsigned)heap_caps_get_largest_free_block(pool_caps[pool]),
+                  (unsigned)heap_caps_get_minimum_free_size(pool_caps[pool]));
+  }
+  Serial.println("[MEM] buffer    policy     internal     psram      peak  allocs  fallbacks  failed  untracked");
+  for (int buf = 0; buf < MEM_BUF_COUNT; buf++) {
+    const mem_buf_stats_t& s = mem_stats[buf];
+    Serial.printf("[MEM] %-9s %-9s %9u %9u %9u %7u %10u %7u %10u\n", mem_buf_names[buf], mem_pool_names[s.pool],
+                  (unsigned)s.live[MEM_POOL_INTERNAL], (unsigned)s.live[MEM_POOL_PSRAM], (unsigned)s.peak,
+                  (unsigned)s.allocs, (unsigned)s.fallbacks, (unsigned)s.failures, (unsigned)s.untracked);
+  }
+}
+
+// =================== BENCHMARK ===================
+// Move ei_input_gray to the input policy's pool
+static void place_input() {
+  const size_t sz = (size_t)EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
+  uint8_t* p = (uint8_t*)mem_place_alloc(MEM_BUF_EI_INPUT, sz, 4, false);
+  if (!p) return;
+  if (ei_input_gray) memcpy(p, ei_input_gray, sz);
+  mem_place_free(ei_input_gray);
+  ei_input_gray = p;
+}
+
+void mem_place_bench(int runs, const mem_bench_ops_t& ops) {
+  const mem_buf_t bufs[3] = { MEM_BUF_ARENA, MEM_BUF_EI_HEAP, MEM_BUF_EI_INPUT };
+  mem_pool_t saved[3];
+  for (int i = 0; i < 3; i++) saved[i] = mem_stats[bufs[i]].pool;
+
+  Serial.printf("[MEM] bench: %d inferences per placement (policy -> where it landed)\n", runs);
+  Serial.println("[MEM]   arena               EI heap             input                ms/inf");
+  for (int combo = 0; combo < 8; combo++) {
+    ops.close();
+    uint32_t fallbacks[3];
+    for (int i = 0; i < 3; i++) {
+      mem_place_set(bufs[i], (combo >> (2 - i)) & 1 ? MEM_POOL_PSRAM : MEM_POOL_INTERNAL);
+      fallbacks[i] = mem_stats[bufs[i]].fallbacks;
+    }
+    place_input();
+    if (!ops.open() || !ops.infer()) {   // first inference outside the timing
+      Serial.printf("[MEM]   %-19s %-19s %-19s  failed\n", mem_pool_names[mem_stats[MEM_BUF_ARENA].pool],
+                    mem_pool_names[mem_stats[MEM_BUF_EI_HEAP].pool], mem_pool_names[mem_stats[MEM_BUF_EI_INPUT].pool]);
+      continue;
+    }
+    const uint32_t t0 = micros();
+    int done = 0;
+    while (done < runs && ops.infer()) done++;
+    const float ms = done ? (micros() - t0) / 1000.0f / done : 0.0f;
+
+    char cols[3][24];
+    for (int i = 0; i < 3; i++) {
+      const mem_pool_t want = mem_stats[bufs[i]].pool;
+      const bool moved = mem_stats[bufs[i]].fallbacks != fallbacks[i];
+      snprintf(cols[i], sizeof(cols[i]), moved ? "%s -> %s" : "%s", mem_pool_names[want],
+               mem_pool_names[want == MEM_POOL_INTERNAL ? MEM_POOL_PSRAM : MEM_POOL_INTERNAL]);
+    }
+    Serial.printf("[MEM]   %-19s %-19s %-19s %7.2f\n", cols[0], cols[1], cols[2], ms);
+  }
+
+  ops.close();
+  for (int i = 0; i < 3; i++) mem_place_set(bufs[i], saved[i]);
+  place_input();
+}
@@ -0,0 +1,65 @@
+#ifndef MEM_PLACE_H
+#define MEM_PLACE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// =================== MEMORY PLACEMENT ===================
+// Named pools and a placement policy per buffer class. Internal SRAM is fast
+// but scarce once WiFi is up; PSRAM is large but several times slower to
+// read. A buffer that does not fit its pool goes to the other one, and the
+// report says so.
+typedef enum {
+  MEM_POOL_INTERNAL = 0,   // internal SRAM (DRAM)
+  MEM_POOL_PSRAM,          // external SPI RAM
+  MEM_POOL_COUNT
+} mem_pool_t;
+
+typedef enum {
+  MEM_BUF_ARENA = 0,       // EI tensor arena: activations, read and written by every node
+  MEM_BUF_EI_HEAP,         // EI heap: feature and result matrices, per inference
+  MEM_BUF_EI_INPUT,        // 96x96 gray input (ei_input_gray)
+  MEM_BUF_FRAME,           // camera frame buffers (esp32-camera allocates them)
+  MEM_BUF_COUNT
+} mem_buf_t;
+
+typedef struct {
+  mem_pool_t pool;                 // policy
+  uint32_t live[MEM_POOL_COUNT];   // bytes held now, per pool
+  uint32_t peak;                   // most bytes held at once
+  uint32_t allocs;
+  uint32_t fallbacks;              // allocations the other pool took
+  uint32_t failures;               // allocations neither pool could take
+  uint32_t untracked;              // bytes allocated with the tracking table full (not in live / peak)
+} mem_buf_stats_t;
+
+void init_mem_place();
+void mem_place_set(mem_buf_t buf, mem_pool_t pool);
+// Zeroed unless zero = false; nullptr if neither pool has room. A 0-byte
+// request gets 1 byte, so nullptr always means failure.
+void* mem_place_alloc(mem_buf_t buf, size_t bytes, size_t align = 4, bool zero = true);
+// Any pointer from mem_place_alloc(); its class and pool are looked up
+void mem_place_free(void* p);
+// Buffers other code allocates (frame buffers), for the report
+void mem_place_note(mem_buf_t buf, size_t bytes, mem_pool_t pool);
+void mem_place_report();
+
+// Tensor arena allocator for run_classifier_set_arena_allocator()
+void* mem_place_arena_alloc(size_t align, size_t bytes);
+void mem_place_arena_free(void* p);
+
+// Boot benchmark: inference time for every arena / EI heap / input placement.
+// open() makes the model resident, infer() runs it once on ei_input_gray.
+typedef struct {
+  bool (*open)();
+  void (*close)();
+  bool (*infer)();
+} mem_bench_ops_t;
+void mem_place_bench(int runs, const mem_bench_ops_t& ops);
+
+// =================== GLOBAL VARIABLES ===================
+extern mem_buf_stats_t mem_stats[MEM_BUF_COUNT];
+extern const char* const mem_pool_names[MEM_POOL_COUNT];
+extern const char* const mem_buf_names[MEM_BUF_COUNT];
+
+#endif // MEM_PLACE_H
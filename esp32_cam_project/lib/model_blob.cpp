@@ -0,0 +1,262 @@
+#include "model_blob.h"
+#include <tflite-model/tflite_learn_3_compiled.h>
+
+static_assert(sizeof(model_blob_header_t) == 76, "model_blob_header_t layout");
+static_assert(sizeof(model_blob_tensor_t) == 36, "model_blob_tensor_t layout");
+static_assert(sizeof(model_blob_node_t) == 16, "model_blob_node_t layout");
+
+// =================== GLOBAL VARIABLES ===================
+model_slot_t model_bound      = MODEL_SLOT_BUILTIN;
+uint32_t     model_switch_us  = 0;
+uint32_t     model_install_us = 0;
+const char* const model_slot_names[] = { "A", "B", "builtin", "auto" };
+
+typedef struct {
+  const esp_partition_t* part;
+  const uint8_t* map;                 // whole partition, read in place
+  spi_flash_mmap_handle_t handle;
+  const char* why;                    // nullptr = holds a valid blob
+} blob_slot_t;
+
+static blob_slot_t slots[2] = { { nullptr, nullptr, 0, "no partition" }, { nullptr, nullptr, 0, "no partition" } };
+static const char* const slot_labels[2] = { MODEL_BLOB_LABEL_A, MODEL_BLOB_LABEL_B };
+static model_session_ops_t session = { nullptr, nullptr };
+static tflite_learn_3_tensor_bind binds[MODEL_BLOB_MAX_TENSORS];
+
+// =================== FORMAT ===================
+uint32_t model_blob_crc32(const void* data, size_t len, uint32_t crc) {
+  static const uint32_t nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc = nibble[(crc ^ p[i]) & 0xF] ^ (crc >> 4);
+    crc = nibble[(crc ^ (p[i] >> 4)) & 0xF] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+// An array header (int count) at off, and its count elements of 4 bytes
+static bool array_fits(const uint8_t* blob, uint32_t total, uint32_t off) {
+  if (off % 4 || (uint64_t)off + 4 > total) return false;
+  int32_t n;
+  memcpy(&n, blob + off, 4);
+  return n > 0 && (uint64_t)off + 4 + 4ull * n <= total;
+}
+
+const char* model_blob_check(const uint8_t* blob, size_t len) {
+  model_blob_header_t h;
+  if (len < sizeof(h)) return "too short";
+  memcpy(&h, blob, sizeof(h));
+  if (h.magic != MODEL_BLOB_MAGIC) return "empty";
+  if (h.version != MODEL_BLOB_VERSION || h.header_bytes != sizeof(h)) return "unknown version";
+  if (model_blob_crc32(&h, offsetof(model_blob_header_t, header_crc)) != h.header_crc) return "header checksum";
+  if (h.total_bytes > len || h.total_bytes < h.header_bytes) return "truncated";
+  if (model_blob_crc32(blob + h.header_bytes, h.total_bytes - h.header_bytes) != h.payload_crc) {
+    return "payload checksum";
+  }
+  if (h.graph_hash != tflite_learn_3_graph_hash()) return "made for another graph";
+  if (h.tensors > MODEL_BLOB_MAX_TENSORS || h.tensor_table % 16 ||
+      (uint64_t)h.tensor_table + (uint64_t)h.tensors * sizeof(model_blob_tensor_t) > h.total_bytes) {
+    return "bad tensor table";
+  }
+  const model_blob_tensor_t* t = (const model_blob_tensor_t*)(blob + h.tensor_table);
+  for (int i = 0; i < h.tensors; i++) {
+    if (!t[i].in_arena && t[i].bytes &&
+        (t[i].data % 16 || (uint64_t)t[i].data + t[i].bytes > h.total_bytes)) {
+      return "bad tensor data";
+    }
+    if (t[i].scale && (!array_fits(blob, h.total_bytes, t[i].scale) ||
+                       !array_fits(blob, h.total_bytes, t[i].zero_point))) {
+      return "bad quantization";
+    }
+  }
+  return nullptr;
+}
+
+// =================== BINDING ===================
+static const model_blob_header_t* slot_header(int s) {
+  return slots[s].why ? nullptr : (const model_blob_header_t*)slots[s].map;
+}
+
+static void check_slot(int s) {
+  if (slots[s].map) slots[s].why = model_blob_check(slots[s].map, slots[s].part->size);
+}
+
+static bool bind_slot(model_slot_t slot) {
+  if (slot == MODEL_SLOT_BUILTIN) return tflite_learn_3_bind(nullptr, 0) == kTfLiteOk;
+  const model_blob_header_t* h = slot_header(slot);
+  if (!h) return false;
+  const uint8_t* blob = slots[slot].map;
+  const model_blob_tensor_t* t = (const model_blob_tensor_t*)(blob + h->tensor_table);
+  for (int i = 0; i < h->tensors; i++) {
+    tflite_learn_3_tensor_bind& b = binds[i];
+    b = {};
+    if (!t[i].in_arena && t[i].bytes) {
+      b.data = blob + t[i].data;
+      b.bytes = t[i].bytes;
+    }
+    if (t[i].scale) {
+      b.scale = (const TfLiteFloatArray*)(blob + t[i].scale);
+      b.zero_point = (const TfLiteIntArray*)(blob + t[i].zero_point);
+      b.quantized_dimension = t[i].quant_dim;
+    }
+  }
+  return tflite_learn_3_bind(binds, h->tensors) == kTfLiteOk;
+}
+
+// MODEL_SLOT_AUTO: the valid slot with the higher install sequence
+static model_slot_t resolve(model_slot_t slot) {
+  if (slot != MODEL_SLOT_AUTO) return slot;
+  const model_blob_header_t* a = slot_header(MODEL_SLOT_A);
+  const model_blob_header_t* b = slot_header(MODEL_SLOT_B);
+  if (a && (!b || a->seq > b->seq)) return MODEL_SLOT_A;
+  return b ? MODEL_SLOT_B : MODEL_SLOT_BUILTIN;
+}
+
+// =================== PUBLIC INTERFACE ===================
+bool init_model_blob(const model_session_ops_t& ops) {
+  session = ops;
+  for (int s = 0; s < 2; s++) {
+    slots[s].part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)MODEL_BLOB_SUBTYPE,
+                                             slot_labels[s]);
+    if (!slots[s].part) continue;
+    const void* map = nullptr;
+    if (esp_partition_mmap(slots[s].part, 0, slots[s].part->size, SPI_FLASH_MMAP_DATA, &map,
+                           &slots[s].handle) != ESP_OK) {
+      slots[s].why = "map failed";
+      continue;
+    }
+    slots[s].map = (const uint8_t*)map;
+    check_slot(s);
+  }
+
+  const model_slot_t want = resolve((model_slot_t)MODEL_BLOB_SLOT);
+  const uint32_t t0 = micros();
+  const bool ok = bind_slot(want);
+  model_bound = ok ? want : MODEL_SLOT_BUILTIN;
+  if (!ok) {
+    Serial.printf("[MODEL] slot %s: %s; builtin weights\n", model_slot_names[want],
+                  want < MODEL_SLOT_BUILTIN && slots[want].why ? slots[want].why : "bind failed");
+    bind_slot(MODEL_SLOT_BUILTIN);
+  }
+  model_switch_us = micros() - t0;
+  model_blob_report();
+  return ok;
+}
+
+bool model_blob_select(model_slot_t slot) {
+  const uint32_t t0 = micros();
+  const model_slot_t want = resolve(slot);
+  if (want != MODEL_SLOT_BUILTIN) {
+    check_slot(want);   // the flash may have changed since boot
+    if (slots[want].why) {
+      Serial.printf("[MODEL] slot %s: %s; staying on %s\n", model_slot_names[want], slots[want].why,
+                    model_slot_names[model_bound]);
+      return false;
+    }
+  }
+  if (session.close) session.close();
+  const bool ok = bind_slot(want) && (!session.open || session.open());
+  if (!ok) {
+    if (session.close) session.close();
+    bind_slot(model_bound);
+    if (session.open) session.open();
+    Serial.printf("[MODEL] switch to %s failed; staying on %s\n", model_slot_names[want],
+                  model_slot_names[model_bound]);
+    return false;
+  }
+  model_bound = want;
+  model_switch_us = micros() - t0;
+  Serial.printf("[MODEL] now on %s (%.1f ms: check, bind, model init)\n", model_slot_names[model_bound],
+                model_switch_us / 1000.0f);
+  return true;
+}
+
+int model_blob_install(const uint8_t* blob, size_t len) {
+  const char* why = model_blob_check(blob, len);
+  if (why) {
+    Serial.printf("[MODEL] install refused: %s\n", why);
+    return -1;
+  }
+  // Never the slot in use; otherwise the empty or older one
+  const model_blob_header_t* a = slot_header(MODEL_SLOT_A);
+  const model_blob_header_t* b = slot_header(MODEL_SLOT_B);
+  int s;
+  if (model_bound == MODEL_SLOT_A || model_bound == MODEL_SLOT_B) {
+    s = model_bound == MODEL_SLOT_A ? MODEL_SLOT_B : MODEL_SLOT_A;
+  } else {
+    s = (!a || (b && a->seq < b->seq)) ? MODEL_SLOT_A : MODEL_SLOT_B;
+  }
+  blob_slot_t& slot = slots[s];
+  model_blob_header_t h;
+  memcpy(&h, blob, sizeof(h));
+  if (!slot.part || h.total_bytes > slot.part->size) {
+    Serial.printf("[MODEL] install refused: slot %s %s\n", model_slot_names[s],
+                  slot.part ? "too small" : "missing");
+    return -1;
+  }
+  h.seq = max(a ? a->seq : 0u, b ? b->seq : 0u) + 1;
+  h.header_crc = model_blob_crc32(&h, offsetof(model_blob_header_t, header_crc));
+
+  // Payload, then the header that makes it valid
+  const uint32_t t0 = micros();
+  if (slot.map) spi_flash_munmap(slot.handle);
+  slot.map = nullptr;
+  slot.why = "install cut short";
+  const size_t erase = (h.total_bytes + MODEL_BLOB_SECTOR - 1) / MODEL_BLOB_SECTOR * MODEL_BLOB_SECTOR;
+  bool ok = esp_partition_erase_range(slot.part, 0, erase) == ESP_OK &&
+            esp_partition_write(slot.part, h.header_bytes, blob + h.header_bytes,
+                                h.total_bytes - h.header_bytes) == ESP_OK &&
+            esp_partition_write(slot.part, 0, &h, sizeof(h)) == ESP_OK;
+  const void* map = nullptr;
+  if (esp_partition_mmap(slot.part, 0, slot.part->size, SPI_FLASH_MMAP_DATA, &map, &slot.handle) == ESP_OK) {
+    slot.map = (const uint8_t*)map;
+    check_slot(s);
+  }
+  ok = ok && !slot.why;
+  model_install_us = micros() - t0;
+  if (!ok) {
+    Serial.printf("[MODEL] install to slot %s failed: %s\n", model_slot_names[s], slot.why ? slot.why : "write");
+    return -1;
+  }
+  Serial.printf("[MODEL] installed '%.*s' in slot %s: %u B, seq %u, %u ms\n", (int)sizeof(h.name), h.name,
+                model_slot_names[s], (unsigned)h.total_bytes, (unsigned)h.seq,
+                (unsigned)(model_install_us / 1000));
+  return s;
+}
+
+void model_blob_report() {
+  for (int s = 0; s < 2; s++) {
+    const model_blob_header_t* h = slot_header(s);
+    if (!h) {
+      Serial.printf("[MODEL] slot %s: %s\n", model_slot_names[s], slots[s].why);
+      continue;
+    }
+    Serial.printf("[MODEL] slot %s: '%.*s' seq %u, %u B%s\n", model_slot_names[s], (int)sizeof(h->name), h->name,
+                  (unsigned)h->seq, (unsigned)h->total_bytes, model_bound == s ? ", in use" : "");
+  }
+  Serial.printf("[MODEL] weights: %s (bound in %.1f ms)\n", model_slot_names[model_bound], model_switch_us / 1000.0f);
+}
+
+bool model_blob_command(const char* line) {
+  if (strncmp(line, "model", 5) || (line[5] && line[5] != ' ')) return false;
+  const char* arg = line + 5;
+  while (*arg == ' ') arg++;
+  if (!*arg || !strcmp(arg, "list")) {
+    model_blob_report();
+  } else if (!strcmp(arg, "a")) {
+    model_blob_select(MODEL_SLOT_A);
+  } else if (!strcmp(arg, "b")) {
+    model_blob_select(MODEL_SLOT_B);
+  } else if (!strcmp(arg, "builtin")) {
+    model_blob_select(MODEL_SLOT_BUILTIN);
+  } else if (!strcmp(arg, "auto")) {
+    model_blob_select(MODEL_SLOT_AUTO);
+  } else {
+    Serial.println("[MODEL] usage: model a|b|builtin|auto|list");
+  }
+  return true;
+}
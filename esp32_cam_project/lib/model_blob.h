@@ -0,0 +1,100 @@
+#ifndef MODEL_BLOB_H
+#define MODEL_BLOB_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "config.h"
+
+// =================== MODEL BLOB ===================
+// Weights and quantization of the EON model in a data partition, read in
+// place through a flash mapping. Two slots (model_a / model_b): a new blob
+// goes to the slot not in use, payload first and header last, so a cut write
+// leaves a slot whose header does not check and the other slot stays good.
+// The graph code (ops, op parameters, wiring, arena plan) is in the firmware;
+// a blob binds only to the graph its hash was made from.
+//
+// Layout, little endian, offsets from the start of the blob:
+//   header                 model_blob_header_t
+//   tensor table           model_blob_tensor_t[tensors], 16-aligned
+//   node table             model_blob_node_t[nodes]
+//   data                   constants (16-aligned), then scale / zero-point
+//                          arrays as TfLiteFloatArray / TfLiteIntArray
+#define MODEL_BLOB_MAGIC       0x424D4945u   // "EIMB"
+#define MODEL_BLOB_VERSION     1
+#define MODEL_BLOB_MAX_TENSORS 96
+#define MODEL_BLOB_NODE_IO     6             // inputs + outputs per node
+#define MODEL_BLOB_SECTOR      4096          // flash erase unit
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_bytes;   // sizeof(model_blob_header_t)
+  uint32_t seq;            // install order; the higher valid slot is newer
+  uint32_t total_bytes;    // header + payload
+  uint32_t payload_crc;    // CRC-32 of bytes [header_bytes, total_bytes)
+  uint32_t graph_hash;     // tflite_learn_3_graph_hash() it was made for
+  uint32_t arena_bytes;    // arena plan size
+  uint16_t tensors;
+  uint16_t nodes;
+  uint32_t tensor_table;
+  uint32_t node_table;
+  char     name[32];
+  uint32_t header_crc;     // CRC-32 of everything above
+} model_blob_header_t;
+
+typedef struct {
+  uint8_t  type;           // TfLiteType
+  uint8_t  in_arena;       // 1: activation at arena offset data; 0: constant at blob offset data
+  uint8_t  rank;
+  uint8_t  quant_dim;
+  int32_t  shape[4];
+  uint32_t data;
+  uint32_t bytes;
+  uint32_t scale;          // blob offset of a TfLiteFloatArray, 0 = not quantized
+  uint32_t zero_point;     // blob offset of a TfLiteIntArray
+} model_blob_tensor_t;
+
+typedef struct {
+  uint16_t op;             // tflite::BuiltinOperator
+  uint8_t  inputs;
+  uint8_t  outputs;
+  int16_t  io[MODEL_BLOB_NODE_IO];   // input tensor indices, then output
+} model_blob_node_t;
+
+typedef enum {
+  MODEL_SLOT_A = 0,
+  MODEL_SLOT_B,
+  MODEL_SLOT_BUILTIN,      // the arrays compiled into the firmware
+  MODEL_SLOT_AUTO,         // newest valid slot, else builtin
+} model_slot_t;
+
+// Model init and release around a switch (the EI persistent session)
+typedef struct {
+  bool (*open)();
+  void (*close)();
+} model_session_ops_t;
+
+uint32_t model_blob_crc32(const void* data, size_t len, uint32_t crc = 0);
+// nullptr if blob is a complete, intact blob for the compiled graph, else why not
+const char* model_blob_check(const uint8_t* blob, size_t len);
+
+// Finds and maps both slots, checks them and binds MODEL_BLOB_SLOT. No model
+// is initialized here; the session opens with the bound weights.
+bool init_model_blob(const model_session_ops_t& ops);
+// Close the session, bind, open it again (the new weights must init); on
+// failure the previous binding is restored. Leaves the session open.
+bool model_blob_select(model_slot_t slot);
+// Writes blob to the slot not in use; returns that slot, or -1. The running
+// model is untouched: model_blob_select() switches to it.
+int model_blob_install(const uint8_t* blob, size_t len);
+void model_blob_report();
+// "model a|b|builtin|auto|list" (serial console); false if not a model command
+bool model_blob_command(const char* line);
+
+// =================== GLOBAL VARIABLES ===================
+extern model_slot_t model_bound;          // weights in use (never MODEL_SLOT_AUTO)
+extern uint32_t     model_switch_us;      // last select: close, check, bind, open
+extern uint32_t     model_install_us;     // last install: erase, write, check
+extern const char* const model_slot_names[];
+
+#endif // MODEL_BLOB_H
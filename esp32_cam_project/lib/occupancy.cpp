@@ -0,0 +1,89 @@
+#include "occupancy.h"
+#include <math.h>
+
+// =================== GLOBAL VARIABLES ===================
+bool occupancy_enabled = (OCC_ENABLE != 0);
+uint32_t occupancy_tau_ms = OCC_TAU_MS;
+float occupancy_conf = 0.f;
+float occupancy_raw = 0.f;
+uint32_t occupancy_frames = 0;
+uint32_t occupancy_smoothed = 0;
+
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+#define OCC_GW  (EI_CLASSIFIER_INPUT_WIDTH / OCC_CELL)
+#define OCC_GH  (EI_CLASSIFIER_INPUT_HEIGHT / OCC_CELL)
+#else
+#define OCC_GW  1                    // classification: the whole frame is one cell
+#define OCC_GH  1
+#endif
+
+static float occ_grid[OCC_GW * OCC_GH];
+static float occ_obs[OCC_GW * OCC_GH];
+static bool occ_seeded = false;      // first frame of a session sets the grid
+static uint32_t occ_last_ms = 0;
+
+// Current session
+static uint32_t occ_sess_frames = 0;
+static uint32_t occ_sess_smoothed = 0;
+
+// =================== FUSION ===================
+// This frame's evidence per cell
+static void observe(const ei_impulse_result_t& result) {
+  memset(occ_obs, 0, sizeof(occ_obs));
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+  for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+    const auto& bb = result.bounding_boxes[i];
+    if (bb.value == 0 || strcmp(bb.label, "car") != 0) continue;
+    const int x0 = max(0, (int)(bb.x / OCC_CELL) - 1);
+    const int y0 = max(0, (int)(bb.y / OCC_CELL) - 1);
+    const int x1 = min(OCC_GW - 1, (int)((bb.x + max(bb.width, 1u) - 1) / OCC_CELL) + 1);
+    const int y1 = min(OCC_GH - 1, (int)((bb.y + max(bb.height, 1u) - 1) / OCC_CELL) + 1);
+    for (int cy = y0; cy <= y1; cy++) {
+      for (int cx = x0; cx <= x1; cx++) {
+        float& o = occ_obs[cy * OCC_GW + cx];
+        o = max(o, bb.value);
+      }
+    }
+  }
+#else
+  occ_obs[0] = occupancy_raw;
+#endif
+}
+
+void occupancy_begin() {
+  occ_seeded = false;   // nothing carries over from before the camera was off
+  memset(occ_grid, 0, sizeof(occ_grid));
+  occ_sess_frames = 0;
+  occ_sess_smoothed = 0;
+}
+
+float occupancy_update(const ei_impulse_result_t& result) {
+  occupancy_raw = extract_car_confidence(result);
+  if (!occupancy_enabled) return occupancy_conf = occupancy_raw;
+
+  const uint32_t now_ms = millis();
+  observe(result);
+  // Share of the new evidence: 1 - e^(-dt/tau)
+  const float alpha = occ_seeded ? 1.f - expf(-(float)(now_ms - occ_last_ms) / (float)max(occupancy_tau_ms, 1u)) : 1.f;
+  float best = 0.f;
+  for (int i = 0; i < OCC_GW * OCC_GH; i++) {
+    occ_grid[i] += alpha * (occ_obs[i] - occ_grid[i]);
+    best = max(best, occ_grid[i]);
+  }
+  occ_seeded = true;
+  occ_last_ms = now_ms;
+
+  occupancy_frames++;
+  occ_sess_frames++;
+  if ((occupancy_raw >= CAR_ON_THRESH) != (best >= CAR_ON_THRESH)) {
+    occupancy_smoothed++;
+    occ_sess_smoothed++;
+  }
+  return occupancy_conf = best;
+}
+
+void occupancy_end() {
+  if (!occupancy_enabled) return;
+  Serial.printf("[OCC] session: %lu/%lu frames on the other side of %.2f than their raw confidence\n",
+                (unsigned long)occ_sess_smoothed, (unsigned long)occ_sess_frames, CAR_ON_THRESH);
+}
@@ -0,0 +1,30 @@
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <Arduino.h>
+#include <model-parameters/model_metadata.h>
+#include <edge-impulse-sdk/classifier/ei_classifier_types.h>
+#include "config.h"
+#include "car_detection.h"
+
+// =================== OCCUPANCY GRID ===================
+// Car evidence per FOMO output cell, each an exponential moving average over
+// frames with time constant OCC_TAU_MS (by the clock, so skipped and dropped
+// frames count as elapsed time). A frame's evidence in a cell is the best
+// "car" box on it or on a neighbouring cell, so a box that shifts by one cell
+// keeps feeding the same cells. The bay confidence handed to the hold timers
+// is the highest cell: a missed frame lowers it by a fraction instead of
+// zeroing it, and a spurious box only nudges it.
+void occupancy_begin();
+float occupancy_update(const ei_impulse_result_t& result);   // bay confidence
+void occupancy_end();
+
+// =================== GLOBAL VARIABLES ===================
+extern bool occupancy_enabled;        // false = each frame's best box as is
+extern uint32_t occupancy_tau_ms;
+extern float occupancy_conf;          // last bay confidence
+extern float occupancy_raw;           // last frame's extract_car_confidence()
+extern uint32_t occupancy_frames;     // frames fused since boot
+extern uint32_t occupancy_smoothed;   // frames where the fused side of CAR_ON_THRESH differed from the raw one
+
+#endif // OCCUPANCY_H
@@ -95,6 +95,16 @@
     #define ESP_NN                                  1
 #endif
 
+// SSE4.1 / AVX2 int8 kernels in front of the reference kernels on x86 hosts,
+// picked at runtime from CPUID (kernels/x86_int8.h)
+#ifndef EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD    1
+#else
+    #define EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD    0
+#endif
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD
+
 // no include checks in the compiler? then just include metadata and then ops_define (optional if on EON model)
 #ifndef __has_include
     #include "model-parameters/model_metadata.h"
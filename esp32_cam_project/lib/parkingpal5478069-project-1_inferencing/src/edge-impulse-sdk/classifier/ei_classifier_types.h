@@ -329,6 +329,34 @@ typedef struct {
 #endif
 } ei_impulse_result_t;
 
+/**
+ * Stage an inference is entering, reported through
+ * `run_classifier_set_stage_hook()` (e.g. to attribute heap use)
+ */
+typedef enum {
+    EI_IMPULSE_STAGE_DSP = 0,            /**< feature extraction */
+    EI_IMPULSE_STAGE_NN,                 /**< model setup and invoke */
+    EI_IMPULSE_STAGE_POSTPROCESSING,     /**< output decoding (FOMO boxes) */
+} ei_impulse_stage_t;
+
+typedef void (*ei_impulse_stage_hook_t)(ei_impulse_stage_t stage);
+
+/**
+ * The one hook of the program: an inline function's local static is shared
+ * by every translation unit that includes this header
+ */
+inline ei_impulse_stage_hook_t& ei_impulse_stage_hook() {
+    static ei_impulse_stage_hook_t hook = nullptr;
+    return hook;
+}
+
+static inline void ei_impulse_enter_stage(ei_impulse_stage_t stage) {
+    ei_impulse_stage_hook_t hook = ei_impulse_stage_hook();
+    if (hook) {
+        hook(stage);
+    }
+}
+
 /** @} */
 
 #endif // _EDGE_IMPULSE_RUN_CLASSIFIER_TYPES_H_
@@ -274,6 +274,10 @@ typedef struct {
     size_t arena_size;
 } ei_config_tflite_graph_t;
 
+#if EI_CLASSIFIER_PROFILE_OPS
+namespace tflite { class MicroProfilerInterface; }
+#endif
+
 /** Configuration for the tflite_eon.h */
 typedef struct {
     uint16_t implementation_version;
@@ -282,6 +286,11 @@ typedef struct {
     TfLiteStatus (*model_reset)(void (*free)(void* ptr));
     TfLiteStatus (*model_input)(int, TfLiteTensor*);
     TfLiteStatus (*model_output)(int, TfLiteTensor*);
+#if EI_CLASSIFIER_PROFILE_OPS
+    TfLiteStatus (*model_set_profiler)(tflite::MicroProfilerInterface*);
+    TfLiteStatus (*model_node_info)(size_t, const char**, uint64_t*, uint32_t*);
+    TfLiteStatus (*model_node_output)(size_t, TfLiteTensor*);
+#endif
 } ei_config_tflite_eon_graph_t;
 
 typedef struct {
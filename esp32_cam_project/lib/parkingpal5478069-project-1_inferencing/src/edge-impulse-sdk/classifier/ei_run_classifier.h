@@ -261,6 +261,8 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
     memset(result, 0, sizeof(ei_impulse_result_t));
 #endif
 
+    ei_impulse_enter_stage(EI_IMPULSE_STAGE_DSP);
+
     // smart pointer to results array
     // currently only SSD has multiple outputs
     // need to be refactored to something more generic
@@ -283,6 +285,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
         if (res != EI_IMPULSE_OK) {
             return res;
         }
+        ei_impulse_enter_stage(EI_IMPULSE_STAGE_POSTPROCESSING);
         res = run_postprocessing(handle, result);
         return res;
     }
@@ -419,11 +422,13 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
 #if EI_CLASSIFIER_DSP_ONLY
     return EI_IMPULSE_OK;
 #else
+    ei_impulse_enter_stage(EI_IMPULSE_STAGE_NN);
     EI_IMPULSE_ERROR res = run_inference(handle, features, result, debug);
     if (res != EI_IMPULSE_OK) {
         return res;
     }
     else {
+        ei_impulse_enter_stage(EI_IMPULSE_STAGE_POSTPROCESSING);
         return run_postprocessing(handle, result);
     }
 #endif
@@ -892,6 +897,108 @@ __attribute__((unused)) void run_classifier_deinit(ei_impulse_handle_t *handle)
 #endif
 }
 
+/**
+ * @brief Call hook as every following inference enters DSP, NN and
+ * post-processing, in the calling task. Pass nullptr to detach.
+ *
+ * The hook runs on the inference path: it should only record the stage.
+ *
+ * @param[in]   hook  stage callback, or nullptr
+ */
+extern "C" void run_classifier_set_stage_hook(ei_impulse_stage_hook_t hook)
+{
+    ei_impulse_stage_hook() = hook;
+}
+
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+/**
+ * @brief Keep the compiled (EON) model initialized between `run_classifier()` calls.
+ *
+ * Allocates the tensor arena and runs op init/prepare once. Until
+ * `run_classifier_session_close()` is called, every inference reuses the arena,
+ * scratch buffers and prepared node state instead of rebuilding them per frame.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in]   handle struct with information about model and DSP
+ *
+ * @return      EI_IMPULSE_OK if the model is resident
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_session_open(ei_impulse_handle_t *handle)
+{
+    for (size_t ix = 0; ix < handle->impulse->learning_blocks_size; ix++) {
+        const ei_learning_block_t &block = handle->impulse->learning_blocks[ix];
+        if (block.infer_fn == run_nn_inference) {
+            return ei_eon_session_open((ei_learning_block_config_tflite_graph_t*)block.config);
+        }
+    }
+    return EI_IMPULSE_OK;
+}
+
+extern "C" EI_IMPULSE_ERROR run_classifier_session_open(void)
+{
+    return run_classifier_session_open(&ei_default_impulse);
+}
+
+/**
+ * @brief Release the model kept by `run_classifier_session_open()` and free its arena.
+ *
+ * **Blocking**: yes
+ */
+extern "C" void run_classifier_session_close(void)
+{
+    ei_eon_session_close();
+}
+
+/**
+ * @brief Allocate the tensor arena with alloc / free_fnc instead of the EI heap.
+ *
+ * Takes effect at the next model init (session open, or the next inference
+ * without a session). Pass nullptr to go back to `ei_aligned_calloc()`.
+ *
+ * @param[in]   alloc     zeroed allocation of size bytes at align
+ * @param[in]   free_fnc  releases what alloc returned
+ *
+ * @return      EI_IMPULSE_OK, or EI_IMPULSE_TFLITE_ERROR while a session is open
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_set_arena_allocator(void *(*alloc)(size_t align, size_t size),
+                                                               void (*free_fnc)(void *ptr))
+{
+    return ei_eon_set_arena_allocator(alloc, free_fnc);
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+/**
+ * @brief Attach a per-node profiler to the compiled graph of the impulse.
+ *
+ * Every following inference records one event per graph node. Pass nullptr
+ * to detach. Built only with EI_CLASSIFIER_PROFILE_OPS=1, so the invoke loop
+ * carries no hooks otherwise.
+ *
+ * @param[in]   handle    struct with information about model and DSP
+ * @param[in]   profiler  aggregating profiler, or nullptr
+ *
+ * @return      EI_IMPULSE_OK if attached
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_set_profiler(ei_impulse_handle_t *handle,
+                                                                      tflite::MicroOpProfiler *profiler)
+{
+    for (size_t ix = 0; ix < handle->impulse->learning_blocks_size; ix++) {
+        const ei_learning_block_t &block = handle->impulse->learning_blocks[ix];
+        if (block.infer_fn == run_nn_inference) {
+            return ei_eon_set_profiler((ei_learning_block_config_tflite_graph_t*)block.config, profiler);
+        }
+    }
+    return EI_IMPULSE_OK;
+}
+
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_set_profiler(tflite::MicroOpProfiler *profiler)
+{
+    return run_classifier_set_profiler(&ei_default_impulse, profiler);
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
+#endif // (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+
 /**
  * @brief Run preprocessing (DSP) on new slice of raw features. Add output features
  *  to rolling matrix and run inference on full sample.
@@ -68,9 +68,13 @@ namespace {
 
 using namespace ei;
 
-#if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
-float ei_dsp_image_buffer[EI_DSP_IMAGE_BUFFER_STATIC_SIZE];
+// Page the image extractors read get_data() into. Always static, so image
+// DSP does not touch the heap; define EI_DSP_IMAGE_BUFFER_STATIC_SIZE to
+// trade RAM against get_data() calls.
+#if !defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
+#define EI_DSP_IMAGE_BUFFER_STATIC_SIZE 256
 #endif
+float ei_dsp_image_buffer[EI_DSP_IMAGE_BUFFER_STATIC_SIZE];
 
 // this is the frame we work on... allocate it statically so we share between invocations
 static float *ei_dsp_cont_current_frame = nullptr;
@@ -1112,61 +1116,143 @@ __attribute__((unused)) int extract_mfe_per_slice_features(signal_t *signal, mat
 #endif
 }
 
-__attribute__((unused)) int extract_image_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency) {
-    ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
+/**
+ * Source pixel formats the specialized image extractors read
+ */
+typedef enum {
+    EI_IMAGE_SRC_RGB888 = 0,    // get_data(): packed 0xRRGGBB floats
+    EI_IMAGE_SRC_GRAY888 = 1,   // get_data(): packed floats with R=G=B
+    EI_IMAGE_SRC_GRAY8 = 2      // signal->gray_u8 bytes, no get_data()
+} ei_image_src_t;
 
-    int16_t channel_count = strcmp(config.channels, "Grayscale") == 0 ? 1 : 3;
+/**
+ * Channel count of an image DSP config; the strcmp only runs when a
+ * different config is passed in.
+ */
+__attribute__((unused)) static int16_t image_channel_count(const ei_dsp_config_image_t *config) {
+    static const char *last_channels = nullptr;
+    static int16_t last_count = 3;
 
-    size_t output_ix = 0;
+    if (config->channels != last_channels) {
+        last_count = strcmp(config->channels, "Grayscale") == 0 ? 1 : 3;
+        last_channels = config->channels;
+    }
+    return last_count;
+}
 
-#if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
-    const size_t page_size = EI_DSP_IMAGE_BUFFER_STATIC_SIZE;
-#else
-    const size_t page_size = 1024;
-#endif
+/**
+ * One packed 0xRRGGBB pixel to 0..1 floats: 3 channels, or ITU-R 601-2 luma.
+ */
+template<int CHANNELS>
+struct image_rgb_to_float {
+    inline void operator()(uint32_t pixel, float *out) const {
+        float r = static_cast<float>(pixel >> 16 & 0xff) / 255.0f;
+        float g = static_cast<float>(pixel >> 8 & 0xff) / 255.0f;
+        float b = static_cast<float>(pixel & 0xff) / 255.0f;
+
+        if (CHANNELS == 3) {
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+        }
+        else {
+            // ITU-R 601-2 luma transform
+            // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
+            out[0] = (0.299f * r) + (0.587f * g) + (0.114f * b);
+        }
+    }
+};
+
+/**
+ * Gray (R=G=B) byte to float features, built once from the RGB path above.
+ */
+template<int CHANNELS>
+__attribute__((unused)) static const float *image_gray_float_lut() {
+    static float lut[256 * CHANNELS];
+    static bool lut_valid = false;
+
+    if (!lut_valid) {
+        const image_rgb_to_float<CHANNELS> convert = {};
+        for (uint32_t g = 0; g < 256; g++) {
+            convert((g << 16) | (g << 8) | g, &lut[g * CHANNELS]);
+        }
+        lut_valid = true;
+    }
+    return lut;
+}
+
+/**
+ * Image features specialized on channel count, source format and output
+ * type. RGB888 pixels go through `rgb`; gray sources are one lookup per
+ * pixel in `gray_lut` (CHANNELS values per gray level). get_data() reads
+ * into the caller's `page`, so nothing is allocated.
+ */
+template<int CHANNELS, ei_image_src_t SRC, typename OUT_T, typename RGB_FN>
+__attribute__((unused)) static int extract_image_pixels(signal_t *signal, OUT_T *out, const OUT_T *gray_lut,
+                                                        const RGB_FN &rgb, float *page, size_t page_size) {
+    if (SRC == EI_IMAGE_SRC_GRAY8) {
+        const uint8_t *gray = signal->gray_u8;
+        if (!gray) {
+            EIDSP_ERR(EIDSP_PARAMETER_INVALID);
+        }
+        for (size_t ix = 0; ix < signal->total_length; ix++) {
+            const OUT_T *v = &gray_lut[gray[ix] * CHANNELS];
+            for (int c = 0; c < CHANNELS; c++) {
+                *out++ = v[c];
+            }
+        }
+        return EIDSP_OK;
+    }
 
     // buffered read from the signal
-    size_t bytes_left = signal->total_length;
     for (size_t ix = 0; ix < signal->total_length; ix += page_size) {
-        size_t elements_to_read = bytes_left > page_size ? page_size : bytes_left;
+        const size_t left = signal->total_length - ix;
+        const size_t elements_to_read = left > page_size ? page_size : left;
 
-#if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
-        matrix_t input_matrix(elements_to_read, config.axes, ei_dsp_image_buffer);
-#else
-        matrix_t input_matrix(elements_to_read, config.axes);
-#endif
-        if (!input_matrix.buffer) {
-            EIDSP_ERR(EIDSP_OUT_OF_MEM);
+        int ret = signal->get_data(ix, elements_to_read, page);
+        if (ret != EIDSP_OK) {
+            EIDSP_ERR(ret);
         }
-        signal->get_data(ix, elements_to_read, input_matrix.buffer);
 
         for (size_t jx = 0; jx < elements_to_read; jx++) {
-            uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
-
-            // rgb to 0..1
-            float r = static_cast<float>(pixel >> 16 & 0xff) / 255.0f;
-            float g = static_cast<float>(pixel >> 8 & 0xff) / 255.0f;
-            float b = static_cast<float>(pixel & 0xff) / 255.0f;
-
-            if (channel_count == 3) {
-                output_matrix->buffer[output_ix++] = r;
-                output_matrix->buffer[output_ix++] = g;
-                output_matrix->buffer[output_ix++] = b;
+            const uint32_t pixel = static_cast<uint32_t>(page[jx]);
+            if (SRC == EI_IMAGE_SRC_GRAY888) {
+                const OUT_T *v = &gray_lut[(pixel & 0xff) * CHANNELS];
+                for (int c = 0; c < CHANNELS; c++) {
+                    *out++ = v[c];
+                }
             }
             else {
-                // ITU-R 601-2 luma transform
-                // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
-                float v = (0.299f * r) + (0.587f * g) + (0.114f * b);
-                output_matrix->buffer[output_ix++] = v;
+                rgb(pixel, out);
+                out += CHANNELS;
             }
         }
-
-        bytes_left -= elements_to_read;
     }
-
     return EIDSP_OK;
 }
 
+/**
+ * Float image features for one channel count and source format, paging
+ * through the shared static buffer.
+ */
+template<int CHANNELS, ei_image_src_t SRC>
+__attribute__((unused)) static int extract_image_features_t(signal_t *signal, float *out) {
+    const float *lut = SRC == EI_IMAGE_SRC_RGB888 ? nullptr : image_gray_float_lut<CHANNELS>();
+    return extract_image_pixels<CHANNELS, SRC>(signal, out, lut, image_rgb_to_float<CHANNELS>(),
+                                               ei_dsp_image_buffer, EI_DSP_IMAGE_BUFFER_STATIC_SIZE);
+}
+
+__attribute__((unused)) int extract_image_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency) {
+    const int16_t channel_count = image_channel_count((ei_dsp_config_image_t*)config_ptr);
+
+    if (channel_count == 1) {
+        return signal->gray_u8 ? extract_image_features_t<1, EI_IMAGE_SRC_GRAY8>(signal, output_matrix->buffer)
+                               : extract_image_features_t<1, EI_IMAGE_SRC_RGB888>(signal, output_matrix->buffer);
+    }
+    return signal->gray_u8 ? extract_image_features_t<3, EI_IMAGE_SRC_GRAY8>(signal, output_matrix->buffer)
+                           : extract_image_features_t<3, EI_IMAGE_SRC_RGB888>(signal, output_matrix->buffer);
+}
+
 #if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI)
 
 /*
@@ -1233,14 +1319,12 @@ __attribute__((unused)) int extract_drpai_features_quantized(signal_t *signal, m
 
 #if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE != EI_CLASSIFIER_DRPAI)
 
-__attribute__((unused)) int extract_image_features_quantized(signal_t *signal, matrix_i8_t *output_matrix, void *config_ptr, float scale, float zero_point, const float frequency,
-                                                             int image_scaling) {
-    ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
-
-    int16_t channel_count = strcmp(config.channels, "Grayscale") == 0 ? 1 : 3;
-
-    size_t output_ix = 0;
-
+/**
+ * Quantize one packed 0xRRGGBB pixel into 1 (grayscale) or 3 int8 values.
+ * Returns the number of values written.
+ */
+__attribute__((unused)) static inline int quantize_image_pixel(uint32_t pixel, int16_t channel_count, float scale, float zero_point,
+                                                               int image_scaling, int8_t *out) {
     const int32_t iRedToGray = (int32_t)(0.299f * 65536.0f);
     const int32_t iGreenToGray = (int32_t)(0.587f * 65536.0f);
     const int32_t iBlueToGray = (int32_t)(0.114f * 65536.0f);
@@ -1248,126 +1332,168 @@ __attribute__((unused)) int extract_image_features_quantized(signal_t *signal, m
     static const float torch_mean[] = { 0.485, 0.456, 0.406 };
     static const float torch_std[] = { 0.229, 0.224, 0.225 };
 
-#if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
-    const size_t page_size = EI_DSP_IMAGE_BUFFER_STATIC_SIZE;
-#else
-    const size_t page_size = 1024;
-#endif
+    if (channel_count == 3) {
+        // fast code path
+        if (scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+            int32_t r = static_cast<int32_t>(pixel >> 16 & 0xff);
+            int32_t g = static_cast<int32_t>(pixel >> 8 & 0xff);
+            int32_t b = static_cast<int32_t>(pixel & 0xff);
 
-    // buffered read from the signal
-    size_t bytes_left = signal->total_length;
-    for (size_t ix = 0; ix < signal->total_length; ix += page_size) {
-        size_t elements_to_read = bytes_left > page_size ? page_size : bytes_left;
+            out[0] = static_cast<int8_t>(r + zero_point);
+            out[1] = static_cast<int8_t>(g + zero_point);
+            out[2] = static_cast<int8_t>(b + zero_point);
+        }
+        // slow code path
+        else {
+            float r = static_cast<float>(pixel >> 16 & 0xff);
+            float g = static_cast<float>(pixel >> 8 & 0xff);
+            float b = static_cast<float>(pixel & 0xff);
+
+            if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+                r /= 255.0f;
+                g /= 255.0f;
+                b /= 255.0f;
+            }
+            else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
+                r /= 255.0f;
+                g /= 255.0f;
+                b /= 255.0f;
+
+                r = (r - torch_mean[0]) / torch_std[0];
+                g = (g - torch_mean[1]) / torch_std[1];
+                b = (b - torch_mean[2]) / torch_std[2];
+            }
+            else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
+                r -= 128.0f;
+                g -= 128.0f;
+                b -= 128.0f;
+            }
 
-#if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
-        matrix_t input_matrix(elements_to_read, config.axes, ei_dsp_image_buffer);
-#else
-        matrix_t input_matrix(elements_to_read, config.axes);
-#endif
-        if (!input_matrix.buffer) {
-            EIDSP_ERR(EIDSP_OUT_OF_MEM);
+            out[0] = static_cast<int8_t>(round(r / scale) + zero_point);
+            out[1] = static_cast<int8_t>(round(g / scale) + zero_point);
+            out[2] = static_cast<int8_t>(round(b / scale) + zero_point);
         }
-        signal->get_data(ix, elements_to_read, input_matrix.buffer);
+        return 3;
+    }
 
-        for (size_t jx = 0; jx < elements_to_read; jx++) {
-            uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
+    // fast code path
+    if (scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+        int32_t r = static_cast<int32_t>(pixel >> 16 & 0xff);
+        int32_t g = static_cast<int32_t>(pixel >> 8 & 0xff);
+        int32_t b = static_cast<int32_t>(pixel & 0xff);
 
-            if (channel_count == 3) {
-                // fast code path
-                if (scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                    int32_t r = static_cast<int32_t>(pixel >> 16 & 0xff);
-                    int32_t g = static_cast<int32_t>(pixel >> 8 & 0xff);
-                    int32_t b = static_cast<int32_t>(pixel & 0xff);
-
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(r + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(g + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(b + zero_point);
-                }
-                // slow code path
-                else {
-                    float r = static_cast<float>(pixel >> 16 & 0xff);
-                    float g = static_cast<float>(pixel >> 8 & 0xff);
-                    float b = static_cast<float>(pixel & 0xff);
-
-                    if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-
-                        r = (r - torch_mean[0]) / torch_std[0];
-                        g = (g - torch_mean[1]) / torch_std[1];
-                        b = (b - torch_mean[2]) / torch_std[2];
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
-                        r -= 128.0f;
-                        g -= 128.0f;
-                        b -= 128.0f;
-                    }
-
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(r / scale) + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(g / scale) + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(b / scale) + zero_point);
-                }
-            }
-            else {
-                // fast code path
-                if (scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                    int32_t r = static_cast<int32_t>(pixel >> 16 & 0xff);
-                    int32_t g = static_cast<int32_t>(pixel >> 8 & 0xff);
-                    int32_t b = static_cast<int32_t>(pixel & 0xff);
-
-                    // ITU-R 601-2 luma transform
-                    // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
-                    int32_t gray = (iRedToGray * r) + (iGreenToGray * g) + (iBlueToGray * b);
-                    gray >>= 16; // scale down to int8_t
-                    gray += zero_point;
-                    if (gray < - 128) gray = -128;
-                    else if (gray > 127) gray = 127;
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(gray);
-                }
-                // slow code path
-                else {
-                    float r = static_cast<float>(pixel >> 16 & 0xff);
-                    float g = static_cast<float>(pixel >> 8 & 0xff);
-                    float b = static_cast<float>(pixel & 0xff);
-
-                    if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-
-                        r = (r - torch_mean[0]) / torch_std[0];
-                        g = (g - torch_mean[1]) / torch_std[1];
-                        b = (b - torch_mean[2]) / torch_std[2];
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
-                        r -= 128.0f;
-                        g -= 128.0f;
-                        b -= 128.0f;
-                    }
-
-                    // ITU-R 601-2 luma transform
-                    // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
-                    float v = (0.299f * r) + (0.587f * g) + (0.114f * b);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(v / scale) + zero_point);
-                }
-            }
+        // ITU-R 601-2 luma transform
+        // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
+        int32_t gray = (iRedToGray * r) + (iGreenToGray * g) + (iBlueToGray * b);
+        gray >>= 16; // scale down to int8_t
+        gray += zero_point;
+        if (gray < - 128) gray = -128;
+        else if (gray > 127) gray = 127;
+        out[0] = static_cast<int8_t>(gray);
+    }
+    // slow code path
+    else {
+        float r = static_cast<float>(pixel >> 16 & 0xff);
+        float g = static_cast<float>(pixel >> 8 & 0xff);
+        float b = static_cast<float>(pixel & 0xff);
+
+        if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+            r /= 255.0f;
+            g /= 255.0f;
+            b /= 255.0f;
+        }
+        else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
+            r /= 255.0f;
+            g /= 255.0f;
+            b /= 255.0f;
+
+            r = (r - torch_mean[0]) / torch_std[0];
+            g = (g - torch_mean[1]) / torch_std[1];
+            b = (b - torch_mean[2]) / torch_std[2];
+        }
+        else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
+            r -= 128.0f;
+            g -= 128.0f;
+            b -= 128.0f;
         }
 
-        bytes_left -= elements_to_read;
+        // ITU-R 601-2 luma transform
+        // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
+        float v = (0.299f * r) + (0.587f * g) + (0.114f * b);
+        out[0] = static_cast<int8_t>(round(v / scale) + zero_point);
+    }
+    return 1;
+}
 
+/**
+ * Gray (R=G=B) byte to quantized input: the per-pixel path above run once
+ * per gray level, cached for the last scale / zero point / scaling seen.
+ */
+__attribute__((unused)) static const int8_t *image_gray_quantize_lut(int16_t channel_count, float scale, float zero_point,
+                                                                     int image_scaling) {
+    static int8_t lut[256 * 3];
+    static bool lut_valid = false;
+    static int16_t lut_channels;
+    static float lut_scale, lut_zero_point;
+    static int lut_scaling;
+
+    if (!lut_valid || lut_channels != channel_count || lut_scale != scale ||
+        lut_zero_point != zero_point || lut_scaling != image_scaling) {
+        for (uint32_t g = 0; g < 256; g++) {
+            quantize_image_pixel((g << 16) | (g << 8) | g, channel_count, scale, zero_point, image_scaling,
+                                 &lut[g * channel_count]);
+        }
+        lut_channels = channel_count;
+        lut_scale = scale;
+        lut_zero_point = zero_point;
+        lut_scaling = image_scaling;
+        lut_valid = true;
     }
-    return EIDSP_OK;
+    return lut;
+}
+
+/**
+ * One packed 0xRRGGBB pixel to CHANNELS quantized values.
+ */
+template<int CHANNELS>
+struct image_rgb_to_i8 {
+    float scale;
+    float zero_point;
+    int image_scaling;
+
+    inline void operator()(uint32_t pixel, int8_t *out) const {
+        quantize_image_pixel(pixel, CHANNELS, scale, zero_point, image_scaling, out);
+    }
+};
+
+/**
+ * Quantized image features for one channel count and source format, paging
+ * through the shared static buffer.
+ */
+template<int CHANNELS, ei_image_src_t SRC>
+__attribute__((unused)) static int extract_image_features_quantized_t(signal_t *signal, int8_t *out, float scale,
+                                                                      float zero_point, int image_scaling) {
+    const int8_t *lut = SRC == EI_IMAGE_SRC_RGB888 ? nullptr
+                                                   : image_gray_quantize_lut(CHANNELS, scale, zero_point, image_scaling);
+    const image_rgb_to_i8<CHANNELS> rgb = { scale, zero_point, image_scaling };
+    return extract_image_pixels<CHANNELS, SRC>(signal, out, lut, rgb, ei_dsp_image_buffer,
+                                               EI_DSP_IMAGE_BUFFER_STATIC_SIZE);
+}
+
+__attribute__((unused)) int extract_image_features_quantized(signal_t *signal, matrix_i8_t *output_matrix, void *config_ptr, float scale, float zero_point, const float frequency,
+                                                             int image_scaling) {
+    const int16_t channel_count = image_channel_count((ei_dsp_config_image_t*)config_ptr);
+    int8_t *out = output_matrix->buffer;
+
+    // gray bytes from the caller are one table lookup per value
+    if (channel_count == 1) {
+        return signal->gray_u8
+            ? extract_image_features_quantized_t<1, EI_IMAGE_SRC_GRAY8>(signal, out, scale, zero_point, image_scaling)
+            : extract_image_features_quantized_t<1, EI_IMAGE_SRC_RGB888>(signal, out, scale, zero_point, image_scaling);
+    }
+    return signal->gray_u8
+        ? extract_image_features_quantized_t<3, EI_IMAGE_SRC_GRAY8>(signal, out, scale, zero_point, image_scaling)
+        : extract_image_features_quantized_t<3, EI_IMAGE_SRC_RGB888>(signal, out, scale, zero_point, image_scaling);
 }
 #endif // (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE != EI_CLASSIFIER_DRPAI)
 
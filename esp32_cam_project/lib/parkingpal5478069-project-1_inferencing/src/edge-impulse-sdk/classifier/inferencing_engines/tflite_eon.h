@@ -43,6 +43,133 @@
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
 #include "edge-impulse-sdk/classifier/inferencing_engines/tflite_helper.h"
 #include "edge-impulse-sdk/classifier/ei_run_dsp.h"
+#if EI_CLASSIFIER_PROFILE_OPS
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_op_profiler.h"
+#endif
+
+/**
+ * Persistent session. While open, the EON graph keeps its tensor arena,
+ * scratch buffers and prepared node state between invocations, so each
+ * inference only pays for model_invoke(). The compiled graph lives in
+ * file-scope state, so a single graph can be held at a time.
+ */
+typedef struct {
+    bool open;
+    TfLiteStatus (*model_init)(void*(*alloc_fnc)(size_t, size_t));
+    TfLiteStatus (*model_reset)(void (*free)(void* ptr));
+} ei_eon_session_t;
+
+static ei_eon_session_t ei_eon_session = { false, nullptr, nullptr };
+
+/**
+ * Tensor arena allocator. Defaults to the aligned EI heap; the application
+ * can place the arena in a memory pool of its choosing.
+ */
+typedef struct {
+    void *(*alloc)(size_t align, size_t size);   // zeroed, like ei_aligned_calloc
+    void (*free)(void *ptr);
+} ei_eon_arena_allocator_t;
+
+static ei_eon_arena_allocator_t ei_eon_arena = { ei_aligned_calloc, ei_aligned_free };
+
+static bool eon_session_holds(const ei_config_tflite_eon_graph_t *graph_config) {
+    return ei_eon_session.open && ei_eon_session.model_init == graph_config->model_init;
+}
+
+static TfLiteStatus eon_model_init(const ei_config_tflite_eon_graph_t *graph_config) {
+    if (eon_session_holds(graph_config)) {
+        return kTfLiteOk;
+    }
+    return graph_config->model_init(ei_eon_arena.alloc);
+}
+
+static TfLiteStatus eon_model_reset(const ei_config_tflite_eon_graph_t *graph_config) {
+    if (eon_session_holds(graph_config)) {
+        return kTfLiteOk;
+    }
+    return graph_config->model_reset(ei_eon_arena.free);
+}
+
+/**
+ * @brief      Release the graph held by the persistent session (frees the arena)
+ */
+__attribute__((unused)) void ei_eon_session_close(void) {
+    if (!ei_eon_session.open) {
+        return;
+    }
+    ei_eon_session.model_reset(ei_eon_arena.free);
+    ei_eon_session.open = false;
+    ei_eon_session.model_init = nullptr;
+    ei_eon_session.model_reset = nullptr;
+}
+
+/**
+ * @brief      Initialize a graph once and keep it for subsequent inferences
+ *
+ * @param      block_config  Learning block whose graph should stay resident
+ *
+ * @return     EI_IMPULSE_OK if the graph is (already) held by the session
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR ei_eon_session_open(ei_learning_block_config_tflite_graph_t *block_config) {
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    if (eon_session_holds(graph_config)) {
+        return EI_IMPULSE_OK;
+    }
+    ei_eon_session_close();
+
+    TfLiteStatus init_status = graph_config->model_init(ei_eon_arena.alloc);
+    if (init_status != kTfLiteOk) {
+        ei_printf("Failed to initialize the model (error code %d)\n", init_status);
+        return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+    }
+
+    ei_eon_session.open = true;
+    ei_eon_session.model_init = graph_config->model_init;
+    ei_eon_session.model_reset = graph_config->model_reset;
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief      Allocate and free the tensor arena through alloc / free_fnc
+ *             from the next model init on. nullptr restores the EI heap.
+ *
+ * @return     EI_IMPULSE_OK, or EI_IMPULSE_TFLITE_ERROR while a session
+ *             holds an arena from the current allocator
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR ei_eon_set_arena_allocator(void *(*alloc)(size_t align, size_t size),
+                                                                     void (*free_fnc)(void *ptr)) {
+    if (ei_eon_session.open) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+    ei_eon_arena.alloc = (alloc && free_fnc) ? alloc : ei_aligned_calloc;
+    ei_eon_arena.free = (alloc && free_fnc) ? free_fnc : ei_aligned_free;
+    return EI_IMPULSE_OK;
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+/**
+ * @brief      Time every node of the graph through profiler, nullptr detaches.
+ *             Registers each node's tag with its MACs and tensor bytes first.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR ei_eon_set_profiler(ei_learning_block_config_tflite_graph_t *block_config,
+                                                              tflite::MicroOpProfiler *profiler) {
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    if (profiler) {
+        const char *tag;
+        uint64_t macs;
+        uint32_t bytes;
+        for (size_t node = 0; graph_config->model_node_info(node, &tag, &macs, &bytes) == kTfLiteOk; node++) {
+            profiler->SetCost(tag, macs, bytes);
+        }
+    }
+    if (graph_config->model_set_profiler(profiler) != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+    return EI_IMPULSE_OK;
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
 
 /**
  * Setup the TFLite runtime
@@ -65,7 +192,7 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
 
     *ctx_start_us = ei_read_timer_us();
 
-    TfLiteStatus init_status = graph_config->model_init(ei_aligned_calloc);
+    TfLiteStatus init_status = eon_model_init(graph_config);
     if (init_status != kTfLiteOk) {
         ei_printf("Failed to initialize the model (error code %d)\n", init_status);
         return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
@@ -179,7 +306,7 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
         return output_res;
     }
 
-    if (graph_config->model_reset(ei_aligned_free) != kTfLiteOk) {
+    if (eon_model_reset(graph_config) != kTfLiteOk) {
         return EI_IMPULSE_TFLITE_ERROR;
     }
     ei_free(outputs);
@@ -295,7 +422,7 @@ EI_IMPULSE_ERROR run_nn_inference(
         result->_raw_outputs[learn_block_index].blockId = block_config->block_id;
     }
 
-    graph_config->model_reset(ei_aligned_free);
+    eon_model_reset(graph_config);
     ei_free(outputs);
 
     if (run_res != EI_IMPULSE_OK) {
@@ -326,6 +453,8 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     TfLiteTensor input;
     TfLiteTensor *outputs;
 
+    ei_impulse_enter_stage(EI_IMPULSE_STAGE_NN);
+
     // allocate outputs
     outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
 
@@ -346,6 +475,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
         return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
     }
 
+    ei_impulse_enter_stage(EI_IMPULSE_STAGE_DSP);
     uint64_t dsp_start_us = ei_read_timer_us();
 
     // features matrix maps around the input tensor to not allocate any memory
@@ -376,6 +506,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
         ei_printf("\n");
     }
 
+    ei_impulse_enter_stage(EI_IMPULSE_STAGE_NN);
     ctx_start_us = ei_read_timer_us();
 
     EI_IMPULSE_ERROR run_res = inference_tflite_run(
@@ -432,7 +563,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
         result->_raw_outputs[learn_block_index].blockId = block_config->block_id;
     }
 
-    graph_config->model_reset(ei_aligned_free);
+    eon_model_reset(graph_config);
     ei_free(outputs);
 
     if (run_res != EI_IMPULSE_OK) {
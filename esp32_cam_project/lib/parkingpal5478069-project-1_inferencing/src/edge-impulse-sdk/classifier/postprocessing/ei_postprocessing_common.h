@@ -81,6 +81,23 @@
     #endif
 #endif
 
+// int8 FOMO maps go through process_fomo_i8_blobs() (no heap, no float per cell)
+// rather than the cube merging of process_fomo_i8_cubes()
+#ifndef EI_CLASSIFIER_FOMO_I8_BLOBS
+#define EI_CLASSIFIER_FOMO_I8_BLOBS 1
+#endif
+
+#if defined(EI_HAS_FOMO) && EI_CLASSIFIER_FOMO_I8_BLOBS
+// Largest grid the blob path takes (FOMO cuts the input by 8), and its box
+// capacity: 8-connected regions of one class are at least a cell apart.
+#ifndef EI_FOMO_BLOB_MAX_CELLS
+#define EI_FOMO_BLOB_MAX_CELLS     ((EI_CLASSIFIER_INPUT_WIDTH / 8) * (EI_CLASSIFIER_INPUT_HEIGHT / 8))
+#endif
+#define EI_FOMO_BLOB_MAX_REGIONS   (((EI_CLASSIFIER_INPUT_WIDTH / 8 + 1) / 2) * ((EI_CLASSIFIER_INPUT_HEIGHT / 8 + 1) / 2) * EI_CLASSIFIER_LABEL_COUNT)
+#define EI_FOMO_BLOB_MAX_BOXES     (EI_FOMO_BLOB_MAX_REGIONS > EI_CLASSIFIER_OBJECT_DETECTION_COUNT ? \
+                                    EI_FOMO_BLOB_MAX_REGIONS : EI_CLASSIFIER_OBJECT_DETECTION_COUNT)
+#endif
+
 int16_t get_block_number(ei_impulse_handle_t *handle, void *init_func)
 {
     for (size_t i = 0; i < handle->impulse->postprocessing_blocks_size; i++) {
@@ -443,7 +460,12 @@ __attribute__((unused)) static EI_IMPULSE_ERROR process_fomo_f32(ei_impulse_hand
 #endif
 }
 
-__attribute__((unused)) static EI_IMPULSE_ERROR process_fomo_i8(ei_impulse_handle_t *handle,
+/**
+ * Original int8 FOMO path: dequantizes every cell and merges heap-allocated
+ * cubes. process_fomo_i8() falls back to it for grids the blob path does not
+ * cover, and host tools keep it as the reference.
+ */
+__attribute__((unused)) static EI_IMPULSE_ERROR process_fomo_i8_cubes(ei_impulse_handle_t *handle,
                                                                     uint32_t block_index,
                                                                     uint32_t input_block_id,
                                                                     ei_impulse_result_t *result,
@@ -481,6 +503,188 @@ __attribute__((unused)) static EI_IMPULSE_ERROR process_fomo_i8(ei_impulse_handl
 #endif
 }
 
+#if defined(EI_HAS_FOMO) && EI_CLASSIFIER_FOMO_I8_BLOBS
+// Connected region of one class on the FOMO grid (cells inclusive)
+typedef struct {
+    uint16_t parent;        // union-find link, self for a root
+    uint16_t first;         // raster index of the first cell
+    uint8_t x0, y0, x1, y1;
+    int8_t max_q;
+} ei_fomo_blob_t;
+
+/**
+ * Smallest int8 value whose dequantized score passes the threshold, computed
+ * with the same float expression as process_fomo_i8_cubes() so that both
+ * paths keep exactly the same cells. 128 if no value passes.
+ */
+__attribute__((unused)) static int16_t ei_fomo_i8_threshold(float threshold, float zero_point, float scale) {
+    float q0 = threshold / scale + zero_point;
+    int32_t q = (q0 < -129.0f) ? -128 : (q0 > 128.0f) ? 128 : (int32_t)ceilf(q0);
+    while (q > -128 && static_cast<float>(q - 1 - zero_point) * scale >= threshold) q--;
+    while (q < 128 && static_cast<float>(q - zero_point) * scale < threshold) q++;
+    return (int16_t)q;
+}
+
+__attribute__((unused)) static uint16_t ei_fomo_blob_root(ei_fomo_blob_t *blobs, uint16_t b) {
+    while (blobs[b].parent != b) {
+        blobs[b].parent = blobs[blobs[b].parent].parent;
+        b = blobs[b].parent;
+    }
+    return b;
+}
+
+// Merges the regions of a and b into the older one; returns the surviving root
+__attribute__((unused)) static uint16_t ei_fomo_blob_union(ei_fomo_blob_t *blobs, uint16_t a, uint16_t b) {
+    a = ei_fomo_blob_root(blobs, a);
+    b = ei_fomo_blob_root(blobs, b);
+    if (a == b) return a;
+    if (b < a) {
+        uint16_t t = a;
+        a = b;
+        b = t;
+    }
+    ei_fomo_blob_t *ra = &blobs[a];
+    const ei_fomo_blob_t *rb = &blobs[b];
+    if (rb->x0 < ra->x0) ra->x0 = rb->x0;
+    if (rb->y0 < ra->y0) ra->y0 = rb->y0;
+    if (rb->x1 > ra->x1) ra->x1 = rb->x1;
+    if (rb->y1 > ra->y1) ra->y1 = rb->y1;
+    if (rb->max_q > ra->max_q) ra->max_q = rb->max_q;
+    if (rb->first < ra->first) ra->first = rb->first;
+    blobs[b].parent = a;
+    return a;
+}
+
+/**
+ * Fill the result structure from a quantized FOMO output map without heap
+ * allocations: cells are compared against the threshold in int8, each class
+ * is labelled in one raster pass (8-connected, union-find), and every region
+ * becomes one box with the region's best score. Boxes come out in order of
+ * each region's first cell, as the cube path orders them.
+ */
+__attribute__((unused)) static EI_IMPULSE_ERROR process_fomo_i8_blobs(ei_impulse_handle_t *handle,
+                                                                    uint32_t block_index,
+                                                                    uint32_t input_block_id,
+                                                                    ei_impulse_result_t *result,
+                                                                    void *config_ptr,
+                                                                    void *state) {
+    const ei_impulse_t *impulse = handle->impulse;
+    const ei_fill_result_fomo_i8_config_t *config = (ei_fill_result_fomo_i8_config_t*)config_ptr;
+
+    static ei_fomo_blob_t blobs[EI_FOMO_BLOB_MAX_CELLS];
+    static uint16_t cell_blob[EI_FOMO_BLOB_MAX_CELLS];
+    static ei_impulse_result_bounding_box_t boxes[EI_FOMO_BLOB_MAX_BOXES];
+    static uint8_t box_label[EI_FOMO_BLOB_MAX_BOXES];
+    static uint16_t box_first[EI_FOMO_BLOB_MAX_BOXES];
+    const uint16_t NONE = 0xFFFF;
+
+    const uint32_t w = config->out_width;
+    const uint32_t h = config->out_height;
+    const uint32_t stride = impulse->label_count + 1;
+    if (w * h > EI_FOMO_BLOB_MAX_CELLS || w > 255 || h > 255 || !(config->scale > 0.0f)) {
+        return process_fomo_i8_cubes(handle, block_index, input_block_id, result, config_ptr, state);
+    }
+
+    ei::matrix_i8_t* raw_output_mtx = NULL;
+    find_mtx_by_idx(result->_raw_outputs, &raw_output_mtx, input_block_id, impulse->learning_blocks_size);
+    const int8_t *map = raw_output_mtx->buffer;
+
+    const int16_t q_thr = ei_fomo_i8_threshold(config->threshold, config->zero_point, config->scale);
+    const uint32_t out_width_factor = impulse->input_width / config->out_width;
+    uint32_t box_count = 0;
+
+    for (uint32_t ix = 1; ix < stride && q_thr <= 127; ix++) {
+        uint16_t blob_count = 0;
+        for (uint32_t y = 0; y < h; y++) {
+            for (uint32_t x = 0; x < w; x++) {
+                const uint32_t cell = y * w + x;
+                const int8_t q = map[cell * stride + ix];
+                if (q < q_thr) {
+                    cell_blob[cell] = NONE;
+                    continue;
+                }
+                // Already labelled neighbours: W, NW, N, NE
+                uint16_t b = NONE;
+                if (x > 0 && cell_blob[cell - 1] != NONE) b = cell_blob[cell - 1];
+                if (y > 0) {
+                    const uint32_t up = cell - w;
+                    if (x > 0 && cell_blob[up - 1] != NONE) {
+                        b = (b == NONE) ? cell_blob[up - 1] : ei_fomo_blob_union(blobs, b, cell_blob[up - 1]);
+                    }
+                    if (cell_blob[up] != NONE) {
+                        b = (b == NONE) ? cell_blob[up] : ei_fomo_blob_union(blobs, b, cell_blob[up]);
+                    }
+                    if (x + 1 < w && cell_blob[up + 1] != NONE) {
+                        b = (b == NONE) ? cell_blob[up + 1] : ei_fomo_blob_union(blobs, b, cell_blob[up + 1]);
+                    }
+                }
+                if (b == NONE) {
+                    b = blob_count++;
+                    blobs[b].parent = b;
+                    blobs[b].first = (uint16_t)cell;
+                    blobs[b].x0 = blobs[b].x1 = (uint8_t)x;
+                    blobs[b].y0 = blobs[b].y1 = (uint8_t)y;
+                    blobs[b].max_q = q;
+                }
+                else {
+                    b = ei_fomo_blob_root(blobs, b);
+                    ei_fomo_blob_t *r = &blobs[b];
+                    if (x < r->x0) r->x0 = (uint8_t)x;
+                    if (x > r->x1) r->x1 = (uint8_t)x;
+                    r->y1 = (uint8_t)y;
+                    if (q > r->max_q) r->max_q = q;
+                }
+                cell_blob[cell] = b;
+            }
+        }
+
+        for (uint16_t b = 0; b < blob_count && box_count < EI_FOMO_BLOB_MAX_BOXES; b++) {
+            const ei_fomo_blob_t *r = &blobs[b];
+            if (r->parent != b) continue;
+            // Insert by (first cell, class); classes run in order, so ties go last
+            uint32_t at = box_count;
+            while (at > 0 && box_first[at - 1] > r->first) {
+                boxes[at] = boxes[at - 1];
+                box_label[at] = box_label[at - 1];
+                box_first[at] = box_first[at - 1];
+                at--;
+            }
+            boxes[at].label = impulse->categories[ix - 1];
+            boxes[at].x = r->x0 * out_width_factor;
+            boxes[at].y = r->y0 * out_width_factor;
+            boxes[at].width = (r->x1 - r->x0 + 1) * out_width_factor;
+            boxes[at].height = (r->y1 - r->y0 + 1) * out_width_factor;
+            boxes[at].value = static_cast<float>(r->max_q - config->zero_point) * config->scale;
+            box_label[at] = (uint8_t)ix;
+            box_first[at] = r->first;
+            box_count++;
+        }
+    }
+
+    // if we didn't detect min required objects, fill the rest with fixed value
+    for (uint32_t ix = box_count; ix < config->object_detection_count && ix < EI_FOMO_BLOB_MAX_BOXES; ix++) {
+        boxes[ix] = ei_impulse_result_bounding_box_t();
+    }
+
+    result->bounding_boxes = boxes;
+    result->bounding_boxes_count = box_count;
+    return EI_IMPULSE_OK;
+}
+#endif // EI_HAS_FOMO && EI_CLASSIFIER_FOMO_I8_BLOBS
+
+__attribute__((unused)) static EI_IMPULSE_ERROR process_fomo_i8(ei_impulse_handle_t *handle,
+                                                                    uint32_t block_index,
+                                                                    uint32_t input_block_id,
+                                                                    ei_impulse_result_t *result,
+                                                                    void *config_ptr,
+                                                                    void *state) {
+#if defined(EI_HAS_FOMO) && EI_CLASSIFIER_FOMO_I8_BLOBS
+    return process_fomo_i8_blobs(handle, block_index, input_block_id, result, config_ptr, state);
+#else
+    return process_fomo_i8_cubes(handle, block_index, input_block_id, result, config_ptr, state);
+#endif
+}
+
 /**
  * Fill the visual anomaly result structures from an unquantized output tensor
  */
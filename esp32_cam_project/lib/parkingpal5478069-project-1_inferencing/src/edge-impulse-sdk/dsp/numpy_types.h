@@ -699,6 +699,15 @@ typedef struct ei_signal_t {
      *  preprocessing and inference.
     */
     size_t total_length;
+
+#ifdef __cplusplus
+    /**
+     * Optional: the same signal as `total_length` 8-bit gray pixels (R=G=B).
+     * Quantized image models then fill their input through a 256-entry table
+     * instead of `get_data()`; all other paths keep using `get_data()`.
+     */
+    const uint8_t *gray_u8 = nullptr;
+#endif
 } signal_t;
 
 /** @} */
@@ -1278,6 +1278,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/kernels/op_macros.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/add.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/x86_int8.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/memory_helpers.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
 
@@ -1340,6 +1341,17 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
             tflite::micro::GetTensorShape(output),
             tflite::micro::GetTensorData<int8_t>(output));
       } else {
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+        if (x86_int8::AddElementwise(
+                MatchingElementsSize(tflite::micro::GetTensorShape(input1),
+                                     tflite::micro::GetTensorShape(input2),
+                                     tflite::micro::GetTensorShape(output)),
+                op_params, tflite::micro::GetTensorData<int8_t>(input1),
+                tflite::micro::GetTensorData<int8_t>(input2),
+                tflite::micro::GetTensorData<int8_t>(output))) {
+          break;
+        }
+#endif
         reference_integer_ops::Add(
             op_params, tflite::micro::GetTensorShape(input1),
             tflite::micro::GetTensorData<int8_t>(input1),
@@ -0,0 +1,572 @@
+// SSE4.1 / AVX2 int8 kernels for x86 hosts, see x86_int8.h
+#include "../../../../classifier/ei_classifier_config.h"
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/x86_int8.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+
+#define EI_X86_AVX2  __attribute__((target("avx2")))
+#define EI_X86_SSE41 __attribute__((target("sse4.1")))
+
+namespace tflite {
+namespace x86_int8 {
+namespace {
+
+constexpr int kMaxKernelHeight = 16;
+constexpr int kRowSlack = 16;   // int16 past each widened row, read by the last lanes
+
+Isa& ActiveIsa() {
+  static Isa isa = DetectIsa();
+  return isa;
+}
+
+// Convolution geometry, NHWC. Input rows are widened to int16 with the input
+// offset applied and padding columns stored as zeros, so a padded tap adds
+// nothing, as in the reference loops.
+struct Geometry {
+  int in_h, in_w, in_c;
+  int out_h, out_w, out_c;
+  int k_h, k_w;
+  int stride_h, stride_w;
+  int pad_h, pad_w;
+  int row_px;     // widened row width in pixels: (out_w - 1) * stride_w + k_w
+  int pairs;      // CONV_2D: int16 pairs per filter row, ceil(k_w * in_c / 2)
+  int lanes;      // output channels per vector: 8 (AVX2) or 4 (SSE4.1)
+  int blocks;     // ceil(out_c / lanes)
+};
+
+// Per-thread buffers, grown on first use
+struct Scratch {
+  std::vector<int16_t> rows;      // k_h widened input rows, then one zero row
+  int row_of_slot[kMaxKernelHeight];
+  std::vector<int16_t> filter16;  // CONV_2D: [block][ky][pair][lane][2]
+  std::vector<int32_t> filter32;  // DEPTHWISE: [tap][channel], channels padded
+  std::vector<int32_t> bias, mult, left, right;   // per channel, padded to blocks * lanes
+};
+
+thread_local Scratch scratch;
+
+bool FillGeometry(const RuntimeShape& input_shape, const RuntimeShape& filter_shape,
+                  const RuntimeShape& output_shape, int stride_w, int stride_h,
+                  const PaddingValues& pad, Geometry* g) {
+  if (input_shape.DimensionsCount() != 4 || filter_shape.DimensionsCount() != 4 ||
+      output_shape.DimensionsCount() != 4) {
+    return false;
+  }
+  g->in_h = input_shape.Dims(1);
+  g->in_w = input_shape.Dims(2);
+  g->in_c = input_shape.Dims(3);
+  g->out_h = output_shape.Dims(1);
+  g->out_w = output_shape.Dims(2);
+  g->out_c = output_shape.Dims(3);
+  g->k_h = filter_shape.Dims(1);
+  g->k_w = filter_shape.Dims(2);
+  g->stride_h = stride_h;
+  g->stride_w = stride_w;
+  g->pad_h = pad.height;
+  g->pad_w = pad.width;
+  g->row_px = (g->out_w - 1) * stride_w + g->k_w;
+  g->lanes = ActiveIsa() == kAvx2 ? 8 : 4;
+  g->blocks = (g->out_c + g->lanes - 1) / g->lanes;
+  return g->k_h >= 1 && g->k_h <= kMaxKernelHeight && g->out_w >= 1 &&
+         stride_w >= 1 && stride_h >= 1;
+}
+
+// Requantization parameters padded to whole vectors; padded lanes get zeros
+void PackRequant(const Geometry& g, const int32_t* bias, const int32_t* multiplier,
+                 const int32_t* shift) {
+  const size_t n = (size_t)g.blocks * g.lanes;
+  scratch.bias.assign(n, 0);
+  scratch.mult.assign(n, 0);
+  scratch.left.assign(n, 0);
+  scratch.right.assign(n, 0);
+  for (int c = 0; c < g.out_c; c++) {
+    scratch.bias[c] = bias ? bias[c] : 0;
+    scratch.mult[c] = multiplier[c];
+    scratch.left[c] = shift[c] > 0 ? shift[c] : 0;
+    scratch.right[c] = shift[c] > 0 ? 0 : -shift[c];
+  }
+}
+
+inline int8_t RequantScalar(int32_t acc, int c, int32_t output_offset,
+                            int32_t act_min, int32_t act_max) {
+  acc += scratch.bias[c];
+  acc = MultiplyByQuantizedMultiplier(acc, scratch.mult[c],
+                                      scratch.left[c] - scratch.right[c]);
+  acc += output_offset;
+  return (int8_t)std::min(act_max, std::max(act_min, acc));
+}
+
+// =================== ROW WIDENING ===================
+EI_X86_AVX2 void WidenAvx2(const int8_t* src, int n, int32_t offset, int16_t* dst) {
+  const __m256i off = _mm256_set1_epi16((int16_t)offset);
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m256i v = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(src + i)));
+    _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi16(v, off));
+  }
+  for (; i < n; i++) dst[i] = (int16_t)(src[i] + offset);
+}
+
+EI_X86_SSE41 void WidenSse41(const int8_t* src, int n, int32_t offset, int16_t* dst) {
+  const __m128i off = _mm_set1_epi16((int16_t)offset);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m128i v = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*)(src + i)));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi16(v, off));
+  }
+  for (; i < n; i++) dst[i] = (int16_t)(src[i] + offset);
+}
+
+size_t RowStride(const Geometry& g) {
+  return (size_t)g.row_px * g.in_c + kRowSlack;
+}
+
+void ResetRows(const Geometry& g) {
+  scratch.rows.assign(RowStride(g) * (g.k_h + 1), 0);
+  for (int s = 0; s < g.k_h; s++) scratch.row_of_slot[s] = -1;
+}
+
+// Widened input row iy of one image; rows outside the input are the zero row.
+// Consecutive output rows need overlapping input rows, so each row is widened
+// once while it stays in its slot.
+const int16_t* WidenedRow(const Geometry& g, const int8_t* image, int iy,
+                          int32_t input_offset) {
+  const size_t stride = RowStride(g);
+  if (iy < 0 || iy >= g.in_h) return scratch.rows.data() + stride * g.k_h;
+  const int slot = iy % g.k_h;
+  int16_t* dst = scratch.rows.data() + stride * slot;
+  if (scratch.row_of_slot[slot] == iy) return dst;
+  scratch.row_of_slot[slot] = iy;
+
+  // Columns left of the input, the input itself, columns right of it
+  const int first = std::min(g.pad_w, g.row_px);
+  const int valid = std::max(0, std::min(g.in_w, g.row_px - g.pad_w));
+  memset(dst, 0, sizeof(int16_t) * first * g.in_c);
+  const int8_t* src = image + (size_t)iy * g.in_w * g.in_c;
+  if (ActiveIsa() == kAvx2) {
+    WidenAvx2(src, valid * g.in_c, input_offset, dst + first * g.in_c);
+  } else {
+    WidenSse41(src, valid * g.in_c, input_offset, dst + first * g.in_c);
+  }
+  const int rest = g.row_px - first - valid;
+  memset(dst + (first + valid) * g.in_c, 0, sizeof(int16_t) * rest * g.in_c);
+  return dst;
+}
+
+// =================== AVX2 REQUANTIZATION ===================
+// gemmlowp SaturatingRoundingDoublingHighMul for b >= 0. Both nudges of the
+// reference reduce to floor((a * b + 2^30) / 2^31) once its truncating
+// division is taken into account, and the result fits in 32 bits.
+EI_X86_AVX2 inline __m256i SrdhmAvx2(__m256i a, __m256i b) {
+  const __m256i nudge = _mm256_set1_epi64x((int64_t)1 << 30);
+  const __m256i even = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(a, b), nudge), 31);
+  const __m256i odd = _mm256_add_epi64(
+      _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), nudge);
+  return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 1), 0xAA);
+}
+
+// gemmlowp RoundingDivideByPOT with a per-lane exponent
+EI_X86_AVX2 inline __m256i RdbpAvx2(__m256i x, __m256i exponent) {
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, exponent), one);
+  const __m256i remainder = _mm256_and_si256(x, mask);
+  const __m256i threshold = _mm256_sub_epi32(
+      _mm256_srai_epi32(mask, 1), _mm256_cmpgt_epi32(_mm256_setzero_si256(), x));
+  return _mm256_sub_epi32(_mm256_srav_epi32(x, exponent),
+                          _mm256_cmpgt_epi32(remainder, threshold));
+}
+
+// Accumulators of one block to int8, n <= 8 channels stored
+EI_X86_AVX2 inline void RequantStoreAvx2(__m256i acc, int c, int n, __m256i output_offset,
+                                         __m256i act_min, __m256i act_max, int8_t* dst) {
+  acc = _mm256_add_epi32(acc, _mm256_loadu_si256((const __m256i*)(scratch.bias.data() + c)));
+  acc = _mm256_sllv_epi32(acc, _mm256_loadu_si256((const __m256i*)(scratch.left.data() + c)));
+  acc = SrdhmAvx2(acc, _mm256_loadu_si256((const __m256i*)(scratch.mult.data() + c)));
+  acc = RdbpAvx2(acc, _mm256_loadu_si256((const __m256i*)(scratch.right.data() + c)));
+  acc = _mm256_add_epi32(acc, output_offset);
+  acc = _mm256_min_epi32(_mm256_max_epi32(acc, act_min), act_max);
+  const __m128i p16 = _mm_packs_epi32(_mm256_castsi256_si128(acc),
+                                      _mm256_extracti128_si256(acc, 1));
+  const __m128i p8 = _mm_packs_epi16(p16, p16);
+  if (n >= 8) {
+    _mm_storel_epi64((__m128i*)dst, p8);
+  } else {
+    int8_t tmp[16];
+    _mm_storeu_si128((__m128i*)tmp, p8);
+    memcpy(dst, tmp, n);
+  }
+}
+
+inline int32_t LoadPair(const int16_t* p) {
+  int32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// =================== CONV_2D ===================
+// Filter as [block][ky][pair][lane][2] int16 so one _madd_epi16 with a
+// broadcast input pair adds two taps to every lane of a block.
+void PackConvFilter(const Geometry& g, const int8_t* filter) {
+  const int run = g.k_w * g.in_c;
+  const int lanes = g.lanes;
+  scratch.filter16.assign((size_t)g.blocks * g.k_h * g.pairs * lanes * 2, 0);
+  for (int oc = 0; oc < g.out_c; oc++) {
+    const int block = oc / lanes, lane = oc % lanes;
+    for (int ky = 0; ky < g.k_h; ky++) {
+      const int8_t* f = filter + ((size_t)oc * g.k_h + ky) * run;
+      int16_t* dst = scratch.filter16.data() + (((size_t)block * g.k_h + ky) * g.pairs) * lanes * 2;
+      for (int j = 0; j < run; j++) dst[(j / 2) * lanes * 2 + lane * 2 + (j % 2)] = f[j];
+    }
+  }
+}
+
+template <int N>
+EI_X86_AVX2 inline void ConvPixelsAvx2(const Geometry& g, const int16_t* const* rows, int ox,
+                                       int block, const ConvParams& params, int8_t* out) {
+  const int step = g.stride_w * g.in_c;
+  __m256i acc[N];
+  for (int i = 0; i < N; i++) acc[i] = _mm256_setzero_si256();
+  for (int ky = 0; ky < g.k_h; ky++) {
+    const int16_t* x = rows[ky] + ox * step;
+    const int16_t* w = scratch.filter16.data() + ((size_t)block * g.k_h + ky) * g.pairs * 16;
+    for (int k = 0; k < g.pairs; k++) {
+      const __m256i wv = _mm256_loadu_si256((const __m256i*)(w + k * 16));
+      for (int i = 0; i < N; i++) {
+        const __m256i xv = _mm256_set1_epi32(LoadPair(x + i * step + 2 * k));
+        acc[i] = _mm256_add_epi32(acc[i], _mm256_madd_epi16(xv, wv));
+      }
+    }
+  }
+  const int c = block * 8;
+  const int n = std::min(8, g.out_c - c);
+  const __m256i offset = _mm256_set1_epi32(params.output_offset);
+  const __m256i lo = _mm256_set1_epi32(params.quantized_activation_min);
+  const __m256i hi = _mm256_set1_epi32(params.quantized_activation_max);
+  for (int i = 0; i < N; i++) {
+    RequantStoreAvx2(acc[i], c, n, offset, lo, hi, out + (size_t)(ox + i) * g.out_c + c);
+  }
+}
+
+EI_X86_AVX2 void ConvRowAvx2(const Geometry& g, const int16_t* const* rows,
+                             const ConvParams& params, int8_t* out) {
+  for (int block = 0; block < g.blocks; block++) {
+    int ox = 0;
+    for (; ox + 4 <= g.out_w; ox += 4) ConvPixelsAvx2<4>(g, rows, ox, block, params, out);
+    for (; ox < g.out_w; ox++) ConvPixelsAvx2<1>(g, rows, ox, block, params, out);
+  }
+}
+
+template <int N>
+EI_X86_SSE41 inline void ConvPixelsSse41(const Geometry& g, const int16_t* const* rows, int ox,
+                                         int block, const ConvParams& params, int8_t* out) {
+  const int step = g.stride_w * g.in_c;
+  __m128i acc[N];
+  for (int i = 0; i < N; i++) acc[i] = _mm_setzero_si128();
+  for (int ky = 0; ky < g.k_h; ky++) {
+    const int16_t* x = rows[ky] + ox * step;
+    const int16_t* w = scratch.filter16.data() + ((size_t)block * g.k_h + ky) * g.pairs * 8;
+    for (int k = 0; k < g.pairs; k++) {
+      const __m128i wv = _mm_loadu_si128((const __m128i*)(w + k * 8));
+      for (int i = 0; i < N; i++) {
+        const __m128i xv = _mm_set1_epi32(LoadPair(x + i * step + 2 * k));
+        acc[i] = _mm_add_epi32(acc[i], _mm_madd_epi16(xv, wv));
+      }
+    }
+  }
+  // Per-lane shifts need AVX2; requantize these four lanes one by one
+  const int c = block * 4;
+  const int n = std::min(4, g.out_c - c);
+  for (int i = 0; i < N; i++) {
+    int32_t a[4];
+    _mm_storeu_si128((__m128i*)a, acc[i]);
+    int8_t* dst = out + (size_t)(ox + i) * g.out_c + c;
+    for (int l = 0; l < n; l++) {
+      dst[l] = RequantScalar(a[l], c + l, params.output_offset,
+                             params.quantized_activation_min, params.quantized_activation_max);
+    }
+  }
+}
+
+EI_X86_SSE41 void ConvRowSse41(const Geometry& g, const int16_t* const* rows,
+                               const ConvParams& params, int8_t* out) {
+  for (int block = 0; block < g.blocks; block++) {
+    int ox = 0;
+    for (; ox + 4 <= g.out_w; ox += 4) ConvPixelsSse41<4>(g, rows, ox, block, params, out);
+    for (; ox < g.out_w; ox++) ConvPixelsSse41<1>(g, rows, ox, block, params, out);
+  }
+}
+
+// =================== DEPTHWISE_CONV_2D ===================
+// Filter widened to int32 as [tap][channel], channels padded to whole blocks
+void PackDepthwiseFilter(const Geometry& g, const int8_t* filter) {
+  const int padded = g.blocks * g.lanes;
+  const int taps = g.k_h * g.k_w;
+  scratch.filter32.assign((size_t)taps * padded, 0);
+  for (int t = 0; t < taps; t++) {
+    for (int c = 0; c < g.out_c; c++) {
+      scratch.filter32[(size_t)t * padded + c] = filter[(size_t)t * g.out_c + c];
+    }
+  }
+}
+
+EI_X86_AVX2 void DepthwiseRowAvx2(const Geometry& g, const int16_t* const* rows,
+                                  const DepthwiseParams& params, int8_t* out) {
+  const int padded = g.blocks * 8;
+  const int step = g.stride_w * g.in_c;
+  const __m256i offset = _mm256_set1_epi32(params.output_offset);
+  const __m256i lo = _mm256_set1_epi32(params.quantized_activation_min);
+  const __m256i hi = _mm256_set1_epi32(params.quantized_activation_max);
+  for (int ox = 0; ox < g.out_w; ox++) {
+    for (int c = 0; c < g.out_c; c += 8) {
+      __m256i acc = _mm256_setzero_si256();
+      const int32_t* w = scratch.filter32.data() + c;
+      for (int ky = 0; ky < g.k_h; ky++) {
+        const int16_t* x = rows[ky] + ox * step + c;
+        for (int kx = 0; kx < g.k_w; kx++, w += padded) {
+          const __m256i xv = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(x + kx * g.in_c)));
+          acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(xv, _mm256_loadu_si256((const __m256i*)w)));
+        }
+      }
+      RequantStoreAvx2(acc, c, std::min(8, g.out_c - c), offset, lo, hi,
+                       out + (size_t)ox * g.out_c + c);
+    }
+  }
+}
+
+EI_X86_SSE41 void DepthwiseRowSse41(const Geometry& g, const int16_t* const* rows,
+                                    const DepthwiseParams& params, int8_t* out) {
+  const int padded = g.blocks * 4;
+  const int step = g.stride_w * g.in_c;
+  for (int ox = 0; ox < g.out_w; ox++) {
+    for (int c = 0; c < g.out_c; c += 4) {
+      __m128i acc = _mm_setzero_si128();
+      const int32_t* w = scratch.filter32.data() + c;
+      for (int ky = 0; ky < g.k_h; ky++) {
+        const int16_t* x = rows[ky] + ox * step + c;
+        for (int kx = 0; kx < g.k_w; kx++, w += padded) {
+          const __m128i xv = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(x + kx * g.in_c)));
+          acc = _mm_add_epi32(acc, _mm_mullo_epi32(xv, _mm_loadu_si128((const __m128i*)w)));
+        }
+      }
+      int32_t a[4];
+      _mm_storeu_si128((__m128i*)a, acc);
+      int8_t* dst = out + (size_t)ox * g.out_c + c;
+      for (int l = 0; l < std::min(4, g.out_c - c); l++) {
+        dst[l] = RequantScalar(a[l], c + l, params.output_offset,
+                               params.quantized_activation_min, params.quantized_activation_max);
+      }
+    }
+  }
+}
+
+// =================== ADD ===================
+// Uniform multipliers and shifts, so both ISAs requantize in vectors
+EI_X86_AVX2 int AddAvx2(int size, const ArithmeticParams& p, const int8_t* a,
+                        const int8_t* b, int8_t* out) {
+  const __m128i left = _mm_cvtsi32_si128(p.left_shift);
+  const __m256i off1 = _mm256_set1_epi32(p.input1_offset);
+  const __m256i off2 = _mm256_set1_epi32(p.input2_offset);
+  const __m256i m1 = _mm256_set1_epi32(p.input1_multiplier);
+  const __m256i m2 = _mm256_set1_epi32(p.input2_multiplier);
+  const __m256i mo = _mm256_set1_epi32(p.output_multiplier);
+  const __m256i e1 = _mm256_set1_epi32(-p.input1_shift);
+  const __m256i e2 = _mm256_set1_epi32(-p.input2_shift);
+  const __m256i eo = _mm256_set1_epi32(-p.output_shift);
+  const __m256i offset = _mm256_set1_epi32(p.output_offset);
+  const __m256i lo = _mm256_set1_epi32(p.quantized_activation_min);
+  const __m256i hi = _mm256_set1_epi32(p.quantized_activation_max);
+  int i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256i x1 = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(a + i)));
+    __m256i x2 = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(b + i)));
+    x1 = _mm256_sll_epi32(_mm256_add_epi32(x1, off1), left);
+    x2 = _mm256_sll_epi32(_mm256_add_epi32(x2, off2), left);
+    x1 = RdbpAvx2(SrdhmAvx2(x1, m1), e1);
+    x2 = RdbpAvx2(SrdhmAvx2(x2, m2), e2);
+    __m256i sum = RdbpAvx2(SrdhmAvx2(_mm256_add_epi32(x1, x2), mo), eo);
+    sum = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(sum, offset), lo), hi);
+    const __m128i p16 = _mm_packs_epi32(_mm256_castsi256_si128(sum),
+                                        _mm256_extracti128_si256(sum, 1));
+    _mm_storel_epi64((__m128i*)(out + i), _mm_packs_epi16(p16, p16));
+  }
+  return i;
+}
+
+EI_X86_SSE41 inline __m128i SrdhmSse41(__m128i a, __m128i b) {
+  const __m128i nudge = _mm_set1_epi64x((int64_t)1 << 30);
+  const __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(a, b), nudge), 31);
+  const __m128i odd = _mm_add_epi64(
+      _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), nudge);
+  return _mm_blend_epi16(even, _mm_slli_epi64(odd, 1), 0xCC);
+}
+
+EI_X86_SSE41 inline __m128i RdbpSse41(__m128i x, int exponent) {
+  const __m128i mask = _mm_set1_epi32((int32_t)((1u << exponent) - 1));
+  const __m128i remainder = _mm_and_si128(x, mask);
+  const __m128i threshold = _mm_sub_epi32(_mm_srai_epi32(mask, 1),
+                                          _mm_cmpgt_epi32(_mm_setzero_si128(), x));
+  return _mm_sub_epi32(_mm_sra_epi32(x, _mm_cvtsi32_si128(exponent)),
+                       _mm_cmpgt_epi32(remainder, threshold));
+}
+
+EI_X86_SSE41 int AddSse41(int size, const ArithmeticParams& p, const int8_t* a,
+                          const int8_t* b, int8_t* out) {
+  const __m128i left = _mm_cvtsi32_si128(p.left_shift);
+  const __m128i off1 = _mm_set1_epi32(p.input1_offset);
+  const __m128i off2 = _mm_set1_epi32(p.input2_offset);
+  const __m128i m1 = _mm_set1_epi32(p.input1_multiplier);
+  const __m128i m2 = _mm_set1_epi32(p.input2_multiplier);
+  const __m128i mo = _mm_set1_epi32(p.output_multiplier);
+  const __m128i offset = _mm_set1_epi32(p.output_offset);
+  const __m128i lo = _mm_set1_epi32(p.quantized_activation_min);
+  const __m128i hi = _mm_set1_epi32(p.quantized_activation_max);
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    int32_t a4, b4;
+    memcpy(&a4, a + i, 4);
+    memcpy(&b4, b + i, 4);
+    __m128i x1 = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(a4));
+    __m128i x2 = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(b4));
+    x1 = _mm_sll_epi32(_mm_add_epi32(x1, off1), left);
+    x2 = _mm_sll_epi32(_mm_add_epi32(x2, off2), left);
+    x1 = RdbpSse41(SrdhmSse41(x1, m1), -p.input1_shift);
+    x2 = RdbpSse41(SrdhmSse41(x2, m2), -p.input2_shift);
+    __m128i sum = RdbpSse41(SrdhmSse41(_mm_add_epi32(x1, x2), mo), -p.output_shift);
+    sum = _mm_min_epi32(_mm_max_epi32(_mm_add_epi32(sum, offset), lo), hi);
+    const __m128i p16 = _mm_packs_epi32(sum, sum);
+    const int32_t packed = _mm_cvtsi128_si32(_mm_packs_epi16(p16, p16));
+    memcpy(out + i, &packed, 4);
+  }
+  return i;
+}
+
+}  // namespace
+
+// =================== DISPATCH ===================
+Isa DetectIsa() {
+#if !defined(TFLITE_SINGLE_ROUNDING) || !TFLITE_SINGLE_ROUNDING
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return kAvx2;
+  if (__builtin_cpu_supports("sse4.1")) return kSse41;
+#endif
+  // Single rounding requantizes differently; those builds keep the reference kernels
+  return kScalar;
+}
+
+Isa GetIsa() { return ActiveIsa(); }
+
+void SetIsa(Isa isa) { ActiveIsa() = std::min(isa, DetectIsa()); }
+
+const char* IsaName(Isa isa) {
+  switch (isa) {
+    case kAvx2:  return "avx2";
+    case kSse41: return "sse4.1";
+    default:     return "scalar";
+  }
+}
+
+bool ConvPerChannel(const ConvParams& params, const int32_t* output_multiplier,
+                    const int32_t* output_shift,
+                    const RuntimeShape& input_shape, const int8_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int32_t* bias_data,
+                    const RuntimeShape& output_shape, int8_t* output_data) {
+  const Isa isa = ActiveIsa();
+  Geometry g;
+  if (isa == kScalar || params.dilation_width_factor != 1 ||
+      params.dilation_height_factor != 1 ||
+      !FillGeometry(input_shape, filter_shape, output_shape, params.stride_width,
+                    params.stride_height, params.padding_values, &g) ||
+      filter_shape.Dims(0) != g.out_c || filter_shape.Dims(3) != g.in_c) {
+    return false;
+  }
+  g.pairs = (g.k_w * g.in_c + 1) / 2;
+  PackConvFilter(g, filter_data);
+  PackRequant(g, bias_data, output_multiplier, output_shift);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int16_t* rows[kMaxKernelHeight];
+  for (int b = 0; b < batches; b++) {
+    const int8_t* image = input_data + (size_t)b * g.in_h * g.in_w * g.in_c;
+    ResetRows(g);
+    for (int oy = 0; oy < g.out_h; oy++) {
+      for (int ky = 0; ky < g.k_h; ky++) {
+        rows[ky] = WidenedRow(g, image, oy * g.stride_h - g.pad_h + ky, params.input_offset);
+      }
+      int8_t* out = output_data + (((size_t)b * g.out_h + oy) * g.out_w) * g.out_c;
+      if (isa == kAvx2) {
+        ConvRowAvx2(g, rows, params, out);
+      } else {
+        ConvRowSse41(g, rows, params, out);
+      }
+    }
+  }
+  return true;
+}
+
+bool DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data) {
+  const Isa isa = ActiveIsa();
+  Geometry g;
+  if (isa == kScalar || params.depth_multiplier != 1 ||
+      params.dilation_width_factor != 1 || params.dilation_height_factor != 1 ||
+      !FillGeometry(input_shape, filter_shape, output_shape, params.stride_width,
+                    params.stride_height, params.padding_values, &g) ||
+      g.in_c != g.out_c || filter_shape.Dims(3) != g.out_c) {
+    return false;
+  }
+  g.pairs = 0;
+  PackDepthwiseFilter(g, filter_data);
+  PackRequant(g, bias_data, output_multiplier, output_shift);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int16_t* rows[kMaxKernelHeight];
+  for (int b = 0; b < batches; b++) {
+    const int8_t* image = input_data + (size_t)b * g.in_h * g.in_w * g.in_c;
+    ResetRows(g);
+    for (int oy = 0; oy < g.out_h; oy++) {
+      for (int ky = 0; ky < g.k_h; ky++) {
+        rows[ky] = WidenedRow(g, image, oy * g.stride_h - g.pad_h + ky, params.input_offset);
+      }
+      int8_t* out = output_data + (((size_t)b * g.out_h + oy) * g.out_w) * g.out_c;
+      if (isa == kAvx2) {
+        DepthwiseRowAvx2(g, rows, params, out);
+      } else {
+        DepthwiseRowSse41(g, rows, params, out);
+      }
+    }
+  }
+  return true;
+}
+
+bool AddElementwise(int size, const ArithmeticParams& params,
+                    const int8_t* input1_data, const int8_t* input2_data,
+                    int8_t* output_data) {
+  const Isa isa = ActiveIsa();
+  if (isa == kScalar) return false;
+  const int done = isa == kAvx2
+                       ? AddAvx2(size, params, input1_data, input2_data, output_data)
+                       : AddSse41(size, params, input1_data, input2_data, output_data);
+  reference_integer_ops::AddElementwise(size - done, params, input1_data + done,
+                                        input2_data + done, output_data + done);
+  return true;
+}
+
+}  // namespace x86_int8
+}  // namespace tflite
+
+#endif  // EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
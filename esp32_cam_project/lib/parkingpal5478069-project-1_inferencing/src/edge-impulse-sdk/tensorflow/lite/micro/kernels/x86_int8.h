@@ -0,0 +1,59 @@
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_X86_INT8_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_X86_INT8_H_
+
+#include <cstdint>
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace x86_int8 {
+
+// SSE4.1 / AVX2 int8 kernels for the reference build on x86 hosts
+// (EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD). The ISA is picked once from CPUID.
+// Results are bit-exact with reference_integer_ops: products are summed in
+// int32 from (input + input_offset) values widened to int16, and requantized
+// with the same double-rounding MultiplyByQuantizedMultiplier.
+//
+// Each entry point returns false, without touching the output, when the ISA
+// is kScalar or the shape is one it does not cover; the caller then runs the
+// reference kernel.
+enum Isa { kScalar = 0, kSse41 = 1, kAvx2 = 2 };
+
+// Best ISA the CPU (and OS) supports.
+Isa DetectIsa();
+
+// ISA the kernels use; starts at DetectIsa().
+Isa GetIsa();
+
+// Lowers the ISA for A/B runs, e.g. kScalar to force the reference kernels.
+// Clamped to DetectIsa().
+void SetIsa(Isa isa);
+
+const char* IsaName(Isa isa);
+
+// CONV_2D, per-channel int8, no dilation, no grouping.
+bool ConvPerChannel(const ConvParams& params, const int32_t* output_multiplier,
+                    const int32_t* output_shift,
+                    const RuntimeShape& input_shape, const int8_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int32_t* bias_data,
+                    const RuntimeShape& output_shape, int8_t* output_data);
+
+// DEPTHWISE_CONV_2D, per-channel int8, depth multiplier 1, no dilation.
+bool DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data);
+
+// ADD, int8, same-shape inputs (AddElementwise).
+bool AddElementwise(int size, const ArithmeticParams& params,
+                    const int8_t* input1_data, const int8_t* input2_data,
+                    int8_t* output_data);
+
+}  // namespace x86_int8
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_X86_INT8_H_
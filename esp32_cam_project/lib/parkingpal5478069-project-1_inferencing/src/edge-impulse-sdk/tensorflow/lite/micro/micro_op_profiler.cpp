@@ -0,0 +1,134 @@
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_op_profiler.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+
+namespace {
+constexpr uint32_t kNoEvent = 0xFFFFFFFF;
+}  // namespace
+
+int MicroOpProfiler::FindOrAddTag(const char* tag) {
+  const int hint = last_tag_ + 1;
+  if (hint < num_tags_ && tags_[hint].tag == tag) {
+    return hint;
+  }
+  for (int i = 0; i < num_tags_; ++i) {
+    if (tags_[i].tag == tag || strcmp(tags_[i].tag, tag) == 0) {
+      return i;
+    }
+  }
+  if (num_tags_ == kMaxTags) {
+    return -1;
+  }
+  TagStats& s = tags_[num_tags_];
+  memset(&s, 0, sizeof(s));
+  s.tag = tag;
+  s.min_ticks = kNoEvent;
+  return num_tags_++;
+}
+
+uint32_t MicroOpProfiler::BeginEvent(const char* tag) {
+  const int i = FindOrAddTag(tag);
+  if (i < 0) {
+    return kNoEvent;
+  }
+  last_tag_ = i;
+  tags_[i].start_ticks = GetCurrentTimeTicks();
+  return (uint32_t)i;
+}
+
+void MicroOpProfiler::EndEvent(uint32_t event_handle) {
+  const uint32_t now = GetCurrentTimeTicks();
+  if (event_handle >= (uint32_t)num_tags_) {
+    return;
+  }
+  TagStats& s = tags_[event_handle];
+  const uint32_t ticks = now - s.start_ticks;
+  s.window[s.count % kWindow] = ticks;
+  s.count++;
+  s.sum_ticks += ticks;
+  s.min_ticks = std::min(s.min_ticks, ticks);
+  s.max_ticks = std::max(s.max_ticks, ticks);
+}
+
+void MicroOpProfiler::SetCost(const char* tag, uint64_t macs, uint32_t bytes) {
+  const int i = FindOrAddTag(tag);
+  if (i < 0) {
+    return;
+  }
+  tags_[i].macs = macs;
+  tags_[i].bytes = bytes;
+}
+
+void MicroOpProfiler::Clear() {
+  for (int i = 0; i < num_tags_; ++i) {
+    TagStats& s = tags_[i];
+    s.count = 0;
+    s.sum_ticks = 0;
+    s.min_ticks = kNoEvent;
+    s.max_ticks = 0;
+  }
+  last_tag_ = -1;
+}
+
+bool MicroOpProfiler::GetStats(int index, MicroOpStats* stats) const {
+  if (index < 0 || index >= num_tags_ || stats == nullptr) {
+    return false;
+  }
+  const TagStats& s = tags_[index];
+  stats->tag = s.tag;
+  stats->count = s.count;
+  stats->macs = s.macs;
+  stats->bytes = s.bytes;
+  if (s.count == 0) {
+    stats->min_ticks = stats->mean_ticks = stats->p99_ticks = stats->max_ticks = 0;
+    return true;
+  }
+  stats->min_ticks = s.min_ticks;
+  stats->max_ticks = s.max_ticks;
+  stats->mean_ticks = (uint32_t)(s.sum_ticks / s.count);
+
+  uint32_t sorted[kWindow];
+  const int n = (int)std::min<uint32_t>(s.count, kWindow);
+  memcpy(sorted, s.window, n * sizeof(uint32_t));
+  std::sort(sorted, sorted + n);
+  stats->p99_ticks = sorted[(n * 99) / 100];
+  return true;
+}
+
+uint32_t MicroOpProfiler::GetTotalMeanTicks() const {
+  uint32_t total = 0;
+  for (int i = 0; i < num_tags_; ++i) {
+    if (tags_[i].count) {
+      total += (uint32_t)(tags_[i].sum_ticks / tags_[i].count);
+    }
+  }
+  return total;
+}
+
+void MicroOpProfiler::Log() const {
+  const uint32_t total = GetTotalMeanTicks();
+  ei_printf("%-24s %6s %8s %8s %8s %8s %6s %10s %8s %7s\n", "tag", "n", "min", "mean",
+            "p99", "max", "%", "MACs", "bytes", "MAC/t");
+  for (int i = 0; i < num_tags_; ++i) {
+    MicroOpStats st;
+    GetStats(i, &st);
+    if (st.count == 0) {
+      continue;   // registered by SetCost() but never ran, e.g. fused nodes
+    }
+    const float share = total ? 100.0f * st.mean_ticks / total : 0.0f;
+    const float mac_per_tick = st.mean_ticks ? (float)st.macs / st.mean_ticks : 0.0f;
+    ei_printf("%-24s %6u %8u %8u %8u %8u %6.1f %10u %8u %7.1f\n", st.tag,
+              (unsigned)st.count, (unsigned)st.min_ticks, (unsigned)st.mean_ticks,
+              (unsigned)st.p99_ticks, (unsigned)st.max_ticks, share,
+              (unsigned)st.macs, (unsigned)st.bytes, mac_per_tick);
+  }
+  ei_printf("total mean ticks per pass: %u\n", (unsigned)total);
+}
+
+}  // namespace tflite
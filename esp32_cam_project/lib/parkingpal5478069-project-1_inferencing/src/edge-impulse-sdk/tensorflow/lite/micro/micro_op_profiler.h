@@ -0,0 +1,79 @@
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_OP_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_OP_PROFILER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/compatibility.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_profiler_interface.h"
+
+namespace tflite {
+
+// Aggregated statistics for one tag of a MicroOpProfiler. Ticks come from
+// GetCurrentTimeTicks(), which is ei_read_timer_us() on Edge Impulse ports.
+struct MicroOpStats {
+  const char* tag;
+  uint32_t count;       // completed events
+  uint32_t min_ticks;
+  uint32_t mean_ticks;
+  uint32_t p99_ticks;   // over the last kWindow events
+  uint32_t max_ticks;
+  uint64_t macs;        // per event, from SetCost()
+  uint32_t bytes;       // tensor bytes read + written per event, from SetCost()
+};
+
+// MicroProfilerInterface that aggregates events per tag instead of keeping
+// every event like MicroProfiler, so it can stay attached across thousands
+// of invocations. Meant for one tag per graph node: tags are matched by
+// pointer first, then by string.
+class MicroOpProfiler : public MicroProfilerInterface {
+ public:
+  static constexpr int kMaxTags = 32;
+  static constexpr int kWindow = 100;
+
+  MicroOpProfiler() = default;
+  virtual ~MicroOpProfiler() = default;
+
+  virtual uint32_t BeginEvent(const char* tag) override;
+  virtual void EndEvent(uint32_t event_handle) override;
+
+  // Static cost of one event with this tag (registers the tag if needed).
+  void SetCost(const char* tag, uint64_t macs, uint32_t bytes);
+
+  // Drops all samples, keeps tags and costs.
+  void Clear();
+
+  int NumTags() const { return num_tags_; }
+  bool GetStats(int index, MicroOpStats* stats) const;
+
+  // Sum of the per-tag mean ticks, i.e. one average pass over all tags.
+  uint32_t GetTotalMeanTicks() const;
+
+  // Prints one row per tag that ran through ei_printf.
+  void Log() const;
+
+ private:
+  struct TagStats {
+    const char* tag;
+    uint32_t start_ticks;
+    uint32_t count;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    uint64_t sum_ticks;
+    uint64_t macs;
+    uint32_t bytes;
+    uint32_t window[kWindow];
+  };
+
+  int FindOrAddTag(const char* tag);
+
+  TagStats tags_[kMaxTags];
+  int num_tags_ = 0;
+  int last_tag_ = -1;   // nodes run in order, so the next tag is the usual hit
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_OP_PROFILER_H_
@@ -85,6 +85,11 @@ const ei_config_tflite_eon_graph_t ei_config_graph_3 = {
     .model_reset = &tflite_learn_3_reset,
     .model_input = &tflite_learn_3_input,
     .model_output = &tflite_learn_3_output,
+#if EI_CLASSIFIER_PROFILE_OPS
+    .model_set_profiler = &tflite_learn_3_set_profiler,
+    .model_node_info = &tflite_learn_3_node_info,
+    .model_node_output = &tflite_learn_3_node_output,
+#endif
 };
 
 const uint8_t ei_output_tensors_indices_3[1] = { 0 };
@@ -32,10 +32,21 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <new>
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+#if EI_CLASSIFIER_PROFILE_OPS
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_profiler_interface.h"
+#endif
+#if EI_CLASSIFIER_TILED_STEM
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
+#endif
 
 #if EI_CLASSIFIER_PRINT_STATE
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -94,9 +105,9 @@ using namespace tflite::ops::micro;
 namespace {
 
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX) || defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX_GNU)
-constexpr int kTensorArenaSize = 242576;
+constexpr int kTensorArenaSize = 154976;
 #else
-constexpr int kTensorArenaSize = 241552;
+constexpr int kTensorArenaSize = 153952;
 #endif
 
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC)
@@ -116,15 +127,12 @@ uint8_t tensor_arena[kTensorArenaSize] ALIGN(16) __attribute__((section(".tensor
 uint8_t* tensor_arena = NULL;
 #endif
 
-static uint8_t* tensor_boundary;
-static uint8_t* current_location;
-
 template <int SZ, class T> struct TfArray {
   int sz; T elem[SZ];
 };
 
 enum used_operators_e {
-  OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_PAD, OP_ADD, OP_SOFTMAX,  OP_LAST
+  OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_ADD, OP_SOFTMAX,  OP_LAST
 };
 
 struct TensorInfo_t { // subset of TfLiteTensor used for initialization from constant memory
@@ -146,25 +154,18 @@ typedef struct {
   int16_t index;
 } TfLiteEvalTensorWithIndex;
 
-TfLiteContext ctx{};
 static const int MAX_TFL_TENSOR_COUNT = 4;
-static TfLiteTensorWithIndex tflTensors[MAX_TFL_TENSOR_COUNT];
 static const int MAX_TFL_EVAL_COUNT = 4;
-static TfLiteEvalTensorWithIndex tflEvalTensors[MAX_TFL_EVAL_COUNT];
-TfLiteRegistration registrations[OP_LAST];
 
+// Graph tables from here through out_tensor_indices, and kTensorArenaSize, are
+// the export in host_tools/eon_export/ after `eon_plan --fold-pad`; do not edit
+// them by hand. `make -C host_tools fold` checks they still are. Re-export
+// steps: docs/HOST_TOOLS.md, "PAD fold".
 namespace g0 {
 const TfArray<4, int> tensor_dimension0 = { 4, { 1,96,96,1 } };
 const TfArray<1, float> quant0_scale = { 1, { 0.0039215688593685627, } };
 const TfArray<1, int> quant0_zero = { 1, { -128 } };
 const TfLiteAffineQuantization quant0 = { (TfLiteFloatArray*)&quant0_scale, (TfLiteIntArray*)&quant0_zero, 0 };
-const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int32_t tensor_data1[4*2] = { 
-  0, 0, 
-  0, 1, 
-  0, 1, 
-  0, 0, 
-};
-const TfArray<2, int> tensor_dimension1 = { 2, { 4,2 } };
 const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(8) int32_t tensor_data2[2] = { 34880, -39412, };
 const TfArray<1, int> tensor_dimension2 = { 1, { 2 } };
 const TfArray<2, float> quant2_scale = { 2, { 0.00017218115681316704, 0.00015014453674666584, } };
@@ -948,7 +949,6 @@ const TfArray<1, float> quant46_scale = { 1, { 0.10935978591442108, } };
 const TfArray<1, int> quant46_zero = { 1, { 12 } };
 const TfLiteAffineQuantization quant46 = { (TfLiteFloatArray*)&quant46_scale, (TfLiteIntArray*)&quant46_zero, 0 };
 const TfArray<4, int> tensor_dimension47 = { 4, { 1,48,48,48 } };
-const TfArray<4, int> tensor_dimension48 = { 4, { 1,49,49,48 } };
 const TfArray<4, int> tensor_dimension49 = { 4, { 1,24,24,48 } };
 const TfArray<4, int> tensor_dimension50 = { 4, { 1,24,24,8 } };
 const TfArray<1, float> quant50_scale = { 1, { 0.076384343206882477, } };
@@ -960,7 +960,6 @@ const TfLiteAffineQuantization quant53 = { (TfLiteFloatArray*)&quant53_scale, (T
 const TfArray<1, float> quant54_scale = { 1, { 0.089281268417835236, } };
 const TfArray<1, int> quant54_zero = { 1, { -22 } };
 const TfLiteAffineQuantization quant54 = { (TfLiteFloatArray*)&quant54_scale, (TfLiteIntArray*)&quant54_zero, 0 };
-const TfArray<4, int> tensor_dimension56 = { 4, { 1,25,25,48 } };
 const TfArray<4, int> tensor_dimension57 = { 4, { 1,12,12,48 } };
 const TfArray<4, int> tensor_dimension58 = { 4, { 1,12,12,16 } };
 const TfArray<1, float> quant58_scale = { 1, { 0.055347558110952377, } };
@@ -988,89 +987,84 @@ const TfLiteAffineQuantization quant69 = { (TfLiteFloatArray*)&quant69_scale, (T
 const TfArray<1, float> quant70_scale = { 1, { 0.00390625, } };
 const TfLiteAffineQuantization quant70 = { (TfLiteFloatArray*)&quant70_scale, (TfLiteIntArray*)&g0::quant0_zero, 0 };
 const TfLiteConvParams opdata0 = { kTfLitePaddingSame, 2,2, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs0 = { 3, { 0,43,42 } };
-const TfArray<1, int> outputs0 = { 1, { 44 } };
+const TfArray<3, int> inputs0 = { 3, { 0,42,41 } };
+const TfArray<1, int> outputs0 = { 1, { 43 } };
 const TfLiteDepthwiseConvParams opdata1 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs1 = { 3, { 44,41,40 } };
-const TfArray<1, int> outputs1 = { 1, { 45 } };
+const TfArray<3, int> inputs1 = { 3, { 43,40,39 } };
+const TfArray<1, int> outputs1 = { 1, { 44 } };
 const TfLiteConvParams opdata2 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs2 = { 3, { 45,39,38 } };
-const TfArray<1, int> outputs2 = { 1, { 46 } };
+const TfArray<3, int> inputs2 = { 3, { 44,38,37 } };
+const TfArray<1, int> outputs2 = { 1, { 45 } };
 const TfLiteConvParams opdata3 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs3 = { 3, { 46,37,36 } };
-const TfArray<1, int> outputs3 = { 1, { 47 } };
-const TfArray<2, int> inputs4 = { 2, { 47,1 } };
-const TfArray<1, int> outputs4 = { 1, { 48 } };
-const TfLiteDepthwiseConvParams opdata5 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs5 = { 3, { 48,35,34 } };
-const TfArray<1, int> outputs5 = { 1, { 49 } };
+const TfArray<3, int> inputs3 = { 3, { 45,36,35 } };
+const TfArray<1, int> outputs3 = { 1, { 46 } };
+const TfLiteDepthwiseConvParams opdata5 = { kTfLitePaddingSame, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs5 = { 3, { 46,34,33 } };
+const TfArray<1, int> outputs5 = { 1, { 47 } };
 const TfLiteConvParams opdata6 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs6 = { 3, { 49,33,32 } };
-const TfArray<1, int> outputs6 = { 1, { 50 } };
+const TfArray<3, int> inputs6 = { 3, { 47,32,31 } };
+const TfArray<1, int> outputs6 = { 1, { 48 } };
 const TfLiteConvParams opdata7 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs7 = { 3, { 50,31,30 } };
-const TfArray<1, int> outputs7 = { 1, { 51 } };
+const TfArray<3, int> inputs7 = { 3, { 48,30,29 } };
+const TfArray<1, int> outputs7 = { 1, { 49 } };
 const TfLiteDepthwiseConvParams opdata8 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs8 = { 3, { 51,29,28 } };
-const TfArray<1, int> outputs8 = { 1, { 52 } };
+const TfArray<3, int> inputs8 = { 3, { 49,28,27 } };
+const TfArray<1, int> outputs8 = { 1, { 50 } };
 const TfLiteConvParams opdata9 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs9 = { 3, { 52,27,26 } };
-const TfArray<1, int> outputs9 = { 1, { 53 } };
+const TfArray<3, int> inputs9 = { 3, { 50,26,25 } };
+const TfArray<1, int> outputs9 = { 1, { 51 } };
 const TfLiteAddParams opdata10 = { kTfLiteActNone };
-const TfArray<2, int> inputs10 = { 2, { 50,53 } };
-const TfArray<1, int> outputs10 = { 1, { 54 } };
+const TfArray<2, int> inputs10 = { 2, { 48,51 } };
+const TfArray<1, int> outputs10 = { 1, { 52 } };
 const TfLiteConvParams opdata11 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs11 = { 3, { 54,25,24 } };
-const TfArray<1, int> outputs11 = { 1, { 55 } };
-const TfArray<2, int> inputs12 = { 2, { 55,1 } };
-const TfArray<1, int> outputs12 = { 1, { 56 } };
-const TfLiteDepthwiseConvParams opdata13 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs13 = { 3, { 56,23,22 } };
-const TfArray<1, int> outputs13 = { 1, { 57 } };
+const TfArray<3, int> inputs11 = { 3, { 52,24,23 } };
+const TfArray<1, int> outputs11 = { 1, { 53 } };
+const TfLiteDepthwiseConvParams opdata13 = { kTfLitePaddingSame, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs13 = { 3, { 53,22,21 } };
+const TfArray<1, int> outputs13 = { 1, { 54 } };
 const TfLiteConvParams opdata14 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs14 = { 3, { 57,21,20 } };
-const TfArray<1, int> outputs14 = { 1, { 58 } };
+const TfArray<3, int> inputs14 = { 3, { 54,20,19 } };
+const TfArray<1, int> outputs14 = { 1, { 55 } };
 const TfLiteConvParams opdata15 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs15 = { 3, { 58,19,18 } };
-const TfArray<1, int> outputs15 = { 1, { 59 } };
+const TfArray<3, int> inputs15 = { 3, { 55,18,17 } };
+const TfArray<1, int> outputs15 = { 1, { 56 } };
 const TfLiteDepthwiseConvParams opdata16 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs16 = { 3, { 59,17,16 } };
-const TfArray<1, int> outputs16 = { 1, { 60 } };
+const TfArray<3, int> inputs16 = { 3, { 56,16,15 } };
+const TfArray<1, int> outputs16 = { 1, { 57 } };
 const TfLiteConvParams opdata17 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs17 = { 3, { 60,15,14 } };
-const TfArray<1, int> outputs17 = { 1, { 61 } };
+const TfArray<3, int> inputs17 = { 3, { 57,14,13 } };
+const TfArray<1, int> outputs17 = { 1, { 58 } };
 const TfLiteAddParams opdata18 = { kTfLiteActNone };
-const TfArray<2, int> inputs18 = { 2, { 58,61 } };
-const TfArray<1, int> outputs18 = { 1, { 62 } };
+const TfArray<2, int> inputs18 = { 2, { 55,58 } };
+const TfArray<1, int> outputs18 = { 1, { 59 } };
 const TfLiteConvParams opdata19 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs19 = { 3, { 62,13,12 } };
-const TfArray<1, int> outputs19 = { 1, { 63 } };
+const TfArray<3, int> inputs19 = { 3, { 59,12,11 } };
+const TfArray<1, int> outputs19 = { 1, { 60 } };
 const TfLiteDepthwiseConvParams opdata20 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs20 = { 3, { 63,11,10 } };
-const TfArray<1, int> outputs20 = { 1, { 64 } };
+const TfArray<3, int> inputs20 = { 3, { 60,10,9 } };
+const TfArray<1, int> outputs20 = { 1, { 61 } };
 const TfLiteConvParams opdata21 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs21 = { 3, { 64,9,8 } };
-const TfArray<1, int> outputs21 = { 1, { 65 } };
+const TfArray<3, int> inputs21 = { 3, { 61,8,7 } };
+const TfArray<1, int> outputs21 = { 1, { 62 } };
 const TfLiteAddParams opdata22 = { kTfLiteActNone };
-const TfArray<2, int> inputs22 = { 2, { 62,65 } };
-const TfArray<1, int> outputs22 = { 1, { 66 } };
+const TfArray<2, int> inputs22 = { 2, { 59,62 } };
+const TfArray<1, int> outputs22 = { 1, { 63 } };
 const TfLiteConvParams opdata23 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs23 = { 3, { 66,7,6 } };
-const TfArray<1, int> outputs23 = { 1, { 67 } };
+const TfArray<3, int> inputs23 = { 3, { 63,6,5 } };
+const TfArray<1, int> outputs23 = { 1, { 64 } };
 const TfLiteConvParams opdata24 = { kTfLitePaddingValid, 1,1, kTfLiteActRelu, 1,1 };
-const TfArray<3, int> inputs24 = { 3, { 67,5,4 } };
-const TfArray<1, int> outputs24 = { 1, { 68 } };
+const TfArray<3, int> inputs24 = { 3, { 64,4,3 } };
+const TfArray<1, int> outputs24 = { 1, { 65 } };
 const TfLiteConvParams opdata25 = { kTfLitePaddingValid, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs25 = { 3, { 68,3,2 } };
-const TfArray<1, int> outputs25 = { 1, { 69 } };
+const TfArray<3, int> inputs25 = { 3, { 65,2,1 } };
+const TfArray<1, int> outputs25 = { 1, { 66 } };
 const TfLiteSoftmaxParams opdata26 = { 1 };
-const TfArray<1, int> inputs26 = { 1, { 69 } };
-const TfArray<1, int> outputs26 = { 1, { 70 } };
+const TfArray<1, int> inputs26 = { 1, { 66 } };
+const TfArray<1, int> outputs26 = { 1, { 67 } };
 };
 
 TensorInfo_t tensorData[] = {
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension0, 9216, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
-{ kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data1, (TfLiteIntArray*)&g0::tensor_dimension1, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data2, (TfLiteIntArray*)&g0::tensor_dimension2, 8, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant2))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data3, (TfLiteIntArray*)&g0::tensor_dimension3, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant3))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data4, (TfLiteIntArray*)&g0::tensor_dimension4, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant4))}, },
@@ -1115,27 +1109,25 @@ TensorInfo_t tensorData[] = {
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data43, (TfLiteIntArray*)&g0::tensor_dimension43, 144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant43))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36864), (TfLiteIntArray*)&g0::tensor_dimension44, 36864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension44, 36864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36864), (TfLiteIntArray*)&g0::tensor_dimension46, 18432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant46))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 115248), (TfLiteIntArray*)&g0::tensor_dimension47, 110592, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension48, 115248, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 115248), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 110592), (TfLiteIntArray*)&g0::tensor_dimension46, 18432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant46))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension47, 110592, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 110592), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 55296), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant50))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant53))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant54))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30000), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension56, 30000, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30000), (TfLiteIntArray*)&g0::tensor_dimension57, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36912), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant58))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 55296), (TfLiteIntArray*)&g0::tensor_dimension50, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant54))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension49, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension57, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 34560), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant58))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant61))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant62))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 34560), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant62))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 16128), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant65))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant66))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant65))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 34560), (TfLiteIntArray*)&g0::tensor_dimension58, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant66))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension59, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant44))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension68, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant68))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 288), (TfLiteIntArray*)&g0::tensor_dimension69, 288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant69))}, },
@@ -1143,12 +1135,11 @@ TensorInfo_t tensorData[] = {
 };
 
 #ifndef TF_LITE_STATIC_MEMORY
-TfLiteNode tflNodes[27] = {
+TfLiteNode tflNodes[25] = {
 { (TfLiteIntArray*)&g0::inputs0, (TfLiteIntArray*)&g0::outputs0, (TfLiteIntArray*)&g0::inputs0, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata0)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs1, (TfLiteIntArray*)&g0::outputs1, (TfLiteIntArray*)&g0::inputs1, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata1)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs2, (TfLiteIntArray*)&g0::outputs2, (TfLiteIntArray*)&g0::inputs2, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata2)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs3, (TfLiteIntArray*)&g0::outputs3, (TfLiteIntArray*)&g0::inputs3, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata3)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs4, (TfLiteIntArray*)&g0::outputs4, (TfLiteIntArray*)&g0::inputs4, nullptr, nullptr, nullptr, nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs5, (TfLiteIntArray*)&g0::outputs5, (TfLiteIntArray*)&g0::inputs5, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata5)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs6, (TfLiteIntArray*)&g0::outputs6, (TfLiteIntArray*)&g0::inputs6, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata6)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs7, (TfLiteIntArray*)&g0::outputs7, (TfLiteIntArray*)&g0::inputs7, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata7)), nullptr, 0, },
@@ -1156,7 +1147,6 @@ TfLiteNode tflNodes[27] = {
 { (TfLiteIntArray*)&g0::inputs9, (TfLiteIntArray*)&g0::outputs9, (TfLiteIntArray*)&g0::inputs9, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata9)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs10, (TfLiteIntArray*)&g0::outputs10, (TfLiteIntArray*)&g0::inputs10, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata10)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs11, (TfLiteIntArray*)&g0::outputs11, (TfLiteIntArray*)&g0::inputs11, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata11)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs12, (TfLiteIntArray*)&g0::outputs12, (TfLiteIntArray*)&g0::inputs12, nullptr, nullptr, nullptr, nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs13, (TfLiteIntArray*)&g0::outputs13, (TfLiteIntArray*)&g0::inputs13, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata13)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs14, (TfLiteIntArray*)&g0::outputs14, (TfLiteIntArray*)&g0::inputs14, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata14)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs15, (TfLiteIntArray*)&g0::outputs15, (TfLiteIntArray*)&g0::inputs15, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata15)), nullptr, 0, },
@@ -1173,12 +1163,11 @@ TfLiteNode tflNodes[27] = {
 { (TfLiteIntArray*)&g0::inputs26, (TfLiteIntArray*)&g0::outputs26, (TfLiteIntArray*)&g0::inputs26, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata26)), nullptr, 0, },
 };
 #else
-TfLiteNode tflNodes[27] = {
+TfLiteNode tflNodes[25] = {
 { (TfLiteIntArray*)&g0::inputs0, (TfLiteIntArray*)&g0::outputs0, (TfLiteIntArray*)&g0::inputs0, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata0)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs1, (TfLiteIntArray*)&g0::outputs1, (TfLiteIntArray*)&g0::inputs1, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata1)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs2, (TfLiteIntArray*)&g0::outputs2, (TfLiteIntArray*)&g0::inputs2, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata2)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs3, (TfLiteIntArray*)&g0::outputs3, (TfLiteIntArray*)&g0::inputs3, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata3)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs4, (TfLiteIntArray*)&g0::outputs4, (TfLiteIntArray*)&g0::inputs4, nullptr, nullptr, nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs5, (TfLiteIntArray*)&g0::outputs5, (TfLiteIntArray*)&g0::inputs5, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata5)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs6, (TfLiteIntArray*)&g0::outputs6, (TfLiteIntArray*)&g0::inputs6, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata6)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs7, (TfLiteIntArray*)&g0::outputs7, (TfLiteIntArray*)&g0::inputs7, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata7)), nullptr, 0, },
@@ -1186,7 +1175,6 @@ TfLiteNode tflNodes[27] = {
 { (TfLiteIntArray*)&g0::inputs9, (TfLiteIntArray*)&g0::outputs9, (TfLiteIntArray*)&g0::inputs9, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata9)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs10, (TfLiteIntArray*)&g0::outputs10, (TfLiteIntArray*)&g0::inputs10, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata10)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs11, (TfLiteIntArray*)&g0::outputs11, (TfLiteIntArray*)&g0::inputs11, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata11)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs12, (TfLiteIntArray*)&g0::outputs12, (TfLiteIntArray*)&g0::inputs12, nullptr, nullptr, nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs13, (TfLiteIntArray*)&g0::outputs13, (TfLiteIntArray*)&g0::inputs13, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata13)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs14, (TfLiteIntArray*)&g0::outputs14, (TfLiteIntArray*)&g0::inputs14, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata14)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs15, (TfLiteIntArray*)&g0::outputs15, (TfLiteIntArray*)&g0::inputs15, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata15)), nullptr, 0, },
@@ -1205,12 +1193,12 @@ TfLiteNode tflNodes[27] = {
 #endif
 
 used_operators_e used_ops[] =
-{OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_SOFTMAX, };
+{OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_SOFTMAX, };
 
 
 // Indices into tflTensors and tflNodes for subgraphs
-const size_t tflTensors_subgraph_index[] = {0, 71, };
-const size_t tflNodes_subgraph_index[] = {0, 27, };
+const size_t tflTensors_subgraph_index[] = {0, 68, };
+const size_t tflNodes_subgraph_index[] = {0, 25, };
 
 // Input/output tensors
 static const int in_tensor_indices[] = {
@@ -1218,13 +1206,129 @@ static const int in_tensor_indices[] = {
 };
 
 static const int out_tensor_indices[] = {
-  70, 
+  67, 
+};
+
+
+static size_t ArenaOffset(size_t i) {
+#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
+  return (size_t)tensorData[i].data;
+#else
+  return (size_t)((uint8_t*)tensorData[i].data - tensor_arena);
+#endif
+}
+
+typedef struct {
+  size_t bytes;
+  void *ptr;
+} scratch_buffer_t;
+
+#if EI_CLASSIFIER_TILED_STEM
+// Stem (nodes 0-5, CONV -> DW -> CONV -> CONV -> DW -> CONV) run in row bands.
+// Each node output is a ring of rows as deep as its consumer's kernel, and a
+// row is computed when the next node first asks for it, so only the graph
+// input and node 5's output exist in full. The arithmetic is that of
+// reference_integer_ops ConvPerChannel / DepthwiseConvPerChannel.
+constexpr int kStemNodes = 6;
+constexpr int kStemMaxChannels = 48;
+constexpr int kStemMaxKernel = 3;
+
+struct StemLayer {
+  bool depthwise;
+  int in_h, in_w, in_c, out_h, out_w, out_c;
+  int k_h, k_w, stride_h, stride_w, pad_h, pad_w;
+  const int8_t* filter;
+  const int32_t* bias;
+  int32_t input_offset, output_offset, act_min, act_max;
+  int32_t multiplier[kStemMaxChannels];
+  int32_t shift[kStemMaxChannels];
+  int8_t* rows;     // ring of ring_rows output rows (last layer: output tensor)
+  int ring_rows;
+  int produced;     // output rows computed this invoke
 };
+#endif // EI_CLASSIFIER_TILED_STEM
 
+struct Instance;
+
+class EonMicroContext : public MicroContext {
+ public:
+
+  explicit EonMicroContext(Instance* instance): MicroContext(nullptr, nullptr, nullptr), instance_(instance) { }
+
+  Instance* instance() const { return instance_; }
+
+  void* AllocatePersistentBuffer(size_t bytes);
+
+  TfLiteStatus RequestScratchBufferInArena(size_t bytes,
+                                           int* buffer_index);
+
+  void* GetScratchBuffer(int buffer_index);
+
+  TfLiteTensor* AllocateTempTfLiteTensor(int tensor_index);
+
+  void DeallocateTempTfLiteTensor(TfLiteTensor* tensor) {
+    return;
+  }
+
+  bool IsAllTempTfLiteTensorDeallocated() {
+    return true;
+  }
 
-size_t current_subgraph_index = 0;
+  TfLiteEvalTensor* GetEvalTensor(int tensor_index);
 
-static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
+ private:
+  Instance* instance_;
+};
+
+// Everything init and invoke write. The tflite_learn_3_* functions drive
+// default_instance; tflite_learn_3_instance_*() create more. Separate
+// instances can be invoked from separate threads at the same time; init and
+// reset (which count live instances and fill the profiler tags) cannot.
+struct Instance {
+  explicit Instance(TfLiteNode* n) : micro_context(this), nodes(n) { }
+
+  uint8_t* arena = nullptr;
+  bool own_arena = false;           // from alloc_fnc, released by reset
+  uint8_t* tensor_boundary = nullptr;
+  uint8_t* current_location = nullptr;
+
+  TfLiteContext ctx{};
+  // Outlives init: ctx.impl_ must stay valid for as long as the graph is prepared
+  EonMicroContext micro_context;
+  TfLiteNode* nodes;                // tflNodes, or a copy (user_data is per instance)
+  TfLiteRegistration registrations[OP_LAST];
+  TfLiteTensorWithIndex tflTensors[MAX_TFL_TENSOR_COUNT];
+  TfLiteEvalTensorWithIndex tflEvalTensors[MAX_TFL_EVAL_COUNT];
+  size_t current_subgraph_index = 0;
+
+  void* overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT];
+  size_t overflow_buffers_ix = 0;
+  scratch_buffer_t scratch_buffers[EI_MAX_SCRATCH_BUFFER_COUNT];
+  size_t scratch_buffers_ix = 0;
+
+#if EI_CLASSIFIER_TILED_STEM
+  StemLayer stem[kStemNodes];
+  const int8_t* stem_input = nullptr;
+  bool stem_tiled = true;           // requested, see tflite_learn_3_set_tiled_stem()
+  bool stem_active = false;         // planned and prepared by the last init
+  size_t stem_buf_offset = 0;
+  size_t stem_buf_bytes = 0;
+  size_t stem_saved_bytes = 0;
+#endif
+
+#if EI_CLASSIFIER_PROFILE_OPS
+  MicroProfilerInterface* profiler = nullptr;
+#endif
+};
+
+static Instance default_instance(tflNodes);
+static size_t live_instances = 0;   // initialized and not reset; bind needs 0
+
+static Instance& InstanceOf(const struct TfLiteContext* context) {
+  return *static_cast<EonMicroContext*>(context->impl_)->instance();
+}
+
+static void init_tflite_tensor(const Instance& inst, size_t i, TfLiteTensor *tensor) {
   tensor->type = tensorData[i].type;
   tensor->is_variable = false;
 
@@ -1236,18 +1340,15 @@ static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
   tensor->bytes = tensorData[i].bytes;
   tensor->dims = tensorData[i].dims;
 
-#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
+  // Arena tensors live at their planned offset in this instance's arena
   if(tensor->allocation_type == kTfLiteArenaRw){
-    uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
+    uint8_t* start = inst.arena + ArenaOffset(i);
 
     tensor->data.data =  start;
   }
   else {
       tensor->data.data = tensorData[i].data;
   }
-#else
-  tensor->data.data = tensorData[i].data;
-#endif // EI_CLASSIFIER_ALLOCATION_HEAP
   tensor->quantization = tensorData[i].quantization;
   if (tensor->quantization.type == kTfLiteAffineQuantization) {
     TfLiteAffineQuantization const* quant = ((TfLiteAffineQuantization const*)(tensorData[i].quantization.params));
@@ -1257,7 +1358,7 @@ static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
 
 }
 
-static void init_tflite_eval_tensor(int i, TfLiteEvalTensor *tensor) {
+static void init_tflite_eval_tensor(const Instance& inst, int i, TfLiteEvalTensor *tensor) {
 
   tensor->type = tensorData[i].type;
 
@@ -1265,28 +1366,27 @@ static void init_tflite_eval_tensor(int i, TfLiteEvalTensor *tensor) {
 
 #if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
   auto allocation_type = tensorData[i].allocation_type;
+#else
+  auto allocation_type = (tensor_arena <= tensorData[i].data && tensorData[i].data < tensor_arena + kTensorArenaSize) ? kTfLiteArenaRw : kTfLiteMmapRo;
+#endif
   if(allocation_type == kTfLiteArenaRw) {
-    uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
+    uint8_t* start = inst.arena + ArenaOffset(i);
 
     tensor->data.data =  start;
   }
   else {
     tensor->data.data = tensorData[i].data;
   }
-#else
-  tensor->data.data = tensorData[i].data;
-#endif // EI_CLASSIFIER_ALLOCATION_HEAP
 }
 
-static void* overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT];
-static size_t overflow_buffers_ix = 0;
-static void * AllocatePersistentBufferImpl(struct TfLiteContext* ctx,
+static void * AllocatePersistentBufferImpl(struct TfLiteContext* context,
                                        size_t bytes) {
+  Instance& inst = InstanceOf(context);
   void *ptr;
   uint32_t align_bytes = (bytes % 16) ? 16 - (bytes % 16) : 0;
 
-  if (current_location - (bytes + align_bytes) < tensor_boundary) {
-    if (overflow_buffers_ix > EI_MAX_OVERFLOW_BUFFER_COUNT - 1) {
+  if (inst.current_location - (bytes + align_bytes) < inst.tensor_boundary) {
+    if (inst.overflow_buffers_ix > EI_MAX_OVERFLOW_BUFFER_COUNT - 1) {
       ei_printf("ERR: Failed to allocate persistent buffer of size %d, does not fit in tensor arena and reached EI_MAX_OVERFLOW_BUFFER_COUNT\n",
         (int)bytes);
       return NULL;
@@ -1299,33 +1399,26 @@ static void * AllocatePersistentBufferImpl(struct TfLiteContext* ctx,
       ei_printf("ERR: Failed to allocate persistent buffer of size %d\n", (int)bytes);
       return NULL;
     }
-    overflow_buffers[overflow_buffers_ix++] = ptr;
+    inst.overflow_buffers[inst.overflow_buffers_ix++] = ptr;
     return ptr;
   }
 
-  current_location -= bytes;
+  inst.current_location -= bytes;
 
   // align to the left aligned boundary of 16 bytes
-  current_location -= 15; // for alignment
-  current_location += 16 - ((uintptr_t)(current_location) & 15);
+  inst.current_location -= 15; // for alignment
+  inst.current_location += 16 - ((uintptr_t)(inst.current_location) & 15);
 
-  ptr = current_location;
+  ptr = inst.current_location;
   memset(ptr, 0, bytes);
 
   return ptr;
 }
 
-typedef struct {
-  size_t bytes;
-  void *ptr;
-} scratch_buffer_t;
-
-static scratch_buffer_t scratch_buffers[EI_MAX_SCRATCH_BUFFER_COUNT];
-static size_t scratch_buffers_ix = 0;
-
-static TfLiteStatus RequestScratchBufferInArenaImpl(struct TfLiteContext* ctx, size_t bytes,
+static TfLiteStatus RequestScratchBufferInArenaImpl(struct TfLiteContext* context, size_t bytes,
                                                 int* buffer_idx) {
-  if (scratch_buffers_ix > EI_MAX_SCRATCH_BUFFER_COUNT - 1) {
+  Instance& inst = InstanceOf(context);
+  if (inst.scratch_buffers_ix > EI_MAX_SCRATCH_BUFFER_COUNT - 1) {
     ei_printf("ERR: Failed to allocate scratch buffer of size %d, reached EI_MAX_SCRATCH_BUFFER_COUNT\n",
       (int)bytes);
     return kTfLiteError;
@@ -1334,55 +1427,57 @@ static TfLiteStatus RequestScratchBufferInArenaImpl(struct TfLiteContext* ctx, s
   scratch_buffer_t b;
   b.bytes = bytes;
 
-  b.ptr = AllocatePersistentBufferImpl(ctx, b.bytes);
+  b.ptr = AllocatePersistentBufferImpl(context, b.bytes);
   if (!b.ptr) {
     ei_printf("ERR: Failed to allocate scratch buffer of size %d\n",
       (int)bytes);
     return kTfLiteError;
   }
 
-  scratch_buffers[scratch_buffers_ix] = b;
-  *buffer_idx = scratch_buffers_ix;
+  inst.scratch_buffers[inst.scratch_buffers_ix] = b;
+  *buffer_idx = inst.scratch_buffers_ix;
 
-  scratch_buffers_ix++;
+  inst.scratch_buffers_ix++;
 
   return kTfLiteOk;
 }
 
-static void* GetScratchBufferImpl(struct TfLiteContext* ctx, int buffer_idx) {
-  if (buffer_idx > (int)scratch_buffers_ix) {
+static void* GetScratchBufferImpl(struct TfLiteContext* context, int buffer_idx) {
+  Instance& inst = InstanceOf(context);
+  if (buffer_idx > (int)inst.scratch_buffers_ix) {
     return NULL;
   }
-  return scratch_buffers[buffer_idx].ptr;
+  return inst.scratch_buffers[buffer_idx].ptr;
 }
 
 static const uint16_t TENSOR_IX_UNUSED = 0x7FFF;
 
-static void ResetTensors() {
+static void ResetTensors(Instance& inst) {
   for (size_t ix = 0; ix < MAX_TFL_TENSOR_COUNT; ix++) {
-    tflTensors[ix].index = TENSOR_IX_UNUSED;
+    inst.tflTensors[ix].index = TENSOR_IX_UNUSED;
   }
   for (size_t ix = 0; ix < MAX_TFL_EVAL_COUNT; ix++) {
-    tflEvalTensors[ix].index = TENSOR_IX_UNUSED;
+    inst.tflEvalTensors[ix].index = TENSOR_IX_UNUSED;
   }
 }
 
 static TfLiteTensor* GetTensorImpl(const struct TfLiteContext* context,
                                int tensor_idx) {
+  Instance& inst = InstanceOf(context);
 
-  tensor_idx = tflTensors_subgraph_index[current_subgraph_index] + tensor_idx;
+  tensor_idx = tflTensors_subgraph_index[inst.current_subgraph_index] + tensor_idx;
 
   for (size_t ix = 0; ix < MAX_TFL_TENSOR_COUNT; ix++) {
     // already used? OK!
-    if (tflTensors[ix].index == tensor_idx) {
-      return &tflTensors[ix].tensor;
+    if (inst.tflTensors[ix].index == tensor_idx) {
+      return &inst.tflTensors[ix].tensor;
     }
     // passed all the ones we've used, so end of the list?
-    if (tflTensors[ix].index == TENSOR_IX_UNUSED) {
+    if (inst.tflTensors[ix].index == TENSOR_IX_UNUSED) {
       // init the tensor
-      init_tflite_tensor(tensor_idx, &tflTensors[ix].tensor);
-      tflTensors[ix].index = tensor_idx;
-      return &tflTensors[ix].tensor;
+      init_tflite_tensor(inst, tensor_idx, &inst.tflTensors[ix].tensor);
+      inst.tflTensors[ix].index = tensor_idx;
+      return &inst.tflTensors[ix].tensor;
     }
   }
 
@@ -1392,20 +1487,21 @@ static TfLiteTensor* GetTensorImpl(const struct TfLiteContext* context,
 
 static TfLiteEvalTensor* GetEvalTensorImpl(const struct TfLiteContext* context,
                                        int tensor_idx) {
+  Instance& inst = InstanceOf(context);
 
-  tensor_idx = tflTensors_subgraph_index[current_subgraph_index] + tensor_idx;
+  tensor_idx = tflTensors_subgraph_index[inst.current_subgraph_index] + tensor_idx;
 
   for (size_t ix = 0; ix < MAX_TFL_EVAL_COUNT; ix++) {
     // already used? OK!
-    if (tflEvalTensors[ix].index == tensor_idx) {
-      return &tflEvalTensors[ix].tensor;
+    if (inst.tflEvalTensors[ix].index == tensor_idx) {
+      return &inst.tflEvalTensors[ix].tensor;
     }
     // passed all the ones we've used, so end of the list?
-    if (tflEvalTensors[ix].index == TENSOR_IX_UNUSED) {
+    if (inst.tflEvalTensors[ix].index == TENSOR_IX_UNUSED) {
       // init the tensor
-      init_tflite_eval_tensor(tensor_idx, &tflEvalTensors[ix].tensor);
-      tflEvalTensors[ix].index = tensor_idx;
-      return &tflEvalTensors[ix].tensor;
+      init_tflite_eval_tensor(inst, tensor_idx, &inst.tflEvalTensors[ix].tensor);
+      inst.tflEvalTensors[ix].index = tensor_idx;
+      return &inst.tflEvalTensors[ix].tensor;
     }
   }
 
@@ -1413,146 +1509,435 @@ static TfLiteEvalTensor* GetEvalTensorImpl(const struct TfLiteContext* context,
   return nullptr;
 }
 
-class EonMicroContext : public MicroContext {
- public:
- 
-  EonMicroContext(): MicroContext(nullptr, nullptr, nullptr) { }
+void* EonMicroContext::AllocatePersistentBuffer(size_t bytes) {
+  return AllocatePersistentBufferImpl(&instance_->ctx, bytes);
+}
+
+TfLiteStatus EonMicroContext::RequestScratchBufferInArena(size_t bytes,
+                                                          int* buffer_index) {
+  return RequestScratchBufferInArenaImpl(&instance_->ctx, bytes, buffer_index);
+}
+
+void* EonMicroContext::GetScratchBuffer(int buffer_index) {
+  return GetScratchBufferImpl(&instance_->ctx, buffer_index);
+}
+
+TfLiteTensor* EonMicroContext::AllocateTempTfLiteTensor(int tensor_index) {
+  return GetTensorImpl(&instance_->ctx, tensor_index);
+}
+
+TfLiteEvalTensor* EonMicroContext::GetEvalTensor(int tensor_index) {
+  return GetEvalTensorImpl(&instance_->ctx, tensor_index);
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+static const char* const op_names[OP_LAST] = {
+  "CONV_2D", "DEPTHWISE_CONV_2D", "ADD", "SOFTMAX",
+};
+static char node_tags[25][24];
+#if EI_CLASSIFIER_TILED_STEM
+static const char* const stem_tag = "05 STEM (00-05 tiled)";   // named after the node it outputs
+#endif
 
-  void* AllocatePersistentBuffer(size_t bytes) {
-    return AllocatePersistentBufferImpl(nullptr, bytes);
+static void InitNodeTags() {
+  if (node_tags[0][0]) return;
+  for (size_t i = 0; i < 25; ++i) {
+    snprintf(node_tags[i], sizeof(node_tags[i]), "%02u %s", (unsigned)i, op_names[used_ops[i]]);
   }
+}
 
-  TfLiteStatus RequestScratchBufferInArena(size_t bytes,
-                                           int* buffer_index) {
-  return RequestScratchBufferInArenaImpl(nullptr, bytes, buffer_index);
+static uint64_t ElementCount(const TfLiteIntArray* dims) {
+  uint64_t n = 1;
+  for (int d = 0; d < dims->size; ++d) {
+    n *= dims->data[d];
   }
+  return n;
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
 
-  void* GetScratchBuffer(int buffer_index) {
-    return GetScratchBufferImpl(nullptr, buffer_index);
+#if EI_CLASSIFIER_TILED_STEM
+static bool StemIntermediate(int t) {
+  for (int i = 0; i < kStemNodes - 1; ++i) {
+    if (tflNodes[i].outputs->data[0] == t) return true;
   }
- 
-  TfLiteTensor* AllocateTempTfLiteTensor(int tensor_index) {
-    return GetTensorImpl(nullptr, tensor_index);
+  return false;
+}
+
+static size_t StemRowBytes(const Instance& inst, int l) {
+  return ((size_t)inst.stem[l].out_w * inst.stem[l].out_c + 15) & ~(size_t)15;
+}
+
+// Checks the chain and lays out its line buffers; needs no arena yet.
+static bool StemPlan(Instance& inst) {
+  for (int i = 0; i < kStemNodes; ++i) {
+    const TfLiteNode& n = tflNodes[i];
+    StemLayer& L = inst.stem[i];
+    if ((used_ops[i] != OP_CONV_2D && used_ops[i] != OP_DEPTHWISE_CONV_2D) ||
+        n.inputs->size != 3 || n.inputs->data[2] < 0 ||
+        (i > 0 && n.inputs->data[0] != tflNodes[i - 1].outputs->data[0])) {
+      return false;
+    }
+    const TfLiteIntArray* in = tensorData[n.inputs->data[0]].dims;
+    const TfLiteIntArray* f = tensorData[n.inputs->data[1]].dims;
+    const TfLiteIntArray* out = tensorData[n.outputs->data[0]].dims;
+    if (tensorData[n.inputs->data[0]].type != kTfLiteInt8 || in->size != 4 || in->data[0] != 1) {
+      return false;
+    }
+    TfLitePadding padding;
+    int dilation_h, dilation_w;
+    L.depthwise = used_ops[i] == OP_DEPTHWISE_CONV_2D;
+    if (L.depthwise) {
+      const TfLiteDepthwiseConvParams* p = (const TfLiteDepthwiseConvParams*)n.builtin_data;
+      if (p->depth_multiplier != 1) return false;
+      padding = p->padding;
+      L.stride_h = p->stride_height;
+      L.stride_w = p->stride_width;
+      dilation_h = p->dilation_height_factor;
+      dilation_w = p->dilation_width_factor;
+    } else {
+      const TfLiteConvParams* p = (const TfLiteConvParams*)n.builtin_data;
+      padding = p->padding;
+      L.stride_h = p->stride_height;
+      L.stride_w = p->stride_width;
+      dilation_h = p->dilation_height_factor;
+      dilation_w = p->dilation_width_factor;
+    }
+    L.in_h = in->data[1];
+    L.in_w = in->data[2];
+    L.in_c = in->data[3];
+    L.out_h = out->data[1];
+    L.out_w = out->data[2];
+    L.out_c = out->data[3];
+    L.k_h = f->data[1];
+    L.k_w = f->data[2];
+    int out_h, out_w;
+    const TfLitePaddingValues pad = ComputePaddingHeightWidth(
+        L.stride_h, L.stride_w, dilation_h, dilation_w, L.in_h, L.in_w, L.k_h, L.k_w,
+        padding, &out_h, &out_w);
+    L.pad_h = pad.height;
+    L.pad_w = pad.width;
+    if (dilation_h != 1 || dilation_w != 1 || out_h != L.out_h || out_w != L.out_w ||
+        L.out_c > kStemMaxChannels || L.k_h > kStemMaxKernel ||
+        (L.depthwise ? L.in_c != L.out_c : f->data[3] != L.in_c)) {
+      return false;
+    }
   }
 
-  void DeallocateTempTfLiteTensor(TfLiteTensor* tensor) {
-    return;
+  // Intermediates must feed the next stem node only
+  for (size_t i = kStemNodes; i < sizeof(used_ops) / sizeof(used_ops[0]); ++i) {
+    for (int ix = 0; ix < tflNodes[i].inputs->size; ++ix) {
+      if (StemIntermediate(tflNodes[i].inputs->data[ix])) return false;
+    }
+  }
+  for (size_t ix = 0; ix < sizeof(out_tensor_indices) / sizeof(out_tensor_indices[0]); ++ix) {
+    if (StemIntermediate(out_tensor_indices[ix])) return false;
   }
 
-  bool IsAllTempTfLiteTensorDeallocated() {
-    return true;
+  size_t buf_bytes = 0;
+  for (int l = 0; l < kStemNodes - 1; ++l) {
+    inst.stem[l].ring_rows = inst.stem[l + 1].k_h;
+    buf_bytes += inst.stem[l].ring_rows * StemRowBytes(inst, l);
+  }
+  inst.stem_buf_bytes = buf_bytes;
+  inst.stem[kStemNodes - 1].ring_rows = inst.stem[kStemNodes - 1].out_h;
+
+  // Nothing but the stem input and output is live while the stem runs, so
+  // the line buffers go in the first gap that misses both.
+  const int in_t = tflNodes[0].inputs->data[0];
+  const int out_t = tflNodes[kStemNodes - 1].outputs->data[0];
+  const size_t in_lo = ArenaOffset(in_t), in_hi = in_lo + tensorData[in_t].bytes;
+  const size_t out_lo = ArenaOffset(out_t), out_hi = out_lo + tensorData[out_t].bytes;
+  const size_t candidates[3] = { 0, (in_hi + 15) & ~(size_t)15, (out_hi + 15) & ~(size_t)15 };
+  inst.stem_buf_offset = ((in_hi > out_hi ? in_hi : out_hi) + 15) & ~(size_t)15;
+  for (size_t c : candidates) {
+    const size_t end = c + buf_bytes;
+    if ((end <= in_lo || c >= in_hi) && (end <= out_lo || c >= out_hi)) {
+      inst.stem_buf_offset = c;
+      break;
+    }
   }
 
-  TfLiteEvalTensor* GetEvalTensor(int tensor_index) {
-    return GetEvalTensorImpl(nullptr, tensor_index);
+  size_t full_end = 0, tiled_end = inst.stem_buf_offset + buf_bytes;
+  for (size_t i = 0; i < sizeof(tensorData) / sizeof(tensorData[0]); ++i) {
+    if (tensorData[i].allocation_type != kTfLiteArenaRw) continue;
+    const size_t end = ArenaOffset(i) + tensorData[i].bytes;
+    full_end = end > full_end ? end : full_end;
+    if (!StemIntermediate((int)i)) tiled_end = end > tiled_end ? end : tiled_end;
   }
+  inst.stem_saved_bytes = full_end > tiled_end ? full_end - tiled_end : 0;
+  return true;
+}
 
-};
+// Quantization as the kernels' Prepare computes it, plus arena pointers.
+static TfLiteStatus StemPrepare(Instance& inst) {
+  int8_t* buf = (int8_t*)(inst.arena + inst.stem_buf_offset);
+  for (int i = 0; i < kStemNodes; ++i) {
+    const TfLiteNode& n = tflNodes[i];
+    StemLayer& L = inst.stem[i];
+    TfLiteTensor input, filter, bias, output;
+    init_tflite_tensor(inst, n.inputs->data[0], &input);
+    init_tflite_tensor(inst, n.inputs->data[1], &filter);
+    init_tflite_tensor(inst, n.inputs->data[2], &bias);
+    init_tflite_tensor(inst, n.outputs->data[0], &output);
+    const TfLiteFusedActivation activation = L.depthwise
+        ? ((const TfLiteDepthwiseConvParams*)n.builtin_data)->activation
+        : ((const TfLiteConvParams*)n.builtin_data)->activation;
+    int32_t multiplier;
+    int shift;
+    TF_LITE_ENSURE_STATUS(PopulateConvolutionQuantizationParams(
+        &inst.ctx, &input, &filter, &bias, &output, activation, &multiplier, &shift,
+        &L.act_min, &L.act_max, L.multiplier, L.shift, L.out_c));
+    L.input_offset = -input.params.zero_point;
+    L.output_offset = output.params.zero_point;
+    L.filter = (const int8_t*)filter.data.data;
+    L.bias = (const int32_t*)bias.data.data;
+    if (i == 0) {
+      inst.stem_input = (const int8_t*)input.data.data;
+    }
+    if (i == kStemNodes - 1) {
+      L.rows = (int8_t*)output.data.data;
+    } else {
+      L.rows = buf;
+      buf += L.ring_rows * StemRowBytes(inst, i);
+    }
+  }
+  return kTfLiteOk;
+}
 
+static int8_t* StemRowPtr(const Instance& inst, int l, int y) {
+  const StemLayer& L = inst.stem[l];
+  const size_t bytes = (l == kStemNodes - 1) ? (size_t)L.out_w * L.out_c : StemRowBytes(inst, l);
+  return L.rows + (y % L.ring_rows) * bytes;
+}
 
-} // namespace
+static void StemEnsure(Instance& inst, int l, int y);
 
-TfLiteStatus tflite_learn_3_init( void*(*alloc_fnc)(size_t,size_t) ) {
+static void StemComputeRow(Instance& inst, int l, int y) {
+  const StemLayer& L = inst.stem[l];
+  const int y0 = y * L.stride_h - L.pad_h;
+
+  // Produce every input row first: later rows may reuse ring slots
+  for (int ky = 0; ky < L.k_h; ++ky) {
+    if (l > 0 && y0 + ky >= 0 && y0 + ky < L.in_h) StemEnsure(inst, l - 1, y0 + ky);
+  }
+  const int8_t* in_rows[kStemMaxKernel];
+  for (int ky = 0; ky < L.k_h; ++ky) {
+    const int iy = y0 + ky;
+    if (iy < 0 || iy >= L.in_h) {
+      in_rows[ky] = nullptr;
+    } else {
+      in_rows[ky] = (l == 0) ? inst.stem_input + (size_t)iy * L.in_w * L.in_c : StemRowPtr(inst, l - 1, iy);
+    }
+  }
+
+  int8_t* out = StemRowPtr(inst, l, y);
+  for (int x = 0; x < L.out_w; ++x) {
+    const int x0 = x * L.stride_w - L.pad_w;
+    for (int oc = 0; oc < L.out_c; ++oc) {
+      int32_t acc = 0;
+      for (int ky = 0; ky < L.k_h; ++ky) {
+        if (!in_rows[ky]) continue;
+        for (int kx = 0; kx < L.k_w; ++kx) {
+          const int ix = x0 + kx;
+          if (ix < 0 || ix >= L.in_w) continue;
+          const int8_t* in = in_rows[ky] + ix * L.in_c;
+          if (L.depthwise) {
+            acc += L.filter[(ky * L.k_w + kx) * L.out_c + oc] * (in[oc] + L.input_offset);
+          } else {
+            const int8_t* f = L.filter + ((oc * L.k_h + ky) * L.k_w + kx) * L.in_c;
+            for (int ic = 0; ic < L.in_c; ++ic) {
+              acc += f[ic] * (in[ic] + L.input_offset);
+            }
+          }
+        }
+      }
+      acc += L.bias[oc];
+      acc = MultiplyByQuantizedMultiplier(acc, L.multiplier[oc], L.shift[oc]);
+      acc += L.output_offset;
+      acc = acc < L.act_min ? L.act_min : (acc > L.act_max ? L.act_max : acc);
+      out[x * L.out_c + oc] = (int8_t)acc;
+    }
+  }
+}
+
+static void StemEnsure(Instance& inst, int l, int y) {
+  while (inst.stem[l].produced <= y) {
+    StemComputeRow(inst, l, inst.stem[l].produced);
+    inst.stem[l].produced++;
+  }
+}
+
+static void StemInvoke(Instance& inst) {
+  for (int l = 0; l < kStemNodes; ++l) {
+    inst.stem[l].produced = 0;
+  }
+  StemEnsure(inst, kStemNodes - 1, inst.stem[kStemNodes - 1].out_h - 1);
+}
+
+#endif // EI_CLASSIFIER_TILED_STEM
+
+static TfLiteStatus Init(Instance& inst, void*(*alloc_fnc)(size_t,size_t)) {
+  size_t arena_size = kTensorArenaSize;
+#if EI_CLASSIFIER_PROFILE_OPS
+  InitNodeTags();   // before any invoke can read them
+#endif
+#if EI_CLASSIFIER_TILED_STEM
+  inst.stem_active = inst.stem_tiled && StemPlan(inst);
 #ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  tensor_arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
-  if (!tensor_arena) {
-    ei_printf("ERR: failed to allocate tensor arena\n");
-    return kTfLiteError;
+  // The persistent/scratch headroom above the tensors stays the same
+  if (inst.stem_active) {
+    arena_size -= inst.stem_saved_bytes;
   }
+#endif
+#endif
+#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
+  inst.own_arena = true;
 #else
-  memset(tensor_arena, 0, kTensorArenaSize);
+  // The static arena belongs to the default instance
+  inst.own_arena = &inst != &default_instance;
 #endif
-  tensor_boundary = tensor_arena;
-  current_location = tensor_arena + kTensorArenaSize;
+  if (!inst.arena) {
+    live_instances++;
+  }
+  if (inst.own_arena) {
+    inst.arena = (uint8_t*) alloc_fnc(16, arena_size);
+    if (!inst.arena) {
+      live_instances--;
+      ei_printf("ERR: failed to allocate tensor arena\n");
+      return kTfLiteError;
+    }
+  }
+  else {
+    inst.arena = tensor_arena;
+    memset(inst.arena, 0, kTensorArenaSize);
+  }
+  inst.tensor_boundary = inst.arena;
+  inst.current_location = inst.arena + arena_size;
 
-  EonMicroContext micro_context_;
-  
   // Set microcontext as the context ptr
-  ctx.impl_ = static_cast<void*>(&micro_context_);
+  inst.ctx.impl_ = static_cast<void*>(&inst.micro_context);
   // Setup tflitecontext functions
-  ctx.AllocatePersistentBuffer = &AllocatePersistentBufferImpl;
-  ctx.RequestScratchBufferInArena = &RequestScratchBufferInArenaImpl;
-  ctx.GetScratchBuffer = &GetScratchBufferImpl;
-  ctx.GetTensor = &GetTensorImpl;
-  ctx.GetEvalTensor = &GetEvalTensorImpl;
-  ctx.ReportError = &MicroContextReportOpError;
-
-  ctx.tensors_size = 71;
-  for (size_t i = 0; i < 71; ++i) {
+  inst.ctx.AllocatePersistentBuffer = &AllocatePersistentBufferImpl;
+  inst.ctx.RequestScratchBufferInArena = &RequestScratchBufferInArenaImpl;
+  inst.ctx.GetScratchBuffer = &GetScratchBufferImpl;
+  inst.ctx.GetTensor = &GetTensorImpl;
+  inst.ctx.GetEvalTensor = &GetEvalTensorImpl;
+  inst.ctx.ReportError = &MicroContextReportOpError;
+
+  inst.ctx.tensors_size = 68;
+  for (size_t i = 0; i < 68; ++i) {
     TfLiteTensor tensor;
-    init_tflite_tensor(i, &tensor);
+    init_tflite_tensor(inst, i, &tensor);
+#if EI_CLASSIFIER_TILED_STEM
+    if (inst.stem_active && StemIntermediate((int)i)) {
+      continue;
+    }
+#endif
     if (tensor.allocation_type == kTfLiteArenaRw) {
       auto data_end_ptr = (uint8_t*)tensor.data.data + tensorData[i].bytes;
-      if (data_end_ptr > tensor_boundary) {
-        tensor_boundary = data_end_ptr;
+      if (data_end_ptr > inst.tensor_boundary) {
+        inst.tensor_boundary = data_end_ptr;
       }
     }
   }
+#if EI_CLASSIFIER_TILED_STEM
+  if (inst.stem_active && inst.arena + inst.stem_buf_offset + inst.stem_buf_bytes > inst.tensor_boundary) {
+    inst.tensor_boundary = inst.arena + inst.stem_buf_offset + inst.stem_buf_bytes;
+  }
+#endif
 
-  if (tensor_boundary > current_location /* end of arena size */) {
+  if (inst.tensor_boundary > inst.current_location /* end of arena size */) {
     ei_printf("ERR: tensor arena is too small, does not fit model - even without scratch buffers\n");
     return kTfLiteError;
   }
 
-  registrations[OP_CONV_2D] = Register_CONV_2D();
-  registrations[OP_DEPTHWISE_CONV_2D] = Register_DEPTHWISE_CONV_2D();
-  registrations[OP_PAD] = Register_PAD();
-  registrations[OP_ADD] = Register_ADD();
-  registrations[OP_SOFTMAX] = Register_SOFTMAX();
+  inst.registrations[OP_CONV_2D] = Register_CONV_2D();
+  inst.registrations[OP_DEPTHWISE_CONV_2D] = Register_DEPTHWISE_CONV_2D();
+  inst.registrations[OP_ADD] = Register_ADD();
+  inst.registrations[OP_SOFTMAX] = Register_SOFTMAX();
 
   for (size_t g = 0; g < 1; ++g) {
-    current_subgraph_index = g;
+    inst.current_subgraph_index = g;
     for(size_t i = tflNodes_subgraph_index[g]; i < tflNodes_subgraph_index[g+1]; ++i) {
-      if (registrations[used_ops[i]].init) {
-        tflNodes[i].user_data = registrations[used_ops[i]].init(&ctx, (const char*)tflNodes[i].builtin_data, 0);
+#if EI_CLASSIFIER_TILED_STEM
+      if (inst.stem_active && i < kStemNodes) {
+        continue;
+      }
+#endif
+      if (inst.registrations[used_ops[i]].init) {
+        inst.nodes[i].user_data = inst.registrations[used_ops[i]].init(&inst.ctx, (const char*)inst.nodes[i].builtin_data, 0);
       }
     }
   }
-  current_subgraph_index = 0;
+  inst.current_subgraph_index = 0;
 
   for(size_t g = 0; g < 1; ++g) {
-    current_subgraph_index = g;
+    inst.current_subgraph_index = g;
     for(size_t i = tflNodes_subgraph_index[g]; i < tflNodes_subgraph_index[g+1]; ++i) {
-      if (registrations[used_ops[i]].prepare) {
-        ResetTensors();
-        TfLiteStatus status = registrations[used_ops[i]].prepare(&ctx, &tflNodes[i]);
+#if EI_CLASSIFIER_TILED_STEM
+      if (inst.stem_active && i < kStemNodes) {
+        continue;
+      }
+#endif
+      if (inst.registrations[used_ops[i]].prepare) {
+        ResetTensors(inst);
+        TfLiteStatus status = inst.registrations[used_ops[i]].prepare(&inst.ctx, &inst.nodes[i]);
         if (status != kTfLiteOk) {
           return status;
         }
       }
     }
   }
-  current_subgraph_index = 0;
-
-  return kTfLiteOk;
-}
+  inst.current_subgraph_index = 0;
 
-TfLiteStatus tflite_learn_3_input(int index, TfLiteTensor *tensor) {
-  init_tflite_tensor(in_tensor_indices[index], tensor);
-  return kTfLiteOk;
-}
+#if EI_CLASSIFIER_TILED_STEM
+  if (inst.stem_active) {
+    TF_LITE_ENSURE_STATUS(StemPrepare(inst));
+  }
+#endif
 
-TfLiteStatus tflite_learn_3_output(int index, TfLiteTensor *tensor) {
-  init_tflite_tensor(out_tensor_indices[index], tensor);
   return kTfLiteOk;
 }
 
-TfLiteStatus tflite_learn_3_invoke() {
-  for (size_t i = 0; i < 27; ++i) {
-    ResetTensors();
+static TfLiteStatus Invoke(Instance& inst) {
+  size_t first = 0;
+#if EI_CLASSIFIER_TILED_STEM
+  if (inst.stem_active) {
+#if EI_CLASSIFIER_PROFILE_OPS
+    const uint32_t event = inst.profiler ? inst.profiler->BeginEvent(stem_tag) : 0;
+#endif
+    StemInvoke(inst);
+#if EI_CLASSIFIER_PROFILE_OPS
+    if (inst.profiler) {
+      inst.profiler->EndEvent(event);
+    }
+#endif
+    first = kStemNodes;
+  }
+#endif
+  for (size_t i = first; i < 25; ++i) {
+    ResetTensors(inst);
 
-    TfLiteStatus status = registrations[used_ops[i]].invoke(&ctx, &tflNodes[i]);
+#if EI_CLASSIFIER_PROFILE_OPS
+    const uint32_t event = inst.profiler ? inst.profiler->BeginEvent(node_tags[i]) : 0;
+#endif
+    TfLiteStatus status = inst.registrations[used_ops[i]].invoke(&inst.ctx, &inst.nodes[i]);
+#if EI_CLASSIFIER_PROFILE_OPS
+    if (inst.profiler) {
+      inst.profiler->EndEvent(event);
+    }
+#endif
 
 #if EI_CLASSIFIER_PRINT_STATE
     ei_printf("layer %lu\n", i);
     ei_printf("    inputs:\n");
-    for (size_t ix = 0; ix < tflNodes[i].inputs->size; ix++) {
-      auto d = tensorData[tflNodes[i].inputs->data[ix]];
+    for (size_t ix = 0; ix < inst.nodes[i].inputs->size; ix++) {
+      auto d = tensorData[inst.nodes[i].inputs->data[ix]];
 
       size_t data_ptr = (size_t)d.data;
 
       if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
+        data_ptr = (size_t)inst.arena + ArenaOffset(inst.nodes[i].inputs->data[ix]);
       }
 
       if (d.type == TfLiteType::kTfLiteInt8) {
@@ -1574,13 +1959,13 @@ TfLiteStatus tflite_learn_3_invoke() {
     ei_printf("\n");
 
     ei_printf("    outputs:\n");
-    for (size_t ix = 0; ix < tflNodes[i].outputs->size; ix++) {
-      auto d = tensorData[tflNodes[i].outputs->data[ix]];
+    for (size_t ix = 0; ix < inst.nodes[i].outputs->size; ix++) {
+      auto d = tensorData[inst.nodes[i].outputs->data[ix]];
 
       size_t data_ptr = (size_t)d.data;
 
       if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
+        data_ptr = (size_t)inst.arena + ArenaOffset(inst.nodes[i].outputs->data[ix]);
       }
 
       if (d.type == TfLiteType::kTfLiteInt8) {
@@ -1609,18 +1994,331 @@ TfLiteStatus tflite_learn_3_invoke() {
   return kTfLiteOk;
 }
 
-TfLiteStatus tflite_learn_3_reset( void (*free_fnc)(void* ptr) ) {
-#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  free_fnc(tensor_arena);
-#endif
+static TfLiteStatus Reset(Instance& inst, void (*free_fnc)(void* ptr)) {
+  if (inst.own_arena) {
+    free_fnc(inst.arena);
+    inst.own_arena = false;
+  }
+  if (inst.arena) {
+    inst.arena = nullptr;
+    live_instances--;
+  }
 
   // scratch buffers are allocated within the arena, so just reset the counter so memory can be reused
-  scratch_buffers_ix = 0;
+  inst.scratch_buffers_ix = 0;
 
   // overflow buffers are on the heap, so free them first
-  for (size_t ix = 0; ix < overflow_buffers_ix; ix++) {
-    ei_free(overflow_buffers[ix]);
+  for (size_t ix = 0; ix < inst.overflow_buffers_ix; ix++) {
+    ei_free(inst.overflow_buffers[ix]);
+  }
+  inst.overflow_buffers_ix = 0;
+  return kTfLiteOk;
+}
+
+// Model blob binding (tflite_learn_3_bind): tensorData is pointed at the
+// blob's constants and at quantization records built over its arrays. The
+// compiled pointers are kept to restore.
+static const size_t kTensorCount = sizeof(tensorData) / sizeof(tensorData[0]);
+static const int op_builtin[OP_LAST] = {
+  BuiltinOperator_CONV_2D, BuiltinOperator_DEPTHWISE_CONV_2D, BuiltinOperator_ADD, BuiltinOperator_SOFTMAX,
+};
+static void* compiled_data[kTensorCount];
+static void* compiled_quant[kTensorCount];
+static bool compiled_saved = false;
+static TfLiteAffineQuantization bound_quant[kTensorCount];
+
+static void HashWord(uint32_t* h, int32_t v) {
+  for (int b = 0; b < 4; ++b) {
+    *h = (*h ^ (((uint32_t)v >> (8 * b)) & 0xFF)) * 16777619u;
+  }
+}
+
+static uint32_t GraphHash() {
+  uint32_t h = 2166136261u;
+  HashWord(&h, kTensorArenaSize);
+  HashWord(&h, (int32_t)kTensorCount);
+  for (size_t i = 0; i < kTensorCount; ++i) {
+    const TensorInfo_t& t = tensorData[i];
+    const bool in_arena = t.allocation_type == kTfLiteArenaRw;
+    HashWord(&h, t.type);
+    HashWord(&h, in_arena);
+    HashWord(&h, (int32_t)t.bytes);
+    HashWord(&h, in_arena ? (int32_t)ArenaOffset(i) : 0);
+    HashWord(&h, t.dims->size);
+    for (int d = 0; d < t.dims->size; ++d) {
+      HashWord(&h, t.dims->data[d]);
+    }
+  }
+  const size_t nodes = sizeof(used_ops) / sizeof(used_ops[0]);
+  HashWord(&h, (int32_t)nodes);
+  for (size_t i = 0; i < nodes; ++i) {
+    HashWord(&h, op_builtin[used_ops[i]]);
+    const TfLiteIntArray* io[2] = { tflNodes[i].inputs, tflNodes[i].outputs };
+    for (const TfLiteIntArray* a : io) {
+      HashWord(&h, a->size);
+      for (int k = 0; k < a->size; ++k) {
+        HashWord(&h, a->data[k]);
+      }
+    }
+  }
+  return h;
+}
+
+static bool BindFits(size_t i, const tflite_learn_3_tensor_bind& b) {
+  const TensorInfo_t& t = tensorData[i];
+  if (b.data && (t.allocation_type != kTfLiteMmapRo || b.bytes != t.bytes)) {
+    return false;
+  }
+  if (!b.scale && !b.zero_point) {
+    return true;
+  }
+  if (!b.scale || !b.zero_point || t.quantization.type != kTfLiteAffineQuantization) {
+    return false;
+  }
+  const TfLiteAffineQuantization* q = (const TfLiteAffineQuantization*)compiled_quant[i];
+  return b.scale->size == q->scale->size && b.zero_point->size == q->zero_point->size &&
+         b.quantized_dimension == q->quantized_dimension;
+}
+
+} // namespace
+
+// Owns its copy of the node table, since kernels keep their state in user_data
+struct tflite_learn_3_instance {
+  tflite_learn_3_instance() : model(tflNodes) {
+    for (size_t i = 0; i < 25; ++i) {
+      nodes[i] = tflNodes[i];
+      nodes[i].user_data = nullptr;
+    }
+    model.nodes = nodes;
+  }
+
+  TfLiteNode nodes[25];
+  Instance model;
+};
+
+TfLiteStatus tflite_learn_3_init( void*(*alloc_fnc)(size_t,size_t) ) {
+  return Init(default_instance, alloc_fnc);
+}
+
+TfLiteStatus tflite_learn_3_input(int index, TfLiteTensor *tensor) {
+  init_tflite_tensor(default_instance, in_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_output(int index, TfLiteTensor *tensor) {
+  init_tflite_tensor(default_instance, out_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_invoke() {
+  return Invoke(default_instance);
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+TfLiteStatus tflite_learn_3_set_profiler(tflite::MicroProfilerInterface* p) {
+  InitNodeTags();
+  default_instance.profiler = p;
+  return kTfLiteOk;
+}
+
+static void NodeCost(size_t node, uint64_t* macs, uint32_t* bytes) {
+  const TfLiteNode& n = tflNodes[node];
+
+  // Tensor bytes touched: every input (incl. weights/bias) and output once
+  uint32_t touched = 0;
+  for (int ix = 0; ix < n.inputs->size; ix++) {
+    if (n.inputs->data[ix] >= 0) touched += tensorData[n.inputs->data[ix]].bytes;
+  }
+  for (int ix = 0; ix < n.outputs->size; ix++) {
+    touched += tensorData[n.outputs->data[ix]].bytes;
+  }
+
+  const uint64_t out_elems = ElementCount(tensorData[n.outputs->data[0]].dims);
+  uint64_t m = 0;
+  switch (used_ops[node]) {
+    case OP_CONV_2D: {            // filter [out_c, kh, kw, in_c]
+      const TfLiteIntArray* f = tensorData[n.inputs->data[1]].dims;
+      m = out_elems * f->data[1] * f->data[2] * f->data[3];
+      break;
+    }
+    case OP_DEPTHWISE_CONV_2D: {  // filter [1, kh, kw, out_c]
+      const TfLiteIntArray* f = tensorData[n.inputs->data[1]].dims;
+      m = out_elems * f->data[1] * f->data[2];
+      break;
+    }
+    case OP_ADD:
+    case OP_SOFTMAX:
+      m = out_elems;
+      break;
+    default:
+      break;
+  }
+  *macs = m;
+  *bytes = touched;
+}
+
+TfLiteStatus tflite_learn_3_node_info(size_t node, const char** tag, uint64_t* macs, uint32_t* bytes) {
+  if (node >= 25) {
+    return kTfLiteError;
+  }
+  InitNodeTags();
+#if EI_CLASSIFIER_TILED_STEM
+  // The tiled stem reports as one event, charged with the whole chain
+  if (node == kStemNodes - 1 && default_instance.stem_tiled && StemPlan(default_instance)) {
+    uint64_t m = 0;
+    uint32_t b = 0;
+    for (size_t i = 0; i < kStemNodes; ++i) {
+      uint64_t node_macs;
+      uint32_t node_bytes;
+      NodeCost(i, &node_macs, &node_bytes);
+      m += node_macs;
+      b += node_bytes;
+      if (i < kStemNodes - 1) {
+        b -= 2 * tensorData[tflNodes[i].outputs->data[0]].bytes;   // never leaves the line buffers
+      }
+    }
+    *tag = stem_tag;
+    *macs = m;
+    *bytes = b;
+    return kTfLiteOk;
+  }
+#endif
+  *tag = node_tags[node];
+  NodeCost(node, macs, bytes);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_node_output(size_t node, TfLiteTensor* tensor) {
+  if (node >= sizeof(used_ops) / sizeof(used_ops[0])) {
+    return kTfLiteError;
+  }
+#if EI_CLASSIFIER_TILED_STEM
+  if (default_instance.stem_active && node < kStemNodes - 1) {
+    return kTfLiteError;   // only ever held as line buffers
+  }
+#endif
+  init_tflite_tensor(default_instance, tflNodes[node].outputs->data[0], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_graph_info(size_t* arena_size, size_t* tensors, size_t* nodes) {
+  *arena_size = kTensorArenaSize;
+  *tensors = sizeof(tensorData) / sizeof(tensorData[0]);
+  *nodes = sizeof(used_ops) / sizeof(used_ops[0]);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_tensor_info(size_t tensor, bool* in_arena, size_t* offset, size_t* bytes) {
+  if (tensor >= sizeof(tensorData) / sizeof(tensorData[0])) {
+    return kTfLiteError;
+  }
+  const TensorInfo_t& t = tensorData[tensor];
+  *in_arena = t.allocation_type == kTfLiteArenaRw;
+  *offset = *in_arena ? ArenaOffset(tensor) : 0;
+  *bytes = t.bytes;
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_node_io(size_t node, const TfLiteIntArray** inputs, const TfLiteIntArray** outputs) {
+  if (node >= sizeof(used_ops) / sizeof(used_ops[0])) {
+    return kTfLiteError;
+  }
+  *inputs = tflNodes[node].inputs;
+  *outputs = tflNodes[node].outputs;
+  return kTfLiteOk;
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
+
+#if EI_CLASSIFIER_TILED_STEM
+TfLiteStatus tflite_learn_3_set_tiled_stem(bool tiled) {
+  default_instance.stem_tiled = tiled;
+  return kTfLiteOk;
+}
+#endif
+
+TfLiteStatus tflite_learn_3_bind(const tflite_learn_3_tensor_bind* tensors, size_t count) {
+  if (live_instances) {
+    return kTfLiteError;   // an instance is initialized: reset it first
+  }
+  if (!compiled_saved) {
+    for (size_t i = 0; i < kTensorCount; ++i) {
+      compiled_data[i] = tensorData[i].data;
+      compiled_quant[i] = tensorData[i].quantization.params;
+    }
+    compiled_saved = true;
+  }
+  if (tensors) {
+    if (count != kTensorCount) {
+      return kTfLiteError;
+    }
+    // Check every entry before changing anything
+    for (size_t i = 0; i < kTensorCount; ++i) {
+      if (!BindFits(i, tensors[i])) {
+        return kTfLiteError;
+      }
+    }
+  }
+  for (size_t i = 0; i < kTensorCount; ++i) {
+    tensorData[i].data = compiled_data[i];
+    tensorData[i].quantization.params = compiled_quant[i];
+    if (!tensors) {
+      continue;
+    }
+    const tflite_learn_3_tensor_bind& b = tensors[i];
+    if (b.data) {
+      tensorData[i].data = const_cast<void*>(b.data);
+    }
+    if (b.scale) {
+      bound_quant[i].scale = const_cast<TfLiteFloatArray*>(b.scale);
+      bound_quant[i].zero_point = const_cast<TfLiteIntArray*>(b.zero_point);
+      bound_quant[i].quantized_dimension = b.quantized_dimension;
+      tensorData[i].quantization.params = &bound_quant[i];
+    }
   }
-  overflow_buffers_ix = 0;
   return kTfLiteOk;
 }
+
+uint32_t tflite_learn_3_graph_hash() {
+  return GraphHash();
+}
+
+TfLiteStatus tflite_learn_3_reset( void (*free_fnc)(void* ptr) ) {
+  return Reset(default_instance, free_fnc);
+}
+
+tflite_learn_3_instance* tflite_learn_3_instance_new() {
+  return new (std::nothrow) tflite_learn_3_instance();
+}
+
+void tflite_learn_3_instance_delete(tflite_learn_3_instance* instance) {
+  delete instance;
+}
+
+TfLiteStatus tflite_learn_3_instance_init(tflite_learn_3_instance* instance, void*(*alloc_fnc)(size_t,size_t)) {
+  return Init(instance->model, alloc_fnc);
+}
+
+TfLiteStatus tflite_learn_3_instance_input(tflite_learn_3_instance* instance, int index, TfLiteTensor* tensor) {
+  init_tflite_tensor(instance->model, in_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_instance_output(tflite_learn_3_instance* instance, int index, TfLiteTensor* tensor) {
+  init_tflite_tensor(instance->model, out_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_3_instance_invoke(tflite_learn_3_instance* instance) {
+  return Invoke(instance->model);
+}
+
+TfLiteStatus tflite_learn_3_instance_reset(tflite_learn_3_instance* instance, void (*free_fnc)(void* ptr)) {
+  return Reset(instance->model, free_fnc);
+}
+
+#if EI_CLASSIFIER_TILED_STEM
+TfLiteStatus tflite_learn_3_instance_set_tiled_stem(tflite_learn_3_instance* instance, bool tiled) {
+  instance->model.stem_tiled = tiled;
+  return kTfLiteOk;
+}
+#endif
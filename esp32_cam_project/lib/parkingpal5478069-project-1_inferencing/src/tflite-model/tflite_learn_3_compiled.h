@@ -35,6 +35,14 @@
 
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 
+// Runs nodes 0-5 in row bands so their large activations never exist in full
+// (~76 KB arena instead of ~154 KB). Off by default: the row code is plain
+// C++, so those six layers no longer use the ESP-NN kernels, and it has not
+// been timed against them on the board.
+#ifndef EI_CLASSIFIER_TILED_STEM
+#define EI_CLASSIFIER_TILED_STEM 0
+#endif
+
 // Sets up the model with init and prepare steps.
 TfLiteStatus tflite_learn_3_init( void*(*alloc_fnc)(size_t,size_t) );
 // Returns the input tensor with the given index.
@@ -46,6 +54,60 @@ TfLiteStatus tflite_learn_3_invoke();
 //Frees memory allocated
 TfLiteStatus tflite_learn_3_reset( void (*free)(void* ptr) );
 
+#if EI_CLASSIFIER_TILED_STEM
+// Tiled (default) or node-by-node stem; takes effect at the next init.
+TfLiteStatus tflite_learn_3_set_tiled_stem(bool tiled);
+#endif
+
+// Constant data and quantization from outside the image: a model blob made
+// for this same graph (tflite_learn_3_graph_hash()). One entry per tensor;
+// nullptr data / scale keep the compiled ones, and tensors = nullptr restores
+// the compiled model. Sizes are checked against the compiled tensors. Call
+// while no instance is initialized; it applies from the next init.
+struct tflite_learn_3_tensor_bind {
+  const void* data;                    // constant tensors only
+  size_t bytes;
+  const TfLiteFloatArray* scale;
+  const TfLiteIntArray* zero_point;
+  int quantized_dimension;
+};
+TfLiteStatus tflite_learn_3_bind(const tflite_learn_3_tensor_bind* tensors, size_t count);
+// FNV-1a over the arena size, each tensor's type, size, shape and arena
+// offset, and each node's builtin op and wiring (op parameters not included).
+uint32_t tflite_learn_3_graph_hash();
+
+// Independent copies of the model, each with its own arena, tensors and
+// kernel state. Only invoke is thread-safe: separate instances may be invoked
+// from different threads at once, while init, reset and bind must not overlap
+// anything else. The EI DSP stage before invoke shares one image buffer and
+// its lookup tables, so it runs on one thread at a time as well. The
+// functions above drive a built-in instance of their own.
+struct tflite_learn_3_instance;
+tflite_learn_3_instance* tflite_learn_3_instance_new();
+void tflite_learn_3_instance_delete(tflite_learn_3_instance* instance);
+TfLiteStatus tflite_learn_3_instance_init(tflite_learn_3_instance* instance, void*(*alloc_fnc)(size_t,size_t));
+TfLiteStatus tflite_learn_3_instance_input(tflite_learn_3_instance* instance, int index, TfLiteTensor* tensor);
+TfLiteStatus tflite_learn_3_instance_output(tflite_learn_3_instance* instance, int index, TfLiteTensor* tensor);
+TfLiteStatus tflite_learn_3_instance_invoke(tflite_learn_3_instance* instance);
+TfLiteStatus tflite_learn_3_instance_reset(tflite_learn_3_instance* instance, void (*free)(void* ptr));
+#if EI_CLASSIFIER_TILED_STEM
+TfLiteStatus tflite_learn_3_instance_set_tiled_stem(tflite_learn_3_instance* instance, bool tiled);
+#endif
+
+#if EI_CLASSIFIER_PROFILE_OPS
+namespace tflite { class MicroProfilerInterface; }
+// Times every node through profiler (nullptr detaches).
+TfLiteStatus tflite_learn_3_set_profiler(tflite::MicroProfilerInterface* profiler);
+// Tag used for node, its MACs and tensor bytes touched per invoke.
+TfLiteStatus tflite_learn_3_node_info(size_t node, const char** tag, uint64_t* macs, uint32_t* bytes);
+// Output tensor of node (valid after invoke until the arena is reused).
+TfLiteStatus tflite_learn_3_node_output(size_t node, TfLiteTensor* tensor);
+// Graph layout for host tools (arena planner): sizes, tensor offsets, node wiring.
+TfLiteStatus tflite_learn_3_graph_info(size_t* arena_size, size_t* tensors, size_t* nodes);
+TfLiteStatus tflite_learn_3_tensor_info(size_t tensor, bool* in_arena, size_t* offset, size_t* bytes);
+TfLiteStatus tflite_learn_3_node_io(size_t node, const TfLiteIntArray** inputs, const TfLiteIntArray** outputs);
+#endif
+
 
 // Returns the number of input tensors.
 inline size_t tflite_learn_3_inputs() {
@@ -7,12 +7,32 @@ void setup_power_management() {
 
 #if SLEEP_MODE == 0
   Serial.println("[PWR] Using safe modem sleep mode (recommended)");
+#elif SLEEP_MODE == 2
+  Serial.println("[PWR] Using deep sleep between rendezvous slots");
 #else
   Serial.println("[PWR] Using light sleep mode");
 #endif
 }
 
 void idle_low_power() {
+#if RDV_ENABLE
+  // Radio off until the next listen slot; the EMF node holds triggers
+  const uint32_t ms = now_rdv_sleep_ms();
+#if SLEEP_MODE == 2
+  // Long gap: state to RTC memory, setup() resumes on the timer wake
+  if (ms >= DEEP_SLEEP_MIN_MS && !evidence_busy()) {
+    fast_resume_save(ms - DEEP_SLEEP_WAKE_MS);
+    enter_deep_sleep(ms - DEEP_SLEEP_WAKE_MS);
+  }
+#endif
+  if (ms >= RDV_MIN_SLEEP_MS && !evidence_busy()) {
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+    esp_light_sleep_start();
+    now_rdv_slept(ms);
+    return;
+  }
+#endif
+
 #if SLEEP_MODE == 0
   // Safe modem-sleep (recommended)
   WiFi.setSleep(true);
@@ -31,6 +51,6 @@ void enter_deep_sleep(uint32_t sleep_time_ms) {
   Serial.printf("[PWR] Entering deep sleep for %u ms\n", sleep_time_ms);
   Serial.flush();
 
-  esp_sleep_enable_timer_wakeup(sleep_time_ms * 1000); // Convert to microseconds
+  esp_sleep_enable_timer_wakeup((uint64_t)sleep_time_ms * 1000); // Convert to microseconds
   esp_deep_sleep_start();
 }
\ No newline at end of file
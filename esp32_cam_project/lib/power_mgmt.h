@@ -6,6 +6,9 @@
 #include <esp_wifi.h>
 #include <esp_sleep.h>
 #include "config.h"
+#include "esp_now_comm.h"  // From shared library
+#include "evidence.h"
+#include "fast_resume.h"
 
 // =================== POWER MANAGEMENT ===================
 void idle_low_power();
@@ -1,8 +1,21 @@
 /*
  * ESP32-CAM (AI-Thinker) + Edge Impulse + ESP-NOW
- * - RX: listens for trigger packets (wakes camera for ACTIVE_WINDOW_MS)
- * - Inference on small GRAYSCALE frames
+ * - RX: listens for trigger packets (wakes camera for ACTIVE_WINDOW_MS); while
+ *   idle the radio only listens in slots agreed with the EMF node
+ * - Window ends early once a decision is confirmed, extends while the scene moves
+ * - Frames are dropped until auto exposure settles, and when dark, blown
+ *   out, flat or blurred; a scene that stays unusable ends the window
+ * - Inference on small GRAYSCALE frames; FOMO is skipped while the scene
+ *   matches the last confident result (cascade)
+ * - FOMO car boxes are fused over frames per cell; the hold timers run on
+ *   the fused bay confidence
  * - TX: sends OCCUPIED/VACANT status on state changes to receiver's MAC
+ * - Deep sleep (SLEEP_MODE 2) keeps its state in RTC memory; a timer wake
+ *   resumes it and skips the cold-boot delays
+ * - Model weights come from an A/B flash partition when one holds a valid
+ *   blob; "model a|b|builtin" on the serial console switches without reflash
+ * - Heap / stack low-water marks and the heap each EI stage holds are
+ *   reported on Serial and sent to the EMF node in heartbeats
  *
  * Core: Arduino-ESP32 2.0.4
  *
@@ -20,16 +33,90 @@
 #include "camera_ei.h"
 #include "car_detection.h"
 #include "power_mgmt.h"
+#include "active_window.h"
+#include "evidence.h"
+#include "cascade.h"
+#include "occupancy.h"
+#include "frame_gate.h"
+#include "fast_resume.h"
+#include "mem_place.h"
+#include "model_blob.h"
+#include "mem_telemetry.h"   // From shared library
 
 // =================== GLOBAL VARIABLES ===================
 // (Now defined in respective modules)
+#if EI_CLASSIFIER_PROFILE_OPS
+static tflite::MicroOpProfiler op_profiler;   // per-node timing, dumped at Camera OFF
+#endif
+
+// EI SDK heap (feature and result matrices): the porting layer's allocators
+// are weak, so they go through the placement policy instead
+void* ei_malloc(size_t size) { return mem_place_alloc(MEM_BUF_EI_HEAP, size, 4, false); }
+void* ei_calloc(size_t nitems, size_t size) {
+  if (size && nitems > SIZE_MAX / size) return nullptr;
+  return mem_place_alloc(MEM_BUF_EI_HEAP, nitems * size);
+}
+void ei_free(void* ptr) { mem_place_free(ptr); }
+
+// Impulse stage hook: EI heap allocations count to the stage running
+static void ei_stage(ei_impulse_stage_t stage) {
+  static const memt_sys_t sys[] = { MEMT_DSP, MEMT_NN, MEMT_POST };
+  memt_stage = sys[stage];
+}
+
+// EI signal view reading from ei_input_gray
+static void ei_signal(ei::signal_t* signal) {
+  signal->total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
+  signal->get_data = &ei_camera_get_data;
+  signal->gray_u8 = ei_input_gray;   // quantized input straight from the bytes (table lookup)
+}
+
+// Persistent session (arena + op prepare); model switches and the bench reopen it
+static bool session_open() { return run_classifier_session_open() == EI_IMPULSE_OK; }
+static void session_close() { run_classifier_session_close(); }
+
+#if MEM_BENCH_RUNS > 0
+// Placement benchmark ops: inference on ei_input_gray
+static bool bench_infer() {
+  ei::signal_t signal;
+  ei_signal(&signal);
+  ei_impulse_result_t result = { 0 };
+  return run_classifier(&signal, &result, false) == EI_IMPULSE_OK;
+}
+#endif
+
+// Serial console, one command per line ("model ...")
+static void console_poll() {
+  static char line[48];
+  static uint8_t len = 0;
+  while (Serial.available() > 0) {
+    const char c = (char)Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (len < sizeof(line) - 1) line[len++] = c;
+      continue;
+    }
+    if (!len) continue;
+    line[len] = '\0';
+    len = 0;
+#if MODEL_BLOB_ENABLE
+    if (model_blob_command(line)) {
+      if (!cam_inited) session_close();   // checked by opening; idle holds no arena
+      continue;
+    }
+#endif
+    Serial.printf("unknown command: %s\n", line);
+  }
+}
 
 // =================== ARDUINO SETUP ===================
 
 void setup() {
   Serial.begin(115200);
-  delay(100);
-  Serial.println("\nESP32-CAM + EI + ESP-NOW (PlatformIO VERSION)");
+  const bool warm = fast_resume_begin();
+  if (!warm) {
+    delay(100);
+    Serial.println("\nESP32-CAM + EI + ESP-NOW (PlatformIO VERSION)");
+  }
 
   // Initialize LED pin
   pinMode(LED_PIN, OUTPUT);
@@ -38,12 +125,16 @@ void setup() {
   // Initialize power management
   setup_power_management();
 
+  // Placement policy for the EI buffers; the arena follows it from the first model init
+  init_mem_place();
+  run_classifier_set_arena_allocator(mem_place_arena_alloc, mem_place_arena_free);
+  init_mem_telemetry();
+  run_classifier_set_stage_hook(ei_stage);
+
   // Allocate EI input buffer (GRAY)
-  delay(3000);
+  if (!warm) delay(3000);
   size_t sz_ei = (size_t)EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT; // 1 Bpp gray
-  ei_input_gray = (uint8_t*)ps_malloc(sz_ei);
-  if (!ei_input_gray) ei_input_gray = (uint8_t*)heap_caps_malloc(sz_ei, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-  if (!ei_input_gray) ei_input_gray = (uint8_t*)heap_caps_malloc(sz_ei, MALLOC_CAP_DEFAULT);
+  ei_input_gray = (uint8_t*)mem_place_alloc(MEM_BUF_EI_INPUT, sz_ei);
 
   if (!ei_input_gray) {
     Serial.printf("ERR: EI buffer alloc failed (%u bytes)\n", (unsigned)sz_ei);
@@ -51,21 +142,46 @@ void setup() {
     Serial.printf("EI gray buffer: %p (%u bytes)\n", (void*)ei_input_gray, (unsigned)sz_ei);
   }
 
+#if EI_CLASSIFIER_PROFILE_OPS
+  run_classifier_set_profiler(&op_profiler);
+#endif
+
   // Initialize car detection state machine
   init_car_detection();
 
-  // Initialize ESP-NOW communication
-  if (!init_now_rx_tx()) {
+  // Initialize ESP-NOW communication (warm: channel and clock from RTC memory)
+  if (!init_now_rx_tx(fast_resume_link())) {
     Serial.println("WARN: ESP-NOW RX/TX not initialized");
   }
+  init_evidence();
+  fast_resume_restore();
+
+#if MODEL_BLOB_ENABLE
+  // Weights from the newest valid model partition, else the compiled ones
+  init_model_blob({ session_open, session_close });
+#endif
+#if MEM_BENCH_RUNS > 0
+  if (ei_input_gray) mem_place_bench(MEM_BENCH_RUNS, { session_open, session_close, bench_infer });
+#endif
+  mem_place_report();
 
   Serial.println("System ready. Waiting for ESP-NOW trigger...");
+  fast_resume_ready();
 }
 
 void loop() {
   static uint32_t frame_idx = 0;
   const uint32_t now = millis();
 
+  // Follow the EMF node if its channel changes, then keep the clock aligned
+  now_channel_poll();
+  now_sync_poll();
+  now_rdv_poll();
+  evidence_poll();
+  console_poll();
+  memt_poll();
+  now_heartbeat_poll();
+
   // Check if we're in active window (triggered by ESP-NOW)
   if ((int32_t)(g_trigger_until_ms - now) > 0) {
     // Initialize camera if not already done
@@ -77,13 +193,23 @@ void loop() {
         return;
       }
       Serial.println("Camera ON");
+      now_rdv_report();
+#if EI_PERSISTENT_SESSION
+      // Arena + op prepare once per camera session instead of once per frame
+      if (run_classifier_session_open() != EI_IMPULSE_OK) {
+        Serial.println("WARN: EI session open failed, using per-frame init");
+      }
+#endif
       print_detection_labels(); // Print labels for classification models
+      active_window_begin();
+      cascade_begin();
+      frame_gate_begin();
+      occupancy_begin();
     }
 
     // Build EI signal view reading from ei_input_gray
     ei::signal_t signal;
-    signal.total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
-    signal.get_data = &ei_camera_get_data;
+    ei_signal(&signal);
 
     // Capture and process frame
     if (!ei_camera_capture()) {
@@ -92,23 +218,43 @@ void loop() {
       return;
     }
 
-    // Run Edge Impulse classifier
-    ei_impulse_result_t result = { 0 };
-    EI_IMPULSE_ERROR e = run_classifier(&signal, &result, ei_debug_nn);
-    if (e != EI_IMPULSE_OK) {
-      Serial.printf("Classifier err=%d\n", e);
-      delay(10);
+    // Nothing from an unsettled exposure or a bad frame reaches the hold timers
+    if (!frame_gate_check(ei_input_gray)) {
+      Serial.printf("[#%lu] frame dropped: %s (mean=%u spread=%u sharp=%u)\n",
+                    (unsigned long)++frame_idx, frame_gate_verdict_name(gate_last),
+                    gate_last_mean, gate_last_spread, gate_last_sharp);
+      if (frame_gate_bad_scene()) active_window_stop("unusable");
       return;
     }
 
-    // Print timing information
-    Serial.printf("[#%lu] DSP=%dms CLS=%dms ANOM=%dms\n",
-                  (unsigned long)++frame_idx,
-                  result.timing.dsp, result.timing.classification, result.timing.anomaly);
+    // Run Edge Impulse classifier, unless stage 1 can answer for it
+    ei_impulse_result_t result = { 0 };
+    if (cascade_skip(ei_input_gray, &result)) {
+      Serial.printf("[#%lu] scene unchanged, FOMO skipped\n", (unsigned long)++frame_idx);
+    } else {
+      EI_IMPULSE_ERROR e = run_classifier(&signal, &result, ei_debug_nn);
+      memt_stage = MEMT_NONE;
+      if (e != EI_IMPULSE_OK) {
+        Serial.printf("Classifier err=%d\n", e);
+        delay(10);
+        return;
+      }
+      cascade_update(ei_input_gray, result);
 
-    // Extract car confidence and update state machine
-    float car_conf = extract_car_confidence(result);
+      // Print timing information
+      Serial.printf("[#%lu] DSP=%dms CLS=%dms ANOM=%dms\n",
+                    (unsigned long)++frame_idx,
+                    result.timing.dsp, result.timing.classification, result.timing.anomaly);
+    }
+
+    // Car confidence fused over frames, then the state machine
+    float car_conf = occupancy_update(result);
+    const bool was_present = is_car_present();
     update_car_detection(car_conf);
+    if (!was_present && is_car_present()) {
+      evidence_begin(ei_input_gray, EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+    }
+    active_window_update(result);
 
     // Print detection results (bounding boxes for object detection)
     print_detection_results(result);
@@ -117,7 +263,24 @@ void loop() {
     // Active window expired - turn off camera and enter low power mode
     if (cam_inited) {
       ei_camera_deinit();
+#if EI_PERSISTENT_SESSION
+      run_classifier_session_close();   // give the arena back while idle
+#endif
       Serial.println("Camera OFF");
+      static bool placed_once = false;   // arena, EI heap and frames seen in use
+      if (!placed_once) {
+        mem_place_report();
+        memt_report();
+        placed_once = true;
+      }
+#if EI_CLASSIFIER_PROFILE_OPS
+      op_profiler.Log();
+      op_profiler.Clear();
+#endif
+      active_window_end();
+      cascade_end();
+      frame_gate_end();
+      occupancy_end();
       led_off();
     }
     idle_low_power();
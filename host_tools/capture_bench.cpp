@@ -0,0 +1,225 @@
+/*
+ * Capture path: full view, software crop and sensor window
+ *
+ * Builds the camera's real camera_ei.cpp against the simulated esp32-camera
+ * (esp_now_sim/esp_camera_sim.cpp) and captures the same scene three ways:
+ *
+ *   full view      CAM_ROI off: the whole field of view at 96x96, and the bay
+ *                  cut out of that frame and scaled up afterwards
+ *   software crop  CAM_ROI on, a sensor without windowing: CAM_ROI_SW_FRAMESIZE
+ *                  frames, bay cropped and resized in camera_ei.cpp
+ *   sensor window  CAM_ROI on, OV2640: set_res_raw() windows the DSP on the bay
+ *                  and zooms it to 96x96, camera_ei.cpp only copies
+ *
+ * Per mode: frame size and bytes DMA'd per frame, DVP transfer time from the
+ * simulator's model (YUV422 at one byte per CAM_XCLK_HZ, read back through the
+ * firmware's own cam_fb_us counter), the frame rate that transfer allows,
+ * host time of the copy / crop in ei_camera_capture(), the sensor pixels that
+ * cover the bay, how far (in EI pixels) the edges of the part of the view
+ * actually used lie from the requested bay (pixel / register grid), and the
+ * mean absolute error of the 96x96 bay image against the scene rendered
+ * straight into that part of the view (what resampling loses).
+ *
+ * The scene is a dark lot with a bright bay holding a fine stripe / chequer
+ * pattern (about 4 EI pixels per period once the bay fills the input).
+ *
+ * Usage: capture_bench [--frames N] [--roi X,Y,W,H] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include "camera_ei.h"
+
+// =================== CONFIGURATION ===================
+static int       opt_frames  = 50;
+static cam_roi_t opt_roi     = { 400, 500, 250, 300 };
+static bool      opt_verbose = false;
+
+static const int W = EI_CLASSIFIER_INPUT_WIDTH;
+static const int H = EI_CLASSIFIER_INPUT_HEIGHT;
+
+// =================== SCENE ===================
+static float bay_u0, bay_v0, bay_u1, bay_v1;
+
+static uint8_t scene(float u, float v) {
+  if (u < bay_u0 || u >= bay_u1 || v < bay_v0 || v >= bay_v1) {
+    return (uint8_t)(30 + 10 * sinf(u * 40.0f) * sinf(v * 30.0f));
+  }
+  // Stripes across the bay and a chequer in its lower half
+  const float bu = (u - bay_u0) / (bay_u1 - bay_u0) * W;
+  const float bv = (v - bay_v0) / (bay_v1 - bay_v0) * H;
+  if (bv < H / 2) return (uint8_t)(140 + 90 * sinf(bu * 3.14159f / 2));
+  return (((int)(bu / 3) + (int)(bv / 3)) & 1) ? 220 : 60;
+}
+
+// Part of the field of view, u/v in [0, 1)
+typedef struct {
+  float u0, v0, u1, v1;
+} view_t;
+
+// The scene straight into WxH over a view, same 4x4 sampling as the
+// simulated sensor
+static void render_view(const view_t& r, std::vector<uint8_t>& out) {
+  out.resize((size_t)W * H);
+  const float du = (r.u1 - r.u0) / W, dv = (r.v1 - r.v0) / H;
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      uint32_t sum = 0;
+      for (int sy = 0; sy < 4; sy++) {
+        for (int sx = 0; sx < 4; sx++) {
+          sum += scene(r.u0 + (x + (sx + 0.5f) / 4) * du, r.v0 + (y + (sy + 0.5f) / 4) * dv);
+        }
+      }
+      out[(size_t)y * W + x] = (uint8_t)((sum + 8) / 16);
+    }
+  }
+}
+
+// =================== PASSES ===================
+typedef struct {
+  const char* name;
+  bool roi;
+  uint16_t sensor;
+} capture_mode_t;
+
+typedef struct {
+  cam_window_t window;
+  int fw, fh;               // frame as DMA'd
+  uint32_t bytes;
+  double bus_ms;            // virtual, from the firmware's counter
+  double copy_us;           // host, copy / crop only
+  std::string bay_px;       // sensor pixels across the bay
+  double shift;             // largest edge offset of the view used, EI pixels
+  double mae;               // against the scene over the view used
+} pass_t;
+
+static uint64_t wall_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static double mae(const uint8_t* a, const std::vector<uint8_t>& b) {
+  long sum = 0;
+  for (size_t i = 0; i < b.size(); i++) sum += abs((int)a[i] - (int)b[i]);
+  return (double)sum / b.size();
+}
+
+// Pixels [*x, *x + *n) of a frame `size` wide that the ROI edge `pos` and
+// length `len` (1/1000) fall on
+static void roi_pixels(int pos, int len, int size, int* x, int* n) {
+  *x = pos * size / 1000;
+  *n = std::max(1, len * size / 1000);
+}
+
+static bool run_pass(const capture_mode_t& mode, pass_t& pass) {
+  cam_sim_set_sensor(mode.sensor);
+  cam_roi = mode.roi ? opt_roi : cam_roi_t{ 0, 0, 0, 0 };
+  cam_window_mode = CAM_WINDOW_FULL;   // new sensor: nothing known about it yet
+  cam_frames = cam_fb_us = cam_copy_us = 0;
+  if (!ei_camera_init()) return false;
+
+  const uint64_t render0 = cam_sim_render_wall_us();
+  const uint64_t t0 = wall_us();
+  for (int f = 0; f < opt_frames; f++) {
+    if (!ei_camera_capture()) return false;
+  }
+  pass.copy_us = (double)(wall_us() - t0 - (cam_sim_render_wall_us() - render0)) / opt_frames;
+  pass.bus_ms = cam_fb_us / 1000.0 / cam_frames;
+  pass.bytes = cam_frame_bytes;
+  pass.window = cam_window_mode;
+
+  camera_fb_t* fb = esp_camera_fb_get();
+  pass.fw = fb->width;
+  pass.fh = fb->height;
+  esp_camera_fb_return(fb);
+  view_t frame_view;
+  cam_sim_view(&frame_view.u0, &frame_view.v0, &frame_view.u1, &frame_view.v1);
+  ei_camera_deinit();
+
+  // Bay as the model sees it, and the part of the view it came from
+  std::vector<uint8_t> bay(ei_input_gray, ei_input_gray + W * H);
+  view_t used = frame_view;
+  char px[32];
+  if (pass.window == CAM_WINDOW_SENSOR) {
+    snprintf(px, sizeof(px), "%dx%d (on sensor)", W, H);
+  } else {
+    // Full view: cut out of the 96x96 frame afterwards and scaled back up
+    int rx, ry, rw, rh;
+    roi_pixels(opt_roi.x, opt_roi.w, pass.fw, &rx, &rw);
+    roi_pixels(opt_roi.y, opt_roi.h, pass.fh, &ry, &rh);
+    if (pass.window == CAM_WINDOW_FULL) {
+      crop_resize_gray_nn(ei_input_gray, W, rx, ry, rw, rh, bay.data(), W, H);
+    }
+    used = { (float)rx / pass.fw, (float)ry / pass.fh, (float)(rx + rw) / pass.fw, (float)(ry + rh) / pass.fh };
+    snprintf(px, sizeof(px), "%dx%d", rw, rh);
+  }
+  pass.bay_px = px;
+
+  const float sx = W / (bay_u1 - bay_u0), sy = H / (bay_v1 - bay_v0);
+  pass.shift = std::max(std::max(fabsf(used.u0 - bay_u0) * sx, fabsf(used.u1 - bay_u1) * sx),
+                        std::max(fabsf(used.v0 - bay_v0) * sy, fabsf(used.v1 - bay_v1) * sy));
+  std::vector<uint8_t> ideal;
+  render_view(used, ideal);
+  pass.mae = mae(bay.data(), ideal);
+  return true;
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    unsigned x, y, w, h;
+    if (a == "--frames" && i + 1 < argc) {
+      opt_frames = std::max(1, atoi(argv[++i]));
+    } else if (a == "--roi" && i + 1 < argc && sscanf(argv[++i], "%u,%u,%u,%u", &x, &y, &w, &h) == 4 &&
+               w > 0 && h > 0 && x + w <= 1000 && y + h <= 1000) {
+      opt_roi = { (uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h };
+    } else if (a == "-v") {
+      opt_verbose = true;
+    } else {
+      fprintf(stderr, "usage: capture_bench [--frames N] [--roi X,Y,W,H] [-v]\n");
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_set_verbose(opt_verbose);
+  bay_u0 = opt_roi.x / 1000.0f;
+  bay_v0 = opt_roi.y / 1000.0f;
+  bay_u1 = (opt_roi.x + opt_roi.w) / 1000.0f;
+  bay_v1 = (opt_roi.y + opt_roi.h) / 1000.0f;
+  cam_sim_set_scene(&scene);
+  ei_input_gray = (uint8_t*)malloc((size_t)W * H);
+
+  const capture_mode_t modes[3] = {
+    { "full view", false, OV2640_PID },
+    { "software crop", true, OV7725_PID },
+    { "sensor window", true, OV2640_PID },
+  };
+  printf("bay %u,%u %ux%u of 1000, %d frames, XCLK %.0f MHz\n", opt_roi.x, opt_roi.y, opt_roi.w,
+         opt_roi.h, opt_frames, CAM_XCLK_HZ / 1e6);
+  printf("  %-14s %8s %8s %8s %8s %8s  %-18s %6s %6s\n", "mode", "frame", "B/frame", "DMA ms", "max fps",
+         "copy us", "bay sensor px", "shift", "MAE");
+  for (const capture_mode_t& mode : modes) {
+    pass_t pass;
+    if (!run_pass(mode, pass)) {
+      fprintf(stderr, "%s: capture failed\n", mode.name);
+      return 1;
+    }
+    char frame[16];
+    snprintf(frame, sizeof(frame), "%dx%d", pass.fw, pass.fh);
+    printf("  %-14s %8s %8u %8.2f %8.1f %8.1f  %-18s %6.1f %6.1f\n", mode.name, frame, pass.bytes,
+           pass.bus_ms, 1000.0 / pass.bus_ms, pass.copy_us, pass.bay_px.c_str(), pass.shift, pass.mae);
+  }
+  free(ei_input_gray);
+  return 0;
+}
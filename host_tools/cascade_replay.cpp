@@ -0,0 +1,401 @@
+/*
+ * Cascade inference replay: FOMO on every frame against the cascade
+ *
+ * Replays a labelled frame sequence twice through the camera's real
+ * cascade.cpp and EI library: once with FOMO on every frame, once with
+ * cascade_skip() / cascade_update() in front of it as in main.cpp. Per mode
+ * it reports host ms per frame (stage 1 + classifier), stage 1 us alone,
+ * FOMO runs, frames skipped as empty / occupied and accuracy of the
+ * per-frame decision (car_conf >= CAR_ON_THRESH) against the labels, and
+ * how many decisions the cascade changed.
+ *
+ * The default sequence is synthetic: a dark bay with sensor noise and
+ * exposure drift, a car (a striped block the model detects) that drives in,
+ * parks, and drives out, and people crossing the empty bay. A frame is
+ * labelled occupied while most of the car is inside the bay.
+ *
+ * --replay FILE reads labelled frames instead: per frame one label byte
+ * (0/1) and 96x96 gray bytes. --sweep repeats the cascade pass for a range
+ * of CASCADE_CELL_DIFF values.
+ *
+ * The FOMO results of the full pass then drive the real state machine
+ * (update_car_detection(), hold timers on the virtual clock, one frame every
+ * --frame-ms) twice: on each frame's best box, and on the occupancy grid's
+ * fused confidence (occupancy.cpp). Both run on the clean results and with
+ * glitches injected: per frame, with probability --glitch each, all boxes
+ * dropped (a missed frame) and a spurious car box added; and the same with
+ * probability --single but never on two frames in a row. A single glitch
+ * resets the raw hold timers; the tau sweep shows which time constant
+ * bridges them, summed over SWEEP_SEEDS glitch seeds. Per decider it
+ * reports the decision latency after each labelled change, missed changes
+ * and flip-flops (state changes beyond one per labelled change). A change
+ * still undecided at the end, less than DECIDE_MAX_MS before it, is left out.
+ *
+ * Usage: cascade_replay [--frames N] [--seed S] [--replay FILE] [--cell-diff D] [--sweep]
+ *                       [--frame-ms MS] [--glitch P] [--single P] [--tau MS] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "cascade.h"
+#include "occupancy.h"
+
+// =================== CONFIGURATION ===================
+static int         opt_frames    = 600;
+static uint32_t    opt_seed      = 1;
+static const char* opt_replay    = nullptr;
+static int         opt_cell_diff = CASCADE_CELL_DIFF;
+static bool        opt_sweep     = false;
+static bool        opt_verbose   = false;
+static uint32_t    opt_frame_ms  = 200;    // capture + gate + FOMO on the board
+static double      opt_glitch    = 0.10;
+static double      opt_single    = 0.03;
+static uint32_t    opt_tau       = OCC_TAU_MS;
+
+static const uint32_t DECIDE_MAX_MS = 20000;   // changes closer to the end and undecided are left out
+static const uint32_t SWEEP_SEEDS   = 20;      // glitch seeds per tau sweep row
+
+static const int W = EI_CLASSIFIER_INPUT_WIDTH;
+static const int H = EI_CLASSIFIER_INPUT_HEIGHT;
+
+// =================== LABELLED FRAMES ===================
+static std::vector<std::vector<uint8_t>> frames;
+static std::vector<uint8_t> labels;
+static const uint8_t* cur_frame = nullptr;
+
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+// Bay and car footprint (pixels)
+static const int BAY_X = 32, CAR_W = 32, CAR_H = 10, CAR_Y = 60;
+
+static void draw_scene(uint8_t* px, int car_x, int person_x, int exposure) {
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      const int v = 8 + exposure + (int)(rng() % 5) - 2;
+      px[y * W + x] = (uint8_t)std::max(0, std::min(255, v));
+    }
+  }
+  for (int y = CAR_Y; y < CAR_Y + CAR_H; y++) {
+    for (int x = std::max(0, car_x); x < std::min(W, car_x + CAR_W); x++) {
+      const int v = 8 + exposure + ((x - car_x + y) % 7) * 14 + (int)(rng() % 3) - 1;
+      px[y * W + x] = (uint8_t)std::max(0, std::min(255, v));
+    }
+  }
+  for (int y = 20; y < 36 && person_x > -6; y++) {
+    for (int x = std::max(0, person_x); x < std::min(W, person_x + 6); x++) {
+      px[y * W + x] = (uint8_t)std::min(255, 60 + exposure + (int)(rng() % 9));
+    }
+  }
+}
+
+// Empty -> drive in -> parked -> drive out, repeated; people cross while empty
+static void make_frames() {
+  rng_state = opt_seed;
+  frames.assign(opt_frames, std::vector<uint8_t>((size_t)W * H));
+  labels.assign(opt_frames, 0);
+  int f = 0;
+  while (f < opt_frames) {
+    const int empty = 40 + rng() % 60, drive = 10, parked = 60 + rng() % 90;
+    const int person_at = (rng() % 2) ? (int)(rng() % empty) : -1;
+    const int phases[4] = { empty, drive, parked, drive };
+    for (int ph = 0; ph < 4; ph++) {
+      for (int i = 0; i < phases[ph] && f < opt_frames; i++, f++) {
+        int car_x = -1000, person_x = -1000;
+        if (ph == 0 && person_at >= 0 && i >= person_at) person_x = (i - person_at) * 6 - 6;
+        if (ph == 1) car_x = -CAR_W + (BAY_X + CAR_W) * (i + 1) / drive;
+        if (ph == 2) car_x = BAY_X;
+        if (ph == 3) car_x = BAY_X + (W - BAY_X) * (i + 1) / drive;
+        const int exposure = (int)(3.0 * sin(f / 37.0));
+        draw_scene(frames[f].data(), car_x, person_x, exposure);
+        const int inside = std::max(0, std::min(car_x + CAR_W, BAY_X + CAR_W) - std::max(car_x, BAY_X));
+        labels[f] = inside * 2 > CAR_W;
+      }
+    }
+  }
+}
+
+// Per frame: label byte, then W*H gray bytes
+static bool load_replay(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  std::vector<uint8_t> px((size_t)W * H);
+  uint8_t label;
+  frames.clear();
+  labels.clear();
+  while (fread(&label, 1, 1, f) == 1 && fread(px.data(), 1, px.size(), f) == px.size()) {
+    frames.push_back(px);
+    labels.push_back(label != 0);
+  }
+  fclose(f);
+  opt_frames = (int)frames.size();
+  return !frames.empty();
+}
+
+// Same packing as ei_camera_get_data(): R=G=B=gray
+static int get_frame_data(size_t offset, size_t length, float* out_ptr) {
+  for (size_t i = 0; i < length; i++) {
+    const uint32_t g = cur_frame[offset + i];
+    out_ptr[i] = (float)((g << 16) | (g << 8) | g);
+  }
+  return 0;
+}
+
+// =================== PASSES ===================
+typedef struct {
+  double ms;                 // per frame, stage 1 + classifier
+  double stage1_us;          // per frame, stage 1 alone
+  int fomo_runs;
+  uint32_t hits_empty, hits_full;
+  std::vector<uint8_t> decision;
+  std::vector<std::vector<ei_impulse_result_bounding_box_t>> boxes;
+} pass_t;
+
+static bool run_pass(bool cascade, pass_t& pass) {
+  signal_t signal;
+  signal.total_length = (size_t)W * H;
+  signal.get_data = &get_frame_data;
+
+  cascade_enabled = cascade;
+  cascade_cell_diff = (uint8_t)opt_cell_diff;
+  const uint32_t empty0 = cascade_hits_empty, full0 = cascade_hits_full;
+  cascade_begin();
+  pass.fomo_runs = 0;
+  pass.decision.assign(frames.size(), 0);
+  pass.boxes.assign(frames.size(), {});
+
+  uint64_t total_us = 0, stage1_us = 0;
+  for (size_t f = 0; f < frames.size(); f++) {
+    cur_frame = frames[f].data();
+    ei_impulse_result_t result = { 0 };
+    const uint64_t t0 = ei_read_timer_us();
+    const bool skipped = cascade_skip(cur_frame, &result);
+    stage1_us += ei_read_timer_us() - t0;
+    if (!skipped) {
+      EI_IMPULSE_ERROR e = run_classifier(&signal, &result, false);
+      if (e != EI_IMPULSE_OK) {
+        fprintf(stderr, "run_classifier err=%d on frame %zu\n", e, f);
+        return false;
+      }
+      cascade_update(cur_frame, result);
+      pass.fomo_runs++;
+    }
+    total_us += ei_read_timer_us() - t0;
+    const float car_conf = extract_car_confidence(result);
+    pass.decision[f] = car_conf >= CAR_ON_THRESH;
+    pass.boxes[f].assign(result.bounding_boxes, result.bounding_boxes + result.bounding_boxes_count);
+    if (opt_verbose) {
+      printf("  %s #%zu label=%d conf=%.3f\n", cascade ? "cascade" : "full", f, labels[f], car_conf);
+    }
+  }
+  pass.ms = total_us / 1000.0 / frames.size();
+  pass.stage1_us = (double)stage1_us / frames.size();
+  pass.hits_empty = cascade_hits_empty - empty0;
+  pass.hits_full = cascade_hits_full - full0;
+  return true;
+}
+
+static double accuracy(const pass_t& pass) {
+  int right = 0;
+  for (size_t f = 0; f < frames.size(); f++) right += pass.decision[f] == labels[f];
+  return 100.0 * right / frames.size();
+}
+
+static void print_pass(const char* name, const pass_t& pass, const pass_t* full) {
+  printf("  %-12s %8.3f %8.1f %9d %7u %8u %8.1f%%", name, pass.ms, pass.stage1_us, pass.fomo_runs,
+         pass.hits_empty, pass.hits_full, accuracy(pass));
+  if (full) {
+    int changed = 0;
+    for (size_t f = 0; f < frames.size(); f++) changed += pass.decision[f] != full->decision[f];
+    printf(" %+8.1f %8d", accuracy(pass) - accuracy(*full), changed);
+  }
+  printf("\n");
+}
+
+// =================== DECISIONS ===================
+typedef struct {
+  int transitions, missed, changes, flips;
+  std::vector<double> on_ms, off_ms;   // labelled change -> state change
+} decide_t;
+
+// The full pass's results, glitched, through the hold timers. single: a
+// glitched frame is always followed by a clean one
+static void decide(const pass_t& pass, bool fused, double glitch, bool single, uint32_t tau,
+                   uint32_t glitch_seed, decide_t& d) {
+  occupancy_enabled = fused;
+  occupancy_tau_ms = tau;
+  init_car_detection();
+  occupancy_begin();
+  rng_state = glitch_seed ^ 0x5EEDu;   // same glitches for both deciders
+  d = decide_t();
+
+  bool state = false;
+  bool glitched = false;                // previous frame
+  int since = labels[0] ? 0 : -1;       // frame of the last labelled change still to be matched
+  std::vector<ei_impulse_result_bounding_box_t> boxes;
+  for (size_t f = 0; f < frames.size(); f++) {
+    if (f > 0 && labels[f] != labels[f - 1]) {
+      if (since >= 0) d.missed++;
+      since = (int)f;
+    }
+    boxes = pass.boxes[f];
+    const bool drop = rng() % 10000 < glitch * 10000;
+    const bool spurious = rng() % 10000 < glitch * 10000;
+    const uint32_t cx = rng() % (W / OCC_CELL), cy = rng() % (H / OCC_CELL), conf = rng() % 20;
+    const bool allowed = !(single && glitched);
+    if (drop && allowed) boxes.clear();
+    if (spurious && allowed) {
+      boxes.push_back({ "car", cx * OCC_CELL, cy * OCC_CELL, OCC_CELL, OCC_CELL, 0.75f + conf / 100.0f });
+    }
+    glitched = (drop || spurious) && allowed;
+    ei_impulse_result_t result = {};
+    result.bounding_boxes = boxes.data();
+    result.bounding_boxes_count = (uint32_t)boxes.size();
+    now_sim_delay_us((uint64_t)opt_frame_ms * 1000);
+    update_car_detection(occupancy_update(result));
+
+    if (is_car_present() == state) continue;
+    state = is_car_present();
+    d.changes++;
+    if (since >= 0 && state == (labels[f] != 0)) {
+      (state ? d.on_ms : d.off_ms).push_back((double)(f - since) * opt_frame_ms);
+      since = -1;
+    }
+  }
+  for (size_t f = 0; f < frames.size(); f++) d.transitions += f == 0 ? labels[0] != 0 : labels[f] != labels[f - 1];
+  if (since >= 0 && (frames.size() - since) * opt_frame_ms >= DECIDE_MAX_MS) d.missed++;
+  else if (since >= 0) d.transitions--;
+  d.flips = d.changes - (int)(d.on_ms.size() + d.off_ms.size());
+}
+
+static std::string p50_max(std::vector<double> v) {
+  if (v.empty()) return "-";
+  std::sort(v.begin(), v.end());
+  char s[32];
+  snprintf(s, sizeof(s), "%.0f / %.0f", v[v.size() / 2], v.back());
+  return s;
+}
+
+static void print_decision(const char* name, const char* glitches, const decide_t& d) {
+  printf("  %-11s %-12s %11d %7d %15s %15s %8d %10d\n", name, glitches, d.transitions, d.missed,
+         p50_max(d.on_ms).c_str(), p50_max(d.off_ms).c_str(), d.changes, d.flips);
+}
+
+static void print_decisions(const pass_t& full) {
+  printf("\ndecisions: %u ms per frame, >= %.2f for %u ms sets, <= %.2f for %u ms clears; tau %u ms\n",
+         (unsigned)opt_frame_ms, CAR_ON_THRESH, (unsigned)CAR_ON_HOLD_MS, CAR_OFF_THRESH,
+         (unsigned)CAR_OFF_HOLD_MS, (unsigned)opt_tau);
+  printf("  %-11s %-12s %11s %7s %15s %15s %8s %10s\n", "decider", "glitches", "transitions", "missed",
+         "ON p50/max ms", "OFF p50/max ms", "changes", "flip-flops");
+  char glitches[3][16];
+  snprintf(glitches[0], sizeof(glitches[0]), "none");
+  snprintf(glitches[1], sizeof(glitches[1]), "%.0f%%", opt_glitch * 100);
+  snprintf(glitches[2], sizeof(glitches[2]), "%.0f%% single", opt_single * 100);
+  for (int g = 0; g < 3; g++) {
+    for (bool fused : { false, true }) {
+      decide_t d;
+      decide(full, fused, g == 1 ? opt_glitch : g == 2 ? opt_single : 0.0, g == 2, opt_tau, opt_seed, d);
+      print_decision(fused ? "fused" : "raw", glitches[g], d);
+    }
+  }
+
+  // Single glitches reset the raw hold timers; what each time constant
+  // costs on clean frames and how many changes it still misses with them
+  printf("\ntau sweep, single glitches summed over %u glitch seeds:\n", (unsigned)SWEEP_SEEDS);
+  for (uint32_t tau : { 0u, 250u, 500u, 750u, 1000u, 1500u, 2000u, 3000u }) {
+    char name[16];
+    snprintf(name, sizeof(name), tau ? "tau %u" : "raw", (unsigned)tau);
+    for (int g : { 0, 2 }) {
+      decide_t sum = {};
+      for (uint32_t seed = 0; seed < (g ? SWEEP_SEEDS : 1); seed++) {
+        decide_t d;
+        decide(full, tau != 0, g ? opt_single : 0.0, true, tau ? tau : opt_tau, opt_seed + seed, d);
+        sum.transitions += d.transitions;
+        sum.missed += d.missed;
+        sum.changes += d.changes;
+        sum.flips += d.flips;
+        sum.on_ms.insert(sum.on_ms.end(), d.on_ms.begin(), d.on_ms.end());
+        sum.off_ms.insert(sum.off_ms.end(), d.off_ms.begin(), d.off_ms.end());
+      }
+      print_decision(name, glitches[g], sum);
+    }
+  }
+  occupancy_enabled = (OCC_ENABLE != 0);
+  occupancy_tau_ms = OCC_TAU_MS;
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc)    opt_frames = std::max(1, atoi(argv[++i]));
+    else if (a == "--seed" && i + 1 < argc)      opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else if (a == "--replay" && i + 1 < argc)    opt_replay = argv[++i];
+    else if (a == "--cell-diff" && i + 1 < argc) opt_cell_diff = std::max(0, std::min(255, atoi(argv[++i])));
+    else if (a == "--sweep")                     opt_sweep = true;
+    else if (a == "--frame-ms" && i + 1 < argc)  opt_frame_ms = (uint32_t)std::max(1, atoi(argv[++i]));
+    else if (a == "--glitch" && i + 1 < argc)    opt_glitch = std::max(0.0, std::min(1.0, atof(argv[++i])));
+    else if (a == "--single" && i + 1 < argc)    opt_single = std::max(0.0, std::min(1.0, atof(argv[++i])));
+    else if (a == "--tau" && i + 1 < argc)       opt_tau = (uint32_t)std::max(1, atoi(argv[++i]));
+    else if (a == "-v")                          opt_verbose = true;
+    else {
+      fprintf(stderr, "usage: cascade_replay [--frames N] [--seed S] [--replay FILE] [--cell-diff D] [--sweep]\n"
+                      "                      [--frame-ms MS] [--glitch P] [--single P] [--tau MS] [-v]\n");
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_set_verbose(false);
+  const uint8_t mac[6] = { 0x24, 0x6f, 0x28, 0, 0, 2 };
+  now_sim_set_current(now_sim_add_node("cam", mac, 1));
+  if (opt_replay) {
+    if (!load_replay(opt_replay)) {
+      fprintf(stderr, "no frames in %s\n", opt_replay);
+      return 1;
+    }
+  } else {
+    make_frames();
+  }
+  int occupied = 0;
+  for (uint8_t l : labels) occupied += l;
+
+  if (run_classifier_session_open() != EI_IMPULSE_OK) {
+    fprintf(stderr, "session open failed\n");
+    return 1;
+  }
+  pass_t full;
+  if (!run_pass(false, full)) return 1;
+
+  printf("%d frames (%s), %d labelled occupied; empty <= %.2f, occupied >= %.2f, max %d skips\n",
+         opt_frames, opt_replay ? opt_replay : "synthetic", occupied,
+         CASCADE_EMPTY_CONF, CASCADE_FULL_CONF, CASCADE_MAX_SKIP);
+  printf("  %-12s %8s %8s %9s %7s %8s %9s %8s %8s\n", "mode", "ms/frame", "stage1us", "FOMO runs",
+         "empty", "occupied", "accuracy", "delta", "changed");
+  print_pass("full", full, nullptr);
+
+  std::vector<int> diffs(1, opt_cell_diff);
+  if (opt_sweep) diffs = { 2, 4, 8, 12, 16, 24, 32 };
+  for (int d : diffs) {
+    opt_cell_diff = d;
+    pass_t cascade;
+    if (!run_pass(true, cascade)) return 1;
+    char name[24];
+    snprintf(name, sizeof(name), "cascade %d", d);
+    print_pass(name, cascade, &full);
+  }
+  print_decisions(full);
+  run_classifier_session_close();
+  return 0;
+}
@@ -0,0 +1,434 @@
+/*
+ * Edge Impulse FOMO model benchmark on the host
+ *
+ * Builds the camera's exported EI library (SDK + EON-compiled model) for the
+ * host and runs run_classifier() over a set of synthetic 96x96 gray frames
+ * (noisy ground, a car-sized bright block moving across the bay), the same
+ * R=G=B packing that ei_camera_get_data() feeds on the board.
+ *
+ * Two passes over the same frames:
+ *   per-frame  model_init / invoke / model_reset every frame (SDK default)
+ *   session    run_classifier_session_open() once, invoke only per frame
+ * and prints per-frame wall time for both. The raw int8 FOMO output map of
+ * every frame is captured (wrapped postprocessing block) and the passes must
+ * match bit for bit.
+ *
+ * A third pass runs the session with signal.gray_u8 set, as the camera does:
+ * the input tensor is then filled through a 256-entry table from the gray
+ * bytes. Its output maps must match the per-frame pass, and the DSP time of
+ * both session passes is reported. Before the passes, the table is checked
+ * against the per-pixel path for every gray level, for the model's input
+ * quantization and a few others (slow paths, RGB).
+ *
+ * --profile adds another session pass with a MicroOpProfiler attached and
+ * prints per-node time, MACs and bytes (min/mean/p99/max over all frames).
+ *
+ * --random replaces the scene with uniform noise frames, which spread the
+ * output map over many more values (better coverage for bit-exact checks).
+ *
+ * --save FILE runs an extra pass that hashes the output of every graph node
+ * and writes them with the output map of each frame; --compare FILE checks a
+ * new build against such a file, e.g. one saved before a graph change.
+ *
+ * Usage: ei_bench [--frames N] [--seed S] [--random] [--profile] [--save F] [--compare F] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+// =================== CONFIGURATION ===================
+static int      opt_frames  = 200;
+static uint32_t opt_seed    = 1;
+static bool     opt_verbose = false;
+static bool     opt_profile = false;
+static bool     opt_random  = false;
+static const char* opt_save    = nullptr;
+static const char* opt_compare = nullptr;
+
+static const int W = EI_CLASSIFIER_INPUT_WIDTH;
+static const int H = EI_CLASSIFIER_INPUT_HEIGHT;
+static const int BLOCK_FRAMES = 10;
+
+// =================== SYNTHETIC FRAMES ===================
+static std::vector<std::vector<uint8_t>> frames;
+static const uint8_t* cur_frame = nullptr;
+
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+static void make_frames() {
+  rng_state = opt_seed;
+  frames.assign(opt_frames, std::vector<uint8_t>((size_t)W * H));
+  for (int f = 0; f < opt_frames; f++) {
+    uint8_t* px = frames[f].data();
+    if (opt_random) {
+      for (int i = 0; i < W * H; i++) px[i] = (uint8_t)rng();
+      continue;
+    }
+    // Ground: vertical gradient + sensor noise
+    for (int y = 0; y < H; y++) {
+      for (int x = 0; x < W; x++) {
+        int v = 60 + y / 2 + (int)(rng() % 17) - 8;
+        px[y * W + x] = (uint8_t)std::max(0, std::min(255, v));
+      }
+    }
+    // Car: present in two of every three frames, drifting through the bay
+    if (f % 3 != 2) {
+      const int cw = 36, ch = 24;
+      const int cx = (f * 3) % (W - cw);
+      const int cy = 30 + (f % 7);
+      for (int y = cy; y < cy + ch; y++) {
+        for (int x = cx; x < cx + cw; x++) {
+          const bool window = (y < cy + 8) && (x > cx + 6) && (x < cx + cw - 6);
+          px[y * W + x] = window ? 40 : (uint8_t)(200 + rng() % 30);
+        }
+      }
+    }
+  }
+}
+
+// Same packing as ei_camera_get_data(): R=G=B=gray
+static int get_frame_data(size_t offset, size_t length, float* out_ptr) {
+  for (size_t i = 0; i < length; i++) {
+    const uint32_t g = cur_frame[offset + i];
+    out_ptr[i] = (float)((g << 16) | (g << 8) | g);
+  }
+  return 0;
+}
+
+// =================== OUTPUT CAPTURE ===================
+// Copy of the default impulse whose FOMO postprocessing first copies the raw
+// int8 output map, then runs the stock process_fomo_i8().
+static ei_impulse_t bench_impulse;
+static std::vector<ei_postprocessing_block_t> bench_post;
+static ei_impulse_handle_t* bench_handle = nullptr;
+static std::vector<int8_t> last_raw;
+
+static EI_IMPULSE_ERROR capture_fomo_i8(ei_impulse_handle_t* handle, uint32_t block_index,
+                                        uint32_t input_block_id, ei_impulse_result_t* result,
+                                        void* config, void* state) {
+  ei::matrix_i8_t* raw = nullptr;
+  if (find_mtx_by_idx(result->_raw_outputs, &raw, input_block_id, handle->impulse->learning_blocks_size) && raw) {
+    last_raw.assign(raw->buffer, raw->buffer + raw->rows * raw->cols);
+  }
+  return process_fomo_i8(handle, block_index, input_block_id, result, config, state);
+}
+
+static void make_bench_impulse() {
+  const ei_impulse_t* base = ei_default_impulse.impulse;
+  bench_impulse = *base;
+  std::vector<ei_postprocessing_block_t>(base->postprocessing_blocks,
+                                         base->postprocessing_blocks + base->postprocessing_blocks_size).swap(bench_post);
+  for (auto& pb : bench_post) {
+    if (pb.postprocess_fn == &process_fomo_i8) pb.postprocess_fn = &capture_fomo_i8;
+  }
+  bench_impulse.postprocessing_blocks = bench_post.data();
+  bench_handle = new ei_impulse_handle_t(&bench_impulse);
+}
+
+// =================== NODE HASHES ===================
+// Profiler that also hashes each node's output tensor right after it ran.
+// PAD nodes are skipped: folding them into the next conv must not change the
+// sequence, and every other node output must stay bit-identical.
+static const ei_config_tflite_eon_graph_t* bench_graph = nullptr;
+
+class NodeHashProfiler : public tflite::MicroOpProfiler {
+ public:
+  std::vector<uint32_t> hashes;   // current frame
+
+  uint32_t BeginEvent(const char* tag) override {
+    node_ = (size_t)atoi(tag);
+    skip_ = strstr(tag, " PAD") != nullptr;
+    return MicroOpProfiler::BeginEvent(tag);
+  }
+
+  void EndEvent(uint32_t event_handle) override {
+    MicroOpProfiler::EndEvent(event_handle);
+    TfLiteTensor t;
+    if (skip_ || bench_graph->model_node_output(node_, &t) != kTfLiteOk) return;
+    uint32_t h = 2166136261u;   // FNV-1a
+    const uint8_t* p = (const uint8_t*)t.data.data;
+    for (size_t i = 0; i < t.bytes; i++) h = (h ^ p[i]) * 16777619u;
+    hashes.push_back(h);
+  }
+
+ private:
+  size_t node_ = 0;
+  bool skip_ = false;
+};
+
+static NodeHashProfiler* node_hasher = nullptr;
+
+// =================== PASSES ===================
+typedef struct {
+  std::vector<double> frame_ms;
+  std::vector<double> dsp_ms;
+  std::vector<std::vector<int8_t>> raw;   // per frame, for cross-pass comparison
+  std::vector<std::vector<uint32_t>> nodes;   // per frame node hashes (hash pass only)
+  int boxes;
+} pass_t;
+
+static bool run_frames(const char* name, pass_t& pass, int first, int last, bool gray_lut = false) {
+  signal_t signal;
+  signal.total_length = (size_t)W * H;
+  signal.get_data = &get_frame_data;
+
+  for (int f = first; f < last; f++) {
+    cur_frame = frames[f].data();
+    signal.gray_u8 = gray_lut ? cur_frame : nullptr;
+    if (node_hasher) node_hasher->hashes.clear();
+    ei_impulse_result_t result = { 0 };
+    const uint64_t t0 = ei_read_timer_us();
+    EI_IMPULSE_ERROR e = run_classifier(bench_handle, &signal, &result, false);
+    const uint64_t t1 = ei_read_timer_us();
+    if (e != EI_IMPULSE_OK) {
+      fprintf(stderr, "%s: run_classifier err=%d on frame %d\n", name, e, f);
+      return false;
+    }
+    pass.frame_ms.push_back((t1 - t0) / 1000.0);
+    pass.dsp_ms.push_back(result.timing.dsp_us / 1000.0);
+    pass.raw.push_back(last_raw);
+    if (node_hasher) pass.nodes.push_back(node_hasher->hashes);
+    int boxes = 0;
+    for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+      if (result.bounding_boxes[i].value > 0) boxes++;
+    }
+    pass.boxes += boxes;
+    if (opt_verbose) {
+      printf("  %s #%d %.3f ms boxes=%d\n", name, f, pass.frame_ms.back(), boxes);
+    }
+  }
+  return true;
+}
+
+// =================== REFERENCE FILE ===================
+// Per frame: u32 map bytes, map, u32 node count, node hashes
+static std::vector<uint8_t> frame_record(const pass_t& pass, int f) {
+  std::vector<uint8_t> rec;
+  auto put = [&](const void* p, size_t n) { rec.insert(rec.end(), (const uint8_t*)p, (const uint8_t*)p + n); };
+  const uint32_t map_len = (uint32_t)pass.raw[f].size(), n_nodes = (uint32_t)pass.nodes[f].size();
+  put(&map_len, 4);
+  put(pass.raw[f].data(), map_len);
+  put(&n_nodes, 4);
+  put(pass.nodes[f].data(), n_nodes * 4);
+  return rec;
+}
+
+static bool save_reference(const char* path, const pass_t& pass) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  for (size_t i = 0; i < pass.raw.size(); i++) {
+    const std::vector<uint8_t> rec = frame_record(pass, (int)i);
+    fwrite(rec.data(), 1, rec.size(), f);
+  }
+  fclose(f);
+  return true;
+}
+
+// Frames that differ from the file (all of them if it cannot be read)
+static int compare_reference(const char* path, const pass_t& pass) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return (int)pass.raw.size();
+  int differ = 0;
+  std::vector<uint8_t> ref;
+  for (size_t i = 0; i < pass.raw.size(); i++) {
+    const std::vector<uint8_t> rec = frame_record(pass, (int)i);
+    ref.resize(rec.size());
+    if (fread(ref.data(), 1, ref.size(), f) != ref.size() || ref != rec) differ++;
+  }
+  fclose(f);
+  return differ;
+}
+
+// =================== INPUT TABLE CHECK ===================
+// Every gray level through extract_image_features_quantized(), once via
+// get_data() and once via gray_u8; returns the number of differing values
+static const uint8_t* lut_gray = nullptr;
+
+static int get_lut_data(size_t offset, size_t length, float* out_ptr) {
+  for (size_t i = 0; i < length; i++) {
+    const uint32_t g = lut_gray[offset + i];
+    out_ptr[i] = (float)((g << 16) | (g << 8) | g);
+  }
+  return 0;
+}
+
+static int check_gray_lut(const char* channels, float scale, float zero_point, int scaling) {
+  static uint8_t levels[256];
+  for (int g = 0; g < 256; g++) levels[g] = (uint8_t)g;
+  lut_gray = levels;
+
+  ei_dsp_config_image_t config = *(ei_dsp_config_image_t*)bench_impulse.dsp_blocks[0].config;
+  config.channels = channels;
+  const int n = (strcmp(channels, "Grayscale") == 0 ? 1 : 3) * 256;
+  std::vector<int8_t> ref(n), lut(n);
+  ei::matrix_i8_t ref_m(1, n, ref.data()), lut_m(1, n, lut.data());
+
+  signal_t signal;
+  signal.total_length = 256;
+  signal.get_data = &get_lut_data;
+  extract_image_features_quantized(&signal, &ref_m, &config, scale, zero_point, 0, scaling);
+  signal.gray_u8 = levels;
+  extract_image_features_quantized(&signal, &lut_m, &config, scale, zero_point, 0, scaling);
+
+  int differ = 0;
+  for (int i = 0; i < n; i++) differ += ref[i] != lut[i];
+  return differ;
+}
+
+// =================== REPORT ===================
+static void print_times(const char* name, std::vector<double> v) {
+  std::sort(v.begin(), v.end());
+  double sum = 0;
+  for (double x : v) sum += x;
+  auto pct = [&](double p) { return v[(size_t)(p * (v.size() - 1) + 0.5)]; };
+  printf("  %-22s n=%-4zu mean=%7.3f  p50=%7.3f  p99=%7.3f  max=%7.3f ms\n",
+         name, v.size(), sum / v.size(), pct(0.50), pct(0.99), v.back());
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() { return (i + 1 < argc) ? argv[++i] : "0"; };
+    if      (a == "--frames") opt_frames  = std::max(1, atoi(next()));
+    else if (a == "--seed")   opt_seed    = (uint32_t)atoi(next());
+    else if (a == "--profile") opt_profile = true;
+    else if (a == "--random")  opt_random  = true;
+    else if (a == "--save")    opt_save    = next();
+    else if (a == "--compare") opt_compare = next();
+    else if (a == "-v")       opt_verbose = true;
+    else {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  make_frames();
+
+  make_bench_impulse();
+
+  // Model input quantization first, then other paths of the per-pixel code
+  const auto* block = (const ei_learning_block_config_tflite_graph_t*)bench_impulse.learning_blocks[0].config;
+  const auto* graph = (const ei_config_tflite_eon_graph_t*)block->graph_config;
+  TfLiteTensor in;
+  graph->model_input(0, &in);
+  int lut_differ = check_gray_lut("Grayscale", in.params.scale, (float)in.params.zero_point,
+                                  bench_impulse.learning_blocks[0].image_scaling);
+  const int model_lut_differ = lut_differ;
+  const float in_scale = in.params.scale;
+  const int in_zero_point = in.params.zero_point;
+  lut_differ += check_gray_lut("RGB", 0.003921568859368563f, -128, EI_CLASSIFIER_IMAGE_SCALING_NONE);
+  lut_differ += check_gray_lut("Grayscale", 0.0078125f, 0, EI_CLASSIFIER_IMAGE_SCALING_MIN128_127);
+  lut_differ += check_gray_lut("Grayscale", 0.02f, -10, EI_CLASSIFIER_IMAGE_SCALING_TORCH);
+  lut_differ += check_gray_lut("RGB", 0.02f, -10, EI_CLASSIFIER_IMAGE_SCALING_TORCH);
+
+  // Passes alternate in short blocks so load on the host hits both alike
+  pass_t per_frame = {}, session = {}, session_lut = {};
+  std::vector<double> open_ms;
+  for (int b = 0; b < opt_frames; b += BLOCK_FRAMES) {
+    const int end = std::min(opt_frames, b + BLOCK_FRAMES);
+    if (!run_frames("per-frame", per_frame, b, end)) return 1;
+
+    const uint64_t t_open = ei_read_timer_us();
+    if (run_classifier_session_open(bench_handle) != EI_IMPULSE_OK) {
+      fprintf(stderr, "session open failed\n");
+      return 1;
+    }
+    open_ms.push_back((ei_read_timer_us() - t_open) / 1000.0);
+    bool ok = run_frames("session", session, b, end);
+    ok = ok && run_frames("session, gray LUT", session_lut, b, end, true);
+    run_classifier_session_close();
+    if (!ok) return 1;
+  }
+
+  // What the session takes off every frame: model_init + model_reset alone
+  std::vector<double> init_reset_ms;
+  for (int i = 0; i < opt_frames; i++) {
+    const uint64_t t0 = ei_read_timer_us();
+    graph->model_init(ei_aligned_calloc);
+    graph->model_reset(ei_aligned_free);
+    init_reset_ms.push_back((ei_read_timer_us() - t0) / 1000.0);
+  }
+
+  int mismatched = 0, lut_mismatched = 0;
+  for (int f = 0; f < opt_frames; f++) {
+    if (per_frame.raw[f].empty() || per_frame.raw[f] != session.raw[f]) mismatched++;
+    if (per_frame.raw[f] != session_lut.raw[f]) lut_mismatched++;
+  }
+
+  printf("\n=== EI FOMO %dx%d, %d frames ===\n", W, H, opt_frames);
+  print_times("per-frame init", per_frame.frame_ms);
+  print_times("session", session.frame_ms);
+  print_times("session, gray LUT", session_lut.frame_ms);
+  print_times("session open", open_ms);
+  print_times("model init + reset", init_reset_ms);
+  print_times("DSP, get_data", session.dsp_ms);
+  print_times("DSP, gray LUT", session_lut.dsp_ms);
+  printf("  output maps: %zu B/frame, %d/%d frames differ between passes, boxes %d/%d\n",
+         per_frame.raw[0].size(), mismatched, opt_frames, per_frame.boxes, session.boxes);
+  printf("  gray LUT: %d/%d frames differ, %d values differ from the per-pixel path "
+         "(%d for this model, input scale %.6f zero point %d)\n",
+         lut_mismatched, opt_frames, lut_differ, model_lut_differ, in_scale, in_zero_point);
+  mismatched += lut_mismatched + lut_differ;
+
+  if (opt_save || opt_compare) {
+    static NodeHashProfiler hasher;
+    pass_t hashed = {};
+    bench_graph = graph;
+    node_hasher = &hasher;
+    if (run_classifier_set_profiler(bench_handle, &hasher) != EI_IMPULSE_OK ||
+        run_classifier_session_open(bench_handle) != EI_IMPULSE_OK) {
+      fprintf(stderr, "node hash pass setup failed\n");
+      return 1;
+    }
+    const bool ok = run_frames("hashed", hashed, 0, opt_frames);
+    run_classifier_session_close();
+    run_classifier_set_profiler(bench_handle, nullptr);
+    node_hasher = nullptr;
+    if (!ok) return 1;
+    if (opt_save && !save_reference(opt_save, hashed)) {
+      fprintf(stderr, "cannot write %s\n", opt_save);
+      return 1;
+    }
+    if (opt_compare) {
+      const int differ = compare_reference(opt_compare, hashed);
+      printf("  vs %s: %d/%d frames differ (output map + %zu node outputs)\n",
+             opt_compare, differ, opt_frames, hashed.nodes[0].size());
+      mismatched += differ;
+    }
+  }
+
+  if (opt_profile) {
+    // Separate pass: the timing passes above ran without a profiler attached
+    static tflite::MicroOpProfiler profiler;
+    pass_t profiled = {};
+    if (run_classifier_set_profiler(bench_handle, &profiler) != EI_IMPULSE_OK ||
+        run_classifier_session_open(bench_handle) != EI_IMPULSE_OK) {
+      fprintf(stderr, "profiler attach failed\n");
+      return 1;
+    }
+    const bool ok = run_frames("profiled", profiled, 0, opt_frames);
+    run_classifier_session_close();
+    run_classifier_set_profiler(bench_handle, nullptr);
+    if (!ok) return 1;
+    for (int f = 0; f < opt_frames; f++) {
+      if (profiled.raw[f] != per_frame.raw[f]) mismatched++;
+    }
+    printf("\n=== per-node profile (ticks = us) ===\n");
+    profiler.Log();
+    print_times("profiled frame", profiled.frame_ms);
+  }
+  return mismatched ? 1 : 0;
+}
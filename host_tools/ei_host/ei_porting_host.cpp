@@ -0,0 +1,51 @@
+// Edge Impulse porting layer for host builds.
+//
+// Replaces porting/clib/ei_classifier_porting.cpp, whose ei_read_timer_us()
+// always returns 0; here it reads CLOCK_MONOTONIC so SDK timings are real.
+// ei_malloc() / ei_calloc() are counted in ei_host_heap_allocs for the
+// benchmarks; they are weak, as in the SDK's own porting layers, so a tool
+// can route them elsewhere.
+
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+EI_IMPULSE_ERROR ei_run_impulse_check_canceled() {
+  return EI_IMPULSE_OK;
+}
+
+EI_IMPULSE_ERROR ei_sleep(int32_t time_ms) {
+  struct timespec ts = { time_ms / 1000, (long)(time_ms % 1000) * 1000000L };
+  nanosleep(&ts, nullptr);
+  return EI_IMPULSE_OK;
+}
+
+uint64_t ei_read_timer_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+uint64_t ei_read_timer_ms() {
+  return ei_read_timer_us() / 1000;
+}
+
+void ei_printf(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+void ei_printf_float(float f) { ei_printf("%f", f); }
+void ei_putchar(char c) { putchar(c); }
+char ei_getchar(void) { return (char)getchar(); }
+
+unsigned long ei_host_heap_allocs = 0;
+
+__attribute__((weak)) void* ei_malloc(size_t size) { ei_host_heap_allocs++; return malloc(size); }
+__attribute__((weak)) void* ei_calloc(size_t nitems, size_t size) { ei_host_heap_allocs++; return calloc(nitems, size); }
+__attribute__((weak)) void  ei_free(void* ptr) { free(ptr); }
@@ -0,0 +1,303 @@
+/*
+ * Check of the PAD-folded EON model against the export it came from
+ *
+ * The camera's tflite_learn_3_compiled.cpp is the Edge Impulse export run
+ * through `eon_plan --fold-pad`, plus hand-written runtime code. The export
+ * as Edge Impulse ships it is kept in eon_export/. The Makefile folds it again
+ * (build/fold/) and links three models into this tool under their own entry
+ * point names:
+ *
+ *   export     the unfolded export, PAD nodes and all
+ *   folded     the export after eon_plan --fold-pad
+ *   firmware   the model the camera builds
+ *
+ * It requires the firmware's graph tables (g0 arrays, tensorData, tflNodes,
+ * used_ops, subgraph and in/out indices, kTensorArenaSize) to be the
+ * folded export's line for line. It then runs the same int8 frames through
+ * all three, node by node (the firmware with its stem untiled), and requires
+ * every node output to be identical byte for byte, the export's PAD nodes
+ * aside. The softmax output alone saturates on most frames and proves little.
+ *
+ * Frames rotate through uniform noise, saturated extremes, gradients and
+ * noisy blocks, as in eon_tile_check.
+ *
+ * Usage: eon_fold_check [--frames N] [--seed S]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_op_profiler.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+
+#ifndef EXPORT_SRC
+#define EXPORT_SRC "eon_export/tflite_learn_3_compiled.cpp"
+#endif
+#ifndef FOLDED_SRC
+#define FOLDED_SRC "build/fold/tflite_learn_3_compiled.cpp"
+#endif
+#ifndef FIRMWARE_SRC
+#define FIRMWARE_SRC "../esp32_cam_project/lib/parkingpal5478069-project-1_inferencing/src/tflite-model/tflite_learn_3_compiled.cpp"
+#endif
+
+typedef void (*eon_node_cb_t)(size_t node, const int8_t* data, size_t bytes);
+
+// The export and its fold, built by eon_fold_nodes.cpp (see the Makefile)
+TfLiteStatus eon_export_init(void* (*alloc_fnc)(size_t, size_t));
+TfLiteStatus eon_export_input(int index, TfLiteTensor* tensor);
+TfLiteStatus eon_export_invoke_nodes(eon_node_cb_t on_node);
+TfLiteStatus eon_export_reset(void (*free)(void* ptr));
+TfLiteStatus eon_folded_init(void* (*alloc_fnc)(size_t, size_t));
+TfLiteStatus eon_folded_input(int index, TfLiteTensor* tensor);
+TfLiteStatus eon_folded_invoke_nodes(eon_node_cb_t on_node);
+TfLiteStatus eon_folded_reset(void (*free)(void* ptr));
+
+// =================== CONFIGURATION ===================
+static int      opt_frames = 200;
+static uint32_t opt_seed   = 1;
+
+// =================== FRAMES ===================
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+static void make_frame(int f, int8_t* px, int w, int h) {
+  switch (f % 4) {
+    case 0:   // uniform noise
+      for (int i = 0; i < w * h; i++) px[i] = (int8_t)(rng() & 0xFF);
+      break;
+    case 1: { // all dark or all bright, one odd pixel on an edge
+      const int8_t v = (f / 4) % 2 ? 127 : -128;
+      memset(px, v, (size_t)w * h);
+      px[rng() % w] = (int8_t)-v;
+      break;
+    }
+    case 2:   // diagonal gradient, direction varies
+      for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+          const int g = (f / 4) % 2 ? x + y : (w - 1 - x) + y;
+          px[y * w + x] = (int8_t)(g * 255 / (w + h - 2) - 128);
+        }
+      }
+      break;
+    default: { // dim noise with a few bright blocks, some touching the border
+      for (int i = 0; i < w * h; i++) px[i] = (int8_t)(-100 + (int)(rng() % 40));
+      for (int b = 0; b < 3; b++) {
+        const int bw = 8 + rng() % 24, bh = 8 + rng() % 24;
+        const int x0 = rng() % (w - bw + 8), y0 = rng() % (h - bh + 8);
+        for (int y = y0; y < y0 + bh && y < h; y++) {
+          for (int x = x0; x < x0 + bw && x < w; x++) px[y * w + x] = (int8_t)(60 + rng() % 60);
+        }
+      }
+      break;
+    }
+  }
+}
+
+// =================== GRAPH TABLES ===================
+typedef struct {
+  std::vector<std::string> lines;   // generated tables, in file order
+  std::vector<bool>        is_pad;  // per node
+  int pads;
+} tables_t;
+
+// From `namespace g0 {` through out_tensor_indices, plus the arena sizes
+static bool read_tables(const char* path, tables_t& t) {
+  std::ifstream in(path);
+  if (!in) return false;
+  t = tables_t{};
+  bool inside = false, ops_next = false, last_block = false;
+  for (std::string l; std::getline(in, l);) {
+    if (l.rfind("namespace g0 {", 0) == 0) inside = true;
+    if (l.find("constexpr int kTensorArenaSize = ") != std::string::npos) t.lines.push_back(l);
+    if (!inside) continue;
+    t.lines.push_back(l);
+    if (ops_next) {
+      for (size_t at = l.find("OP_"); at != std::string::npos; at = l.find("OP_", at + 1)) {
+        t.is_pad.push_back(l.compare(at, 7, "OP_PAD,") == 0);
+        t.pads += t.is_pad.back();
+      }
+    }
+    ops_next = l.rfind("used_operators_e used_ops[] =", 0) == 0;
+    if (l.rfind("static const int out_tensor_indices[] = {", 0) == 0) last_block = true;
+    if (last_block && l.rfind("};", 0) == 0) break;
+  }
+  return !t.is_pad.empty();
+}
+
+// =================== RUN ===================
+typedef std::vector<std::vector<int8_t>> outputs_t;   // node -> output bytes
+
+static outputs_t* capture_to = nullptr;
+
+static void capture(size_t node, const int8_t* data, size_t bytes) {
+  if (capture_to->size() <= node) capture_to->resize(node + 1);
+  (*capture_to)[node].assign(data, data + bytes);
+}
+
+// The firmware model hands node outputs out through its profiler hook
+class NodeProfiler : public tflite::MicroOpProfiler {
+ public:
+  uint32_t BeginEvent(const char* tag) override {
+    node_ = (size_t)atoi(tag);
+    return MicroOpProfiler::BeginEvent(tag);
+  }
+
+  void EndEvent(uint32_t event_handle) override {
+    MicroOpProfiler::EndEvent(event_handle);
+    TfLiteTensor t;
+    if (on_node && tflite_learn_3_node_output(node_, &t) == kTfLiteOk) {
+      on_node(node_, (const int8_t*)t.data.data, t.bytes);
+    }
+  }
+
+  eon_node_cb_t on_node = nullptr;
+
+ private:
+  size_t node_ = 0;
+};
+
+static TfLiteStatus firmware_invoke_nodes(eon_node_cb_t on_node) {
+  static NodeProfiler profiler;
+  profiler.on_node = on_node;
+  tflite_learn_3_set_profiler(&profiler);
+  const TfLiteStatus status = tflite_learn_3_invoke();
+  tflite_learn_3_set_profiler(nullptr);
+  return status;
+}
+
+typedef struct {
+  const char* name;
+  TfLiteStatus (*init)(void* (*)(size_t, size_t));
+  TfLiteStatus (*input)(int, TfLiteTensor*);
+  TfLiteStatus (*invoke_nodes)(eon_node_cb_t);
+  TfLiteStatus (*reset)(void (*)(void*));
+  const tables_t* tables;
+  size_t arena;
+  outputs_t out;   // this frame, PAD nodes dropped
+} model_t;
+
+static size_t arena_bytes = 0;
+
+static void* arena_alloc(size_t align, size_t size) {
+  arena_bytes = size;
+  void* p = aligned_alloc(align, (size + align - 1) / align * align);
+  if (p) memset(p, 0, size);
+  return p;
+}
+
+static bool run_frame(model_t& m, const std::vector<int8_t>& frame) {
+  TfLiteTensor in;
+  m.input(0, &in);
+  if (in.bytes != frame.size()) return false;
+  memcpy(in.data.data, frame.data(), frame.size());
+  outputs_t all;
+  capture_to = &all;
+  if (m.invoke_nodes(capture) != kTfLiteOk || all.size() != m.tables->is_pad.size()) return false;
+  m.out.clear();
+  for (size_t n = 0; n < all.size(); n++) {
+    if (!m.tables->is_pad[n]) m.out.push_back(all[n]);
+  }
+  return true;
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc) opt_frames = atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc)   opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else {
+      fprintf(stderr, "usage: eon_fold_check [--frames N] [--seed S]\n");
+      exit(2);
+    }
+  }
+  if (opt_frames < 1) opt_frames = 1;
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+
+  tables_t exported, folded, firmware;
+  if (!read_tables(EXPORT_SRC, exported) || !read_tables(FOLDED_SRC, folded) ||
+      !read_tables(FIRMWARE_SRC, firmware)) {
+    fprintf(stderr, "cannot read the graph tables of %s, %s or %s\n", EXPORT_SRC, FOLDED_SRC, FIRMWARE_SRC);
+    return 1;
+  }
+  size_t table_diff = 0;
+  while (table_diff < folded.lines.size() && table_diff < firmware.lines.size() &&
+         folded.lines[table_diff] == firmware.lines[table_diff]) {
+    table_diff++;
+  }
+  const bool tables_ok = folded.lines == firmware.lines;
+
+  model_t models[] = {
+    {"export", eon_export_init, eon_export_input, eon_export_invoke_nodes, eon_export_reset, &exported, 0, {}},
+    {"folded", eon_folded_init, eon_folded_input, eon_folded_invoke_nodes, eon_folded_reset, &folded, 0, {}},
+    {"firmware", tflite_learn_3_init, tflite_learn_3_input, firmware_invoke_nodes, tflite_learn_3_reset,
+     &firmware, 0, {}},
+  };
+#if EI_CLASSIFIER_TILED_STEM
+  tflite_learn_3_set_tiled_stem(false);   // eon_tile_check covers the tiled stem
+#endif
+  for (model_t& m : models) {
+    if (m.init(arena_alloc) != kTfLiteOk) {
+      fprintf(stderr, "%s: model init failed\n", m.name);
+      return 1;
+    }
+    m.arena = arena_bytes;
+  }
+
+  TfLiteTensor in;
+  tflite_learn_3_input(0, &in);
+  const int w = in.dims->data[2], h = in.dims->data[1];
+  std::vector<int8_t> frame((size_t)w * h);
+  rng_state = opt_seed;
+
+  int differ = 0;
+  size_t compared = 0, bytes = 0;
+  for (int f = 0; f < opt_frames; f++) {
+    make_frame(f, frame.data(), w, h);
+    for (model_t& m : models) {
+      if (!run_frame(m, frame)) {
+        fprintf(stderr, "%s: invoke failed on frame %d\n", m.name, f);
+        return 1;
+      }
+    }
+    bool frame_ok = true;
+    for (int k = 1; k < 3; k++) {
+      const outputs_t &ref = models[0].out, &got = models[k].out;
+      for (size_t n = 0; n < ref.size(); n++) {
+        if (n < got.size() && got[n] == ref[n]) continue;
+        if (frame_ok) printf("  frame %d: %s node %zu differs from the export\n", f, models[k].name, n);
+        frame_ok = false;
+      }
+      if (got.size() != ref.size()) frame_ok = false;
+    }
+    for (const std::vector<int8_t>& o : models[0].out) bytes += o.size();
+    compared += models[0].out.size();
+    if (!frame_ok) differ++;
+  }
+  for (model_t& m : models) m.reset(free);
+
+  printf("\n=== EON PAD fold: export vs folded vs firmware, %d frames ===\n", opt_frames);
+  for (const model_t& m : models) {
+    printf("  %-9s %2zu nodes (%d PAD)  arena %7zu B\n", m.name, m.tables->is_pad.size(), m.tables->pads, m.arena);
+  }
+  if (tables_ok) {
+    printf("  firmware graph tables: the folded export's, %zu lines\n", firmware.lines.size());
+  } else {
+    printf("  firmware graph tables differ from the folded export's at table line %zu:\n", table_diff);
+    printf("    folded   %.100s\n", table_diff < folded.lines.size() ? folded.lines[table_diff].c_str() : "(end)");
+    printf("    firmware %.100s\n", table_diff < firmware.lines.size() ? firmware.lines[table_diff].c_str() : "(end)");
+  }
+  printf("  node outputs compared: %zu (%zu per frame, %zu B)\n", compared, models[0].out.size(),
+         bytes / opt_frames);
+  printf("  %d/%d frames differ\n", differ, opt_frames);
+  return (differ || !tables_ok) ? 1 : 0;
+}
@@ -0,0 +1,29 @@
+/*
+ * Node-by-node run of an EON export, for eon_fold_check
+ *
+ * Built once per export: EON_SRC names the source, EON_PREFIX the prefix of
+ * what this file adds, and the export's own tflite_learn_3_* entry points are
+ * renamed on the command line. Including the source gives access to the
+ * graph tables the generated invoke keeps to itself.
+ */
+
+#include EON_SRC
+
+#define EON_CAT2(a, b) a##_##b
+#define EON_CAT(a, b)  EON_CAT2(a, b)
+#define EON_FN(f)      EON_CAT(EON_PREFIX, f)
+
+typedef void (*eon_node_cb_t)(size_t node, const int8_t* data, size_t bytes);
+
+// The generated invoke, handing each node's output to on_node as the node finishes
+TfLiteStatus EON_FN(invoke_nodes)(eon_node_cb_t on_node) {
+  for (size_t i = 0; i < sizeof(used_ops) / sizeof(used_ops[0]); ++i) {
+    ResetTensors();
+    const TfLiteStatus status = registrations[used_ops[i]].invoke(&ctx, &tflNodes[i]);
+    if (status != kTfLiteOk) return status;
+    TfLiteTensor out;
+    init_tflite_tensor(tflNodes[i].outputs->data[0], &out);
+    on_node(i, (const int8_t*)out.data.data, out.bytes);
+  }
+  return kTfLiteOk;
+}
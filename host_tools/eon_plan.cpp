@@ -0,0 +1,724 @@
+/*
+ * Offline arena planner for the camera's EON-compiled model
+ *
+ * The EON export bakes one tensor_arena offset per activation tensor into
+ * tflite_learn_3_compiled.cpp. This tool reads the graph back from the model
+ * (tensor sizes, node wiring), derives each activation's lifetime in node
+ * order and re-plans the arena with the SDK's GreedyMemoryPlanner:
+ *
+ *   baseline   offsets as they are in the source
+ *   greedy     every activation its own buffer
+ *   in-place   ADD writes over an input that dies at the ADD (same size,
+ *              element-wise, so the output can alias it)
+ *
+ * It prints peak tensor bytes for each, the lower bound (largest set of
+ * simultaneously live tensors) and the offset table. --apply rewrites the
+ * offsets and kTensorArenaSize in the given source, keeping the persistent /
+ * scratch headroom the export left above the tensors.
+ *
+ * --fold-pad works on the text of an export instead of the linked model. Each
+ * PAD whose only reader is a VALID depthwise convolution, padding exactly as
+ * SAME would with the input's zero point, is dropped and the depthwise is
+ * switched to SAME. The padded tensor and the pad spec go, tensor indices and
+ * the generated counts are renumbered, and the result is planned as above.
+ * An export without such a PAD is left as it is.
+ *
+ * Usage: eon_plan [--no-inplace] [--apply tflite_learn_3_compiled.cpp]
+ *        eon_plan [--no-inplace] --fold-pad export.cpp [--out folded.cpp]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/memory_helpers.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+
+// =================== CONFIGURATION ===================
+static bool        opt_inplace = true;
+static const char* opt_apply   = nullptr;
+static const char* opt_fold    = nullptr;
+static const char* opt_out     = nullptr;
+
+static const size_t ALIGN = 16;   // same as the micro allocator's buffer alignment
+
+// =================== GRAPH ===================
+typedef struct {
+  bool   arena;
+  size_t bytes;
+  size_t old_offset;
+  int    first, last;   // node range the tensor is live in, -1 if unused
+  int    alias;         // in-place: tensor whose buffer this one reuses, else -1
+  int    offset;        // planned
+} tensor_t;
+
+static std::vector<tensor_t> tensors;
+static std::vector<std::vector<int>> node_in, node_out;
+static std::vector<bool> node_is_add;
+static size_t arena_size = 0;
+
+static bool load_graph() {
+  size_t n_tensors, n_nodes;
+  if (tflite_learn_3_graph_info(&arena_size, &n_tensors, &n_nodes) != kTfLiteOk) return false;
+
+  tensors.assign(n_tensors, tensor_t{});
+  for (size_t t = 0; t < n_tensors; t++) {
+    tensor_t& x = tensors[t];
+    if (tflite_learn_3_tensor_info(t, &x.arena, &x.old_offset, &x.bytes) != kTfLiteOk) return false;
+    x.first = x.last = -1;
+    x.alias = -1;
+    x.offset = (int)x.old_offset;
+  }
+
+  node_in.resize(n_nodes);
+  node_out.resize(n_nodes);
+  node_is_add.resize(n_nodes);
+  for (size_t n = 0; n < n_nodes; n++) {
+    const TfLiteIntArray *in, *out;
+    const char* tag;
+    uint64_t macs;
+    uint32_t bytes;
+    if (tflite_learn_3_node_io(n, &in, &out) != kTfLiteOk ||
+        tflite_learn_3_node_info(n, &tag, &macs, &bytes) != kTfLiteOk) {
+      return false;
+    }
+    node_in[n].assign(in->data, in->data + in->size);
+    node_out[n].assign(out->data, out->data + out->size);
+    node_is_add[n] = strstr(tag, " ADD") != nullptr;
+  }
+  return true;
+}
+
+// Live range per activation; graph inputs live from node 0, outputs to the end
+static void compute_lifetimes() {
+  const int last_node = (int)node_in.size() - 1;
+  std::vector<bool> produced(tensors.size()), consumed(tensors.size());
+  auto touch = [&](int t, int n) {
+    if (t < 0 || !tensors[t].arena) return;
+    tensor_t& x = tensors[t];
+    x.first = (x.first < 0) ? n : std::min(x.first, n);
+    x.last = std::max(x.last, n);
+  };
+  for (int n = 0; n <= last_node; n++) {
+    for (int t : node_in[n]) {
+      touch(t, n);
+      if (t >= 0) consumed[t] = true;
+    }
+    for (int t : node_out[n]) {
+      touch(t, n);
+      produced[t] = true;
+    }
+  }
+  for (size_t t = 0; t < tensors.size(); t++) {
+    if (tensors[t].first < 0) continue;
+    if (!produced[t]) tensors[t].first = 0;
+    if (!consumed[t]) tensors[t].last = last_node;
+  }
+}
+
+static int root_of(int t) {
+  while (tensors[t].alias >= 0) t = tensors[t].alias;
+  return t;
+}
+
+// ADD output takes over an input buffer whose last reader is this ADD
+static int apply_inplace_add() {
+  int merged = 0;
+  for (size_t n = 0; n < node_in.size(); n++) {
+    if (!node_is_add[n]) continue;
+    const int out = node_out[n][0];
+    for (int in : node_in[n]) {
+      if (in < 0 || in == out || !tensors[in].arena) continue;
+      const int root = root_of(in);
+      if (tensors[in].last != (int)n || tensors[in].bytes != tensors[out].bytes) continue;
+      tensors[out].alias = root;
+      tensors[root].last = std::max(tensors[root].last, tensors[out].last);
+      merged++;
+      break;
+    }
+  }
+  return merged;
+}
+
+// =================== PLANNING ===================
+static size_t plan_greedy() {
+  std::vector<int> ids;
+  for (size_t t = 0; t < tensors.size(); t++) {
+    if (tensors[t].first >= 0 && tensors[t].alias < 0) ids.push_back((int)t);
+  }
+  std::vector<unsigned char> scratch(tflite::GreedyMemoryPlanner::per_buffer_size() * ids.size());
+  tflite::GreedyMemoryPlanner planner;
+  planner.Init(scratch.data(), (int)scratch.size());
+  for (int t : ids) {
+    planner.AddBuffer((int)tflite::AlignSizeUp(tensors[t].bytes, ALIGN), tensors[t].first, tensors[t].last);
+  }
+  for (size_t i = 0; i < ids.size(); i++) {
+    planner.GetOffsetForBuffer((int)i, &tensors[ids[i]].offset);
+  }
+  for (size_t t = 0; t < tensors.size(); t++) {
+    if (tensors[t].alias >= 0) tensors[t].offset = tensors[root_of((int)t)].offset;
+  }
+  return planner.GetMaximumMemorySize();
+}
+
+static size_t peak_of(bool planned) {
+  size_t peak = 0;
+  for (const tensor_t& x : tensors) {
+    if (x.first < 0) continue;
+    peak = std::max(peak, (planned ? (size_t)x.offset : x.old_offset) + x.bytes);
+  }
+  return peak;
+}
+
+// Largest sum of simultaneously live buffers, aliases counted once
+static size_t lower_bound() {
+  size_t best = 0;
+  for (size_t n = 0; n < node_in.size(); n++) {
+    size_t live = 0;
+    for (const tensor_t& x : tensors) {
+      if (x.first >= 0 && x.alias < 0 && x.first <= (int)n && (int)n <= x.last) live += x.bytes;
+    }
+    best = std::max(best, live);
+  }
+  return best;
+}
+
+// Two live, distinct buffers sharing bytes at the same node
+static int count_overlaps() {
+  int bad = 0;
+  for (size_t a = 0; a < tensors.size(); a++) {
+    for (size_t b = a + 1; b < tensors.size(); b++) {
+      const tensor_t& x = tensors[a];
+      const tensor_t& y = tensors[b];
+      if (x.first < 0 || y.first < 0 || root_of((int)a) == root_of((int)b)) continue;
+      const bool time = x.first <= y.last && y.first <= x.last;
+      const bool space = x.offset < y.offset + (int)y.bytes && y.offset < x.offset + (int)x.bytes;
+      if (time && space) bad++;
+    }
+  }
+  return bad;
+}
+
+// =================== APPLY ===================
+static std::string replace_number_after(const std::string& line, const std::string& key, size_t value) {
+  const size_t at = line.find(key);
+  if (at == std::string::npos) return line;
+  const size_t from = at + key.size();
+  size_t to = from;
+  while (to < line.size() && isdigit((unsigned char)line[to])) to++;
+  return line.substr(0, from) + std::to_string(value) + line.substr(to);
+}
+
+static bool apply_to_source(const char* path, size_t new_arena) {
+  std::ifstream in(path);
+  if (!in) return false;
+  std::vector<std::string> lines;
+  for (std::string l; std::getline(in, l);) lines.push_back(l);
+  in.close();
+
+  size_t row = 0;
+  bool in_table = false;
+  for (std::string& l : lines) {
+    if (l.rfind("TensorInfo_t tensorData[] = {", 0) == 0) {
+      in_table = true;
+      continue;
+    }
+    if (in_table && l.rfind("};", 0) == 0) {
+      in_table = false;
+      continue;
+    }
+    if (in_table) {
+      if (row < tensors.size() && tensors[row].arena && tensors[row].first >= 0) {
+        l = replace_number_after(l, "(tensor_arena + ", (size_t)tensors[row].offset);
+      }
+      row++;
+      continue;
+    }
+    // Keep the export's gap between the two arena size variants
+    const std::string key = "constexpr int kTensorArenaSize = ";
+    if (l.find(key) != std::string::npos) {
+      const long old = atol(l.c_str() + l.find(key) + key.size());
+      l = replace_number_after(l, key, (size_t)(old - (long)arena_size + (long)new_arena));
+    }
+  }
+  if (row != tensors.size()) {
+    fprintf(stderr, "%s: tensorData has %zu rows, model has %zu tensors\n", path, row, tensors.size());
+    return false;
+  }
+
+  std::ofstream out(path);
+  for (const std::string& l : lines) out << l << "\n";
+  return (bool)out;
+}
+
+// =================== EXPORT SOURCE ===================
+// The graph tables of an EON export, read back as text so a fresh export can
+// be rewritten before it is ever compiled
+typedef struct {
+  bool        arena;
+  size_t      offset, bytes;
+  std::string type, dims, quant, data;   // element type and g0:: names, "" if none
+} src_tensor_t;
+
+typedef struct {
+  std::string      id;   // K of g0::inputsK / outputsK / opdataK
+  std::string      op;   // OP_* from used_ops
+  std::vector<int> in, out;
+} src_node_t;
+
+typedef struct {
+  std::vector<std::string>      lines;
+  std::vector<bool>             dead;        // dropped when written back
+  std::map<std::string, size_t> decl;        // g0 name -> first line of its definition
+  std::vector<src_tensor_t>     tensors;
+  std::vector<size_t>           tensor_line;
+  std::vector<src_node_t>       nodes;
+  std::vector<int>              graph_in, graph_out;
+  std::vector<size_t>           graph_in_line, graph_out_line;
+  size_t                        ops_line;
+  size_t                        arena_size;
+} src_graph_t;
+
+static bool starts_with(const std::string& s, const char* prefix) {
+  return s.rfind(prefix, 0) == 0;
+}
+
+static bool is_ident(char c) {
+  return isalnum((unsigned char)c) || c == '_';
+}
+
+// Integer literals in s, skipping digits inside identifiers and comments
+static std::vector<int> parse_ints(const std::string& s) {
+  std::vector<int> v;
+  for (size_t i = 0; i < s.size();) {
+    if (s.compare(i, 2, "/*") == 0) {
+      const size_t end = s.find("*/", i + 2);
+      i = (end == std::string::npos) ? s.size() : end + 2;
+    } else if (is_ident(s[i]) && !isdigit((unsigned char)s[i])) {
+      while (i < s.size() && is_ident(s[i])) i++;
+    } else if (isdigit((unsigned char)s[i]) || (s[i] == '-' && i + 1 < s.size() && isdigit((unsigned char)s[i + 1]))) {
+      char* end;
+      v.push_back((int)strtol(s.c_str() + i, &end, 10));
+      i = end - s.c_str();
+    } else {
+      i++;
+    }
+  }
+  return v;
+}
+
+// Identifier starting right after key, "" if key is absent
+static std::string name_after(const std::string& s, const std::string& key) {
+  const size_t at = s.find(key);
+  if (at == std::string::npos) return "";
+  size_t end = at + key.size();
+  while (end < s.size() && is_ident(s[end])) end++;
+  return s.substr(at + key.size(), end - at - key.size());
+}
+
+// Element list of `{ n, { a,b,c } }`
+static std::vector<int> inner_list(const std::string& s) {
+  const size_t close = s.find('}');
+  const size_t open = s.rfind('{', close);
+  return parse_ints(s.substr(open + 1, close - open - 1));
+}
+
+static bool has_word(const std::string& s, const std::string& word) {
+  for (size_t at = s.find(word); at != std::string::npos; at = s.find(word, at + 1)) {
+    const bool head = at == 0 || !is_ident(s[at - 1]);
+    const bool tail = at + word.size() == s.size() || !is_ident(s[at + word.size()]);
+    if (head && tail) return true;
+  }
+  return false;
+}
+
+static size_t decl_end(const src_graph_t& g, size_t from) {
+  size_t to = from;
+  while (to + 1 < g.lines.size() && g.lines[to].find_last_not_of(" \t") != std::string::npos &&
+         g.lines[to][g.lines[to].find_last_not_of(" \t")] != ';') {
+    to++;
+  }
+  return to;
+}
+
+static std::vector<int> decl_ints(const src_graph_t& g, const std::string& name, bool list) {
+  const auto it = g.decl.find(name);
+  if (it == g.decl.end()) return {};
+  std::string text;
+  for (size_t i = it->second; i <= decl_end(g, it->second); i++) text += g.lines[i] + "\n";
+  if (list) return inner_list(text);
+  return parse_ints(text.substr(text.find("= {") + 3));
+}
+
+static bool load_source(const char* path, src_graph_t& g) {
+  std::ifstream in(path);
+  if (!in) return false;
+  g = src_graph_t{};
+  for (std::string l; std::getline(in, l);) g.lines.push_back(l);
+  g.dead.assign(g.lines.size(), false);
+
+  static const std::regex io_re("^const TfArray<\\d+, int> (inputs|outputs)(\\d+) = ");
+  static const std::regex decl_re("^const .*?(\\w+)(\\[[^\\]]*\\])? = ");
+  std::map<std::string, std::vector<int>> io;
+  std::vector<std::string> ops, ids;
+  enum { NONE, G0, TENSORS, NODES, SKIP, IN_IDX, OUT_IDX } block = NONE;
+  bool nodes_seen = false;
+  for (size_t i = 0; i < g.lines.size(); i++) {
+    const std::string& l = g.lines[i];
+    std::smatch m;
+    if (block == G0 && starts_with(l, "};")) {
+      block = NONE;
+    } else if (block == G0) {
+      if (std::regex_search(l, m, decl_re) && !g.decl.count(m[1])) g.decl[m[1]] = i;
+      if (std::regex_search(l, m, io_re)) io[m[1].str() + m[2].str()] = inner_list(l);
+      if (starts_with(l, "const ")) i = decl_end(g, i);   // weight tables end in "};" too
+    } else if (block != NONE && starts_with(l, "};")) {
+      if (block == NODES) nodes_seen = true;
+      block = NONE;
+    } else if (block == TENSORS) {
+      src_tensor_t t;
+      const size_t at = l.find("(tensor_arena + ");
+      t.arena = at != std::string::npos;
+      t.offset = t.arena ? strtoul(l.c_str() + at + 16, nullptr, 10) : 0;
+      t.type = name_after(l, ", kTfLite");
+      t.dims = "tensor_dimension" + name_after(l, "&g0::tensor_dimension");
+      t.bytes = strtoul(l.c_str() + l.find(t.dims) + t.dims.size() + 2, nullptr, 10);
+      t.quant = name_after(l, "&g0::quant");
+      if (!t.quant.empty()) t.quant = "quant" + t.quant;
+      t.data = name_after(l, "g0::tensor_data");
+      if (!t.data.empty()) t.data = "tensor_data" + t.data;
+      g.tensors.push_back(t);
+      g.tensor_line.push_back(i);
+    } else if (block == NODES) {
+      ids.push_back(name_after(l, "&g0::inputs"));
+    } else if (block == IN_IDX || block == OUT_IDX) {
+      for (int t : parse_ints(l)) {
+        (block == IN_IDX ? g.graph_in : g.graph_out).push_back(t);
+        (block == IN_IDX ? g.graph_in_line : g.graph_out_line).push_back(i);
+      }
+    } else if (block == NONE) {
+      if (starts_with(l, "namespace g0 {")) block = G0;
+      else if (starts_with(l, "TensorInfo_t tensorData[] = {")) block = TENSORS;
+      else if (starts_with(l, "TfLiteNode tflNodes[")) block = nodes_seen ? SKIP : NODES;
+      else if (starts_with(l, "static const int in_tensor_indices[] = {")) block = IN_IDX;
+      else if (starts_with(l, "static const int out_tensor_indices[] = {")) block = OUT_IDX;
+      else if (starts_with(l, "used_operators_e used_ops[] =") && i + 1 < g.lines.size()) {
+        g.ops_line = i + 1;
+        for (size_t at = g.lines[i + 1].find("OP_"); at != std::string::npos;
+             at = g.lines[i + 1].find("OP_", at + 1)) {
+          ops.push_back("OP_" + name_after(g.lines[i + 1].substr(at), "OP_"));
+          at += ops.back().size() - 1;
+        }
+      } else if (l.find("constexpr int kTensorArenaSize = ") != std::string::npos) {
+        // the last definition is the one outside the HIMAX variants
+        g.arena_size = strtoul(l.c_str() + l.find(" = ") + 3, nullptr, 10);
+      }
+    }
+  }
+
+  if (g.tensors.empty() || ids.empty() || ids.size() != ops.size()) return false;
+  for (size_t n = 0; n < ids.size(); n++) {
+    if (!io.count("inputs" + ids[n]) || !io.count("outputs" + ids[n])) return false;
+    g.nodes.push_back(src_node_t{ids[n], ops[n], io["inputs" + ids[n]], io["outputs" + ids[n]]});
+  }
+  return true;
+}
+
+static bool write_source(const src_graph_t& g, const char* path) {
+  std::ofstream out(path);
+  for (size_t i = 0; i < g.lines.size(); i++) {
+    if (!g.dead[i]) out << g.lines[i] << "\n";
+  }
+  return (bool)out;
+}
+
+// Planner input from the parsed tables instead of the linked model
+static void load_graph_from(const src_graph_t& g) {
+  tensors.assign(g.tensors.size(), tensor_t{});
+  for (size_t t = 0; t < g.tensors.size(); t++) {
+    tensor_t& x = tensors[t];
+    x.arena = g.tensors[t].arena;
+    x.bytes = g.tensors[t].bytes;
+    x.old_offset = g.tensors[t].offset;
+    x.first = x.last = -1;
+    x.alias = -1;
+    x.offset = (int)x.old_offset;
+  }
+  node_in.clear();
+  node_out.clear();
+  node_is_add.clear();
+  for (const src_node_t& n : g.nodes) {
+    node_in.push_back(n.in);
+    node_out.push_back(n.out);
+    node_is_add.push_back(n.op == "OP_ADD");
+  }
+  arena_size = g.arena_size;
+}
+
+// =================== PAD FOLD ===================
+// SAME padding of a strided window: rows/cols added before and after
+static void same_pad(int in, int k, int stride, int* out, int* before, int* after) {
+  *out = (in + stride - 1) / stride;
+  const int total = std::max((*out - 1) * stride + k - in, 0);
+  *before = total / 2;
+  *after = total - *before;
+}
+
+static std::string int_array(const char* kind, const std::string& id, const std::vector<int>& v) {
+  std::string items;
+  for (size_t i = 0; i < v.size(); i++) items += (i ? "," : "") + std::to_string(v[i]);
+  return "const TfArray<" + std::to_string(v.size()) + ", int> " + kind + id + " = { " +
+         std::to_string(v.size()) + ", { " + items + " } };";
+}
+
+static void replace_all(std::string& s, const std::string& from, const std::string& to) {
+  for (size_t at = s.find(from); at != std::string::npos; at = s.find(from, at + to.size())) {
+    s.replace(at, from.size(), to);
+  }
+}
+
+// A PAD in front of a VALID depthwise is that depthwise with SAME padding when
+// the pad amounts are SAME's and the fill is the input zero point (PAD fills
+// with its output zero point, so input and output must share quantization)
+static int fold_candidate(const src_graph_t& g, size_t p) {
+  const src_node_t& pad = g.nodes[p];
+  if (pad.op != "OP_PAD" || pad.in.size() != 2 || pad.out.size() != 1) return -1;
+  const int x = pad.in[0], spec = pad.in[1], y = pad.out[0];
+  if (std::count(g.graph_out.begin(), g.graph_out.end(), y)) return -1;
+  int consumer = -1;
+  for (size_t n = 0; n < g.nodes.size(); n++) {
+    const int uses = (int)std::count(g.nodes[n].in.begin(), g.nodes[n].in.end(), y);
+    if (uses && consumer >= 0) return -1;
+    if (uses) consumer = (int)n;
+  }
+  if (consumer < 0) return -1;
+
+  const src_node_t& dw = g.nodes[consumer];
+  const auto op = g.decl.find("opdata" + dw.id);
+  if (dw.op != "OP_DEPTHWISE_CONV_2D" || dw.in.size() < 2 || dw.in[0] != y || op == g.decl.end()) return -1;
+  const std::string& params = g.lines[op->second];
+  const std::vector<int> p_ints = parse_ints(params);   // stride w,h, multiplier, dilation w,h
+  if (params.find("kTfLitePaddingValid") == std::string::npos || p_ints.size() != 5 ||
+      p_ints[3] != 1 || p_ints[4] != 1) {
+    return -1;
+  }
+  const src_tensor_t &tx = g.tensors[x], &ty = g.tensors[y];
+  if (tx.type != ty.type || tx.quant != ty.quant || tx.quant.empty()) return -1;
+
+  const std::vector<int> xd = decl_ints(g, tx.dims, true);
+  const std::vector<int> kd = decl_ints(g, g.tensors[dw.in[1]].dims, true);
+  const std::vector<int> od = decl_ints(g, g.tensors[dw.out[0]].dims, true);
+  const std::vector<int> pads = decl_ints(g, g.tensors[spec].data, false);
+  if (xd.size() != 4 || kd.size() != 4 || od.size() != 4 || pads.size() != 8) return -1;
+  int oh, ow, bh, ah, bw, aw;
+  same_pad(xd[1], kd[1], p_ints[1], &oh, &bh, &ah);
+  same_pad(xd[2], kd[2], p_ints[0], &ow, &bw, &aw);
+  const std::vector<int> want = {0, 0, bh, ah, bw, aw, 0, 0};
+  if (pads != want || od[1] != oh || od[2] != ow) return -1;
+  return consumer;
+}
+
+static int fold_pads(src_graph_t& g) {
+  const size_t n_nodes = g.nodes.size(), n_tensors = g.tensors.size();
+  std::vector<bool> drop_node(n_nodes), drop_tensor(n_tensors);
+  int folded = 0;
+  for (size_t p = 0; p < n_nodes; p++) {
+    const int c = fold_candidate(g, p);
+    if (g.nodes[p].op == "OP_PAD" && c < 0) printf("  node %zu PAD: not foldable, kept\n", p);
+    if (c < 0) continue;
+    src_node_t& pad = g.nodes[p];
+    src_node_t& dw = g.nodes[c];
+    printf("  node %zu PAD %d -> %d folded into node %d DEPTHWISE_CONV_2D as SAME padding\n",
+           p, pad.in[0], pad.out[0], c);
+    dw.in[0] = pad.in[0];
+    replace_all(g.lines[g.decl["opdata" + dw.id]], "kTfLitePaddingValid", "kTfLitePaddingSame");
+    drop_node[p] = true;
+    drop_tensor[pad.out[0]] = true;
+    drop_tensor[pad.in[1]] = true;
+    folded++;
+  }
+  if (!folded) return 0;
+
+  // Pad specs shared with a PAD that stays are kept
+  for (size_t n = 0; n < n_nodes; n++) {
+    if (drop_node[n]) continue;
+    for (int t : g.nodes[n].in) if (t >= 0) drop_tensor[t] = false;
+  }
+
+  std::vector<int> remap(n_tensors, -1);
+  int kept = 0;
+  std::vector<std::string> orphans;
+  for (size_t t = 0; t < n_tensors; t++) {
+    if (!drop_tensor[t]) {
+      remap[t] = kept++;
+      continue;
+    }
+    g.dead[g.tensor_line[t]] = true;
+    for (const std::string* name : {&g.tensors[t].dims, &g.tensors[t].quant, &g.tensors[t].data}) {
+      if (!name->empty()) orphans.push_back(*name);
+    }
+  }
+
+  std::vector<src_node_t> nodes;
+  std::string ops = "{";
+  for (size_t n = 0; n < n_nodes; n++) {
+    src_node_t& node = g.nodes[n];
+    if (drop_node[n]) {
+      for (const char* kind : {"inputs", "outputs", "opdata"}) {
+        if (g.decl.count(kind + node.id)) orphans.push_back(kind + node.id);
+      }
+      const std::string row = "(TfLiteIntArray*)&g0::inputs" + node.id + ",";
+      for (size_t i = 0; i < g.lines.size(); i++) {
+        if (starts_with(g.lines[i], "{ ") && g.lines[i].find(row) != std::string::npos) g.dead[i] = true;
+      }
+      continue;
+    }
+    for (int& t : node.in) if (t >= 0) t = remap[t];
+    for (int& t : node.out) t = remap[t];
+    g.lines[g.decl["inputs" + node.id]] = int_array("inputs", node.id, node.in);
+    g.lines[g.decl["outputs" + node.id]] = int_array("outputs", node.id, node.out);
+    ops += node.op + ", ";
+    nodes.push_back(node);
+  }
+  g.lines[g.ops_line] = ops + "};";
+  for (size_t i = 0; i < g.graph_in.size(); i++) {
+    g.lines[g.graph_in_line[i]] = "  " + std::to_string(remap[g.graph_in[i]]) + ", ";
+  }
+  for (size_t i = 0; i < g.graph_out.size(); i++) {
+    g.lines[g.graph_out_line[i]] = "  " + std::to_string(remap[g.graph_out[i]]) + ", ";
+  }
+
+  // Counts baked into the generated runtime
+  const std::string on = std::to_string(n_nodes), nn = std::to_string(nodes.size());
+  const std::string ot = std::to_string(n_tensors), nt = std::to_string(kept);
+  const bool pad_left = std::any_of(nodes.begin(), nodes.end(),
+                                    [](const src_node_t& n) { return n.op == "OP_PAD"; });
+  for (size_t i = 0; i < g.lines.size(); i++) {
+    std::string& l = g.lines[i];
+    replace_all(l, "tflNodes[" + on + "] = {", "tflNodes[" + nn + "] = {");
+    replace_all(l, "tflTensors_subgraph_index[] = {0, " + ot + ", }", "tflTensors_subgraph_index[] = {0, " + nt + ", }");
+    replace_all(l, "tflNodes_subgraph_index[] = {0, " + on + ", }", "tflNodes_subgraph_index[] = {0, " + nn + ", }");
+    replace_all(l, "tensors_size = " + ot + ";", "tensors_size = " + nt + ";");
+    replace_all(l, "i < " + ot + ";", "i < " + nt + ";");
+    replace_all(l, "i < " + on + ";", "i < " + nn + ";");
+    if (!pad_left && l.find("OP_LAST") != std::string::npos) replace_all(l, "OP_PAD, ", "");
+    if (!pad_left && l.find("registrations[OP_PAD]") != std::string::npos) g.dead[i] = true;
+  }
+
+  // g0 definitions nothing refers to any more, and what only they referred to
+  while (!orphans.empty()) {
+    const std::string name = orphans.back();
+    orphans.pop_back();
+    const auto it = g.decl.find(name);
+    if (it == g.decl.end() || g.dead[it->second]) continue;
+    const size_t from = it->second, to = decl_end(g, from);
+    bool used = false;
+    for (size_t i = 0; i < g.lines.size() && !used; i++) {
+      used = !g.dead[i] && (i < from || i > to) && has_word(g.lines[i], name);
+    }
+    if (used) continue;
+    for (size_t i = from; i <= to; i++) {
+      g.dead[i] = true;
+      for (const auto& d : g.decl) {
+        if (d.first != name && has_word(g.lines[i], d.first)) orphans.push_back(d.first);
+      }
+    }
+  }
+  g.nodes = nodes;
+  return folded;
+}
+
+// =================== REPORT ===================
+static void print_table() {
+  printf("  %4s %8s %9s %8s %8s  %s\n", "t", "bytes", "live", "old", "new", "");
+  for (size_t t = 0; t < tensors.size(); t++) {
+    const tensor_t& x = tensors[t];
+    if (x.first < 0) continue;
+    char live[16];
+    snprintf(live, sizeof(live), "%d..%d", x.first, x.last);
+    printf("  %4zu %8zu %9s %8zu %8d", t, x.bytes, live, x.old_offset, x.offset);
+    if (x.alias >= 0) printf("  in-place over %d", x.alias);
+    printf("\n");
+  }
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--no-inplace") opt_inplace = false;
+    else if (a == "--apply" && i + 1 < argc) opt_apply = argv[++i];
+    else if (a == "--fold-pad" && i + 1 < argc) opt_fold = argv[++i];
+    else if (a == "--out" && i + 1 < argc) opt_out = argv[++i];
+    else {
+      fprintf(stderr, "usage: eon_plan [--no-inplace] [--apply FILE | --fold-pad EXPORT [--out FILE]]\n");
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  const char* target = opt_apply;
+  if (opt_fold) {
+    // Fold, write, then plan from the written tables: the export's offsets
+    // let a depthwise output overlap what is now its live input
+    target = opt_out ? opt_out : opt_fold;
+    src_graph_t g;
+    if (!load_source(opt_fold, g)) {
+      fprintf(stderr, "cannot read the graph tables of %s\n", opt_fold);
+      return 1;
+    }
+    printf("\n=== PAD fold: %s ===\n", opt_fold);
+    const int folded = fold_pads(g);
+    if (!write_source(g, target) || !load_source(target, g)) {
+      fprintf(stderr, "cannot rewrite %s\n", target);
+      return 1;
+    }
+    if (!folded) {
+      printf("  no PAD to fold, %s left as is\n", target);
+      return 0;
+    }
+    load_graph_from(g);
+  } else if (!load_graph()) {
+    fprintf(stderr, "cannot read graph layout from the model\n");
+    return 1;
+  }
+  compute_lifetimes();
+
+  const size_t baseline = peak_of(false);
+  const size_t greedy = plan_greedy();
+  const int merged = opt_inplace ? apply_inplace_add() : 0;
+  const size_t planned = merged ? plan_greedy() : greedy;
+  const size_t headroom = arena_size - baseline;
+  const int overlaps = count_overlaps();
+
+  printf("\n=== EON arena plan: %zu tensors, %zu nodes ===\n", tensors.size(), node_in.size());
+  print_table();
+  printf("\n  tensor peak  baseline %7zu B\n", baseline);
+  printf("               greedy   %7zu B\n", greedy);
+  if (opt_inplace) printf("               in-place %7zu B  (%d ADD outputs aliased)\n", planned, merged);
+  printf("               bound    %7zu B  (largest live set)\n", lower_bound());
+  printf("  arena        %zu -> %zu B  (%zu B persistent/scratch headroom kept)\n",
+         arena_size, planned + headroom, headroom);
+  printf("  overlapping live buffers: %d\n", overlaps);
+  if (overlaps) return 1;
+
+  if (target) {
+    if (planned >= baseline && !opt_fold) {
+      printf("  %s: no gain, left unchanged\n", target);
+    } else if (!apply_to_source(target, planned + headroom)) {
+      fprintf(stderr, "cannot rewrite %s\n", target);
+      return 1;
+    } else {
+      printf("  %s: offsets and kTensorArenaSize rewritten\n", target);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,269 @@
+/*
+ * Multi-threaded replay of the camera's EON model
+ *
+ * Each worker thread owns a tflite_learn_3 instance (own arena, tensors and
+ * kernel state) and a deque of frame numbers, seeded with an equal share.
+ * A worker takes frames from the back of its own deque and, once that is
+ * empty, steals from the front of the others', so a worker that falls behind
+ * (preempted, slower core) does not hold up the batch.
+ *
+ * The same frames are replayed with 1, 2, 4 ... N workers; the report gives
+ * frames/s, speedup and efficiency against one worker, and the steals. Every
+ * frame's output must match a run of the default instance byte for byte.
+ *
+ * Usage: eon_pool_bench [--frames N] [--threads N] [--seed S] [--tiled]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+
+// =================== CONFIGURATION ===================
+static int      opt_frames  = 400;
+static int      opt_threads = 0;       // 0: hardware_concurrency()
+static uint32_t opt_seed    = 1;
+static bool     opt_tiled   = false;   // node by node is faster with the x86 kernels
+
+static const int RUNS = 3;             // best of, per worker count
+
+// =================== FRAMES ===================
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+// Noise frames alternating with gradients so the outputs spread over many values
+static void make_frame(int f, int8_t* px, int n) {
+  if (f % 2 == 0) {
+    for (int i = 0; i < n; i++) px[i] = (int8_t)(rng() & 0xFF);
+  } else {
+    const int phase = rng() % 256;
+    for (int i = 0; i < n; i++) px[i] = (int8_t)(((i * 3 + phase) & 0xFF) - 128);
+  }
+}
+
+static void* arena_alloc(size_t align, size_t size) {
+  void* p = aligned_alloc(align, (size + align - 1) / align * align);
+  if (p) memset(p, 0, size);
+  return p;
+}
+
+static std::vector<std::vector<int8_t>> frames;
+static std::vector<std::vector<int8_t>> expected;
+
+// Reference outputs from the built-in instance, one frame at a time
+static bool run_reference() {
+#if EI_CLASSIFIER_TILED_STEM
+  tflite_learn_3_set_tiled_stem(opt_tiled);
+#endif
+  if (tflite_learn_3_init(arena_alloc) != kTfLiteOk) return false;
+  TfLiteTensor in, out;
+  tflite_learn_3_input(0, &in);
+  tflite_learn_3_output(0, &out);
+  expected.assign(frames.size(), std::vector<int8_t>());
+  for (size_t f = 0; f < frames.size(); f++) {
+    memcpy(in.data.data, frames[f].data(), in.bytes);
+    if (tflite_learn_3_invoke() != kTfLiteOk) {
+      tflite_learn_3_reset(free);
+      return false;
+    }
+    const int8_t* o = (const int8_t*)out.data.data;
+    expected[f].assign(o, o + out.bytes);
+  }
+  tflite_learn_3_reset(free);
+  return true;
+}
+
+// =================== WORK-STEALING POOL ===================
+typedef struct alignas(64) {   // one cache line or more each
+  tflite_learn_3_instance* model;
+  std::mutex               lock;
+  std::deque<int>          queue;
+  int                      done;
+  int                      steals;
+  bool                     failed;
+} worker_t;
+
+static std::vector<worker_t> workers(0);
+static std::vector<std::vector<int8_t>> results;
+
+static bool take_own(worker_t& w, int* f) {
+  std::lock_guard<std::mutex> g(w.lock);
+  if (w.queue.empty()) return false;
+  *f = w.queue.back();
+  w.queue.pop_back();
+  return true;
+}
+
+static bool steal(int self, int n, int* f) {
+  for (int k = 1; k < n; k++) {
+    worker_t& v = workers[(self + k) % n];
+    std::lock_guard<std::mutex> g(v.lock);
+    if (v.queue.empty()) continue;
+    *f = v.queue.front();
+    v.queue.pop_front();
+    return true;
+  }
+  return false;
+}
+
+// No frames are added once the pool starts, so one empty sweep means done
+static void worker_main(int self, int n) {
+  worker_t& w = workers[self];
+  TfLiteTensor in, out;
+  tflite_learn_3_instance_input(w.model, 0, &in);
+  tflite_learn_3_instance_output(w.model, 0, &out);
+  int f;
+  for (;;) {
+    if (!take_own(w, &f)) {
+      if (!steal(self, n, &f)) break;
+      w.steals++;
+    }
+    memcpy(in.data.data, frames[f].data(), in.bytes);
+    if (tflite_learn_3_instance_invoke(w.model) != kTfLiteOk) {
+      w.failed = true;
+      continue;
+    }
+    const int8_t* o = (const int8_t*)out.data.data;
+    results[f].assign(o, o + out.bytes);
+    w.done++;
+  }
+}
+
+typedef struct {
+  double us;
+  int steals;
+  int min_done, max_done;
+  int differ;
+  bool failed;
+} pool_run_t;
+
+static pool_run_t run_pool(int n) {
+  pool_run_t run = { 0, 0, 0, 0, 0, false };
+  const int total = (int)frames.size();
+  results.assign(frames.size(), std::vector<int8_t>());
+  for (int t = 0; t < n; t++) {
+    worker_t& w = workers[t];
+    w.queue.clear();
+    for (int f = total * t / n; f < total * (t + 1) / n; f++) w.queue.push_back(f);
+    w.done = w.steals = 0;
+    w.failed = false;
+  }
+
+  const uint64_t start = ei_read_timer_us();
+  std::vector<std::thread> threads;
+  for (int t = 1; t < n; t++) threads.emplace_back(worker_main, t, n);
+  worker_main(0, n);
+  for (std::thread& th : threads) th.join();
+  run.us = (double)(ei_read_timer_us() - start);
+
+  run.min_done = total;
+  for (int t = 0; t < n; t++) {
+    run.steals += workers[t].steals;
+    run.min_done = std::min(run.min_done, workers[t].done);
+    run.max_done = std::max(run.max_done, workers[t].done);
+    run.failed |= workers[t].failed;
+  }
+  for (int f = 0; f < total; f++) run.differ += results[f] != expected[f];
+  return run;
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc)  opt_frames = atoi(argv[++i]);
+    else if (a == "--threads" && i + 1 < argc) opt_threads = atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc)    opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else if (a == "--tiled")                   opt_tiled = true;
+    else {
+      fprintf(stderr, "usage: eon_pool_bench [--frames N] [--threads N] [--seed S] [--tiled]\n");
+      exit(2);
+    }
+  }
+  if (opt_frames < 1) opt_frames = 1;
+  if (opt_threads < 1) opt_threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+
+  TfLiteTensor in;
+  tflite_learn_3_input(0, &in);
+  rng_state = opt_seed;
+  frames.assign(opt_frames, std::vector<int8_t>(in.bytes));
+  for (int f = 0; f < opt_frames; f++) make_frame(f, frames[f].data(), (int)in.bytes);
+  if (!run_reference()) {
+    fprintf(stderr, "reference init or invoke failed\n");
+    return 1;
+  }
+
+  workers = std::vector<worker_t>(opt_threads);
+  for (worker_t& w : workers) {
+    w.model = tflite_learn_3_instance_new();
+    if (!w.model) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+#if EI_CLASSIFIER_TILED_STEM
+    tflite_learn_3_instance_set_tiled_stem(w.model, opt_tiled);
+#endif
+    if (tflite_learn_3_instance_init(w.model, arena_alloc) != kTfLiteOk) {
+      fprintf(stderr, "instance init failed\n");
+      return 1;
+    }
+  }
+
+  std::vector<int> counts;
+  for (int n = 1; n < opt_threads; n *= 2) counts.push_back(n);
+  counts.push_back(opt_threads);
+
+  printf("%d frames, %s stem, %u hardware threads\n", opt_frames,
+         opt_tiled ? "tiled" : "node-by-node", std::thread::hardware_concurrency());
+  printf("  %7s %9s %9s %8s %6s %7s %11s  %s\n", "workers", "ms/frame", "frames/s", "speedup",
+         "eff", "steals", "frames/wkr", "vs single instance");
+
+  run_pool(opt_threads);   // warm-up: first touch of every arena and code path
+
+  double base_fps = 0;
+  int mismatched = 0;
+  bool failed = false;
+  for (int n : counts) {
+    pool_run_t best = run_pool(n);
+    for (int r = 1; r < RUNS; r++) {
+      pool_run_t run = run_pool(n);   // fastest run's timings, every run's checks
+      run.differ = std::max(run.differ, best.differ);
+      run.failed |= best.failed;
+      if (run.us < best.us) {
+        best = run;
+      } else {
+        best.differ = run.differ;
+        best.failed = run.failed;
+      }
+    }
+    const double fps = opt_frames * 1e6 / best.us;
+    if (n == 1) base_fps = fps;
+    printf("  %7d %9.3f %9.1f %7.2fx %5.0f%% %7d %5d-%-5d  %d/%d frames differ%s\n",
+           n, best.us / 1000.0 / opt_frames, fps, fps / base_fps, 100.0 * fps / base_fps / n,
+           best.steals, best.min_done, best.max_done, best.differ, opt_frames,
+           best.failed ? ", invoke failed" : "");
+    mismatched += best.differ;
+    failed |= best.failed;
+  }
+
+  for (worker_t& w : workers) {
+    tflite_learn_3_instance_reset(w.model, free);
+    tflite_learn_3_instance_delete(w.model);
+  }
+  return (mismatched || failed) ? 1 : 0;
+}
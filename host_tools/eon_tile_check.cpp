@@ -0,0 +1,187 @@
+/*
+ * Bit-exact check of the tiled EON stem against node-by-node invoke
+ *
+ * The compiled model runs nodes 0-5 in row bands by default
+ * (EI_CLASSIFIER_TILED_STEM). This tool runs the same int8 frames through
+ * tflite_learn_3_invoke() twice, once with the stem tiled and once node by
+ * node (tflite_learn_3_set_tiled_stem(false)), captures every node output as
+ * the node finishes (through the profiler hook) and requires all outputs both
+ * modes produce (node 5 onwards) to be identical byte for byte.
+ *
+ * Frames rotate through uniform noise, saturated extremes, gradients and
+ * noisy blocks so padding edges and activation clamps are all exercised.
+ * It also prints the arena each mode allocates and the mean invoke time.
+ *
+ * Usage: eon_tile_check [--frames N] [--seed S]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_op_profiler.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+
+// =================== CONFIGURATION ===================
+static int      opt_frames = 200;
+static uint32_t opt_seed   = 1;
+
+// =================== FRAMES ===================
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+static void make_frame(int f, int8_t* px, int w, int h) {
+  switch (f % 4) {
+    case 0:   // uniform noise
+      for (int i = 0; i < w * h; i++) px[i] = (int8_t)(rng() & 0xFF);
+      break;
+    case 1: { // all dark or all bright, one odd pixel on an edge
+      const int8_t v = (f / 4) % 2 ? 127 : -128;
+      memset(px, v, (size_t)w * h);
+      px[rng() % w] = (int8_t)-v;
+      break;
+    }
+    case 2:   // diagonal gradient, direction varies
+      for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+          const int g = (f / 4) % 2 ? x + y : (w - 1 - x) + y;
+          px[y * w + x] = (int8_t)(g * 255 / (w + h - 2) - 128);
+        }
+      }
+      break;
+    default: { // dim noise with a few bright blocks, some touching the border
+      for (int i = 0; i < w * h; i++) px[i] = (int8_t)(-100 + (int)(rng() % 40));
+      for (int b = 0; b < 3; b++) {
+        const int bw = 8 + rng() % 24, bh = 8 + rng() % 24;
+        const int x0 = rng() % (w - bw + 8), y0 = rng() % (h - bh + 8);
+        for (int y = y0; y < y0 + bh && y < h; y++) {
+          for (int x = x0; x < x0 + bw && x < w; x++) px[y * w + x] = (int8_t)(60 + rng() % 60);
+        }
+      }
+      break;
+    }
+  }
+}
+
+// =================== CAPTURE ===================
+typedef std::map<size_t, std::vector<int8_t>> outputs_t;   // node -> output bytes
+
+// Copies each node's output as soon as the node has run; later nodes reuse the arena
+class CaptureProfiler : public tflite::MicroOpProfiler {
+ public:
+  outputs_t* out = nullptr;
+
+  uint32_t BeginEvent(const char* tag) override {
+    node_ = (size_t)atoi(tag);
+    return MicroOpProfiler::BeginEvent(tag);
+  }
+
+  void EndEvent(uint32_t event_handle) override {
+    MicroOpProfiler::EndEvent(event_handle);
+    TfLiteTensor t;
+    if (!out || tflite_learn_3_node_output(node_, &t) != kTfLiteOk) return;
+    const int8_t* p = (const int8_t*)t.data.data;
+    (*out)[node_].assign(p, p + t.bytes);
+  }
+
+ private:
+  size_t node_ = 0;
+};
+
+static size_t arena_bytes = 0;
+
+static void* arena_alloc(size_t align, size_t size) {
+  arena_bytes = size;
+  void* p = aligned_alloc(align, (size + align - 1) / align * align);
+  if (p) memset(p, 0, size);
+  return p;
+}
+
+typedef struct {
+  std::vector<outputs_t> frames;
+  size_t arena;
+  double invoke_ms;
+} mode_run_t;
+
+static bool run_mode(bool tiled, mode_run_t& run) {
+  static CaptureProfiler capture;
+  tflite_learn_3_set_tiled_stem(tiled);
+  tflite_learn_3_set_profiler(&capture);
+  if (tflite_learn_3_init(arena_alloc) != kTfLiteOk) return false;
+  run.arena = arena_bytes;
+
+  TfLiteTensor in;
+  tflite_learn_3_input(0, &in);
+  rng_state = opt_seed;
+  run.frames.assign(opt_frames, outputs_t());
+  uint64_t total_us = 0;
+  for (int f = 0; f < opt_frames; f++) {
+    make_frame(f, (int8_t*)in.data.data, in.dims->data[2], in.dims->data[1]);
+    capture.out = &run.frames[f];
+    const uint64_t t0 = ei_read_timer_us();
+    const TfLiteStatus st = tflite_learn_3_invoke();
+    total_us += ei_read_timer_us() - t0;
+    if (st != kTfLiteOk) return false;
+  }
+  capture.out = nullptr;
+  tflite_learn_3_set_profiler(nullptr);
+  tflite_learn_3_reset(free);
+  run.invoke_ms = total_us / 1000.0 / opt_frames;
+  return true;
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc) opt_frames = atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc)   opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else {
+      fprintf(stderr, "usage: eon_tile_check [--frames N] [--seed S]\n");
+      exit(2);
+    }
+  }
+  if (opt_frames < 1) opt_frames = 1;
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+
+  mode_run_t nodes = {}, tiled = {};
+  if (!run_mode(false, nodes) || !run_mode(true, tiled)) {
+    fprintf(stderr, "model init or invoke failed\n");
+    return 1;
+  }
+
+  int differ = 0;
+  size_t compared = 0;
+  for (int f = 0; f < opt_frames; f++) {
+    bool frame_ok = !tiled.frames[f].empty();
+    for (const auto& kv : tiled.frames[f]) {
+      auto ref = nodes.frames[f].find(kv.first);
+      compared++;
+      if (ref == nodes.frames[f].end() || ref->second != kv.second) {
+        if (frame_ok) {
+          size_t at = 0;
+          while (ref != nodes.frames[f].end() && at < kv.second.size() && ref->second[at] == kv.second[at]) at++;
+          printf("  frame %d: node %zu differs at byte %zu\n", f, kv.first, at);
+        }
+        frame_ok = false;
+      }
+    }
+    if (!frame_ok) differ++;
+  }
+
+  printf("\n=== EON tiled stem vs node-by-node, %d frames ===\n", opt_frames);
+  printf("  node outputs compared: %zu (%zu per frame)\n", compared, tiled.frames[0].size());
+  printf("  arena      node-by-node %7zu B   tiled %7zu B\n", nodes.arena, tiled.arena);
+  printf("  invoke     node-by-node %7.3f ms  tiled %7.3f ms\n", nodes.invoke_ms, tiled.invoke_ms);
+  printf("  %d/%d frames differ\n", differ, opt_frames);
+  return differ ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the subset of the Arduino-ESP32 core used by the
+// firmware modules. Time comes from the simulator's virtual clock, so
+// millis()/delay() are per-node and run faster than real time.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "esp_now_sim.h"
+
+using std::max;
+using std::min;
+
+#define HIGH    1
+#define LOW     0
+#define INPUT   0
+#define OUTPUT  1
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+
+// =================== TIME ===================
+static inline uint32_t millis() { return (uint32_t)(now_sim_local_us() / 1000); }
+static inline uint32_t micros() { return (uint32_t)now_sim_local_us(); }
+static inline void delay(uint32_t ms) { now_sim_delay_us((uint64_t)ms * 1000); }
+static inline void delayMicroseconds(uint32_t us) { now_sim_delay_us(us); }
+static inline void yield() {}
+
+// =================== FREERTOS ===================
+// Single-threaded simulator: critical sections are no-ops
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED  { 0 }
+#define portENTER_CRITICAL(mux)       ((void)(mux))
+#define portEXIT_CRITICAL(mux)        ((void)(mux))
+
+// =================== GPIO / ADC ===================
+typedef enum { ADC_0db, ADC_2_5db, ADC_6db, ADC_11db } adc_attenuation_t;
+
+static inline void pinMode(int, int) {}
+static inline void digitalWrite(int, int) {}
+static inline int  digitalRead(int) { return 0; }
+static inline int  analogRead(int pin) { return now_sim_analog_read(pin); }
+static inline void analogReadResolution(int) {}
+static inline void analogSetPinAttenuation(int, int) {}
+
+// =================== SERIAL ===================
+class HardwareSerial {
+ public:
+  void begin(unsigned long) {}
+  void flush() {}
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char* s);
+  size_t print(char c);
+  size_t print(int v);
+  size_t print(unsigned v);
+  size_t print(long v);
+  size_t print(unsigned long v);
+  size_t print(double v, int digits = 2);
+  size_t println(const char* s = "");
+  size_t println(int v);
+  size_t println(unsigned v);
+  size_t println(unsigned long v);
+  size_t println(double v, int digits = 2);
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,39 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// Host stand-in for the WiFi object. Only the mode/sleep/channel calls made
+// before ESP-NOW init are modelled; there is no IP stack.
+
+#include "Arduino.h"
+#include "esp_wifi.h"
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA,
+} wifi_mode_t;
+
+#define WIFI_MODE_NULL  WIFI_OFF
+#define WIFI_MODE_STA   WIFI_STA
+#define WIFI_MODE_AP    WIFI_AP
+
+class WiFiClass {
+ public:
+  bool mode(wifi_mode_t m) { mode_ = m; return true; }
+  wifi_mode_t getMode() { return mode_; }
+  bool setSleep(bool) { return true; }
+  int32_t channel() {
+    uint8_t ch = 0;
+    wifi_second_chan_t s;
+    esp_wifi_get_channel(&ch, &s);
+    return ch;
+  }
+
+ private:
+  wifi_mode_t mode_ = WIFI_OFF;
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
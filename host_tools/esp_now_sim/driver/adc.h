@@ -0,0 +1,17 @@
+#ifndef HOST_DRIVER_ADC_H
+#define HOST_DRIVER_ADC_H
+
+// adc_attenuation_t and the analog helpers live in the Arduino.h stand-in;
+// the ADC1 driver calls below only matter on the chip.
+#include "Arduino.h"
+
+typedef enum { ADC1_CHANNEL_0, ADC1_CHANNEL_1, ADC1_CHANNEL_2, ADC1_CHANNEL_3,
+               ADC1_CHANNEL_4, ADC1_CHANNEL_5, ADC1_CHANNEL_6, ADC1_CHANNEL_7 } adc1_channel_t;
+typedef enum { ADC_WIDTH_BIT_9, ADC_WIDTH_BIT_10, ADC_WIDTH_BIT_11, ADC_WIDTH_BIT_12 } adc_bits_width_t;
+typedef enum { ADC_ATTEN_DB_0, ADC_ATTEN_DB_2_5, ADC_ATTEN_DB_6, ADC_ATTEN_DB_11 } adc_atten_t;
+
+static inline int  adc1_config_width(adc_bits_width_t) { return 0; }
+static inline int  adc1_config_channel_atten(adc1_channel_t, adc_atten_t) { return 0; }
+static inline void adc1_ulp_enable(void) {}
+
+#endif // HOST_DRIVER_ADC_H
@@ -0,0 +1,12 @@
+#ifndef HOST_ESP32_RTC_H
+#define HOST_ESP32_RTC_H
+
+// Host stand-in for esp32/rtc.h: the RTC timer keeps counting through deep
+// sleep, on its own (slow, less accurate) clock.
+
+#include <stdint.h>
+#include "esp_now_sim.h"
+
+static inline uint64_t esp_rtc_get_time_us(void) { return now_sim_rtc_us(); }
+
+#endif // HOST_ESP32_RTC_H
@@ -0,0 +1,100 @@
+#ifndef HOST_ESP32_ULP_H
+#define HOST_ESP32_ULP_H
+
+// Host stand-in for esp32/ulp.h: the ULP FSM macro assembler subset the EMF
+// firmware uses, and an interpreter for the loaded program (ulp_sim.cpp).
+// RTC_SLOW_MEM is a plain array of 32-bit words; as on the chip, ST writes
+// the 16-bit value into the low half and the PC into the high half, and
+// the program occupies the words it was loaded to.
+//
+// Registers and the ALU are 16 bits. ADD sets the overflow flag on a carry
+// out of bit 15, SUB on a borrow; other ALU ops clear it. LD/ST and jumps
+// leave the flags alone. I_ADC reads what ulp_sim_set_adc() supplies.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+#include "esp_now.h"   // esp_err_t
+
+#define R0 0
+#define R1 1
+#define R2 2
+#define R3 3
+
+#define RTC_SLOW_MEM_WORDS 2048
+extern uint32_t ulp_sim_rtc_slow_mem[RTC_SLOW_MEM_WORDS];
+#define RTC_SLOW_MEM ulp_sim_rtc_slow_mem
+
+typedef enum {
+  ULP_OP_ALU_R, ULP_OP_ALU_I, ULP_OP_LD, ULP_OP_ST, ULP_OP_ADC,
+  ULP_OP_BR_R0, ULP_OP_BX, ULP_OP_WAKE, ULP_OP_HALT, ULP_OP_LABEL,
+} ulp_opcode_t;
+
+typedef enum { ULP_ALU_ADD, ULP_ALU_SUB, ULP_ALU_AND, ULP_ALU_OR, ULP_ALU_MOV, ULP_ALU_LSH, ULP_ALU_RSH } ulp_alu_t;
+typedef enum { ULP_BR_LT, ULP_BR_GE } ulp_br_cmp_t;
+typedef enum { ULP_BX_ALWAYS, ULP_BX_ZERO, ULP_BX_OVF } ulp_bx_cond_t;
+
+typedef struct {
+  uint8_t  op;       // ulp_opcode_t
+  uint8_t  sub;      // ALU op, branch comparison or condition
+  uint8_t  rd, rs1, rs2;
+  int32_t  imm;      // immediate, offset, label or ADC pad
+  int32_t  cmp;      // R0 branches: value R0 is compared with
+  bool     label;    // imm is a label number
+} ulp_insn_t;
+
+// =================== ALU ===================
+#define I_ALU_R(op_, rd_, rs1_, rs2_) ulp_insn_t{ ULP_OP_ALU_R, op_, rd_, rs1_, rs2_, 0, 0, false }
+#define I_ALU_I(op_, rd_, rs_, imm_)  ulp_insn_t{ ULP_OP_ALU_I, op_, rd_, rs_, 0, (int32_t)(imm_), 0, false }
+#define I_ADDR(rd, rs1, rs2)  I_ALU_R(ULP_ALU_ADD, rd, rs1, rs2)
+#define I_SUBR(rd, rs1, rs2)  I_ALU_R(ULP_ALU_SUB, rd, rs1, rs2)
+#define I_ANDR(rd, rs1, rs2)  I_ALU_R(ULP_ALU_AND, rd, rs1, rs2)
+#define I_ORR(rd, rs1, rs2)   I_ALU_R(ULP_ALU_OR, rd, rs1, rs2)
+#define I_MOVR(rd, rs)        I_ALU_R(ULP_ALU_MOV, rd, rs, 0)
+#define I_LSHR(rd, rs1, rs2)  I_ALU_R(ULP_ALU_LSH, rd, rs1, rs2)
+#define I_RSHR(rd, rs1, rs2)  I_ALU_R(ULP_ALU_RSH, rd, rs1, rs2)
+#define I_ADDI(rd, rs, imm)   I_ALU_I(ULP_ALU_ADD, rd, rs, imm)
+#define I_SUBI(rd, rs, imm)   I_ALU_I(ULP_ALU_SUB, rd, rs, imm)
+#define I_ANDI(rd, rs, imm)   I_ALU_I(ULP_ALU_AND, rd, rs, imm)
+#define I_ORI(rd, rs, imm)    I_ALU_I(ULP_ALU_OR, rd, rs, imm)
+#define I_MOVI(rd, imm)       I_ALU_I(ULP_ALU_MOV, rd, 0, imm)
+#define I_LSHI(rd, rs, imm)   I_ALU_I(ULP_ALU_LSH, rd, rs, imm)
+#define I_RSHI(rd, rs, imm)   I_ALU_I(ULP_ALU_RSH, rd, rs, imm)
+
+// =================== MEMORY / PERIPHERALS ===================
+// Word address = register + offset
+#define I_LD(rd, rs_addr, offset)     ulp_insn_t{ ULP_OP_LD, 0, rd, rs_addr, 0, (int32_t)(offset), 0, false }
+#define I_ST(rs_val, rs_addr, offset) ulp_insn_t{ ULP_OP_ST, 0, rs_val, rs_addr, 0, (int32_t)(offset), 0, false }
+#define I_ADC(rd, adc_idx, pad_idx)   ulp_insn_t{ ULP_OP_ADC, (uint8_t)(adc_idx), rd, 0, 0, (int32_t)(pad_idx), 0, false }
+#define I_WAKE()                      ulp_insn_t{ ULP_OP_WAKE, 0, 0, 0, 0, 0, 0, false }
+#define I_HALT()                      ulp_insn_t{ ULP_OP_HALT, 0, 0, 0, 0, 0, 0, false }
+
+// =================== BRANCHES ===================
+// I_BL / I_BGE: relative, on R0 against an immediate
+#define I_BL(pc_offset, imm)   ulp_insn_t{ ULP_OP_BR_R0, ULP_BR_LT, 0, 0, 0, (int32_t)(pc_offset), (int32_t)(imm), false }
+#define I_BGE(pc_offset, imm)  ulp_insn_t{ ULP_OP_BR_R0, ULP_BR_GE, 0, 0, 0, (int32_t)(pc_offset), (int32_t)(imm), false }
+// Labels: M_LABEL marks a spot, the M_B* forms jump to it
+#define M_LABEL(n)             ulp_insn_t{ ULP_OP_LABEL, 0, 0, 0, 0, (int32_t)(n), 0, true }
+#define M_BL(n, imm)           ulp_insn_t{ ULP_OP_BR_R0, ULP_BR_LT, 0, 0, 0, (int32_t)(n), (int32_t)(imm), true }
+#define M_BGE(n, imm)          ulp_insn_t{ ULP_OP_BR_R0, ULP_BR_GE, 0, 0, 0, (int32_t)(n), (int32_t)(imm), true }
+#define M_BX(n)                ulp_insn_t{ ULP_OP_BX, ULP_BX_ALWAYS, 0, 0, 0, (int32_t)(n), 0, true }
+#define M_BXZ(n)               ulp_insn_t{ ULP_OP_BX, ULP_BX_ZERO, 0, 0, 0, (int32_t)(n), 0, true }
+#define M_BXF(n)               ulp_insn_t{ ULP_OP_BX, ULP_BX_OVF, 0, 0, 0, (int32_t)(n), 0, true }
+
+esp_err_t ulp_process_macros_and_load(uint32_t load_addr, const ulp_insn_t* program, size_t* psize);
+esp_err_t ulp_run(uint32_t entry_point);
+esp_err_t ulp_set_wakeup_period(size_t period_index, uint32_t period_us);
+
+// =================== SIMULATION ===================
+// ADC code for I_ADC(rd, adc_idx, pad)
+void ulp_sim_set_adc(std::function<int(int adc_idx, int pad)> fn);
+// Run the loaded program once, as the ULP timer does every wakeup period.
+// True if it executed I_WAKE. Aborts on a runaway program or a store into
+// its own code.
+bool ulp_sim_run();
+uint32_t ulp_sim_period_us();
+uint32_t ulp_sim_last_cycles();   // RTC fast clock cycles of the last run (estimate)
+size_t ulp_sim_program_words();
+
+#endif // HOST_ESP32_ULP_H
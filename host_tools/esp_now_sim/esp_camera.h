@@ -0,0 +1,127 @@
+#ifndef HOST_ESP_CAMERA_H
+#define HOST_ESP_CAMERA_H
+
+// Host stand-in for the subset of esp32-camera (esp_camera.h / sensor.h)
+// the camera firmware uses. One simulated sensor renders a scene the tool
+// supplies over the full field of view. As on the chip, frames keep the
+// configured frame size; an OV2640 additionally takes set_res_raw() to
+// window its DSP on part of the view and zoom that to the output size.
+// Other sensors have no set_res_raw().
+//
+// Auto exposure is off unless the tool turns it on: then a gain applies to
+// the scene, restarts at a chosen value on every init and moves a fixed
+// fraction (in log) toward the gain that brings the last frame's mean to
+// the target, capped like the sensor's AGC. Lens blur and sensor noise
+// (growing with gain) can be added on top. With a frame rate set the sensor
+// free-runs: fb_get() waits for the next frame and the AEC steps on every
+// frame, whether it was read out or not.
+//
+// esp_camera_fb_get() advances the virtual clock by the DVP transfer of the
+// frame: YUV422 (2 bytes per pixel, the driver keeps Y) at one byte per
+// XCLK. Sensor mode timing (exposure, blanking) is not modelled.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+#include "esp_now.h"          // esp_err_t
+#include "img_converters.h"   // pixformat_t
+
+typedef enum {
+  FRAMESIZE_96X96,    // 96x96
+  FRAMESIZE_QQVGA,    // 160x120
+  FRAMESIZE_QCIF,     // 176x144
+  FRAMESIZE_HQVGA,    // 240x176
+  FRAMESIZE_240X240,  // 240x240
+  FRAMESIZE_QVGA,     // 320x240
+  FRAMESIZE_CIF,      // 400x296
+  FRAMESIZE_HVGA,     // 480x320
+  FRAMESIZE_VGA,      // 640x480
+  FRAMESIZE_SVGA,     // 800x600
+  FRAMESIZE_XGA,      // 1024x768
+  FRAMESIZE_HD,       // 1280x720
+  FRAMESIZE_SXGA,     // 1280x1024
+  FRAMESIZE_UXGA,     // 1600x1200
+  FRAMESIZE_INVALID
+} framesize_t;
+
+typedef enum { LEDC_TIMER_0, LEDC_TIMER_1 } ledc_timer_t;
+typedef enum { LEDC_CHANNEL_0, LEDC_CHANNEL_1 } ledc_channel_t;
+typedef enum { CAMERA_FB_IN_PSRAM, CAMERA_FB_IN_DRAM } camera_fb_location_t;
+typedef enum { CAMERA_GRAB_WHEN_EMPTY, CAMERA_GRAB_LATEST } camera_grab_mode_t;
+
+typedef struct {
+  int pin_pwdn;
+  int pin_reset;
+  int pin_xclk;
+  int pin_sscb_sda;
+  int pin_sscb_scl;
+  int pin_d7, pin_d6, pin_d5, pin_d4, pin_d3, pin_d2, pin_d1, pin_d0;
+  int pin_vsync;
+  int pin_href;
+  int pin_pclk;
+  int xclk_freq_hz;
+  ledc_timer_t ledc_timer;
+  ledc_channel_t ledc_channel;
+  pixformat_t pixel_format;
+  framesize_t frame_size;
+  int jpeg_quality;
+  size_t fb_count;
+  camera_fb_location_t fb_location;
+  camera_grab_mode_t grab_mode;
+} camera_config_t;
+
+typedef struct {
+  uint8_t* buf;
+  size_t len;
+  size_t width;
+  size_t height;
+  pixformat_t format;
+} camera_fb_t;
+
+typedef enum {
+  OV7725_PID = 0x77,
+  OV2640_PID = 0x26,
+  OV3660_PID = 0x3660,
+  OV5640_PID = 0x5640,
+} camera_pid_t;
+
+typedef struct {
+  uint8_t MIDH;
+  uint8_t MIDL;
+  uint16_t PID;
+  uint8_t VER;
+} sensor_id_t;
+
+typedef struct _sensor sensor_t;
+struct _sensor {
+  sensor_id_t id;
+  // OV2640: startX = sensor mode (0 UXGA, 1 SVGA, 2 CIF), offset / total =
+  // DSP window in that mode's pixels, output = zoomed size
+  int (*set_res_raw)(sensor_t* sensor, int startX, int startY, int endX, int endY,
+                     int offsetX, int offsetY, int totalX, int totalY,
+                     int outputX, int outputY, bool scale, bool binning);
+};
+
+esp_err_t esp_camera_init(const camera_config_t* config);
+esp_err_t esp_camera_deinit(void);
+camera_fb_t* esp_camera_fb_get(void);
+void esp_camera_fb_return(camera_fb_t* fb);
+sensor_t* esp_camera_sensor_get(void);
+
+// =================== SIMULATION ===================
+// Scene brightness at (u, v) in [0, 1) over the full field of view
+void cam_sim_set_scene(std::function<uint8_t(float u, float v)> scene);
+void cam_sim_set_sensor(uint16_t pid);   // OV2640 (default) windows, others do not
+uint64_t cam_sim_render_wall_us();       // host time spent rendering frames
+// Part of the field of view the current frames cover
+void cam_sim_view(float* u0, float* v0, float* u1, float* v1);
+// Auto exposure: gain after each init, as a multiple of the converged gain
+// (0 = off, gain 1); reaching the max gain leaves the frame dark
+void cam_sim_set_aec(float start_factor, float max_gain = 16.0f);
+float cam_sim_exposure_error();          // last frame: gain / converged gain
+void cam_sim_set_fps(float fps);         // free-running sensor (0 = frame on demand)
+void cam_sim_set_blur(int radius);       // box blur, frame pixels (0 = sharp)
+void cam_sim_set_noise(float sigma);     // noise at gain 1, gray levels
+
+#endif // HOST_ESP_CAMERA_H
@@ -0,0 +1,219 @@
+#include "esp_camera.h"
+
+#include <math.h>
+#include <time.h>
+#include <vector>
+
+#include "esp_now_sim.h"
+
+// =================== STATE ===================
+static const uint16_t frame_w[FRAMESIZE_INVALID] = { 96, 160, 176, 240, 240, 320, 400, 480, 640, 800, 1024, 1280, 1280, 1600 };
+static const uint16_t frame_h[FRAMESIZE_INVALID] = { 96, 120, 144, 176, 240, 240, 296, 320, 480, 600, 768, 720, 1024, 1200 };
+
+// OV2640 sensor modes (set_res_raw startX) and their size
+static const uint16_t ov2640_mode_w[3] = { 1600, 800, 400 };
+static const uint16_t ov2640_mode_h[3] = { 1200, 600, 296 };
+
+static std::function<uint8_t(float, float)> scene;
+static uint16_t sensor_pid = OV2640_PID;
+static sensor_t sensor;
+static camera_config_t config;
+static bool inited = false;
+
+// Part of the field of view the frame covers
+static float win_u0, win_v0, win_u1, win_v1;
+
+// Auto exposure, lens and noise
+#define AEC_TARGET  110.0f   // mean gray level the AEC aims for
+#define AEC_STEP    0.25f    // fraction of the log gain error closed per frame
+static float aec_start = 0.0f;
+static float aec_max = 16.0f;
+static float aec_gain = 1.0f;
+static float aec_error = 1.0f;
+static uint32_t sensor_period_us = 0;   // 0 = frames on demand
+static uint64_t sensor_t0_us = 0;
+static uint64_t sensor_frame = 0;       // index of the last frame read out
+static int blur_radius = 0;
+static float noise_sigma = 0.0f;
+static uint32_t noise_state = 1;
+
+static std::vector<float> raw;
+static std::vector<uint8_t> frame;
+static camera_fb_t fb;
+static uint64_t render_wall_us = 0;
+
+static uint64_t wall_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+// =================== OV2640 ===================
+static int ov2640_set_res_raw(sensor_t*, int startX, int, int, int, int offsetX, int offsetY,
+                              int totalX, int totalY, int outputX, int outputY, bool, bool) {
+  if (!inited || startX < 0 || startX > 2) return -1;
+  const int mw = ov2640_mode_w[startX], mh = ov2640_mode_h[startX];
+  // DSP registers hold sizes in units of 4; the scaler only zooms out
+  if ((totalX | totalY | outputX | outputY) & 3) return -1;
+  if (offsetX < 0 || offsetY < 0 || offsetX + totalX > mw || offsetY + totalY > mh) return -1;
+  if (outputX > totalX || outputY > totalY) return -1;
+  // The driver's frame buffers keep the size they were set up with
+  if (outputX != frame_w[config.frame_size] || outputY != frame_h[config.frame_size]) return -1;
+  win_u0 = (float)offsetX / mw;
+  win_v0 = (float)offsetY / mh;
+  win_u1 = (float)(offsetX + totalX) / mw;
+  win_v1 = (float)(offsetY + totalY) / mh;
+  return 0;
+}
+
+// =================== SENSOR MODEL ===================
+static float noise() {
+  // Sum of four uniforms, close enough to Gaussian with sigma 1
+  float sum = 0.0f;
+  for (int i = 0; i < 4; i++) {
+    noise_state = noise_state * 1664525u + 1013904223u;
+    sum += (noise_state >> 8) / 16777216.0f - 0.5f;
+  }
+  return sum * 1.732f;
+}
+
+// Converged gain for a scene mean, within the sensor's range
+static float aec_goal(float mean) {
+  return std::min(aec_max, std::max(1.0f / aec_max, AEC_TARGET / std::max(mean, 0.5f)));
+}
+
+// Box blur in place, rows then columns
+static void box_blur(std::vector<float>& px, int w, int h, int r) {
+  std::vector<float> tmp(px.size());
+  for (int pass = 0; pass < 2; pass++) {
+    const int n = pass ? h : w, lines = pass ? w : h;
+    for (int l = 0; l < lines; l++) {
+      for (int i = 0; i < n; i++) {
+        float sum = 0.0f;
+        int cnt = 0;
+        for (int k = std::max(0, i - r); k <= std::min(n - 1, i + r); k++, cnt++) {
+          sum += pass ? px[(size_t)k * w + l] : px[(size_t)l * w + k];
+        }
+        (pass ? tmp[(size_t)i * w + l] : tmp[(size_t)l * w + i]) = sum / cnt;
+      }
+    }
+    px.swap(tmp);
+  }
+}
+
+// =================== CAMERA API ===================
+esp_err_t esp_camera_init(const camera_config_t* cfg) {
+  if (inited || cfg->frame_size >= FRAMESIZE_INVALID) return ESP_FAIL;
+  config = *cfg;
+  sensor = sensor_t();
+  sensor.id.PID = sensor_pid;
+  sensor.set_res_raw = sensor_pid == OV2640_PID ? &ov2640_set_res_raw : nullptr;
+  win_u0 = win_v0 = 0.0f;
+  win_u1 = win_v1 = 1.0f;
+  frame.assign((size_t)frame_w[config.frame_size] * frame_h[config.frame_size], 0);
+  raw.assign(frame.size(), 0.0f);
+  aec_gain = 0.0f;   // set from the first frame
+  aec_error = 1.0f;
+  sensor_t0_us = now_sim_local_us();
+  sensor_frame = 0;
+  inited = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_camera_deinit(void) {
+  if (!inited) return ESP_FAIL;
+  inited = false;
+  return ESP_OK;
+}
+
+// Each pixel is the mean of a 4x4 grid of scene samples over its footprint
+camera_fb_t* esp_camera_fb_get(void) {
+  if (!inited) return nullptr;
+  const int w = frame_w[config.frame_size], h = frame_h[config.frame_size];
+  // Free-running sensor: wait for the next frame; the AEC stepped on
+  // every frame in between, read out or not
+  int aec_steps = 1;
+  if (sensor_period_us) {
+    const uint64_t next = (now_sim_local_us() - sensor_t0_us) / sensor_period_us + 1;
+    now_sim_delay_us(sensor_t0_us + next * sensor_period_us - now_sim_local_us());
+    aec_steps = (int)std::min<uint64_t>(next - sensor_frame, 1000);
+    sensor_frame = next;
+  }
+
+  const uint64_t t0 = wall_us();
+  const float du = (win_u1 - win_u0) / w, dv = (win_v1 - win_v0) / h;
+  double raw_sum = 0.0;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      uint32_t sum = 0;
+      for (int sy = 0; sy < 4; sy++) {
+        for (int sx = 0; sx < 4; sx++) {
+          const float u = win_u0 + (x + (sx + 0.5f) / 4) * du;
+          const float v = win_v0 + (y + (sy + 0.5f) / 4) * dv;
+          sum += scene ? scene(u, v) : 0;
+        }
+      }
+      raw[(size_t)y * w + x] = sum / 16.0f;
+      raw_sum += sum / 16.0f;
+    }
+  }
+  if (blur_radius > 0) box_blur(raw, w, h, blur_radius);
+
+  if (aec_start <= 0.0f && blur_radius == 0 && noise_sigma <= 0.0f) {
+    for (size_t i = 0; i < frame.size(); i++) frame[i] = (uint8_t)(raw[i] + 0.5f);
+  } else {
+    // Gain stepped toward the goal once per sensor frame since the last readout
+    const float goal = aec_start > 0.0f ? aec_goal((float)(raw_sum / frame.size())) : 1.0f;
+    if (aec_gain <= 0.0f) {
+      aec_gain = aec_start > 0.0f ? std::min(aec_max, goal * aec_start) : 1.0f;
+      aec_steps--;   // readout frame included
+    }
+    if (aec_start > 0.0f && aec_steps > 0) {
+      aec_gain = expf(logf(aec_gain) + (1.0f - powf(1.0f - AEC_STEP, aec_steps)) * logf(goal / aec_gain));
+    }
+    aec_error = aec_gain / goal;
+    for (size_t i = 0; i < frame.size(); i++) {
+      const float v = raw[i] * aec_gain + noise_sigma * std::max(1.0f, aec_gain) * noise();
+      frame[i] = (uint8_t)std::min(255.0f, std::max(0.0f, v + 0.5f));
+    }
+  }
+  render_wall_us += wall_us() - t0;
+
+  // DVP transfer: YUV422 at one byte per XCLK
+  now_sim_delay_us((uint64_t)w * h * 2 * 1000000ULL / (uint64_t)config.xclk_freq_hz);
+
+  fb.buf = frame.data();
+  fb.len = frame.size();
+  fb.width = w;
+  fb.height = h;
+  fb.format = PIXFORMAT_GRAYSCALE;
+  return &fb;
+}
+
+void esp_camera_fb_return(camera_fb_t*) {}
+
+sensor_t* esp_camera_sensor_get(void) {
+  return inited ? &sensor : nullptr;
+}
+
+// =================== SIMULATION ===================
+void cam_sim_set_scene(std::function<uint8_t(float u, float v)> fn) { scene = std::move(fn); }
+void cam_sim_set_sensor(uint16_t pid) { sensor_pid = pid; }
+uint64_t cam_sim_render_wall_us() { return render_wall_us; }
+
+void cam_sim_view(float* u0, float* v0, float* u1, float* v1) {
+  *u0 = win_u0;
+  *v0 = win_v0;
+  *u1 = win_u1;
+  *v1 = win_v1;
+}
+
+void cam_sim_set_aec(float start_factor, float max_gain) {
+  aec_start = start_factor;
+  aec_max = max_gain;
+}
+
+float cam_sim_exposure_error() { return aec_error; }
+void cam_sim_set_fps(float fps) { sensor_period_us = fps > 0 ? (uint32_t)(1e6f / fps) : 0; }
+void cam_sim_set_blur(int radius) { blur_radius = radius; }
+void cam_sim_set_noise(float sigma) { noise_sigma = sigma; }
@@ -0,0 +1,34 @@
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+// Host stand-in for esp_heap_caps.h: internal SRAM and PSRAM as two pools of
+// set sizes (heap_caps_sim.cpp). Memory comes from the host heap; only the
+// accounting is the board's. The largest free block is the smaller of the
+// free space and the set largest block (no fragmentation model).
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_EXEC      (1 << 0)
+#define MALLOC_CAP_32BIT     (1 << 1)
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+#define MALLOC_CAP_SPIRAM    (1 << 10)
+#define MALLOC_CAP_INTERNAL  (1 << 11)
+#define MALLOC_CAP_DEFAULT   (1 << 12)
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void  heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+
+// =================== SIMULATION ===================
+// Pool sizes; psram = false is internal SRAM. free_bytes = 0: no such pool.
+// Defaults: 170,000 B internal (113,792 B largest block, as with WiFi up)
+// and 4 MB PSRAM.
+void heap_sim_set_pool(bool psram, size_t free_bytes, size_t largest_block);
+
+#endif // HOST_ESP_HEAP_CAPS_H
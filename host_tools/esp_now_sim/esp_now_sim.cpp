@@ -0,0 +1,471 @@
+#include "esp_now_sim.h"
+#include "Arduino.h"
+#include "WiFi.h"
+#include "esp_now.h"
+#include "esp_wifi.h"
+
+#include <stdarg.h>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+// =================== SIMULATOR STATE ===================
+namespace {
+
+struct sim_peer_t {
+  uint8_t mac[6];
+  uint8_t channel;
+};
+
+struct sim_node_t {
+  std::string name;
+  uint8_t mac[6];
+  uint8_t channel;
+  int64_t clock_offset_us;
+  float   drift_ppm;
+  uint64_t boot_local_us;   // raw local clock at the last reboot
+  int     wake_cause;
+  float   rtc_ppm;
+  bool    now_inited;
+  bool    radio_on;
+  uint64_t radio_on_since_us;
+  uint64_t radio_on_total_us;
+  esp_now_recv_cb_t recv_cb;
+  esp_now_send_cb_t send_cb;
+  std::vector<sim_peer_t> peers;
+  std::function<int(int)> analog;
+};
+
+struct sim_event_t {
+  uint64_t t_us;
+  uint64_t seq;
+  int node;
+  std::function<void()> fn;
+  bool operator>(const sim_event_t& o) const {
+    return t_us != o.t_us ? t_us > o.t_us : seq > o.seq;
+  }
+};
+
+std::vector<sim_node_t> nodes;
+std::vector<std::vector<now_sim_link_t>> links;
+now_sim_link_t default_link = { 2000, 1000, 0.0f, 3, 1000 };
+std::priority_queue<sim_event_t, std::vector<sim_event_t>, std::greater<sim_event_t>> events;
+uint64_t sim_now_us = 0;
+uint64_t event_seq = 0;
+int current_node = -1;
+bool verbose = false;
+now_sim_stats_t stats = {};
+std::mt19937 rng(1);
+
+const uint8_t BROADCAST_MAC[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+// 802.11b long preamble (192 us) + MAC header/FCS/vendor IE overhead (~43 B)
+const uint32_t AIR_PREAMBLE_US = 192;
+const uint32_t AIR_OVERHEAD_BYTES = 43;
+const uint32_t ACK_TIMEOUT_US = 300;
+
+sim_node_t* cur() {
+  return (current_node >= 0 && current_node < (int)nodes.size()) ? &nodes[current_node] : nullptr;
+}
+
+int find_node(const uint8_t mac[6]) {
+  for (size_t i = 0; i < nodes.size(); i++) {
+    if (memcmp(nodes[i].mac, mac, 6) == 0) return (int)i;
+  }
+  return -1;
+}
+
+sim_peer_t* find_peer(sim_node_t& n, const uint8_t mac[6]) {
+  for (auto& p : n.peers) {
+    if (memcmp(p.mac, mac, 6) == 0) return &p;
+  }
+  return nullptr;
+}
+
+uint32_t airtime_us(const now_sim_link_t& l, size_t len) {
+  uint32_t kbps = l.phy_kbps ? l.phy_kbps : 1000;
+  return AIR_PREAMBLE_US + (uint32_t)(((len + AIR_OVERHEAD_BYTES) * 8ULL * 1000) / kbps);
+}
+
+uint32_t jitter(const now_sim_link_t& l) {
+  return l.jitter_us ? (uint32_t)(rng() % (l.jitter_us + 1)) : 0;
+}
+
+bool can_hear(int from, int to) {
+  const sim_node_t& a = nodes[from];
+  const sim_node_t& b = nodes[to];
+  return b.now_inited && b.radio_on && a.channel == b.channel;
+}
+
+void push_event(int node, uint64_t t_us, std::function<void()> fn) {
+  events.push(sim_event_t{ t_us, event_seq++, node, std::move(fn) });
+}
+
+void run_event(const sim_event_t& ev) {
+  int saved = current_node;
+  current_node = ev.node;
+  ev.fn();
+  current_node = saved;
+}
+
+void deliver(int from, int to, std::vector<uint8_t> frame, uint64_t t_us) {
+  uint8_t src[6];
+  memcpy(src, nodes[from].mac, 6);
+  push_event(to, t_us, [to, src, frame]() {
+    // The receiver may have changed channel or powered down in flight
+    sim_node_t& n = nodes[to];
+    if (!n.now_inited || !n.radio_on || !n.recv_cb) return;
+    stats.delivered++;
+    n.recv_cb(src, frame.data(), (int)frame.size());
+  });
+}
+
+void complete_send(int from, const uint8_t dst[6], esp_now_send_status_t st, uint64_t t_us) {
+  uint8_t d[6];
+  memcpy(d, dst, 6);
+  push_event(from, t_us, [from, d, st]() {
+    sim_node_t& n = nodes[from];
+    if (n.send_cb) n.send_cb(d, st);
+  });
+}
+
+} // namespace
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+
+// =================== CONFIGURATION ===================
+now_sim_link_t now_sim_default_link() {
+  return default_link;
+}
+
+int now_sim_add_node(const char* name, const uint8_t mac[6], uint8_t channel) {
+  sim_node_t n{};
+  n.name = name;
+  memcpy(n.mac, mac, 6);
+  n.channel = channel;
+  n.radio_on = true;
+  n.radio_on_since_us = sim_now_us;
+  nodes.push_back(n);
+
+  for (auto& row : links) row.push_back(default_link);
+  links.push_back(std::vector<now_sim_link_t>(nodes.size(), default_link));
+  return (int)nodes.size() - 1;
+}
+
+int now_sim_node_count() { return (int)nodes.size(); }
+const char* now_sim_node_name(int node) { return nodes[node].name.c_str(); }
+const uint8_t* now_sim_node_mac(int node) { return nodes[node].mac; }
+
+void now_sim_set_current(int node) { current_node = node; }
+int  now_sim_current() { return current_node; }
+
+void now_sim_set_default_link(const now_sim_link_t& link) {
+  default_link = link;
+  for (auto& row : links) {
+    for (auto& l : row) l = link;
+  }
+}
+
+void now_sim_set_link(int from, int to, const now_sim_link_t& link) {
+  links[from][to] = link;
+}
+
+void now_sim_set_clock(int node, int64_t offset_us, float drift_ppm) {
+  nodes[node].clock_offset_us = offset_us;
+  nodes[node].drift_ppm = drift_ppm;
+}
+
+void now_sim_set_channel(int node, uint8_t channel) { nodes[node].channel = channel; }
+uint8_t now_sim_channel(int node) { return nodes[node].channel; }
+
+void now_sim_set_radio(int node, bool on) {
+  sim_node_t& n = nodes[node];
+  if (n.radio_on == on) return;
+  if (on) {
+    n.radio_on_since_us = sim_now_us;
+  } else {
+    n.radio_on_total_us += sim_now_us - n.radio_on_since_us;
+  }
+  n.radio_on = on;
+}
+
+bool now_sim_radio(int node) { return nodes[node].radio_on; }
+
+void now_sim_reboot(int node, int wake_cause) {
+  sim_node_t& n = nodes[node];
+  n.boot_local_us += now_sim_node_local_us(node);
+  n.wake_cause = wake_cause;
+  n.now_inited = false;
+  n.recv_cb = nullptr;
+  n.send_cb = nullptr;
+  n.peers.clear();
+}
+
+int now_sim_wake_cause() {
+  return cur() ? cur()->wake_cause : 0;
+}
+
+uint64_t now_sim_rtc_us() {
+  const float ppm = cur() ? cur()->rtc_ppm : 0.0f;
+  return (uint64_t)((double)sim_now_us * (1.0 + ppm * 1e-6));
+}
+
+void now_sim_set_rtc_drift(int node, float ppm) { nodes[node].rtc_ppm = ppm; }
+
+uint64_t now_sim_radio_on_us(int node) {
+  const sim_node_t& n = nodes[node];
+  return n.radio_on_total_us + (n.radio_on ? sim_now_us - n.radio_on_since_us : 0);
+}
+
+void now_sim_set_analog(int node, std::function<int(int)> fn) { nodes[node].analog = fn; }
+
+int now_sim_analog_read(int pin) {
+  sim_node_t* n = cur();
+  return (n && n->analog) ? n->analog(pin) : 0;
+}
+
+// =================== VIRTUAL TIME ===================
+void now_sim_seed(uint32_t seed) { rng.seed(seed); }
+uint64_t now_sim_time_us() { return sim_now_us; }
+
+uint64_t now_sim_node_local_us(int node) {
+  const sim_node_t& n = nodes[node];
+  double local = (double)sim_now_us * (1.0 + n.drift_ppm * 1e-6) + (double)n.clock_offset_us -
+                 (double)n.boot_local_us;
+  return local > 0 ? (uint64_t)local : 0;
+}
+
+uint64_t now_sim_local_us() {
+  return cur() ? now_sim_node_local_us(current_node) : sim_now_us;
+}
+
+void now_sim_run_until(uint64_t t_us) {
+  while (!events.empty() && events.top().t_us <= t_us) {
+    sim_event_t ev = events.top();
+    events.pop();
+    if (ev.t_us > sim_now_us) sim_now_us = ev.t_us;
+    run_event(ev);
+  }
+  if (t_us > sim_now_us) sim_now_us = t_us;
+}
+
+void now_sim_delay_us(uint64_t us) {
+  now_sim_run_until(sim_now_us + us);
+}
+
+void now_sim_at(int node, uint64_t t_us, std::function<void()> fn) {
+  push_event(node, t_us, std::move(fn));
+}
+
+void now_sim_every(int node, uint64_t t_us, uint64_t period_us, std::function<void()> fn) {
+  push_event(node, t_us, [node, t_us, period_us, fn]() {
+    uint64_t started = now_sim_time_us();
+    fn();
+    // A task that overran its period (e.g. used delay()) runs again at once
+    uint64_t next = t_us + period_us;
+    if (next < started) next = started;
+    now_sim_every(node, next, period_us, fn);
+  });
+}
+
+// =================== REPORTING ===================
+void now_sim_set_verbose(bool v) { verbose = v; }
+bool now_sim_verbose() { return verbose; }
+const now_sim_stats_t& now_sim_stats() { return stats; }
+uint32_t now_sim_rand() { return rng(); }
+float now_sim_randf() { return (float)(rng() >> 8) / (float)(1u << 24); }
+
+// =================== ESP-NOW API ===================
+esp_err_t esp_now_init(void) {
+  sim_node_t* n = cur();
+  if (!n) return ESP_FAIL;
+  n->now_inited = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_deinit(void) {
+  sim_node_t* n = cur();
+  if (!n) return ESP_FAIL;
+  n->now_inited = false;
+  n->recv_cb = nullptr;
+  n->send_cb = nullptr;
+  n->peers.clear();
+  return ESP_OK;
+}
+
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) {
+  sim_node_t* n = cur();
+  if (!n || !n->now_inited) return ESP_ERR_ESPNOW_NOT_INIT;
+  n->recv_cb = cb;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_register_send_cb(esp_now_send_cb_t cb) {
+  sim_node_t* n = cur();
+  if (!n || !n->now_inited) return ESP_ERR_ESPNOW_NOT_INIT;
+  n->send_cb = cb;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t* peer) {
+  sim_node_t* n = cur();
+  if (!n || !n->now_inited) return ESP_ERR_ESPNOW_NOT_INIT;
+  if (!peer) return ESP_ERR_ESPNOW_ARG;
+  if (find_peer(*n, peer->peer_addr)) return ESP_ERR_ESPNOW_EXIST;
+  if (n->peers.size() >= ESP_NOW_MAX_TOTAL_PEER_NUM) return ESP_ERR_ESPNOW_FULL;
+  sim_peer_t p;
+  memcpy(p.mac, peer->peer_addr, 6);
+  p.channel = peer->channel;
+  n->peers.push_back(p);
+  return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t* peer_addr) {
+  sim_node_t* n = cur();
+  if (!n || !n->now_inited) return ESP_ERR_ESPNOW_NOT_INIT;
+  for (size_t i = 0; i < n->peers.size(); i++) {
+    if (memcmp(n->peers[i].mac, peer_addr, 6) == 0) {
+      n->peers.erase(n->peers.begin() + i);
+      return ESP_OK;
+    }
+  }
+  return ESP_ERR_ESPNOW_NOT_FOUND;
+}
+
+esp_err_t esp_now_mod_peer(const esp_now_peer_info_t* peer) {
+  sim_node_t* n = cur();
+  if (!n || !n->now_inited) return ESP_ERR_ESPNOW_NOT_INIT;
+  sim_peer_t* p = peer ? find_peer(*n, peer->peer_addr) : nullptr;
+  if (!p) return ESP_ERR_ESPNOW_NOT_FOUND;
+  p->channel = peer->channel;
+  return ESP_OK;
+}
+
+bool esp_now_is_peer_exist(const uint8_t* peer_addr) {
+  sim_node_t* n = cur();
+  return n && find_peer(*n, peer_addr) != nullptr;
+}
+
+esp_err_t esp_now_send(const uint8_t* peer_addr, const uint8_t* data, size_t len) {
+  sim_node_t* n = cur();
+  if (!n || !n->now_inited) return ESP_ERR_ESPNOW_NOT_INIT;
+  if (!peer_addr || !data || len == 0 || len > ESP_NOW_MAX_DATA_LEN) return ESP_ERR_ESPNOW_ARG;
+
+  sim_peer_t* peer = find_peer(*n, peer_addr);
+  if (!peer) return ESP_ERR_ESPNOW_NOT_FOUND;
+  // A pinned peer channel must equal the home channel, as on the chip
+  if (peer->channel != 0 && peer->channel != n->channel) return ESP_ERR_ESPNOW_ARG;
+
+  const int from = current_node;
+  std::vector<uint8_t> frame(data, data + len);
+  stats.tx_frames++;
+
+  if (memcmp(peer_addr, BROADCAST_MAC, 6) == 0) {
+    // Broadcast: one attempt, no ACK, every tuned-in node rolls its own loss
+    uint64_t t_air = sim_now_us;
+    for (size_t to = 0; to < nodes.size(); to++) {
+      if ((int)to == from) continue;
+      const now_sim_link_t& l = links[from][to];
+      if (!can_hear(from, (int)to) || now_sim_randf() < l.loss) continue;
+      deliver(from, (int)to, frame, t_air + airtime_us(l, len) + l.latency_us + jitter(l));
+    }
+    stats.tx_attempts++;
+    stats.airtime_us += airtime_us(default_link, len);
+    complete_send(from, peer_addr, ESP_NOW_SEND_SUCCESS, sim_now_us + airtime_us(default_link, len));
+    return ESP_OK;
+  }
+
+  const int to = find_node(peer_addr);
+  const now_sim_link_t& l = (to >= 0) ? links[from][to] : default_link;
+  const uint32_t air = airtime_us(l, len);
+  uint64_t t = sim_now_us;
+
+  for (uint8_t attempt = 0; attempt <= l.retries; attempt++) {
+    stats.tx_attempts++;
+    stats.airtime_us += air;
+    t += air;
+    if (to < 0 || !can_hear(from, to)) {
+      stats.chan_mismatch++;
+      t += ACK_TIMEOUT_US;
+      continue;
+    }
+    if (now_sim_randf() < l.loss) {
+      t += ACK_TIMEOUT_US;
+      continue;
+    }
+    uint64_t t_rx = t + l.latency_us + jitter(l);
+    deliver(from, to, frame, t_rx);
+    complete_send(from, peer_addr, ESP_NOW_SEND_SUCCESS, t + l.latency_us);
+    return ESP_OK;
+  }
+
+  stats.lost++;
+  complete_send(from, peer_addr, ESP_NOW_SEND_FAIL, t + l.latency_us);
+  return ESP_OK;
+}
+
+// =================== ESP-WIFI API ===================
+esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t) {
+  sim_node_t* n = cur();
+  if (!n || primary < 1 || primary > 14) return ESP_ERR_ESPNOW_ARG;
+  n->channel = primary;
+  return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_channel(uint8_t* primary, wifi_second_chan_t* second) {
+  sim_node_t* n = cur();
+  if (!n) return ESP_FAIL;
+  if (primary) *primary = n->channel;
+  if (second) *second = WIFI_SECOND_CHAN_NONE;
+  return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t) { return ESP_OK; }
+
+// =================== SERIAL ===================
+static void log_prefix() {
+  sim_node_t* n = cur();
+  fprintf(stdout, "[%9.3f %-4s] ", sim_now_us / 1e6, n ? n->name.c_str() : "sim");
+}
+
+static size_t log_text(const char* s, bool newline) {
+  if (!verbose) return strlen(s);
+  static bool at_line_start = true;
+  size_t len = strlen(s);
+  for (size_t i = 0; i < len; i++) {
+    if (at_line_start) { log_prefix(); at_line_start = false; }
+    fputc(s[i], stdout);
+    if (s[i] == '\n') at_line_start = true;
+  }
+  if (newline) {
+    if (at_line_start) log_prefix();
+    fputc('\n', stdout);
+    at_line_start = true;
+  }
+  return len + (newline ? 1 : 0);
+}
+
+int HardwareSerial::printf(const char* fmt, ...) {
+  char buf[512];
+  va_list ap;
+  va_start(ap, fmt);
+  int len = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  log_text(buf, false);
+  return len;
+}
+
+size_t HardwareSerial::print(const char* s) { return log_text(s, false); }
+size_t HardwareSerial::print(char c) { char s[2] = { c, 0 }; return log_text(s, false); }
+size_t HardwareSerial::print(int v) { return printf("%d", v); }
+size_t HardwareSerial::print(unsigned v) { return printf("%u", v); }
+size_t HardwareSerial::print(long v) { return printf("%ld", v); }
+size_t HardwareSerial::print(unsigned long v) { return printf("%lu", v); }
+size_t HardwareSerial::print(double v, int digits) { return printf("%.*f", digits, v); }
+size_t HardwareSerial::println(const char* s) { return log_text(s, true); }
+size_t HardwareSerial::println(int v) { return print(v) + println(); }
+size_t HardwareSerial::println(unsigned v) { return print(v) + println(); }
+size_t HardwareSerial::println(unsigned long v) { return print(v) + println(); }
+size_t HardwareSerial::println(double v, int digits) { return print(v, digits) + println(); }
@@ -0,0 +1,93 @@
+#ifndef ESP_NOW_SIM_H
+#define ESP_NOW_SIM_H
+
+// In-process ESP-NOW medium for host builds.
+//
+// N simulated nodes share one virtual clock and one radio medium. Firmware
+// code calls the normal esp_now_* / esp_wifi_* / millis() API; those calls
+// act on the "current" node, which the simulator switches whenever it runs
+// a node's task or delivers a frame/send callback to it.
+//
+// Each directed link has latency, jitter, per-attempt loss and a retry
+// budget. Frames are only heard by nodes tuned to the sender's channel.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+// =================== MEDIUM CONFIGURATION ===================
+typedef struct {
+  uint32_t latency_us;    // fixed one-way latency (stack + driver)
+  uint32_t jitter_us;     // extra uniform delay in [0, jitter_us]
+  float    loss;          // per-attempt frame loss probability (0..1)
+  uint8_t  retries;       // unicast MAC retries after the first attempt
+  uint32_t phy_kbps;      // PHY rate used for airtime (ESP-NOW default 1 Mbps)
+} now_sim_link_t;
+
+typedef struct {
+  uint32_t tx_frames;        // esp_now_send() calls accepted
+  uint32_t tx_attempts;      // on-air attempts including retries
+  uint32_t delivered;        // frames handed to a receive callback
+  uint32_t lost;             // unicast frames that exhausted retries
+  uint32_t chan_mismatch;    // attempts nobody could hear (wrong channel/asleep)
+  uint64_t airtime_us;       // total on-air time of all attempts
+} now_sim_stats_t;
+
+now_sim_link_t now_sim_default_link();
+
+// =================== NODES ===================
+int  now_sim_add_node(const char* name, const uint8_t mac[6], uint8_t channel);
+int  now_sim_node_count();
+const char* now_sim_node_name(int node);
+const uint8_t* now_sim_node_mac(int node);
+
+void now_sim_set_current(int node);
+int  now_sim_current();
+
+void now_sim_set_default_link(const now_sim_link_t& link);
+void now_sim_set_link(int from, int to, const now_sim_link_t& link);
+
+// Local clock = global * (1 + drift_ppm/1e6) + offset_us
+void now_sim_set_clock(int node, int64_t offset_us, float drift_ppm);
+void now_sim_set_channel(int node, uint8_t channel);
+uint8_t now_sim_channel(int node);
+
+// A node with its radio off neither hears frames nor gets ACKs through.
+void now_sim_set_radio(int node, bool on);
+bool now_sim_radio(int node);
+uint64_t now_sim_radio_on_us(int node);
+
+// Deep sleep wake or reset: the node's local clock (millis(), esp_timer)
+// restarts at 0 and its ESP-NOW state is cleared. The RTC clock keeps
+// running across reboots at its own error. wake_cause is what
+// esp_sleep_get_wakeup_cause() returns afterwards (0 = not a sleep wake).
+void now_sim_reboot(int node, int wake_cause);
+int  now_sim_wake_cause();
+uint64_t now_sim_rtc_us();
+void now_sim_set_rtc_drift(int node, float ppm);
+
+// Value returned by analogRead() on this node.
+void now_sim_set_analog(int node, std::function<int(int pin)> fn);
+int  now_sim_analog_read(int pin);
+
+// =================== VIRTUAL TIME ===================
+void now_sim_seed(uint32_t seed);
+uint64_t now_sim_time_us();        // global virtual time
+uint64_t now_sim_local_us();       // current node's clock
+uint64_t now_sim_node_local_us(int node);
+void now_sim_delay_us(uint64_t us);
+void now_sim_run_until(uint64_t t_us);
+
+// Run fn on `node` at global time t_us.
+void now_sim_at(int node, uint64_t t_us, std::function<void()> fn);
+// Run fn on `node` every period_us starting at t_us.
+void now_sim_every(int node, uint64_t t_us, uint64_t period_us, std::function<void()> fn);
+
+// =================== REPORTING ===================
+void now_sim_set_verbose(bool verbose);
+bool now_sim_verbose();
+const now_sim_stats_t& now_sim_stats();
+uint32_t now_sim_rand();
+float now_sim_randf();
+
+#endif // ESP_NOW_SIM_H
@@ -0,0 +1,68 @@
+#ifndef HOST_ESP_PARTITION_H
+#define HOST_ESP_PARTITION_H
+
+// Host stand-in for the ESP-IDF 4.4 partition API subset used by the camera
+// (partition_sim.cpp). Partitions are host buffers added by the tool; flash
+// semantics are the board's: erase sets whole 4 KB sectors to 0xFF, a write
+// can only clear bits, and a mapping reads the flash in place. Erase and
+// write advance the virtual clock at typical SPI NOR rates.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_now.h"   // esp_err_t
+
+#define ESP_ERR_INVALID_ARG    0x102
+#define ESP_ERR_INVALID_SIZE   0x104
+#define ESP_ERR_NOT_FOUND      0x105
+
+typedef enum {
+  ESP_PARTITION_TYPE_APP  = 0x00,
+  ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef int esp_partition_subtype_t;
+#define ESP_PARTITION_SUBTYPE_ANY  0xff
+
+typedef struct {
+  void* flash_chip;
+  esp_partition_type_t type;
+  esp_partition_subtype_t subtype;
+  uint32_t address;
+  uint32_t size;
+  char label[17];
+  bool encrypted;
+} esp_partition_t;
+
+typedef enum {
+  SPI_FLASH_MMAP_DATA,
+  SPI_FLASH_MMAP_INST,
+} spi_flash_mmap_memory_t;
+
+typedef uint32_t spi_flash_mmap_handle_t;
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label);
+esp_err_t esp_partition_read(const esp_partition_t* part, size_t src_offset, void* dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t* part, size_t dst_offset, const void* src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t* part, size_t offset, size_t size);
+esp_err_t esp_partition_mmap(const esp_partition_t* part, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void** out_ptr,
+                             spi_flash_mmap_handle_t* out_handle);
+void spi_flash_munmap(spi_flash_mmap_handle_t handle);
+
+// =================== SIMULATION ===================
+#define PARTITION_SIM_ERASE_US  45000   // per 4 KB sector
+#define PARTITION_SIM_PAGE_US   400     // per 256 B page program
+
+// Adds an erased partition (size a multiple of 4 KB) after the previous one
+const esp_partition_t* partition_sim_add(const char* label, esp_partition_type_t type,
+                                         esp_partition_subtype_t subtype, uint32_t size);
+// Power cut: writes stop after this many more bytes (the rest of that write
+// and every later one fail). < 0: no cut.
+void partition_sim_cut_after(long bytes);
+// Open mappings, to check that every map is released
+int partition_sim_maps();
+
+#endif // HOST_ESP_PARTITION_H
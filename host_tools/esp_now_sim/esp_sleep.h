@@ -0,0 +1,32 @@
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+// Host stand-in for esp_sleep.h: the wake-up cause and wake source setup.
+// Sleeping itself is modelled by the tools (radio off, now_sim_reboot() for
+// deep sleep); esp_light_sleep_start() returns at once.
+
+#include <stdint.h>
+#include "esp_now.h"   // esp_err_t
+#include "esp_now_sim.h"
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,   // reset was not caused by exit from deep sleep
+  ESP_SLEEP_WAKEUP_ALL,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER,
+  ESP_SLEEP_WAKEUP_TOUCHPAD,
+  ESP_SLEEP_WAKEUP_ULP,
+} esp_sleep_wakeup_cause_t;
+
+typedef esp_sleep_wakeup_cause_t esp_sleep_source_t;
+
+static inline esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void) {
+  return (esp_sleep_wakeup_cause_t)now_sim_wake_cause();
+}
+static inline esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) { return ESP_OK; }
+static inline esp_err_t esp_sleep_enable_ulp_wakeup(void) { return ESP_OK; }
+static inline esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t) { return ESP_OK; }
+static inline esp_err_t esp_light_sleep_start(void) { return ESP_OK; }
+
+#endif // HOST_ESP_SLEEP_H
@@ -0,0 +1,11 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+// Host stand-in for esp_timer: 64-bit microseconds on the current node's clock.
+
+#include <stdint.h>
+#include "esp_now_sim.h"
+
+static inline int64_t esp_timer_get_time(void) { return (int64_t)now_sim_local_us(); }
+
+#endif // HOST_ESP_TIMER_H
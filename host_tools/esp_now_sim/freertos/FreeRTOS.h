@@ -0,0 +1,12 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+// Host stand-in for freertos/FreeRTOS.h: the types task.h needs
+
+#include <stdint.h>
+
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+#endif // HOST_FREERTOS_H
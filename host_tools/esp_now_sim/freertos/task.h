@@ -0,0 +1,22 @@
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+// Host stand-in for freertos/task.h: task handles by name and their stack
+// high-water marks (task_sim.cpp). There is no scheduler; the calling code
+// is always the loop task. The high-water marks are set, not measured
+// (defaults are plausible values for a board running WiFi).
+
+#include "FreeRTOS.h"
+
+typedef struct sim_task* TaskHandle_t;
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+TaskHandle_t xTaskGetHandle(const char* name);       // nullptr if not running
+UBaseType_t  uxTaskGetStackHighWaterMark(TaskHandle_t task);   // bytes, as on ESP-IDF
+
+// =================== SIMULATION ===================
+// Stack never used by the named task; 0 = the task is not running.
+// Defaults: loopTask 5,312 B, wifi 1,764 B, tiT 1,428 B, esp_timer 2,848 B.
+void task_sim_set_stack(const char* name, uint32_t high_water);
+
+#endif // HOST_FREERTOS_TASK_H
@@ -0,0 +1,84 @@
+#include "esp_heap_caps.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <utility>
+
+// =================== STATE ===================
+typedef struct {
+  size_t size;       // free bytes when nothing is allocated
+  size_t largest;    // largest block when nothing is allocated
+  size_t used;
+  size_t min_free;
+} sim_pool_t;
+
+static sim_pool_t pools[2] = {
+  { 170000, 113792, 0, 170000 },
+  { 4u << 20, 4u << 20, 0, 4u << 20 },
+};
+// ptr -> bytes, pool. Built on first use: the EI SDK allocates from static
+// constructors, which may run before this file's.
+static std::map<void*, std::pair<size_t, int>>& live() {
+  static std::map<void*, std::pair<size_t, int>> m;
+  return m;
+}
+
+static int pool_of(uint32_t caps) {
+  return (caps & MALLOC_CAP_SPIRAM) ? 1 : 0;
+}
+
+void heap_sim_set_pool(bool psram, size_t free_bytes, size_t largest_block) {
+  sim_pool_t& p = pools[psram ? 1 : 0];
+  p.size = free_bytes;
+  p.largest = largest_block < free_bytes ? largest_block : free_bytes;
+  p.min_free = free_bytes > p.used ? free_bytes - p.used : 0;
+}
+
+// =================== ALLOCATION ===================
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+  sim_pool_t& p = pools[pool_of(caps)];
+  if (!size || size > heap_caps_get_largest_free_block(caps)) return nullptr;
+  if (alignment < sizeof(void*)) alignment = sizeof(void*);
+  void* ptr = aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+  if (!ptr) return nullptr;
+  p.used += size;
+  if (p.size - p.used < p.min_free) p.min_free = p.size - p.used;
+  live()[ptr] = { size, pool_of(caps) };
+  return ptr;
+}
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+  return heap_caps_aligned_alloc(16, size, caps);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  void* ptr = heap_caps_aligned_alloc(16, n * size, caps);
+  if (ptr) memset(ptr, 0, n * size);
+  return ptr;
+}
+
+void heap_caps_free(void* ptr) {
+  if (!ptr) return;
+  auto it = live().find(ptr);
+  if (it == live().end()) abort();   // not from heap_caps_*
+  pools[it->second.second].used -= it->second.first;
+  live().erase(it);
+  free(ptr);
+}
+
+// =================== STATISTICS ===================
+size_t heap_caps_get_free_size(uint32_t caps) {
+  const sim_pool_t& p = pools[pool_of(caps)];
+  return p.size - p.used;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  const sim_pool_t& p = pools[pool_of(caps)];
+  const size_t free_bytes = p.size - p.used;
+  return p.largest < free_bytes ? p.largest : free_bytes;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  return pools[pool_of(caps)].min_free;
+}
@@ -0,0 +1,210 @@
+#include "img_converters.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+// Minimal baseline JPEG encoder (single grayscale component, 8x8 float DCT,
+// Annex K luminance tables). Quality scaling follows libjpeg, like the
+// esp32-camera encoder, so byte counts land in the same ballpark.
+
+// =================== TABLES ===================
+static const uint8_t ZIGZAG[64] = {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static const uint8_t STD_LUMA_Q[64] = {
+  16, 11, 10, 16,  24,  40,  51,  61,
+  12, 12, 14, 19,  26,  58,  60,  55,
+  14, 13, 16, 24,  40,  57,  69,  56,
+  14, 17, 22, 29,  51,  87,  80,  62,
+  18, 22, 37, 56,  68, 109, 103,  77,
+  24, 35, 55, 64,  81, 104, 113,  92,
+  49, 64, 78, 87, 103, 121, 120, 101,
+  72, 92, 95, 98, 112, 100, 103,  99,
+};
+
+static const uint8_t DC_BITS[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t DC_VALS[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+static const uint8_t AC_BITS[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+static const uint8_t AC_VALS[162] = {
+  0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+  0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+  0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+  0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+  0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+  0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+  0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+  0xf9, 0xfa,
+};
+
+typedef struct { uint16_t code[256]; uint8_t len[256]; } huff_t;
+
+static void build_huff(const uint8_t bits[16], const uint8_t* vals, huff_t& h) {
+  memset(&h, 0, sizeof(h));
+  uint16_t code = 0;
+  int k = 0;
+  for (int l = 1; l <= 16; l++) {
+    for (int i = 0; i < bits[l - 1]; i++, k++) {
+      h.code[vals[k]] = code++;
+      h.len[vals[k]] = (uint8_t)l;
+    }
+    code <<= 1;
+  }
+}
+
+// =================== BIT WRITER ===================
+typedef struct {
+  std::vector<uint8_t> out;
+  uint32_t acc;
+  int nbits;
+} bitw_t;
+
+static void put_byte(bitw_t& w, uint8_t b) { w.out.push_back(b); }
+static void put_u16(bitw_t& w, uint16_t v) { put_byte(w, v >> 8); put_byte(w, v & 0xFF); }
+
+static void put_bits(bitw_t& w, uint32_t code, int len) {
+  w.acc = (w.acc << len) | (code & ((1u << len) - 1));
+  w.nbits += len;
+  while (w.nbits >= 8) {
+    uint8_t b = (uint8_t)(w.acc >> (w.nbits - 8));
+    put_byte(w, b);
+    if (b == 0xFF) put_byte(w, 0x00);   // byte stuffing
+    w.nbits -= 8;
+  }
+}
+
+static void flush_bits(bitw_t& w) {
+  if (w.nbits > 0) put_bits(w, 0x7F, 8 - w.nbits);   // pad with 1s
+}
+
+// Magnitude category and the bits that follow it
+static int mag_bits(int v, uint32_t& bits) {
+  int a = v < 0 ? -v : v;
+  int n = 0;
+  while (a) { n++; a >>= 1; }
+  bits = (uint32_t)(v < 0 ? v + (1 << n) - 1 : v);
+  return n;
+}
+
+// =================== ENCODER ===================
+static void fdct8x8(const float in[64], float out[64]) {
+  static float c[8][8];
+  static bool ready = false;
+  if (!ready) {
+    for (int u = 0; u < 8; u++) {
+      for (int x = 0; x < 8; x++) {
+        c[u][x] = (u == 0 ? sqrtf(0.125f) : 0.5f) * cosf((2 * x + 1) * u * (float)M_PI / 16);
+      }
+    }
+    ready = true;
+  }
+  float tmp[64];
+  for (int y = 0; y < 8; y++) {
+    for (int u = 0; u < 8; u++) {
+      float s = 0;
+      for (int x = 0; x < 8; x++) s += c[u][x] * in[y * 8 + x];
+      tmp[y * 8 + u] = s;
+    }
+  }
+  for (int u = 0; u < 8; u++) {
+    for (int v = 0; v < 8; v++) {
+      float s = 0;
+      for (int y = 0; y < 8; y++) s += c[v][y] * tmp[y * 8 + u];
+      out[v * 8 + u] = s;
+    }
+  }
+}
+
+bool fmt2jpg(uint8_t* src, size_t src_len, uint16_t width, uint16_t height,
+             pixformat_t format, uint8_t quality, uint8_t** out, size_t* out_len) {
+  if (!src || !out || !out_len || format != PIXFORMAT_GRAYSCALE) return false;
+  if (width == 0 || height == 0 || src_len < (size_t)width * height) return false;
+
+  if (quality < 1) quality = 1;
+  if (quality > 100) quality = 100;
+  const int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+  uint8_t q[64];
+  for (int i = 0; i < 64; i++) {
+    int v = (STD_LUMA_Q[i] * scale + 50) / 100;
+    q[i] = (uint8_t)(v < 1 ? 1 : (v > 255 ? 255 : v));
+  }
+
+  huff_t dc, ac;
+  build_huff(DC_BITS, DC_VALS, dc);
+  build_huff(AC_BITS, AC_VALS, ac);
+
+  bitw_t w{};
+  w.out.reserve((size_t)width * height / 4 + 400);
+
+  // SOI, DQT, SOF0, DHT x2, SOS
+  put_u16(w, 0xFFD8);
+  put_u16(w, 0xFFDB); put_u16(w, 67); put_byte(w, 0x00);
+  for (int i = 0; i < 64; i++) put_byte(w, q[ZIGZAG[i]]);
+  put_u16(w, 0xFFC0); put_u16(w, 11); put_byte(w, 8);
+  put_u16(w, height); put_u16(w, width);
+  put_byte(w, 1); put_byte(w, 1); put_byte(w, 0x11); put_byte(w, 0);
+  put_u16(w, 0xFFC4); put_u16(w, 3 + 16 + 12); put_byte(w, 0x00);
+  for (int i = 0; i < 16; i++) put_byte(w, DC_BITS[i]);
+  for (int i = 0; i < 12; i++) put_byte(w, DC_VALS[i]);
+  put_u16(w, 0xFFC4); put_u16(w, 3 + 16 + 162); put_byte(w, 0x10);
+  for (int i = 0; i < 16; i++) put_byte(w, AC_BITS[i]);
+  for (int i = 0; i < 162; i++) put_byte(w, AC_VALS[i]);
+  put_u16(w, 0xFFDA); put_u16(w, 8); put_byte(w, 1);
+  put_byte(w, 1); put_byte(w, 0x00);
+  put_byte(w, 0); put_byte(w, 63); put_byte(w, 0);
+
+  int prev_dc = 0;
+  float blk[64], coef[64];
+  for (int by = 0; by < height; by += 8) {
+    for (int bx = 0; bx < width; bx += 8) {
+      // Edge blocks repeat the last row/column
+      for (int y = 0; y < 8; y++) {
+        int sy = std::min(by + y, height - 1);
+        for (int x = 0; x < 8; x++) {
+          int sx = std::min(bx + x, width - 1);
+          blk[y * 8 + x] = (float)src[sy * width + sx] - 128.0f;
+        }
+      }
+      fdct8x8(blk, coef);
+
+      int zz[64];
+      for (int i = 0; i < 64; i++) zz[i] = (int)lroundf(coef[ZIGZAG[i]] / q[ZIGZAG[i]]);
+
+      uint32_t bits;
+      int diff = zz[0] - prev_dc;
+      prev_dc = zz[0];
+      int n = mag_bits(diff, bits);
+      put_bits(w, dc.code[n], dc.len[n]);
+      if (n) put_bits(w, bits, n);
+
+      int run = 0;
+      for (int i = 1; i < 64; i++) {
+        if (zz[i] == 0) { run++; continue; }
+        while (run >= 16) { put_bits(w, ac.code[0xF0], ac.len[0xF0]); run -= 16; }
+        n = mag_bits(zz[i], bits);
+        const int sym = (run << 4) | n;
+        put_bits(w, ac.code[sym], ac.len[sym]);
+        put_bits(w, bits, n);
+        run = 0;
+      }
+      if (run) put_bits(w, ac.code[0x00], ac.len[0x00]);   // EOB
+    }
+  }
+  flush_bits(w);
+  put_u16(w, 0xFFD9);
+
+  *out = (uint8_t*)malloc(w.out.size());
+  if (!*out) return false;
+  memcpy(*out, w.out.data(), w.out.size());
+  *out_len = w.out.size();
+  return true;
+}
@@ -0,0 +1,23 @@
+#ifndef HOST_IMG_CONVERTERS_H
+#define HOST_IMG_CONVERTERS_H
+
+// Host stand-in for esp32-camera's img_converters.h. Only the grayscale
+// path of fmt2jpg() is implemented (baseline JPEG, standard Huffman tables),
+// which is what the evidence thumbnails use.
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+  PIXFORMAT_RGB565,
+  PIXFORMAT_YUV422,
+  PIXFORMAT_GRAYSCALE,
+  PIXFORMAT_JPEG,
+  PIXFORMAT_RGB888,
+} pixformat_t;
+
+// Output is malloc'd; caller frees *out
+bool fmt2jpg(uint8_t* src, size_t src_len, uint16_t width, uint16_t height,
+             pixformat_t format, uint8_t quality, uint8_t** out, size_t* out_len);
+
+#endif // HOST_IMG_CONVERTERS_H
@@ -0,0 +1,110 @@
+#include "esp_partition.h"
+#include "Arduino.h"
+
+#include <string.h>
+#include <memory>
+#include <vector>
+
+// =================== STATE ===================
+typedef struct {
+  esp_partition_t part;
+  std::vector<uint8_t> flash;
+} sim_part_t;
+
+// Built on first use, like the heap simulator's table
+static std::vector<std::unique_ptr<sim_part_t>>& parts() {
+  static std::vector<std::unique_ptr<sim_part_t>> p;
+  return p;
+}
+static long cut_after = -1;
+static int maps = 0;
+static spi_flash_mmap_handle_t next_handle = 1;
+static uint32_t next_address = 0x310000;
+
+#define SECTOR 4096
+#define PAGE   256
+
+static sim_part_t* find(const esp_partition_t* part) {
+  for (auto& p : parts()) {
+    if (&p->part == part) return p.get();
+  }
+  return nullptr;
+}
+
+const esp_partition_t* partition_sim_add(const char* label, esp_partition_type_t type,
+                                         esp_partition_subtype_t subtype, uint32_t size) {
+  std::unique_ptr<sim_part_t> p(new sim_part_t());
+  p->part.type = type;
+  p->part.subtype = subtype;
+  p->part.address = next_address;
+  p->part.size = (size + SECTOR - 1) / SECTOR * SECTOR;
+  strncpy(p->part.label, label, sizeof(p->part.label) - 1);
+  p->flash.assign(p->part.size, 0xFF);
+  next_address += p->part.size;
+  parts().push_back(std::move(p));
+  return &parts().back()->part;
+}
+
+void partition_sim_cut_after(long bytes) {
+  cut_after = bytes;
+}
+
+int partition_sim_maps() {
+  return maps;
+}
+
+// =================== PARTITION API ===================
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label) {
+  for (auto& p : parts()) {
+    if (p->part.type != type) continue;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && p->part.subtype != subtype) continue;
+    if (label && strcmp(label, p->part.label)) continue;
+    return &p->part;
+  }
+  return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* part, size_t src_offset, void* dst, size_t size) {
+  sim_part_t* p = find(part);
+  if (!p || src_offset + size > part->size) return ESP_ERR_INVALID_ARG;
+  memcpy(dst, p->flash.data() + src_offset, size);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* part, size_t dst_offset, const void* src, size_t size) {
+  sim_part_t* p = find(part);
+  if (!p || dst_offset + size > part->size) return ESP_ERR_INVALID_ARG;
+  size_t n = size;
+  if (cut_after >= 0 && (long)n > cut_after) n = (size_t)cut_after;
+  const uint8_t* s = (const uint8_t*)src;
+  for (size_t i = 0; i < n; i++) p->flash[dst_offset + i] &= s[i];   // NOR: program clears bits only
+  if (cut_after >= 0) cut_after -= (long)n;
+  now_sim_delay_us((uint64_t)(n + PAGE - 1) / PAGE * PARTITION_SIM_PAGE_US);
+  return n == size ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* part, size_t offset, size_t size) {
+  sim_part_t* p = find(part);
+  if (!p || offset + size > part->size) return ESP_ERR_INVALID_ARG;
+  if (offset % SECTOR || size % SECTOR) return ESP_ERR_INVALID_SIZE;
+  if (cut_after == 0) return ESP_FAIL;
+  memset(p->flash.data() + offset, 0xFF, size);
+  now_sim_delay_us((uint64_t)size / SECTOR * PARTITION_SIM_ERASE_US);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* part, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void** out_ptr,
+                             spi_flash_mmap_handle_t* out_handle) {
+  sim_part_t* p = find(part);
+  if (!p || offset + size > part->size) return ESP_ERR_INVALID_ARG;
+  *out_ptr = p->flash.data() + offset;
+  *out_handle = next_handle++;
+  maps++;
+  return ESP_OK;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle) {
+  if (maps > 0) maps--;
+}
@@ -0,0 +1,48 @@
+#include "freertos/task.h"
+#include <string.h>
+
+#define TASK_SIM_SLOTS 8
+
+struct sim_task {
+  char name[16];
+  uint32_t high_water;
+};
+
+static sim_task* tasks() {
+  // Function-local so it is set up before any static constructor asks
+  static sim_task t[TASK_SIM_SLOTS] = {
+    { "loopTask", 5312 }, { "wifi", 1764 }, { "tiT", 1428 }, { "esp_timer", 2848 },
+  };
+  return t;
+}
+
+static sim_task* find(const char* name) {
+  for (int i = 0; i < TASK_SIM_SLOTS; i++) {
+    if (tasks()[i].name[0] && !strcmp(tasks()[i].name, name)) return &tasks()[i];
+  }
+  return nullptr;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+  return find("loopTask");
+}
+
+TaskHandle_t xTaskGetHandle(const char* name) {
+  sim_task* t = find(name);
+  return t && t->high_water ? t : nullptr;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  return task ? task->high_water : 0;
+}
+
+void task_sim_set_stack(const char* name, uint32_t high_water) {
+  sim_task* t = find(name);
+  for (int i = 0; !t && i < TASK_SIM_SLOTS; i++) {
+    if (!tasks()[i].name[0]) {
+      t = &tasks()[i];
+      strncpy(t->name, name, sizeof(t->name) - 1);
+    }
+  }
+  if (t) t->high_water = high_water;
+}
@@ -0,0 +1,162 @@
+#include "esp32/ulp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <map>
+#include <vector>
+
+// =================== STATE ===================
+uint32_t ulp_sim_rtc_slow_mem[RTC_SLOW_MEM_WORDS];
+
+static std::vector<ulp_insn_t> program;   // labels resolved to absolute word addresses
+static uint32_t load_addr = 0;
+static uint32_t entry = 0;
+static bool running = false;
+static uint32_t period_us = 0;
+static uint16_t reg[4];
+static bool flag_ovf = false, flag_zero = false;
+static uint32_t last_cycles = 0;
+static std::function<int(int, int)> adc_fn;
+
+// RTC fast clock cycles per instruction (TRM figures, ADC at default SAR timing)
+#define CYC_ALU   6
+#define CYC_LDST  8
+#define CYC_JUMP  4
+#define CYC_ADC   74
+#define CYC_WAKE  6
+#define CYC_HALT  2
+
+static void fail(const char* what, uint32_t pc) {
+  fprintf(stderr, "ULP: %s at pc %u\n", what, (unsigned)pc);
+  exit(1);
+}
+
+// =================== LOADER ===================
+esp_err_t ulp_process_macros_and_load(uint32_t addr, const ulp_insn_t* prog, size_t* psize) {
+  std::map<int32_t, uint32_t> labels;
+  std::vector<ulp_insn_t> code;
+  for (size_t i = 0; i < *psize; i++) {
+    if (prog[i].op == ULP_OP_LABEL) {
+      if (labels.count(prog[i].imm)) return ESP_FAIL;
+      labels[prog[i].imm] = (uint32_t)code.size();
+    } else {
+      code.push_back(prog[i]);
+    }
+  }
+  for (size_t pc = 0; pc < code.size(); pc++) {
+    ulp_insn_t& in = code[pc];
+    if (!in.label) {
+      if (in.op == ULP_OP_BR_R0) in.imm += (int32_t)pc;   // relative forms
+      continue;
+    }
+    auto it = labels.find(in.imm);
+    if (it == labels.end()) return ESP_FAIL;
+    in.imm = (int32_t)it->second;
+    in.label = false;
+  }
+  if (addr + code.size() > RTC_SLOW_MEM_WORDS) return ESP_FAIL;
+  program = code;
+  load_addr = addr;
+  for (size_t i = 0; i < code.size(); i++) ulp_sim_rtc_slow_mem[addr + i] = 0xC0DE0000u | (uint32_t)i;
+  *psize = code.size();
+  return ESP_OK;
+}
+
+esp_err_t ulp_run(uint32_t entry_point) {
+  if (entry_point >= program.size()) return ESP_FAIL;
+  entry = entry_point;
+  running = true;
+  return ESP_OK;
+}
+
+esp_err_t ulp_set_wakeup_period(size_t period_index, uint32_t us) {
+  if (period_index != 0) return ESP_FAIL;
+  period_us = us;
+  return ESP_OK;
+}
+
+// =================== INTERPRETER ===================
+static uint32_t mem_addr(uint32_t pc, int32_t addr) {
+  if (addr < 0 || addr >= RTC_SLOW_MEM_WORDS) fail("address out of RTC slow memory", pc);
+  return (uint32_t)addr;
+}
+
+bool ulp_sim_run() {
+  if (!running) return false;
+  bool wake = false;
+  uint32_t cycles = 0;
+  uint32_t pc = entry;
+  for (int steps = 0;; steps++) {
+    if (steps > 1000000) fail("program does not halt", pc);
+    if (pc >= program.size()) fail("ran off the end of the program", pc);
+    const ulp_insn_t& in = program[pc];
+    uint32_t next = pc + 1;
+    switch (in.op) {
+      case ULP_OP_ALU_R:
+      case ULP_OP_ALU_I: {
+        const uint32_t a = in.sub == ULP_ALU_MOV && in.op == ULP_OP_ALU_I ? 0 : reg[in.rs1];
+        const uint32_t b = in.op == ULP_OP_ALU_R ? (in.sub == ULP_ALU_MOV ? 0 : reg[in.rs2])
+                                                 : (uint32_t)(in.imm & 0xFFFF);
+        uint32_t r = 0;
+        flag_ovf = false;
+        switch (in.sub) {
+          case ULP_ALU_ADD: r = a + b; flag_ovf = r > 0xFFFF; break;
+          case ULP_ALU_SUB: r = a - b; flag_ovf = a < b; break;
+          case ULP_ALU_AND: r = a & b; break;
+          case ULP_ALU_OR:  r = a | b; break;
+          case ULP_ALU_MOV: r = in.op == ULP_OP_ALU_I ? b : a; break;
+          case ULP_ALU_LSH: r = b < 16 ? a << b : 0; break;
+          case ULP_ALU_RSH: r = b < 16 ? a >> b : 0; break;
+        }
+        reg[in.rd] = (uint16_t)r;
+        flag_zero = reg[in.rd] == 0;
+        cycles += CYC_ALU;
+        break;
+      }
+      case ULP_OP_LD:
+        reg[in.rd] = (uint16_t)ulp_sim_rtc_slow_mem[mem_addr(pc, reg[in.rs1] + in.imm)];
+        cycles += CYC_LDST;
+        break;
+      case ULP_OP_ST: {
+        const uint32_t a = mem_addr(pc, reg[in.rs1] + in.imm);
+        if (a >= load_addr && a < load_addr + program.size()) fail("store into the program", pc);
+        ulp_sim_rtc_slow_mem[a] = ((load_addr + pc) << 16) | reg[in.rd];
+        cycles += CYC_LDST;
+        break;
+      }
+      case ULP_OP_ADC:
+        reg[in.rd] = (uint16_t)(adc_fn ? adc_fn(in.sub, in.imm) & 0xFFF : 0);
+        cycles += CYC_ADC;
+        break;
+      case ULP_OP_BR_R0: {
+        const bool lt = reg[0] < (uint32_t)in.cmp;
+        if (in.sub == ULP_BR_LT ? lt : !lt) next = (uint32_t)in.imm;
+        cycles += CYC_JUMP;
+        break;
+      }
+      case ULP_OP_BX:
+        if (in.sub == ULP_BX_ALWAYS || (in.sub == ULP_BX_ZERO && flag_zero) ||
+            (in.sub == ULP_BX_OVF && flag_ovf)) {
+          next = (uint32_t)in.imm;
+        }
+        cycles += CYC_JUMP;
+        break;
+      case ULP_OP_WAKE:
+        wake = true;
+        cycles += CYC_WAKE;
+        break;
+      case ULP_OP_HALT:
+        last_cycles = cycles + CYC_HALT;
+        return wake;
+      default:
+        fail("bad instruction", pc);
+    }
+    pc = next;
+  }
+}
+
+// =================== SIMULATION ===================
+void ulp_sim_set_adc(std::function<int(int, int)> fn) { adc_fn = std::move(fn); }
+uint32_t ulp_sim_period_us() { return period_us; }
+uint32_t ulp_sim_last_cycles() { return last_cycles; }
+size_t ulp_sim_program_words() { return program.size(); }
@@ -0,0 +1,339 @@
+/*
+ * FOMO int8 post-processing: blob path against the cube path
+ *
+ * Runs process_fomo_i8_blobs() (int8 threshold, one-pass connected
+ * components, static box array) and the original process_fomo_i8_cubes()
+ * over the same output maps and reports per-frame time and heap allocations
+ * for both.
+ *
+ * The blob path must agree exactly with an independent flood fill of the
+ * map (same regions, boxes, order and scores). Against the cube path the
+ * report gives frames with identical boxes, with the same best score per
+ * class and with the same box count. The cube path merges only boxes that
+ * touch its running box and cannot grow a box to the left, so shapes such as
+ * an L or a diagonal come out as several boxes there, and its second merge
+ * pass raises a box's score after the box was emitted, so it can report less
+ * than the best cell. The blob path's best score per class is never lower.
+ *
+ * Maps are synthetic (rectangles, L shapes, diagonals and noise around the
+ * threshold) or, with --maps, the output maps an ei_bench --save file holds.
+ *
+ * Usage: fomo_blob_bench [--frames N] [--seed S] [--maps FILE] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+// =================== CONFIGURATION ===================
+static int         opt_frames  = 2000;
+static uint32_t    opt_seed    = 1;
+static const char* opt_maps    = nullptr;
+static bool        opt_verbose = false;
+
+static const int RUNS = 5;   // timing passes, best kept
+
+// =================== HEAP COUNTER ===================
+// Out of line, or GCC flags the inlined malloc/free pairs in the SDK headers
+#define HEAP_FN __attribute__((noinline))
+
+static unsigned long heap_allocs = 0;
+
+HEAP_FN void* operator new(size_t n) {
+  heap_allocs++;
+  void* p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+HEAP_FN void* operator new[](size_t n) { return operator new(n); }
+HEAP_FN void operator delete(void* p) noexcept { free(p); }
+HEAP_FN void operator delete[](void* p) noexcept { free(p); }
+HEAP_FN void operator delete(void* p, size_t) noexcept { free(p); }
+HEAP_FN void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// =================== MODEL ===================
+static const ei_impulse_t*                    impulse = nullptr;
+static const ei_postprocessing_block_t*       fomo_block = nullptr;
+static const ei_fill_result_fomo_i8_config_t* fomo = nullptr;
+static ei_impulse_handle_t*                   handle = nullptr;
+static uint32_t map_w, map_h, map_stride, map_len;
+
+static bool find_fomo_block() {
+  impulse = ei_default_impulse.impulse;
+  for (size_t i = 0; i < impulse->postprocessing_blocks_size; i++) {
+    if (impulse->postprocessing_blocks[i].postprocess_fn == &process_fomo_i8) {
+      fomo_block = &impulse->postprocessing_blocks[i];
+    }
+  }
+  if (!fomo_block) return false;
+  fomo = (const ei_fill_result_fomo_i8_config_t*)fomo_block->config;
+  handle = new ei_impulse_handle_t(impulse);
+  map_w = fomo->out_width;
+  map_h = fomo->out_height;
+  map_stride = impulse->label_count + 1;
+  map_len = map_w * map_h * map_stride;
+  return true;
+}
+
+// =================== MAPS ===================
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+static int16_t q_threshold() {
+  return ei_fomo_i8_threshold(fomo->threshold, fomo->zero_point, fomo->scale);
+}
+
+static void put(std::vector<int8_t>& m, uint32_t x, uint32_t y, uint32_t c, int v) {
+  if (x >= map_w || y >= map_h) return;
+  m[(y * map_w + x) * map_stride + c] = (int8_t)std::max(-128, std::min(127, v));
+}
+
+// Background near zero probability, then a few shapes per class
+static void make_map(std::vector<int8_t>& m) {
+  const int thr = q_threshold();
+  m.assign(map_len, -128);
+  for (uint32_t i = 0; i < map_w * map_h; i++) {
+    for (uint32_t c = 1; c < map_stride; c++) m[i * map_stride + c] = (int8_t)(-128 + rng() % 24);
+  }
+  for (uint32_t c = 1; c < map_stride; c++) {
+    const int shapes = rng() % 5;
+    for (int s = 0; s < shapes; s++) {
+      const uint32_t x = rng() % map_w, y = rng() % map_h;
+      const uint32_t w = 1 + rng() % 4, h = 1 + rng() % 4;
+      const int peak = thr + (int)(rng() % (128 - std::min(thr, 127)));
+      switch (rng() % 4) {
+        case 0:   // block
+          for (uint32_t j = 0; j < h; j++)
+            for (uint32_t i = 0; i < w; i++) put(m, x + i, y + j, c, peak - (int)(rng() % 16));
+          break;
+        case 1:   // L: a column, then a row out to the left
+          for (uint32_t j = 0; j < h + 1; j++) put(m, x, y + j, c, peak);
+          for (uint32_t i = 0; i <= w && i <= x; i++) put(m, x - i, y + h, c, peak);
+          break;
+        case 2:   // diagonal down-left (8-connected only)
+          for (uint32_t k = 0; k < w + 1 && k <= x; k++) put(m, x - k, y + k, c, peak);
+          break;
+        default:  // cells right at the threshold
+          for (uint32_t k = 0; k < w * h; k++) {
+            put(m, rng() % map_w, rng() % map_h, c, thr - 1 + (int)(rng() % 3));
+          }
+          break;
+      }
+    }
+  }
+}
+
+// Output maps out of an ei_bench --save file: u32 len, map, u32 n, n hashes
+static bool load_maps(const char* path, std::vector<std::vector<int8_t>>& maps) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  uint32_t len, n;
+  while (fread(&len, 4, 1, f) == 1) {
+    std::vector<int8_t> m(len);
+    if (fread(m.data(), 1, len, f) != len || fread(&n, 4, 1, f) != 1 || fseek(f, (long)n * 4, SEEK_CUR)) break;
+    if (len == map_len) maps.push_back(m);
+  }
+  fclose(f);
+  return !maps.empty();
+}
+
+// =================== RUN ===================
+typedef EI_IMPULSE_ERROR (*post_fn_t)(ei_impulse_handle_t*, uint32_t, uint32_t,
+                                     ei_impulse_result_t*, void*, void*);
+
+typedef struct {
+  const char* label;
+  uint32_t x, y, width, height;
+  float value;
+} box_t;
+
+// One post-processing call on map, the way run_classifier() makes it
+static void invoke_path(post_fn_t fn, std::vector<int8_t>& m, ei_impulse_result_t* result) {
+  ei::matrix_i8_t mtx(1, map_len, m.data());
+  ei_feature_t raw;
+  raw.matrix_i8 = &mtx;
+  raw.blockId = fomo_block->input_block_id;
+  memset(result, 0, sizeof(*result));
+  result->_raw_outputs = &raw;
+  fn(handle, 0, fomo_block->input_block_id, result, fomo_block->config, nullptr);
+  result->_raw_outputs = nullptr;
+}
+
+// Boxes of one call; padded tells whether the slots after them are zeroed
+static std::vector<box_t> run_path(post_fn_t fn, std::vector<int8_t>& m, bool* padded) {
+  ei_impulse_result_t result;
+  invoke_path(fn, m, &result);
+  std::vector<box_t> boxes;
+  for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+    const ei_impulse_result_bounding_box_t& b = result.bounding_boxes[i];
+    boxes.push_back({ b.label, b.x, b.y, b.width, b.height, b.value });
+  }
+  *padded = true;
+  for (uint32_t i = result.bounding_boxes_count; i < fomo->object_detection_count; i++) {
+    *padded &= result.bounding_boxes[i].value == 0;
+  }
+  return boxes;
+}
+
+// Flood fill per class, 8-connected, thresholding the dequantized score as
+// the cube path does; boxes in order of first cell, then class
+static bool above(int8_t q) {
+  return static_cast<float>(q - fomo->zero_point) * fomo->scale >= fomo->threshold;
+}
+
+static std::vector<box_t> oracle(const std::vector<int8_t>& m) {
+  const uint32_t scale = impulse->input_width / map_w;
+  std::vector<std::pair<uint32_t, box_t>> found;
+  for (uint32_t c = 1; c < map_stride; c++) {
+    std::vector<bool> seen(map_w * map_h, false);
+    for (uint32_t start = 0; start < map_w * map_h; start++) {
+      if (seen[start] || !above(m[start * map_stride + c])) continue;
+      uint32_t x0 = map_w, y0 = map_h, x1 = 0, y1 = 0;
+      int best = -128;
+      std::vector<uint32_t> stack(1, start);
+      seen[start] = true;
+      while (!stack.empty()) {
+        const uint32_t cell = stack.back();
+        stack.pop_back();
+        const uint32_t x = cell % map_w, y = cell / map_w;
+        x0 = std::min(x0, x); x1 = std::max(x1, x);
+        y0 = std::min(y0, y); y1 = std::max(y1, y);
+        best = std::max(best, (int)m[cell * map_stride + c]);
+        for (int dy = -1; dy <= 1; dy++) {
+          for (int dx = -1; dx <= 1; dx++) {
+            const int nx = (int)x + dx, ny = (int)y + dy;
+            if (nx < 0 || ny < 0 || nx >= (int)map_w || ny >= (int)map_h) continue;
+            const uint32_t n = ny * map_w + nx;
+            if (seen[n] || !above(m[n * map_stride + c])) continue;
+            seen[n] = true;
+            stack.push_back(n);
+          }
+        }
+      }
+      const float value = static_cast<float>(best - fomo->zero_point) * fomo->scale;
+      found.push_back({ start, { impulse->categories[c - 1], x0 * scale, y0 * scale,
+                                 (x1 - x0 + 1) * scale, (y1 - y0 + 1) * scale, value } });
+    }
+  }
+  std::stable_sort(found.begin(), found.end(),
+                   [](const std::pair<uint32_t, box_t>& a, const std::pair<uint32_t, box_t>& b) { return a.first < b.first; });
+  std::vector<box_t> boxes;
+  for (auto& f : found) boxes.push_back(f.second);
+  return boxes;
+}
+
+static bool same_boxes(const std::vector<box_t>& a, const std::vector<box_t>& b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i].label != b[i].label || a[i].x != b[i].x || a[i].y != b[i].y ||
+        a[i].width != b[i].width || a[i].height != b[i].height || a[i].value != b[i].value) return false;
+  }
+  return true;
+}
+
+// Best score per class (0 if none), compared as exact floats
+static std::vector<float> best_scores(const std::vector<box_t>& boxes) {
+  std::vector<float> best(impulse->label_count, 0.0f);
+  for (const box_t& b : boxes) {
+    for (uint32_t c = 0; c < impulse->label_count; c++) {
+      if (b.label == impulse->categories[c]) best[c] = std::max(best[c], b.value);
+    }
+  }
+  return best;
+}
+
+// Best of RUNS passes over all maps: us per frame, heap allocations per frame
+static double time_path(post_fn_t fn, std::vector<std::vector<int8_t>>& maps, double* allocs) {
+  ei_impulse_result_t result;
+  double best_us = 1e30;
+  for (int r = 0; r < RUNS; r++) {
+    const unsigned long heap_before = heap_allocs;
+    const uint64_t start = ei_read_timer_us();
+    for (auto& m : maps) invoke_path(fn, m, &result);
+    best_us = std::min(best_us, (double)(ei_read_timer_us() - start));
+    *allocs = (double)(heap_allocs - heap_before) / maps.size();
+  }
+  return best_us / maps.size();
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc) opt_frames = atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc)   opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else if (a == "--maps" && i + 1 < argc)   opt_maps = argv[++i];
+    else if (a == "-v")                       opt_verbose = true;
+    else {
+      fprintf(stderr, "usage: fomo_blob_bench [--frames N] [--seed S] [--maps FILE] [-v]\n");
+      exit(2);
+    }
+  }
+  if (opt_frames < 1) opt_frames = 1;
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  if (!find_fomo_block()) {
+    fprintf(stderr, "model has no int8 FOMO block\n");
+    return 1;
+  }
+
+  std::vector<std::vector<int8_t>> maps;
+  if (opt_maps) {
+    if (!load_maps(opt_maps, maps)) {
+      fprintf(stderr, "no %ux%ux%u maps in %s\n", map_w, map_h, map_stride, opt_maps);
+      return 1;
+    }
+  } else {
+    rng_state = opt_seed;
+    maps.resize(opt_frames);
+    for (auto& m : maps) make_map(m);
+  }
+
+  int wrong = 0, unpadded = 0, identical = 0, same_best = 0, lower_best = 0, same_count = 0;
+  size_t blob_boxes = 0, cube_boxes = 0;
+  for (size_t f = 0; f < maps.size(); f++) {
+    bool pad_blob, pad_cube;
+    const std::vector<box_t> blobs = run_path(&process_fomo_i8_blobs, maps[f], &pad_blob);
+    const std::vector<box_t> cubes = run_path(&process_fomo_i8_cubes, maps[f], &pad_cube);
+    const bool ok = same_boxes(blobs, oracle(maps[f]));
+    wrong += !ok;
+    unpadded += !pad_blob;
+    identical += same_boxes(blobs, cubes);
+    const std::vector<float> blob_best = best_scores(blobs), cube_best = best_scores(cubes);
+    same_best += blob_best == cube_best;
+    for (size_t c = 0; c < blob_best.size(); c++) lower_best += blob_best[c] < cube_best[c];
+    same_count += blobs.size() == cubes.size();
+    blob_boxes += blobs.size();
+    cube_boxes += cubes.size();
+    if (opt_verbose || !ok) {
+      printf("  #%zu blobs=%zu cubes=%zu%s\n", f, blobs.size(), cubes.size(), ok ? "" : "  MISMATCH vs flood fill");
+    }
+  }
+
+  double blob_allocs = 0, cube_allocs = 0;
+  const double cube_us = time_path(&process_fomo_i8_cubes, maps, &cube_allocs);
+  const double blob_us = time_path(&process_fomo_i8_blobs, maps, &blob_allocs);
+
+  const int n = (int)maps.size();
+  printf("%d %ux%u maps (%s), %u label(s), threshold %.2f -> q >= %d\n", n, map_w, map_h,
+         opt_maps ? opt_maps : "synthetic", impulse->label_count, fomo->threshold, q_threshold());
+  printf("  %-6s %9s %12s %9s\n", "path", "us/frame", "allocs/frame", "boxes");
+  printf("  %-6s %9.3f %12.2f %9zu\n", "cubes", cube_us, cube_allocs, cube_boxes);
+  printf("  %-6s %9.3f %12.2f %9zu\n", "blobs", blob_us, blob_allocs, blob_boxes);
+  printf("  speedup %.2fx\n", cube_us / blob_us);
+  printf("  blobs vs flood fill: %d/%d frames differ, %d with bad padding\n", wrong, n, unpadded);
+  printf("  blobs vs cubes: %d identical, %d same best score, %d same box count, %d lower best score\n",
+         identical, same_best, same_count, lower_best);
+  return (wrong || unpadded || lower_best) ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * Frame quality gate: camera wake-ups with and without the gate
+ *
+ * Builds the camera's real camera_ei.cpp and frame_gate.cpp against the
+ * simulated esp32-camera (esp_now_sim/esp_camera_sim.cpp) and runs one
+ * camera session per scenario, once with frame_gate_check() in front of
+ * inference as in main.cpp and once without. The sensor free-runs at
+ * --fps and its auto exposure restarts off target on every init; each frame
+ * that passes costs --infer-ms (FOMO), a dropped one only its capture.
+ *
+ * Per scenario and mode: time from camera on to the first frame passed to
+ * inference, time until the simulated exposure is within 10 % of its
+ * converged value, frames dropped, frames passed while the exposure was
+ * still off or the scene unusable ("bad in"), usable settled frames
+ * dropped ("good out"), inference runs, camera-on time (the session ends
+ * early once the gate flags the scene) and the gate's last verdict.
+ *
+ * Scenarios: day wakes over- and under-exposed, dusk (high gain, noisy),
+ * night (gain runs out: dark), a fouled lens (blurred) and a sensor that
+ * wakes converged.
+ *
+ * Usage: gate_bench [--fps F] [--infer-ms MS] [--window-ms MS] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#include "camera_ei.h"
+#include "frame_gate.h"
+
+// =================== CONFIGURATION ===================
+static float    opt_fps       = 25.0f;
+static uint32_t opt_infer_ms  = 150;
+static uint32_t opt_window_ms = ACTIVE_WINDOW_MS;
+static bool     opt_verbose   = false;
+
+static const int W = EI_CLASSIFIER_INPUT_WIDTH;
+static const int H = EI_CLASSIFIER_INPUT_HEIGHT;
+
+// =================== SCENE ===================
+static float scene_light = 1.0f;
+
+// Asphalt with texture, painted bay lines and a parked car, times the light
+static uint8_t scene(float u, float v) {
+  float g = 95 + 25 * sinf(u * 57.0f) * sinf(v * 43.0f) + 12 * sinf((u + v) * 131.0f);
+  if (fabsf(u - 0.15f) < 0.012f || fabsf(u - 0.5f) < 0.012f || fabsf(u - 0.85f) < 0.012f) g = 215;
+  if (u > 0.2f && u < 0.45f && v > 0.3f && v < 0.8f) {
+    g = (v < 0.45f || (u > 0.25f && u < 0.4f && v > 0.6f && v < 0.7f)) ? 160 : 45;
+  }
+  return (uint8_t)std::min(255.0f, g * scene_light);
+}
+
+typedef struct {
+  const char* name;
+  float aec_start;     // gain after init, x converged
+  float light;
+  int blur;            // frame pixels
+  float noise;         // gray levels at gain 1
+  bool usable;
+} scenario_t;
+
+typedef struct {
+  uint32_t first_valid_ms;   // 0 = none
+  uint32_t settled_ms;       // 0 = never
+  uint32_t frames, dropped, bad_in, good_out, inferences;
+  uint32_t on_ms;
+  gate_verdict_t last;
+  bool flagged;
+} pass_t;
+
+// =================== SESSION ===================
+static void run_pass(const scenario_t& sc, bool gate, pass_t& pass) {
+  memset(&pass, 0, sizeof(pass));
+  scene_light = sc.light;
+  cam_sim_set_aec(sc.aec_start);
+  cam_sim_set_blur(sc.blur);
+  cam_sim_set_noise(sc.noise);
+  cam_sim_set_fps(opt_fps);
+  gate_enabled = gate;
+
+  if (!ei_camera_init()) {
+    fprintf(stderr, "%s: camera init failed\n", sc.name);
+    exit(1);
+  }
+  const uint32_t t0 = millis();
+  frame_gate_begin();
+  while (millis() - t0 < opt_window_ms) {
+    if (!ei_camera_capture()) break;
+    const uint32_t at = millis() - t0;
+    const bool settled = fabsf(cam_sim_exposure_error() - 1.0f) <= 0.1f;
+    if (settled && !pass.settled_ms) pass.settled_ms = std::max(1u, at);
+    const bool good = sc.usable && settled;
+
+    pass.frames++;
+    const bool in = frame_gate_check(ei_input_gray);
+    if (opt_verbose && gate) {
+      printf("    %6u ms  exposure x%.2f  mean %3u spread %3u sharp %3u  %s\n", at,
+             cam_sim_exposure_error(), gate_last_mean, gate_last_spread, gate_last_sharp,
+             in ? "in" : frame_gate_verdict_name(gate_last));
+    }
+    if (!in) {
+      pass.dropped++;
+      if (good) pass.good_out++;
+      if (frame_gate_bad_scene()) {
+        pass.flagged = true;
+        break;   // main.cpp ends the window
+      }
+      continue;
+    }
+    if (!pass.first_valid_ms) pass.first_valid_ms = std::max(1u, at);
+    if (!good) pass.bad_in++;
+    pass.inferences++;
+    delay(opt_infer_ms);
+  }
+  pass.on_ms = millis() - t0;
+  pass.last = gate_last;
+  ei_camera_deinit();
+  frame_gate_end();
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--fps" && i + 1 < argc) {
+      opt_fps = std::max(1.0f, (float)atof(argv[++i]));
+    } else if (a == "--infer-ms" && i + 1 < argc) {
+      opt_infer_ms = (uint32_t)atoi(argv[++i]);
+    } else if (a == "--window-ms" && i + 1 < argc) {
+      opt_window_ms = std::max(100, atoi(argv[++i]));
+    } else if (a == "-v") {
+      opt_verbose = true;
+    } else {
+      fprintf(stderr, "usage: gate_bench [--fps F] [--infer-ms MS] [--window-ms MS] [-v]\n");
+      exit(2);
+    }
+  }
+}
+
+static std::string ms_or_dash(uint32_t ms) {
+  char buf[16];
+  if (!ms) return "-";
+  snprintf(buf, sizeof(buf), "%u", ms);
+  return buf;
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_set_verbose(opt_verbose);
+  cam_sim_set_scene(&scene);
+  cam_roi = cam_roi_t{ 0, 0, 0, 0 };
+  ei_input_gray = (uint8_t*)malloc((size_t)W * H);
+
+  const scenario_t scenarios[] = {
+    { "day, wakes bright", 4.0f, 1.0f, 0, 1.0f, true },
+    { "day, wakes dark", 0.25f, 1.0f, 0, 1.0f, true },
+    { "dusk", 3.0f, 0.12f, 0, 1.0f, true },
+    { "night", 3.0f, 0.015f, 0, 1.0f, false },
+    { "fouled lens", 4.0f, 1.0f, 4, 1.0f, false },
+    { "wakes converged", 1.0f, 1.0f, 0, 1.0f, true },
+  };
+  printf("sensor %.0f fps, inference %u ms, window %u ms\n", opt_fps, opt_infer_ms, opt_window_ms);
+  printf("  %-18s %-4s %8s %8s %7s %7s %7s %7s %6s %6s  %s\n", "scenario", "gate", "valid ms",
+         "AEC ms", "frames", "dropped", "bad in", "good out", "runs", "on s", "last verdict");
+  for (const scenario_t& sc : scenarios) {
+    for (int gate = 0; gate <= 1; gate++) {
+      pass_t pass;
+      run_pass(sc, gate != 0, pass);
+      std::string verdict = gate ? frame_gate_verdict_name(pass.last) : "-";
+      if (pass.flagged) verdict += ", unusable";
+      printf("  %-18s %-4s %8s %8s %7u %7u %7u %7u %6u %6.1f  %s\n", gate ? "" : sc.name,
+             gate ? "on" : "off", ms_or_dash(pass.first_valid_ms).c_str(),
+             ms_or_dash(pass.settled_ms).c_str(), pass.frames, pass.dropped, pass.bad_in,
+             pass.good_out, pass.inferences, pass.on_ms / 1000.0, verdict.c_str());
+    }
+  }
+  free(ei_input_gray);
+  return 0;
+}
@@ -0,0 +1,251 @@
+/*
+ * Image DSP: specialized feature extractors against the original loop
+ *
+ * Times every variant of extract_image_features_t<>() (float output) and
+ * extract_image_features_quantized_t<>() (int8 output): 1 or 3 channels,
+ * read as packed RGB888 or packed R=G=B through get_data(), or as gray bytes
+ * from signal.gray_u8. The baseline is the loop the SDK shipped before:
+ * strcmp on the channel name every call, a heap-allocated 1024-float page
+ * per chunk and the full RGB to luma math per pixel.
+ *
+ * Per variant it reports us per 96x96 frame (best of several passes),
+ * ei_malloc / ei_calloc calls per frame and values that differ from the
+ * baseline on the same frames (RGB888 on colour frames, the gray sources on
+ * gray frames). Every variant must match the baseline bit for bit.
+ *
+ * int8 runs use the model's input quantization (scale 1/255, zero point
+ * -128, no scaling: the integer fast path) and TORCH scaling (float path).
+ *
+ * Usage: image_dsp_bench [--frames N] [--seed S]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+extern unsigned long ei_host_heap_allocs;   // ei_host/ei_porting_host.cpp
+
+// =================== CONFIGURATION ===================
+static int      opt_frames = 200;
+static uint32_t opt_seed   = 1;
+
+static const int RUNS = 5;   // timing passes, best kept
+static const int PIXELS = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
+
+// =================== FRAMES ===================
+static std::vector<uint32_t> rgb_frames, gray_frames;   // packed 0xRRGGBB
+static std::vector<uint8_t>  gray_bytes;                // same gray frames, one byte per pixel
+static const uint32_t* cur_px = nullptr;
+
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+
+static void make_frames() {
+  rng_state = opt_seed;
+  rgb_frames.resize((size_t)opt_frames * PIXELS);
+  gray_frames.resize(rgb_frames.size());
+  gray_bytes.resize(rgb_frames.size());
+  for (size_t i = 0; i < rgb_frames.size(); i++) {
+    rgb_frames[i] = rng() & 0xffffff;
+    const uint32_t g = rng() & 0xff;
+    gray_frames[i] = (g << 16) | (g << 8) | g;
+    gray_bytes[i] = (uint8_t)g;
+  }
+}
+
+static int get_frame_data(size_t offset, size_t length, float* out_ptr) {
+  for (size_t i = 0; i < length; i++) out_ptr[i] = (float)cur_px[offset + i];
+  return 0;
+}
+
+// =================== BASELINE ===================
+// The SDK's extract_image_features() / _quantized() before specialization
+static ei_dsp_config_image_t config_gray, config_rgb;
+static float q_scale, q_zero_point;
+static int q_scaling;
+
+static int legacy_float(signal_t* signal, void* out_ptr, void* config_ptr) {
+  ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
+  float* out = (float*)out_ptr;
+  int16_t channel_count = strcmp(config.channels, "Grayscale") == 0 ? 1 : 3;
+  size_t output_ix = 0;
+  const size_t page_size = 1024;
+  size_t bytes_left = signal->total_length;
+  for (size_t ix = 0; ix < signal->total_length; ix += page_size) {
+    size_t elements_to_read = bytes_left > page_size ? page_size : bytes_left;
+    ei::matrix_t input_matrix(elements_to_read, config.axes);
+    if (!input_matrix.buffer) return ei::EIDSP_OUT_OF_MEM;
+    signal->get_data(ix, elements_to_read, input_matrix.buffer);
+    for (size_t jx = 0; jx < elements_to_read; jx++) {
+      uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
+      float r = static_cast<float>(pixel >> 16 & 0xff) / 255.0f;
+      float g = static_cast<float>(pixel >> 8 & 0xff) / 255.0f;
+      float b = static_cast<float>(pixel & 0xff) / 255.0f;
+      if (channel_count == 3) {
+        out[output_ix++] = r;
+        out[output_ix++] = g;
+        out[output_ix++] = b;
+      } else {
+        out[output_ix++] = (0.299f * r) + (0.587f * g) + (0.114f * b);
+      }
+    }
+    bytes_left -= elements_to_read;
+  }
+  return ei::EIDSP_OK;
+}
+
+static int legacy_i8(signal_t* signal, void* out_ptr, void* config_ptr) {
+  ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
+  int8_t* out = (int8_t*)out_ptr;
+  int16_t channel_count = strcmp(config.channels, "Grayscale") == 0 ? 1 : 3;
+  size_t output_ix = 0;
+  const size_t page_size = 1024;
+  size_t bytes_left = signal->total_length;
+  for (size_t ix = 0; ix < signal->total_length; ix += page_size) {
+    size_t elements_to_read = bytes_left > page_size ? page_size : bytes_left;
+    ei::matrix_t input_matrix(elements_to_read, config.axes);
+    if (!input_matrix.buffer) return ei::EIDSP_OUT_OF_MEM;
+    signal->get_data(ix, elements_to_read, input_matrix.buffer);
+    for (size_t jx = 0; jx < elements_to_read; jx++) {
+      uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
+      output_ix += quantize_image_pixel(pixel, channel_count, q_scale, q_zero_point, q_scaling, &out[output_ix]);
+    }
+    bytes_left -= elements_to_read;
+  }
+  return ei::EIDSP_OK;
+}
+
+// =================== VARIANTS ===================
+template<int C, ei_image_src_t S>
+static int run_float(signal_t* signal, void* out, void*) {
+  return extract_image_features_t<C, S>(signal, (float*)out);
+}
+
+template<int C, ei_image_src_t S>
+static int run_i8(signal_t* signal, void* out, void*) {
+  return extract_image_features_quantized_t<C, S>(signal, (int8_t*)out, q_scale, q_zero_point, q_scaling);
+}
+
+typedef int (*image_fn_t)(signal_t*, void*, void*);
+
+typedef struct {
+  const char*    name;
+  ei_image_src_t src;
+  image_fn_t     fn;
+} variant_t;
+
+typedef struct {
+  double us;          // per frame, best pass
+  double allocs;      // per frame
+  long differ;        // values, against the baseline
+} result_t;
+
+// One pass per run over all frames; outputs of the last pass kept in out
+static result_t run_variant(image_fn_t fn, ei_image_src_t src, int channels, size_t value_size,
+                            void* config, std::vector<uint8_t>& out) {
+  const size_t frame_bytes = (size_t)PIXELS * channels * value_size;
+  out.assign(frame_bytes * opt_frames, 0);
+  signal_t signal;
+  signal.total_length = PIXELS;
+  signal.get_data = &get_frame_data;
+
+  result_t r = { 1e30, 0, 0 };
+  for (int run = 0; run < RUNS; run++) {
+    const unsigned long heap0 = ei_host_heap_allocs;
+    const uint64_t t0 = ei_read_timer_us();
+    for (int f = 0; f < opt_frames; f++) {
+      const size_t px = (size_t)f * PIXELS;
+      cur_px = (src == EI_IMAGE_SRC_RGB888 ? rgb_frames.data() : gray_frames.data()) + px;
+      signal.gray_u8 = src == EI_IMAGE_SRC_GRAY8 ? gray_bytes.data() + px : nullptr;
+      if (fn(&signal, out.data() + f * frame_bytes, config) != ei::EIDSP_OK) {
+        fprintf(stderr, "extract failed on frame %d\n", f);
+        exit(1);
+      }
+    }
+    r.us = std::min(r.us, (double)(ei_read_timer_us() - t0) / opt_frames);
+    r.allocs = (double)(ei_host_heap_allocs - heap0) / opt_frames;
+  }
+  return r;
+}
+
+// Baseline (on colour and on gray frames) and the three sources for one
+// output type and channel count; returns values that differ
+static long run_group(const char* title, int channels, size_t value_size, image_fn_t legacy,
+                      const variant_t* variants) {
+  void* config = channels == 1 ? &config_gray : &config_rgb;
+  std::vector<uint8_t> ref_rgb, ref_gray, out;
+  const result_t base = run_variant(legacy, EI_IMAGE_SRC_RGB888, channels, value_size, config, ref_rgb);
+  run_variant(legacy, EI_IMAGE_SRC_GRAY888, channels, value_size, config, ref_gray);
+
+  printf("  %s\n", title);
+  printf("    %-26s %9.1f %8.1f %9s\n", "baseline (strcmp, heap)", base.us, base.allocs, "-");
+  long differ = 0;
+  for (int v = 0; v < 3; v++) {
+    result_t r = run_variant(variants[v].fn, variants[v].src, channels, value_size, config, out);
+    const std::vector<uint8_t>& ref = variants[v].src == EI_IMAGE_SRC_RGB888 ? ref_rgb : ref_gray;
+    for (size_t i = 0; i < out.size(); i += value_size) r.differ += memcmp(&out[i], &ref[i], value_size) != 0;
+    printf("    %-26s %9.1f %8.1f %9ld %7.1fx\n", variants[v].name, r.us, r.allocs, r.differ, base.us / r.us);
+    differ += r.differ;
+  }
+  return differ;
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc) opt_frames = std::max(1, atoi(argv[++i]));
+    else if (a == "--seed" && i + 1 < argc)   opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else {
+      fprintf(stderr, "usage: image_dsp_bench [--frames N] [--seed S]\n");
+      exit(2);
+    }
+  }
+}
+
+#define VARIANTS(run, C) {                                                  \
+    { "RGB888 via get_data",  EI_IMAGE_SRC_RGB888,  &run<C, EI_IMAGE_SRC_RGB888> },  \
+    { "GRAY888 via get_data", EI_IMAGE_SRC_GRAY888, &run<C, EI_IMAGE_SRC_GRAY888> }, \
+    { "GRAY8 bytes",          EI_IMAGE_SRC_GRAY8,   &run<C, EI_IMAGE_SRC_GRAY8> } }
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  make_frames();
+  config_gray = *(ei_dsp_config_image_t*)ei_default_impulse.impulse->dsp_blocks[0].config;
+  config_rgb = config_gray;
+  config_gray.channels = "Grayscale";
+  config_rgb.channels = "RGB";
+
+  const variant_t float1[3] = VARIANTS(run_float, 1), float3[3] = VARIANTS(run_float, 3);
+  const variant_t i8_1[3] = VARIANTS(run_i8, 1), i8_3[3] = VARIANTS(run_i8, 3);
+
+  printf("%d frames %dx%d, page %d floats\n", opt_frames, EI_CLASSIFIER_INPUT_WIDTH,
+         EI_CLASSIFIER_INPUT_HEIGHT, EI_DSP_IMAGE_BUFFER_STATIC_SIZE);
+  printf("    %-26s %9s %8s %9s %8s\n", "variant", "us/frame", "allocs", "differ", "speedup");
+  long differ = 0;
+  differ += run_group("float, 1 channel (luma)", 1, sizeof(float), &legacy_float, float1);
+  differ += run_group("float, 3 channels", 3, sizeof(float), &legacy_float, float3);
+
+  q_scale = 0.003921568859368563f;
+  q_zero_point = -128;
+  q_scaling = EI_CLASSIFIER_IMAGE_SCALING_NONE;
+  differ += run_group("int8 1/255 -128, 1 channel", 1, 1, &legacy_i8, i8_1);
+  differ += run_group("int8 1/255 -128, 3 channels", 3, 1, &legacy_i8, i8_3);
+
+  q_scale = 0.02f;
+  q_zero_point = -10;
+  q_scaling = EI_CLASSIFIER_IMAGE_SCALING_TORCH;
+  differ += run_group("int8 TORCH, 1 channel", 1, 1, &legacy_i8, i8_1);
+  differ += run_group("int8 TORCH, 3 channels", 3, 1, &legacy_i8, i8_3);
+
+  printf("%ld values differ from the baseline\n", differ);
+  return differ ? 1 : 0;
+}
@@ -0,0 +1,411 @@
+/*
+ * x86 int8 kernel benchmark for the camera's EON model
+ *
+ * The host build of the EI SDK runs the TFLM reference kernels, with the
+ * SSE4.1 / AVX2 kernels of kernels/x86_int8.h in front of them (picked from
+ * CPUID). This tool checks and times them two ways:
+ *
+ *   kernels   every distinct CONV_2D / DEPTHWISE_CONV_2D / ADD shape of
+ *             tflite_learn_3, random data and requantization parameters,
+ *             reference kernel against each ISA the CPU has; outputs must
+ *             match byte for byte
+ *   replay    the full model over the same frames per ISA, stem node by node
+ *             and tiled; the logits (node 23) and the softmax output must
+ *             match the scalar node-by-node run byte for byte
+ *
+ * Times are the best of five timed batches (the host is shared and noisy).
+ *
+ * Usage: kernel_bench [--frames N] [--seed S]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/x86_int8.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+
+using tflite::x86_int8::Isa;
+
+// =================== CONFIGURATION ===================
+static int      opt_frames = 100;
+static uint32_t opt_seed   = 1;
+
+static const int BATCHES = 5;
+static const uint64_t BATCH_US = 20000;   // each timed batch runs at least this long
+static const size_t LOGITS_NODE = 23;     // last CONV_2D, feeds the softmax
+
+// =================== MODEL SHAPES ===================
+typedef enum { OP_CONV, OP_DW, OP_ADD } op_t;
+
+typedef struct {
+  op_t        op;
+  const char* nodes;
+  int         h, w, c;     // input
+  int         out_c;       // CONV_2D only
+  int         k, stride;
+  bool        same;
+} shape_t;
+
+// Distinct shapes of tflite_learn_3 (NHWC, batch 1), node numbers as profiled
+static const shape_t shapes[] = {
+  { OP_CONV, "0",        96, 96,  1, 16, 3, 2, true  },
+  { OP_DW,   "1",        48, 48, 16,  0, 3, 1, true  },
+  { OP_CONV, "2",        48, 48, 16,  8, 1, 1, true  },
+  { OP_CONV, "3",        48, 48,  8, 48, 1, 1, true  },
+  { OP_DW,   "4",        48, 48, 48,  0, 3, 2, true  },
+  { OP_CONV, "5 8",      24, 24, 48,  8, 1, 1, true  },
+  { OP_CONV, "6 10",     24, 24,  8, 48, 1, 1, true  },
+  { OP_DW,   "7",        24, 24, 48,  0, 3, 1, true  },
+  { OP_ADD,  "9",        24, 24,  8,  0, 0, 0, false },
+  { OP_DW,   "11",       24, 24, 48,  0, 3, 2, true  },
+  { OP_CONV, "12",       12, 12, 48, 16, 1, 1, true  },
+  { OP_CONV, "13 17 21", 12, 12, 16, 96, 1, 1, true  },
+  { OP_DW,   "14 18",    12, 12, 96,  0, 3, 1, true  },
+  { OP_CONV, "15 19",    12, 12, 96, 16, 1, 1, true  },
+  { OP_ADD,  "16 20",    12, 12, 16,  0, 0, 0, false },
+  { OP_CONV, "22",       12, 12, 96, 32, 1, 1, false },
+  { OP_CONV, "23",       12, 12, 32,  2, 1, 1, false },
+};
+static const int N_SHAPES = sizeof(shapes) / sizeof(shapes[0]);
+
+// =================== RANDOM DATA ===================
+static uint32_t rng_state = 1;
+static uint32_t rng() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return rng_state >> 8;
+}
+static int rand_in(int lo, int hi) { return lo + (int)(rng() % (uint32_t)(hi - lo + 1)); }
+
+static void fill_int8(std::vector<int8_t>& v, size_t n) {
+  v.resize(n);
+  for (auto& x : v) x = (int8_t)(rng() & 0xFF);
+}
+
+// Quantized multiplier in [2^30, 2^31) with a shift around what the export uses
+static void rand_requant(int32_t* mult, int32_t* shift) {
+  *mult = (int32_t)((1u << 30) + (rng() << 6) % (1u << 30));
+  *shift = rand_in(-10, 1);
+}
+
+// =================== KERNEL RUNS ===================
+typedef struct {
+  tflite::ConvParams conv;
+  tflite::DepthwiseParams dw;
+  tflite::ArithmeticParams add;
+  tflite::RuntimeShape in_shape, filter_shape, bias_shape, out_shape;
+  std::vector<int8_t> in, in2, filter;
+  std::vector<int32_t> bias, mult, shift;
+  size_t out_bytes;
+  uint64_t macs;
+} case_t;
+
+static void set_shape(tflite::RuntimeShape& shape, int b, int h, int w, int c) {
+  const int32_t dims[4] = {b, h, w, c};
+  shape.ReplaceWith(4, dims);
+}
+
+static int out_dim(int in, int k, int stride, bool same) {
+  return same ? (in + stride - 1) / stride : (in - k) / stride + 1;
+}
+
+static int pad_before(int in, int out, int k, int stride) {
+  return std::max((out - 1) * stride + k - in, 0) / 2;
+}
+
+static void make_case(const shape_t& s, case_t& t) {
+  const int oh = s.op == OP_ADD ? s.h : out_dim(s.h, s.k, s.stride, s.same);
+  const int ow = s.op == OP_ADD ? s.w : out_dim(s.w, s.k, s.stride, s.same);
+  const int oc = s.op == OP_CONV ? s.out_c : s.c;
+  set_shape(t.in_shape, 1, s.h, s.w, s.c);
+  set_shape(t.out_shape, 1, oh, ow, oc);
+  t.out_bytes = (size_t)oh * ow * oc;
+  fill_int8(t.in, (size_t)s.h * s.w * s.c);
+
+  const int32_t in_offset = rand_in(-127, 128), out_offset = rand_in(-128, 127);
+  const bool relu6 = rng() % 2;
+  const int32_t act_min = relu6 ? std::max(-128, out_offset) : -128;
+  const int32_t act_max = relu6 ? std::min(127, out_offset + rand_in(20, 200)) : 127;
+
+  if (s.op == OP_ADD) {
+    fill_int8(t.in2, t.in.size());
+    tflite::ArithmeticParams& p = t.add;
+    p = tflite::ArithmeticParams();
+    p.left_shift = 20;
+    p.input1_offset = rand_in(-127, 128);
+    p.input2_offset = rand_in(-127, 128);
+    p.output_offset = out_offset;
+    int32_t shift;
+    rand_requant(&p.input1_multiplier, &shift);
+    p.input1_shift = rand_in(-3, 0);
+    rand_requant(&p.input2_multiplier, &shift);
+    p.input2_shift = rand_in(-3, 0);
+    rand_requant(&p.output_multiplier, &shift);
+    p.output_shift = rand_in(-22, -18);
+    p.quantized_activation_min = act_min;
+    p.quantized_activation_max = act_max;
+    t.macs = t.out_bytes;
+    return;
+  }
+
+  const int in_c = s.op == OP_CONV ? s.c : 1;
+  set_shape(t.filter_shape, s.op == OP_CONV ? oc : 1, s.k, s.k, s.op == OP_CONV ? in_c : oc);
+  const int32_t bias_dims[1] = {oc};
+  t.bias_shape.ReplaceWith(1, bias_dims);
+  fill_int8(t.filter, (size_t)oc * s.k * s.k * in_c);
+  t.bias.resize(oc);
+  t.mult.resize(oc);
+  t.shift.resize(oc);
+  for (int c = 0; c < oc; c++) {
+    t.bias[c] = rand_in(-20000, 20000);
+    rand_requant(&t.mult[c], &t.shift[c]);
+  }
+  t.macs = (uint64_t)t.out_bytes * s.k * s.k * in_c;
+
+  tflite::PaddingValues pad = {};
+  pad.height = (int16_t)pad_before(s.h, oh, s.k, s.stride);
+  pad.width = (int16_t)pad_before(s.w, ow, s.k, s.stride);
+  if (s.op == OP_CONV) {
+    tflite::ConvParams& p = t.conv;
+    p = tflite::ConvParams();
+    p.padding_values = pad;
+    p.stride_width = p.stride_height = (int16_t)s.stride;
+    p.dilation_width_factor = p.dilation_height_factor = 1;
+    p.input_offset = in_offset;
+    p.output_offset = out_offset;
+    p.quantized_activation_min = act_min;
+    p.quantized_activation_max = act_max;
+  } else {
+    tflite::DepthwiseParams& p = t.dw;
+    p = tflite::DepthwiseParams();
+    p.padding_values = pad;
+    p.stride_width = p.stride_height = (int16_t)s.stride;
+    p.dilation_width_factor = p.dilation_height_factor = 1;
+    p.depth_multiplier = 1;
+    p.input_offset = in_offset;
+    p.output_offset = out_offset;
+    p.quantized_activation_min = act_min;
+    p.quantized_activation_max = act_max;
+  }
+}
+
+// One call of the reference kernel (isa == kScalar) or the x86 kernel
+static bool run_case(const shape_t& s, case_t& t, Isa isa, int8_t* out) {
+  if (isa == tflite::x86_int8::kScalar) {
+    switch (s.op) {
+      case OP_CONV:
+        tflite::reference_integer_ops::ConvPerChannel(
+            t.conv, t.mult.data(), t.shift.data(), t.in_shape, t.in.data(), t.filter_shape,
+            t.filter.data(), t.bias_shape, t.bias.data(), t.out_shape, out);
+        return true;
+      case OP_DW:
+        tflite::reference_integer_ops::DepthwiseConvPerChannel(
+            t.dw, t.mult.data(), t.shift.data(), t.in_shape, t.in.data(), t.filter_shape,
+            t.filter.data(), t.bias_shape, t.bias.data(), t.out_shape, out);
+        return true;
+      default:
+        tflite::reference_integer_ops::AddElementwise((int)t.out_bytes, t.add, t.in.data(),
+                                                      t.in2.data(), out);
+        return true;
+    }
+  }
+  tflite::x86_int8::SetIsa(isa);
+  switch (s.op) {
+    case OP_CONV:
+      return tflite::x86_int8::ConvPerChannel(
+          t.conv, t.mult.data(), t.shift.data(), t.in_shape, t.in.data(), t.filter_shape,
+          t.filter.data(), t.bias_shape, t.bias.data(), t.out_shape, out);
+    case OP_DW:
+      return tflite::x86_int8::DepthwiseConvPerChannel(
+          t.dw, t.mult.data(), t.shift.data(), t.in_shape, t.in.data(), t.filter_shape,
+          t.filter.data(), t.bias_shape, t.bias.data(), t.out_shape, out);
+    default:
+      return tflite::x86_int8::AddElementwise((int)t.out_bytes, t.add, t.in.data(),
+                                              t.in2.data(), out);
+  }
+}
+
+// Best per-call time over BATCHES batches, microseconds
+static double time_case(const shape_t& s, case_t& t, Isa isa, int8_t* out) {
+  double best = 1e30;
+  for (int b = 0; b < BATCHES; b++) {
+    int calls = 0;
+    const uint64_t t0 = ei_read_timer_us();
+    uint64_t elapsed;
+    do {
+      run_case(s, t, isa, out);
+      calls++;
+      elapsed = ei_read_timer_us() - t0;
+    } while (elapsed < BATCH_US / BATCHES);
+    best = std::min(best, (double)elapsed / calls);
+  }
+  return best;
+}
+
+static const char* op_name(op_t op) {
+  return op == OP_CONV ? "CONV_2D" : op == OP_DW ? "DEPTHWISE" : "ADD";
+}
+
+static int bench_kernels(const std::vector<Isa>& isas) {
+  printf("\n=== int8 kernels, tflite_learn_3 shapes ===\n");
+  printf("  %-9s %-9s %-15s %4s %8s %9s", "op", "nodes", "input", "k/s", "out_c", "ref us");
+  for (size_t i = 1; i < isas.size(); i++) printf(" %8s us %6s", tflite::x86_int8::IsaName(isas[i]), "x");
+  printf("\n");
+
+  int mismatched = 0;
+  for (int i = 0; i < N_SHAPES; i++) {
+    const shape_t& s = shapes[i];
+    case_t t;
+    make_case(s, t);
+    std::vector<int8_t> ref(t.out_bytes), out(t.out_bytes);
+    run_case(s, t, tflite::x86_int8::kScalar, ref.data());
+    const double ref_us = time_case(s, t, tflite::x86_int8::kScalar, ref.data());
+
+    char dims[32], ks[8];
+    snprintf(dims, sizeof(dims), "%dx%dx%d", s.h, s.w, s.c);
+    snprintf(ks, sizeof(ks), s.op == OP_ADD ? "-" : "%d/%d", s.k, s.stride);
+    printf("  %-9s %-9s %-15s %4s %8d %9.1f", op_name(s.op), s.nodes, dims, ks,
+           s.op == OP_ADD ? s.c : (int)t.out_shape.Dims(3), ref_us);
+    for (size_t j = 1; j < isas.size(); j++) {
+      std::fill(out.begin(), out.end(), 0x55);
+      if (!run_case(s, t, isas[j], out.data())) {
+        printf(" %11s %6s", "n/a", "");
+        continue;
+      }
+      const bool same = out == ref;
+      const double us = time_case(s, t, isas[j], out.data());
+      printf(" %11.1f %5.1fx%s", us, ref_us / us, same ? "" : " DIFF");
+      mismatched += !same;
+    }
+    printf("\n");
+  }
+  return mismatched;
+}
+
+// =================== FULL MODEL REPLAY ===================
+static void* arena_alloc(size_t align, size_t size) {
+  void* p = aligned_alloc(align, (size + align - 1) / align * align);
+  if (p) memset(p, 0, size);
+  return p;
+}
+
+// Noise frames alternating with gradients so the logits spread over many values
+static void make_frame(int f, int8_t* px, int n) {
+  if (f % 2 == 0) {
+    for (int i = 0; i < n; i++) px[i] = (int8_t)(rng() & 0xFF);
+  } else {
+    const int phase = rng() % 256;
+    for (int i = 0; i < n; i++) px[i] = (int8_t)(((i * 3 + phase) & 0xFF) - 128);
+  }
+}
+
+typedef struct {
+  std::vector<std::vector<int8_t>> logits, outputs;
+  double ms;
+} replay_t;
+
+static bool replay(bool tiled, Isa isa, replay_t& run) {
+  tflite::x86_int8::SetIsa(isa);
+  tflite_learn_3_set_tiled_stem(tiled);
+  if (tflite_learn_3_init(arena_alloc) != kTfLiteOk) return false;
+  TfLiteTensor in, out, logits;
+  tflite_learn_3_input(0, &in);
+  tflite_learn_3_output(0, &out);
+
+  rng_state = opt_seed;
+  run.logits.assign(opt_frames, std::vector<int8_t>());
+  run.outputs.assign(opt_frames, std::vector<int8_t>());
+  uint64_t best_us = UINT64_MAX;
+  for (int pass = 0; pass < 2; pass++) {   // first pass warms caches, both are checked
+    uint64_t total = 0;
+    for (int f = 0; f < opt_frames; f++) {
+      make_frame(f, (int8_t*)in.data.data, (int)in.bytes);
+      const uint64_t t0 = ei_read_timer_us();
+      const TfLiteStatus st = tflite_learn_3_invoke();
+      total += ei_read_timer_us() - t0;
+      if (st != kTfLiteOk || tflite_learn_3_node_output(LOGITS_NODE, &logits) != kTfLiteOk) {
+        tflite_learn_3_reset(free);
+        return false;
+      }
+      const int8_t* l = (const int8_t*)logits.data.data;
+      const int8_t* o = (const int8_t*)out.data.data;
+      if (pass == 0) {
+        run.logits[f].assign(l, l + logits.bytes);
+        run.outputs[f].assign(o, o + out.bytes);
+      } else if (run.logits[f] != std::vector<int8_t>(l, l + logits.bytes)) {
+        run.logits[f].clear();   // not even deterministic
+      }
+    }
+    rng_state = opt_seed;
+    best_us = std::min(best_us, total);
+  }
+  tflite_learn_3_reset(free);
+  run.ms = best_us / 1000.0 / opt_frames;
+  return true;
+}
+
+static int bench_replay(const std::vector<Isa>& isas) {
+  printf("\n=== full model replay, %d frames ===\n", opt_frames);
+  printf("  %-13s %-8s %9s %9s %8s  %s\n", "stem", "isa", "ms/frame", "frames/s", "speedup", "vs scalar node-by-node");
+
+  replay_t ref;
+  int mismatched = 0;
+  for (int tiled = 0; tiled < 2; tiled++) {
+    for (Isa isa : isas) {
+      replay_t run;
+      if (!replay(tiled, isa, run)) {
+        fprintf(stderr, "model init or invoke failed\n");
+        return -1;
+      }
+      if (!tiled && isa == tflite::x86_int8::kScalar) ref = run;
+      int differ = 0;
+      for (int f = 0; f < opt_frames; f++) {
+        differ += run.logits[f].empty() || run.logits[f] != ref.logits[f] ||
+                  run.outputs[f] != ref.outputs[f];
+      }
+      printf("  %-13s %-8s %9.3f %9.1f %7.2fx  %d/%d frames differ\n",
+             tiled ? "tiled" : "node-by-node", tflite::x86_int8::IsaName(isa), run.ms,
+             1000.0 / run.ms, ref.ms / run.ms, differ, opt_frames);
+      mismatched += differ;
+    }
+  }
+  return mismatched;
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if      (a == "--frames" && i + 1 < argc) opt_frames = atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc)   opt_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else {
+      fprintf(stderr, "usage: kernel_bench [--frames N] [--seed S]\n");
+      exit(2);
+    }
+  }
+  if (opt_frames < 1) opt_frames = 1;
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  const Isa best = tflite::x86_int8::DetectIsa();
+  std::vector<Isa> isas;
+  for (int i = tflite::x86_int8::kScalar; i <= best; i++) isas.push_back((Isa)i);
+  printf("CPU: %s (kernels for: %s)\n", tflite::x86_int8::IsaName(best),
+         best == tflite::x86_int8::kScalar ? "none, reference only" : "sse4.1, avx2");
+
+  rng_state = opt_seed;
+  const int kernel_diffs = bench_kernels(isas);
+  const int replay_diffs = bench_replay(isas);
+  tflite::x86_int8::SetIsa(best);
+
+  printf("\n  kernel shapes with differences: %d, replay frames with differences: %d\n",
+         kernel_diffs, std::max(replay_diffs, 0));
+  return (kernel_diffs || replay_diffs) ? 1 : 0;
+}
@@ -0,0 +1,624 @@
+/*
+ * Model blob: EON weights as a flash partition image, and what loading it costs
+ *
+ * Reads an EON-compiled model source (tflite_learn_3_compiled.cpp as Edge
+ * Impulse exports it) and packs its constant tensors, quantization arrays,
+ * tensor table (type, shape, arena plan) and node wiring into the blob the
+ * camera maps from its model_a / model_b partitions (lib/model_blob.h). The
+ * graph hash is computed from the source the same way the firmware computes
+ * it from the compiled graph, so a blob only binds to firmware built from
+ * the same graph.
+ *
+ * Then it runs the camera's real model_blob.cpp against two simulated
+ * partitions (esp_now_sim/partition_sim.cpp) and the host-built model:
+ *
+ *   parity     blob weights vs compiled weights, output tensor bit for bit
+ *              over the same frames, tiled and node-by-node stem
+ *   negatives  perturbed weights must change the output; a corrupt payload,
+ *              a blob for another graph and a write cut mid-install must be
+ *              refused, with the model left on the good slot
+ *   timing     install (flash erase + program at SPI NOR rates, virtual
+ *              clock) and switch (check + bind + model init, host time)
+ *              against reflashing the app image and rebooting
+ *
+ * Usage: model_blob [--out FILE] [--name S] [--seq N] [--app-bytes B] [--frames N] [source.cpp]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated.h"
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+#include "model_blob.h"
+
+// =================== CONFIGURATION ===================
+static const char* opt_source    = MODEL_SRC;
+static const char* opt_out       = nullptr;
+static std::string opt_name      = "tflite_learn_3";
+static uint32_t    opt_seq       = 1;
+static uint32_t    opt_app_bytes = 1100000;   // app image estimate (EI SDK + WiFi + camera driver)
+static int         opt_frames    = 8;
+
+static const uint32_t SLOT_BYTES = 0x10000;  // as in partitions_model.csv
+static const uint32_t BOOT_MS    = 3100;     // setup()'s fixed cold-boot delays
+
+// =================== SOURCE PARSER ===================
+typedef struct {
+  bool is_float;
+  std::vector<double> v;
+} src_array_t;
+
+typedef struct {
+  std::string scale, zero;
+  int qdim;
+} src_quant_t;
+
+typedef struct {
+  bool in_arena;
+  int type;
+  uint32_t offset;         // arena offset
+  std::string data;        // constant array name
+  std::string dims;
+  uint32_t bytes;
+  std::string quant;       // empty: not quantized
+} src_tensor_t;
+
+typedef struct {
+  int op;
+  std::string inputs, outputs;
+} src_node_t;
+
+static std::map<std::string, src_array_t> arrays;              // TfArray<N, int|float>
+static std::map<std::string, src_quant_t> quants;
+static std::map<std::string, std::vector<uint8_t>> constants;  // tensor_dataK, little endian
+static std::vector<src_tensor_t> src_tensors;
+static std::vector<src_node_t> src_nodes;
+static int32_t src_arena = 0;
+
+static std::string strip_comments(const std::string& s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s.compare(i, 2, "/*") == 0) {
+      const size_t end = s.find("*/", i + 2);
+      if (end == std::string::npos) break;
+      i = end + 1;
+    } else {
+      out += s[i];
+    }
+  }
+  return out;
+}
+
+// Innermost "{ ... }" list of a declaration, as numbers
+static std::vector<double> numbers(const std::string& stmt) {
+  const size_t close = stmt.rfind('}');
+  const size_t open = stmt.rfind('{', close - 1);
+  const size_t inner = stmt.rfind('}', close - 1);   // "{ n, { list } }": take the list
+  size_t from = open, to = close;
+  if (inner != std::string::npos && inner > stmt.find('=')) {
+    to = inner;
+    from = stmt.rfind('{', inner);
+  }
+  std::vector<double> v;
+  std::string list = stmt.substr(from + 1, to - from - 1);
+  for (char& c : list) {
+    if (c == ',') c = ' ';
+  }
+  std::istringstream in(list);
+  for (std::string tok; in >> tok;) v.push_back(strtod(tok.c_str(), nullptr));
+  return v;
+}
+
+static std::string strip_ns(std::string name) {
+  return name.rfind("g0::", 0) == 0 ? name.substr(4) : name;
+}
+
+static bool parse_decl(const std::string& stmt) {
+  static const std::regex arr_re("TfArray<\\s*\\d+\\s*,\\s*(int|float)\\s*>\\s+(\\w+)\\s*$");
+  static const std::regex quant_re("TfLiteAffineQuantization\\s+(\\w+)\\s*=\\s*\\{\\s*\\(TfLiteFloatArray\\*\\)&([\\w:]+)"
+                                   "\\s*,\\s*\\(TfLiteIntArray\\*\\)&([\\w:]+)\\s*,\\s*(\\d+)");
+  static const std::regex data_re("\\b(u?int8_t|int16_t|int32_t|float)\\s+(tensor_data\\w+)\\s*\\[");
+  const std::string head = stmt.substr(0, stmt.find('='));
+  std::smatch m;
+  if (std::regex_search(stmt, m, quant_re)) {
+    quants[m[1]] = { strip_ns(m[2]), strip_ns(m[3]), atoi(m[4].str().c_str()) };
+  } else if (std::regex_search(head.begin(), head.end(), m, data_re)) {
+    const std::string type = m[1], name = m[2];
+    std::vector<uint8_t>& out = constants[name];
+    for (double d : numbers(stmt)) {
+      uint8_t b[4];
+      size_t n = 1;
+      if (type == "float") {
+        const float f = (float)d;
+        memcpy(b, &f, 4);
+        n = 4;
+      } else {
+        const int32_t v = (int32_t)d;
+        memcpy(b, &v, 4);
+        n = type == "int32_t" ? 4 : type == "int16_t" ? 2 : 1;
+      }
+      out.insert(out.end(), b, b + n);
+    }
+  } else if (std::regex_search(head.begin(), head.end(), m, arr_re)) {
+    arrays[m[2]] = { m[1] == "float", numbers(stmt) };
+  }
+  return true;
+}
+
+static int type_code(const std::string& name) {
+  static const std::map<std::string, int> types = {
+    { "kTfLiteFloat32", kTfLiteFloat32 }, { "kTfLiteInt32", kTfLiteInt32 }, { "kTfLiteUInt8", kTfLiteUInt8 },
+    { "kTfLiteInt64", kTfLiteInt64 },     { "kTfLiteInt16", kTfLiteInt16 }, { "kTfLiteInt8", kTfLiteInt8 },
+    { "kTfLiteBool", kTfLiteBool },
+  };
+  auto it = types.find(name);
+  return it == types.end() ? -1 : it->second;
+}
+
+static int builtin_code(const std::string& op) {   // "OP_CONV_2D" -> BuiltinOperator_CONV_2D
+  const char* const* names = tflite::EnumNamesBuiltinOperator();
+  for (int i = tflite::BuiltinOperator_MIN; i <= tflite::BuiltinOperator_MAX; i++) {
+    if (names[i] && op == std::string("OP_") + names[i]) return i;
+  }
+  return -1;
+}
+
+static bool fail(const char* what, const std::string& detail = "") {
+  fprintf(stderr, "%s: %s%s%s\n", opt_source, what, detail.empty() ? "" : ": ", detail.c_str());
+  return false;
+}
+
+static bool parse_source() {
+  std::ifstream in(opt_source);
+  if (!in) return fail("cannot read");
+  std::stringstream ss;
+  ss << in.rdbuf();
+  const std::string text = ss.str();
+
+  // Declarations: everything in namespace g0 up to the tensor table
+  const size_t g0 = text.find("namespace g0 {");
+  const size_t table = text.find("TensorInfo_t tensorData[] = {");
+  if (g0 == std::string::npos || table == std::string::npos) return fail("not an EON model source");
+  const std::string decls = strip_comments(text.substr(g0 + 14, table - g0 - 14));
+  for (size_t at = 0;;) {
+    const size_t end = decls.find("};", at);
+    if (end == std::string::npos) break;
+    parse_decl(decls.substr(at, end + 1 - at));
+    at = end + 2;
+  }
+
+  // Tensor table rows
+  static const std::regex row_re("\\{\\s*(kTfLite\\w+)\\s*,\\s*(kTfLite\\w+)\\s*,\\s*\\(\\w+\\*\\)"
+                                 "(?:\\(tensor_arena \\+ (\\d+)\\)|([\\w:]+))\\s*,\\s*\\(TfLiteIntArray\\*\\)&([\\w:]+)"
+                                 "\\s*,\\s*(\\d+)\\s*,\\s*\\{\\s*(kTfLite\\w+)(?:.*&([\\w:]+)\\)\\))?");
+  std::istringstream rows(text.substr(table));
+  std::string line;
+  std::getline(rows, line);
+  while (std::getline(rows, line) && line.rfind("};", 0) != 0) {
+    std::smatch m;
+    if (!std::regex_search(line, m, row_re)) return fail("unreadable tensor row", line);
+    src_tensor_t t;
+    t.in_arena = m[1] == "kTfLiteArenaRw";
+    t.type = type_code(m[2]);
+    t.offset = m[3].matched ? (uint32_t)atol(m[3].str().c_str()) : 0;
+    t.data = m[4].matched ? strip_ns(m[4]) : "";
+    t.dims = strip_ns(m[5]);
+    t.bytes = (uint32_t)atol(m[6].str().c_str());
+    t.quant = m[7] == "kTfLiteAffineQuantization" ? strip_ns(m[8]) : "";
+    if (t.type < 0) return fail("unknown tensor type", m[2]);
+    if (!t.in_arena && m[1] != "kTfLiteMmapRo") return fail("unknown allocation", m[1]);
+    if (!arrays.count(t.dims)) return fail("missing shape", t.dims);
+    if (!t.quant.empty() && !quants.count(t.quant)) return fail("missing quantization", t.quant);
+    if (!t.in_arena && constants[t.data].size() != t.bytes) return fail("constant size differs", t.data);
+    src_tensors.push_back(t);
+  }
+
+  // Node wiring (the first variant of the table; both list the same arrays) and ops
+  const size_t nodes = text.find("TfLiteNode tflNodes[");
+  const size_t ops = text.find("used_operators_e used_ops[] =");
+  if (nodes == std::string::npos || ops == std::string::npos) return fail("no node table");
+  std::istringstream node_rows(text.substr(nodes, text.find("};", nodes) - nodes));
+  std::getline(node_rows, line);
+  static const std::regex node_re("&g0::(inputs\\d+)\\s*,\\s*\\(TfLiteIntArray\\*\\)&g0::(outputs\\d+)");
+  while (std::getline(node_rows, line)) {
+    std::smatch m;
+    if (!std::regex_search(line, m, node_re)) continue;
+    if (!arrays.count(m[1]) || !arrays.count(m[2])) return fail("missing node wiring", m[1]);
+    src_nodes.push_back({ -1, m[1], m[2] });
+  }
+  const std::string op_list = text.substr(ops, text.find("};", ops) - ops);
+  static const std::regex op_re("OP_\\w+");
+  size_t n = 0;
+  for (std::sregex_iterator it(op_list.begin(), op_list.end(), op_re), end; it != end; ++it, ++n) {
+    if (n >= src_nodes.size()) return fail("more ops than nodes");
+    src_nodes[n].op = builtin_code(it->str());
+    if (src_nodes[n].op < 0) return fail("unknown op", it->str());
+  }
+  if (n != src_nodes.size()) return fail("fewer ops than nodes");
+
+  // The arena size the build uses (the last variant)
+  const std::string key = "constexpr int kTensorArenaSize = ";
+  const size_t arena = text.rfind(key);
+  if (arena == std::string::npos) return fail("no kTensorArenaSize");
+  src_arena = atoi(text.c_str() + arena + key.size());
+  return true;
+}
+
+// As GraphHash() in the compiled model
+static void hash_word(uint32_t* h, int32_t v) {
+  for (int b = 0; b < 4; b++) *h = (*h ^ (((uint32_t)v >> (8 * b)) & 0xFF)) * 16777619u;
+}
+
+static uint32_t source_hash() {
+  uint32_t h = 2166136261u;
+  hash_word(&h, src_arena);
+  hash_word(&h, (int32_t)src_tensors.size());
+  for (const src_tensor_t& t : src_tensors) {
+    const src_array_t& dims = arrays[t.dims];
+    hash_word(&h, t.type);
+    hash_word(&h, t.in_arena);
+    hash_word(&h, (int32_t)t.bytes);
+    hash_word(&h, t.in_arena ? (int32_t)t.offset : 0);
+    hash_word(&h, (int32_t)dims.v.size());
+    for (double d : dims.v) hash_word(&h, (int32_t)d);
+  }
+  hash_word(&h, (int32_t)src_nodes.size());
+  for (const src_node_t& n : src_nodes) {
+    hash_word(&h, n.op);
+    for (const std::string& io : { n.inputs, n.outputs }) {
+      const src_array_t& a = arrays[io];
+      hash_word(&h, (int32_t)a.v.size());
+      for (double d : a.v) hash_word(&h, (int32_t)d);
+    }
+  }
+  return h;
+}
+
+// =================== BLOB ===================
+typedef struct {
+  std::vector<uint8_t> bytes;
+  uint32_t constant_bytes, quant_bytes;
+  size_t weight_at, weight_bytes;   // the largest constant
+} blob_t;
+
+static uint32_t append(std::vector<uint8_t>& b, const void* p, size_t n, size_t align) {
+  while (b.size() % align) b.push_back(0);
+  const uint32_t at = (uint32_t)b.size();
+  b.insert(b.end(), (const uint8_t*)p, (const uint8_t*)p + n);
+  return at;
+}
+
+static uint32_t append_array(std::vector<uint8_t>& b, const src_array_t& a) {
+  std::vector<uint8_t> out(4);
+  const int32_t n = (int32_t)a.v.size();
+  memcpy(out.data(), &n, 4);
+  for (double d : a.v) {
+    uint8_t w[4];
+    if (a.is_float) {
+      const float f = (float)d;
+      memcpy(w, &f, 4);
+    } else {
+      const int32_t v = (int32_t)d;
+      memcpy(w, &v, 4);
+    }
+    out.insert(out.end(), w, w + 4);
+  }
+  return append(b, out.data(), out.size(), 4);
+}
+
+static void seal(std::vector<uint8_t>& b) {
+  model_blob_header_t h;
+  memcpy(&h, b.data(), sizeof(h));
+  h.total_bytes = (uint32_t)b.size();
+  h.payload_crc = model_blob_crc32(b.data() + sizeof(h), b.size() - sizeof(h));
+  h.header_crc = model_blob_crc32(&h, offsetof(model_blob_header_t, header_crc));
+  memcpy(b.data(), &h, sizeof(h));
+}
+
+static bool build_blob(uint32_t graph_hash, blob_t& blob) {
+  if (src_tensors.size() > MODEL_BLOB_MAX_TENSORS) return fail("too many tensors for a blob");
+  std::vector<uint8_t>& b = blob.bytes;
+  b.assign(sizeof(model_blob_header_t), 0);
+  const uint32_t tensor_table = append(b, nullptr, 0, 16);
+  b.resize(tensor_table + src_tensors.size() * sizeof(model_blob_tensor_t));
+  const uint32_t node_table = append(b, nullptr, 0, 4);
+  b.resize(node_table + src_nodes.size() * sizeof(model_blob_node_t));
+
+  std::vector<model_blob_tensor_t> tt(src_tensors.size());
+  std::map<std::string, uint32_t> placed;   // shared scale / zero-point arrays go in once
+  blob.constant_bytes = blob.quant_bytes = 0;
+  uint32_t largest = 0;
+  for (size_t i = 0; i < src_tensors.size(); i++) {
+    const src_tensor_t& s = src_tensors[i];
+    const src_array_t& dims = arrays[s.dims];
+    model_blob_tensor_t& t = tt[i];
+    if (dims.v.size() > 4) return fail("rank above 4", s.dims);
+    t = {};
+    t.type = (uint8_t)s.type;
+    t.in_arena = s.in_arena;
+    t.rank = (uint8_t)dims.v.size();
+    for (size_t d = 0; d < dims.v.size(); d++) t.shape[d] = (int32_t)dims.v[d];
+    t.bytes = s.bytes;
+    if (s.in_arena) {
+      t.data = s.offset;
+    } else {
+      const std::vector<uint8_t>& c = constants[s.data];
+      t.data = append(b, c.data(), c.size(), 16);
+      blob.constant_bytes += (uint32_t)c.size();
+      if (c.size() > largest) {
+        largest = (uint32_t)c.size();
+        blob.weight_at = t.data;
+        blob.weight_bytes = c.size();
+      }
+    }
+  }
+  for (size_t i = 0; i < src_tensors.size(); i++) {
+    const src_tensor_t& s = src_tensors[i];
+    if (s.quant.empty()) continue;
+    const src_quant_t& q = quants[s.quant];
+    for (const std::string& name : { q.scale, q.zero }) {
+      if (!placed.count(name)) {
+        if (!arrays.count(name)) return fail("missing quantization array", name);
+        const size_t before = b.size();
+        placed[name] = append_array(b, arrays[name]);
+        blob.quant_bytes += (uint32_t)(b.size() - before);
+      }
+    }
+    tt[i].scale = placed[q.scale];
+    tt[i].zero_point = placed[q.zero];
+    tt[i].quant_dim = (uint8_t)q.qdim;
+  }
+  memcpy(b.data() + tensor_table, tt.data(), tt.size() * sizeof(model_blob_tensor_t));
+
+  for (size_t i = 0; i < src_nodes.size(); i++) {
+    const src_array_t& in = arrays[src_nodes[i].inputs];
+    const src_array_t& out = arrays[src_nodes[i].outputs];
+    if (in.v.size() + out.v.size() > MODEL_BLOB_NODE_IO) return fail("node with too many tensors");
+    model_blob_node_t n = {};
+    n.op = (uint16_t)src_nodes[i].op;
+    n.inputs = (uint8_t)in.v.size();
+    n.outputs = (uint8_t)out.v.size();
+    int k = 0;
+    for (double d : in.v) n.io[k++] = (int16_t)d;
+    for (double d : out.v) n.io[k++] = (int16_t)d;
+    memcpy(b.data() + node_table + i * sizeof(n), &n, sizeof(n));
+  }
+
+  model_blob_header_t h = {};
+  h.magic = MODEL_BLOB_MAGIC;
+  h.version = MODEL_BLOB_VERSION;
+  h.header_bytes = sizeof(h);
+  h.seq = opt_seq;
+  h.graph_hash = graph_hash;
+  h.arena_bytes = (uint32_t)src_arena;
+  h.tensors = (uint16_t)src_tensors.size();
+  h.nodes = (uint16_t)src_nodes.size();
+  h.tensor_table = tensor_table;
+  h.node_table = node_table;
+  strncpy(h.name, opt_name.c_str(), sizeof(h.name) - 1);
+  memcpy(b.data(), &h, sizeof(h));
+  seal(b);
+  return true;
+}
+
+// =================== MODEL ===================
+typedef std::vector<std::vector<uint8_t>> outputs_t;   // output tensor per frame
+
+static void* arena_alloc(size_t align, size_t size) {
+  return aligned_alloc(align, (size + align - 1) / align * align);
+}
+
+static bool model_open() { return tflite_learn_3_init(arena_alloc) == kTfLiteOk; }
+static void model_close() { tflite_learn_3_reset(free); }
+
+// Frame 0: a car-like striped block on a dark bay; the rest seeded noise
+static void make_frame(int f, int8_t* in, int w, int h) {
+  uint32_t rng = 0x9E3779B9u * (uint32_t)(f + 1);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      rng = rng * 1664525u + 1013904223u;
+      const bool car = x >= 32 && x < 64 && y >= 60 && y < 70;
+      const int v = f == 0 ? (car ? 8 + ((x - 32 + y) % 7) * 14 : 8 + (x * 7 + y * 3) % 5) : (int)(rng >> 24);
+      in[y * w + x] = (int8_t)(v - 128);
+    }
+  }
+}
+
+// Runs the open session over opt_frames frames with the given stem
+static bool run_frames(bool tiled, outputs_t& out) {
+  model_close();
+  tflite_learn_3_set_tiled_stem(tiled);
+  if (!model_open()) return false;
+  TfLiteTensor in, res;
+  tflite_learn_3_input(0, &in);
+  out.assign(opt_frames, {});
+  for (int f = 0; f < opt_frames; f++) {
+    make_frame(f, (int8_t*)in.data.data, in.dims->data[2], in.dims->data[1]);
+    if (tflite_learn_3_invoke() != kTfLiteOk) return false;
+    tflite_learn_3_output(0, &res);
+    out[f].assign(res.data.uint8, res.data.uint8 + res.bytes);
+  }
+  return true;
+}
+
+static int differing(const outputs_t& a, const outputs_t& b) {
+  int n = 0;
+  for (size_t f = 0; f < a.size(); f++) n += f >= b.size() || a[f] != b[f];
+  return n;
+}
+
+// =================== CHECKS ===================
+static int failures = 0;
+
+static void expect(bool ok, const char* what) {
+  printf("  %-58s %s\n", what, ok ? "ok" : "FAIL");
+  failures += !ok;
+}
+
+static void verbose(bool on) {
+  fflush(stdout);
+  now_sim_set_verbose(on);
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--out" && i + 1 < argc) {
+      opt_out = argv[++i];
+    } else if (a == "--name" && i + 1 < argc) {
+      opt_name = argv[++i];
+    } else if (a == "--seq" && i + 1 < argc) {
+      opt_seq = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    } else if (a == "--app-bytes" && i + 1 < argc) {
+      opt_app_bytes = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    } else if (a == "--frames" && i + 1 < argc) {
+      opt_frames = std::max(1, atoi(argv[++i]));
+    } else if (a[0] != '-') {
+      opt_source = argv[i];
+    } else {
+      fprintf(stderr, "usage: model_blob [--out FILE] [--name S] [--seq N] [--app-bytes B] [--frames N] [source.cpp]\n");
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_set_verbose(false);
+  const uint8_t mac[6] = { 0x24, 0x6f, 0x28, 0, 0, 2 };
+  now_sim_set_current(now_sim_add_node("cam", mac, 1));
+
+  // ---- Convert ----
+  if (!parse_source()) return 1;
+  const uint32_t hash = source_hash();
+  const uint32_t firmware_hash = tflite_learn_3_graph_hash();
+  blob_t blob;
+  if (!build_blob(hash, blob)) return 1;
+  size_t n_const = 0;
+  for (const src_tensor_t& t : src_tensors) n_const += !t.in_arena;
+  printf("== %s\n", opt_source);
+  printf("  %zu tensors (%zu constant), %zu nodes, arena %d B\n", src_tensors.size(), n_const, src_nodes.size(),
+         src_arena);
+  printf("  graph hash %08x, firmware %08x%s\n", (unsigned)hash, (unsigned)firmware_hash,
+         hash == firmware_hash ? "" : "  (blob will not bind to this firmware)");
+  printf("  blob %zu B: constants %u B, quantization %u B, tables and padding %zu B\n", blob.bytes.size(),
+         (unsigned)blob.constant_bytes, (unsigned)blob.quant_bytes,
+         blob.bytes.size() - blob.constant_bytes - blob.quant_bytes);
+  if (opt_out) {
+    std::ofstream out(opt_out, std::ios::binary);
+    out.write((const char*)blob.bytes.data(), blob.bytes.size());
+    if (!out) {
+      fprintf(stderr, "cannot write %s\n", opt_out);
+      return 1;
+    }
+    printf("  written to %s\n", opt_out);
+  }
+  if (hash != firmware_hash) return 1;
+  if (blob.bytes.size() > SLOT_BYTES) {
+    fprintf(stderr, "blob does not fit a %u B slot\n", (unsigned)SLOT_BYTES);
+    return 1;
+  }
+
+  // ---- Boot with empty slots: compiled weights, reference outputs ----
+  partition_sim_add(MODEL_BLOB_LABEL_A, ESP_PARTITION_TYPE_DATA, MODEL_BLOB_SUBTYPE, SLOT_BYTES);
+  partition_sim_add(MODEL_BLOB_LABEL_B, ESP_PARTITION_TYPE_DATA, MODEL_BLOB_SUBTYPE, SLOT_BYTES);
+  printf("\n== boot, slots erased\n");
+  verbose(true);
+  init_model_blob({ model_open, model_close });
+  verbose(false);
+  outputs_t ref_tiled, ref_nodes;
+  if (!model_open() || !run_frames(true, ref_tiled) || !run_frames(false, ref_nodes)) {
+    fprintf(stderr, "model init or invoke failed\n");
+    return 1;
+  }
+  expect(model_bound == MODEL_SLOT_BUILTIN, "no valid slot: compiled weights");
+  expect(differing(ref_tiled, ref_nodes) == 0, "compiled weights: tiled and node-by-node stem agree");
+
+  // ---- Install and switch ----
+  printf("\n== install and switch\n");
+  verbose(true);
+  const int slot = model_blob_install(blob.bytes.data(), blob.bytes.size());
+  verbose(false);
+  const uint32_t install_us = model_install_us;
+  const uint64_t t0 = ei_read_timer_us();
+  const bool switched = model_blob_select(MODEL_SLOT_AUTO);
+  const uint64_t switch_us = ei_read_timer_us() - t0;
+  expect(slot == MODEL_SLOT_A && switched && model_bound == MODEL_SLOT_A, "installed to A, switched to A");
+  outputs_t blob_tiled, blob_nodes;
+  expect(run_frames(true, blob_tiled) && differing(ref_tiled, blob_tiled) == 0,
+         "blob weights, tiled stem: output identical on every frame");
+  expect(run_frames(false, blob_nodes) && differing(ref_nodes, blob_nodes) == 0,
+         "blob weights, node-by-node: output identical on every frame");
+
+  // ---- Negatives ----
+  printf("\n== refused and recovered\n");
+  blob_t bad = blob;
+  for (size_t i = 0; i < bad.weight_bytes; i++) {   // the largest constant, negated
+    bad.bytes[bad.weight_at + i] = (uint8_t)-(int8_t)bad.bytes[bad.weight_at + i];
+  }
+  seal(bad.bytes);
+  verbose(true);
+  const int perturbed = model_blob_install(bad.bytes.data(), bad.bytes.size());
+  verbose(false);
+  outputs_t pert;
+  expect(perturbed == MODEL_SLOT_B && model_blob_select(MODEL_SLOT_B) && run_frames(true, pert) &&
+         differing(ref_tiled, pert) > 0, "negated weights in B: output changes (blob really used)");
+  expect(model_blob_select(MODEL_SLOT_A), "back to A");
+
+  bad = blob;
+  bad.bytes[bad.bytes.size() - 1] ^= 0x01;
+  expect(!strcmp(model_blob_check(bad.bytes.data(), bad.bytes.size()) ?: "", "payload checksum"),
+         "flipped payload bit: refused (payload checksum)");
+  bad = blob;
+  model_blob_header_t h;
+  memcpy(&h, bad.bytes.data(), sizeof(h));
+  h.graph_hash ^= 1;
+  memcpy(bad.bytes.data(), &h, sizeof(h));
+  seal(bad.bytes);
+  verbose(true);
+  const int other = model_blob_install(bad.bytes.data(), bad.bytes.size());
+  verbose(false);
+  expect(other < 0, "blob for another graph: install refused");
+
+  // Cut the power half way through the payload of a new install into B
+  partition_sim_cut_after((long)blob.bytes.size() / 2);
+  verbose(true);
+  const int torn = model_blob_install(blob.bytes.data(), blob.bytes.size());
+  verbose(false);
+  partition_sim_cut_after(-1);
+  verbose(true);
+  const bool refused = !model_blob_select(MODEL_SLOT_B);
+  verbose(false);
+  const bool stayed = refused && model_blob_select(MODEL_SLOT_AUTO);
+  outputs_t after;
+  expect(torn < 0 && stayed && model_bound == MODEL_SLOT_A, "install cut mid-write: B refused, auto stays on A");
+  expect(run_frames(true, after) && differing(ref_tiled, after) == 0, "A still gives the compiled output");
+  model_close();
+  expect(partition_sim_maps() == 2, "one mapping per slot, none leaked");
+
+  // ---- Timing ----
+  const uint32_t sectors = (opt_app_bytes + MODEL_BLOB_SECTOR - 1) / MODEL_BLOB_SECTOR;
+  const uint32_t pages = (opt_app_bytes + 255) / 256;
+  const uint32_t ota_ms = (sectors * PARTITION_SIM_ERASE_US + pages * PARTITION_SIM_PAGE_US) / 1000 + BOOT_MS;
+  printf("\n== model update cost (flash at %u ms / 4 KB erase, %.1f ms / 256 B page)\n",
+         PARTITION_SIM_ERASE_US / 1000, PARTITION_SIM_PAGE_US / 1000.0);
+  printf("  %-34s %9s %9s\n", "", "bytes", "ms");
+  printf("  %-34s %9zu %9.1f\n", "blob: install (erase + write)", blob.bytes.size(), install_us / 1000.0);
+  printf("  %-34s %9s %9.1f\n", "blob: switch (check, bind, init)", "", switch_us / 1000.0);
+  printf("  %-34s %9u %9u\n", "full OTA: app image + reboot", (unsigned)opt_app_bytes, (unsigned)ota_ms);
+  printf("  switch is host time; the board prints its own in the [MODEL] line. The OTA\n"
+         "  image size is an estimate (--app-bytes); download time is not counted, and\n"
+         "  would be %.0fx larger for the image than for the blob.\n",
+         (double)opt_app_bytes / blob.bytes.size());
+
+  printf("\n%s\n", failures ? "FAILED" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,583 @@
+/*
+ * EMF sensor + ESP32-CAM end-to-end scenario on the host ESP-NOW simulator
+ *
+ * Runs the real EMF trigger/status code (emf_now, emf_sensor) and the real
+ * camera link/state machine code (esp_now_comm, car_detection) as two nodes
+ * on a simulated medium. Camera init and inference are modelled as virtual
+ * time costs and the FOMO confidence comes from a scripted parking scene.
+ *
+ * For every car arrival/departure it records when the trigger left the EMF
+ * node, when the camera heard it, and when the EMF node received the new
+ * OCCUPIED/VACANT status, then prints latency percentiles. Once a second it
+ * also compares the camera's synced clock against the EMF node's real clock.
+ * Each arrival also sends an evidence thumbnail of a synthetic 96x96 frame
+ * (real fmt2jpg-style JPEG) through the fragmented evidence protocol.
+ * With --hop-every the EMF node moves to another channel periodically (AP
+ * channel change) and the time until the camera finds it again is reported.
+ * While idle the camera's radio is off between rendezvous slots (light sleep
+ * in idle_low_power()); --no-rdv keeps it listening all the time. With
+ * --deep-sleep (SLEEP_MODE 2) gaps of DEEP_SLEEP_MIN_MS or more are spent in
+ * deep sleep: the camera reboots on every wake and resumes from the RTC
+ * state in fast_resume.cpp; cold and warm wake-to-ready times are reported.
+ *
+ * Usage: now_scenario [--events N] [--loss P] [--latency-us U] [--jitter-us U]
+ *                     [--retries R] [--emf-ch C] [--cam-ch C] [--trigger manual|rf]
+ *                     [--fixed-window] [--save-evidence FILE] [--hop-every S]
+ *                     [--no-scan] [--no-rdv] [--rdv-period MS] [--deep-sleep]
+ *                     [--seed S] [-v]
+ */
+
+#include <Arduino.h>
+#include <vector>
+#include <string>
+
+#include "esp_now_comm.h"   // camera side (shared lib)
+#include "car_detection.h"
+#include "active_window.h"
+#include "occupancy.h"
+#include "evidence.h"
+#include "fast_resume.h"
+#include "emf_sensor.h"
+#include "emf_now.h"
+#include "emf_evidence.h"
+
+// =================== SCENARIO CONFIGURATION ===================
+static int      opt_events   = 100;
+static float    opt_loss     = 0.0f;
+static uint32_t opt_latency  = 2000;
+static uint32_t opt_jitter   = 1000;
+static int      opt_retries  = 3;
+static int      opt_emf_ch   = 1;
+static int      opt_cam_ch   = 1;
+static bool     opt_rf       = false;  // drive triggers through the RF detector
+static uint32_t opt_seed     = 1;
+static const char* opt_save_evidence = nullptr;
+static uint32_t opt_hop_s    = 0;      // EMF channel change period (0 = never)
+static bool     opt_deep     = false;  // SLEEP_MODE 2
+
+// Camera costs on an AI-Thinker board (virtual time)
+static const uint32_t CAM_INIT_MS     = 3350;  // ei_camera_init settle delay + first frame
+static const uint32_t CAM_FRAME_MS    = 95;    // capture + DSP + FOMO
+static const uint32_t CAM_IDLE_MS     = 5;     // idle_low_power() yield
+static const uint32_t CAM_WAKE_BOOT_MS = 120;  // ROM + bootloader + app start after a timer wake
+static const uint32_t CAM_WIFI_START_MS = 40;  // WiFi start before esp_now_init()
+static const float    CAM_RTC_DRIFT_PPM = 300.0f;  // RTC slow clock, after calibration
+
+// Crystal error of each board
+static const float EMF_DRIFT_PPM      = 12.0f;
+static const float CAM_DRIFT_PPM      = -18.0f;
+
+// Scene timing
+static const uint32_t SCENE_START_MS  = 35000; // past the EMF boot-time trigger cooldown
+static const uint32_t DWELL_MIN_MS    = 40000;
+static const uint32_t DWELL_MAX_MS    = 90000;
+static const uint32_t GAP_MIN_MS      = 45000;
+static const uint32_t GAP_MAX_MS      = 90000;
+static const uint32_t RF_BURST_MS     = 15000; // RF activity around each event
+static const uint32_t PARK_MS         = 9000;  // car manoeuvring into the bay
+static const uint32_t LEAVE_MS        = 4000;  // car pulling out, still in view
+static const uint32_t EVENT_TIMEOUT_MS = 30000;
+
+// =================== SCENE ===================
+typedef struct {
+  uint64_t t_us;        // ground truth: car arrives (arrive=1) or leaves
+  bool     arrive;
+  uint64_t trig_tx_us;  // EMF accepted a trigger for this event
+  uint64_t trig_rx_us;  // camera heard a trigger for this event
+  uint64_t status_us;   // EMF received the matching status
+} scene_event_t;
+
+static std::vector<scene_event_t> scene;
+static int emf_node = -1;
+static int cam_node = -1;
+
+static uint32_t rand_between(uint32_t lo, uint32_t hi) {
+  return lo + now_sim_rand() % (hi - lo + 1);
+}
+
+// Car in view? A leaving car stays visible while it pulls out.
+static bool scene_car_present(uint64_t t_us) {
+  bool present = false;
+  for (const auto& e : scene) {
+    if (e.t_us > t_us) break;
+    present = e.arrive || (t_us - e.t_us) < LEAVE_MS * 1000ULL;
+  }
+  return present;
+}
+
+// Index of the latest event at or before t_us (or -1)
+static int scene_current_event(uint64_t t_us) {
+  int idx = -1;
+  for (size_t i = 0; i < scene.size() && scene[i].t_us <= t_us; i++) idx = (int)i;
+  return idx;
+}
+
+static void build_scene() {
+  uint64_t t = (uint64_t)SCENE_START_MS * 1000;
+  for (int i = 0; i < opt_events; i++) {
+    bool arrive = (i % 2) == 0;
+    scene.push_back(scene_event_t{ t, arrive, 0, 0, 0 });
+    uint32_t next_ms = arrive ? rand_between(DWELL_MIN_MS, DWELL_MAX_MS)
+                              : rand_between(GAP_MIN_MS, GAP_MAX_MS);
+    t += (uint64_t)next_ms * 1000;
+  }
+}
+
+// =================== EMF NODE ===================
+// AD8317 output voltage for the scene: quiet floor around -62 dBm and a
+// noisy, rising burst while a car is manoeuvring.
+static int emf_analog(int pin) {
+  uint64_t now = now_sim_time_us();
+  float dbm = -62.0f + (now_sim_randf() - 0.5f) * 0.6f;
+  int idx = scene_current_event(now);
+  if (idx >= 0) {
+    uint64_t since_ms = (now - scene[idx].t_us) / 1000;
+    if (since_ms < RF_BURST_MS) {
+      dbm += 18.0f * (float)since_ms / RF_BURST_MS + (now_sim_randf() - 0.5f) * 4.0f;
+    }
+  }
+  float v = (dbm - intercept_dBm) * slope_V_per_dB;
+  int adc = (int)(v * ADC_MAX / VREF);
+  return max(0, min(ADC_MAX, adc));
+}
+
+static uint32_t rf_triggers = 0;
+
+static void emf_record_trigger() {
+  int idx = scene_current_event(now_sim_time_us());
+  if (idx >= 0 && scene[idx].trig_tx_us == 0) scene[idx].trig_tx_us = now_sim_time_us();
+}
+
+static void emf_loop() {
+  // Same order as emf_sensor_project/src/main.cpp loop(), minus web/CSV
+  float dbm_median = read_dbm_median();
+  update_signal_processing(dbm_median);
+  if (check_trigger_condition()) {
+    rf_triggers++;
+    if (send_camera_trigger(delta_db)) emf_record_trigger();
+  }
+}
+
+// Scripted press of the /trigger button shortly after each event
+static void emf_manual_trigger() {
+  if (send_camera_trigger(delta_db)) emf_record_trigger();
+}
+
+static void emf_recv(const uint8_t* mac, const uint8_t* data, int len) {
+  bool was_present = cam_present;
+  emf_on_now_recv(mac, data, len);
+  if (cam_present == was_present) return;
+
+  int idx = scene_current_event(now_sim_time_us());
+  if (idx >= 0 && scene[idx].arrive == cam_present && scene[idx].status_us == 0) {
+    scene[idx].status_us = now_sim_time_us();
+  }
+}
+
+static void emf_setup() {
+  init_sensor();
+  init_emf_now();
+  esp_now_register_recv_cb(emf_recv);
+}
+
+// =================== CAMERA NODE ===================
+static bool sim_cam_on = false;
+static uint32_t sim_frames = 0;
+static uint64_t sim_cam_on_us = 0;
+static uint64_t sim_cam_since_us = 0;
+
+// FOMO output for the current scene: one "car" box that slides across the
+// frame while the car manoeuvres and sits still once it is parked
+static ei_impulse_result_bounding_box_t sim_bb;
+
+// EI input frame (96x96 gray): textured asphalt, bay lines and the car body
+static const int SIM_W = EI_CLASSIFIER_INPUT_WIDTH;
+static const int SIM_H = EI_CLASSIFIER_INPUT_HEIGHT;
+static uint8_t sim_gray[SIM_W * SIM_H];
+
+static void sim_render_frame(int car_x) {
+  for (int y = 0; y < SIM_H; y++) {
+    for (int x = 0; x < SIM_W; x++) {
+      int v = 70 + y / 4 + (int)(now_sim_rand() % 12);
+      if (x == 12 || x == 84) v = 215;                  // bay lines
+      if (car_x >= 0 && abs(x - car_x) < 22 && y > 26 && y < 70) {
+        v = (y < 38) ? 60 : 150;                        // windscreen / body
+        if (y > 62 && (abs(x - car_x + 14) < 5 || abs(x - car_x - 14) < 5)) v = 25;  // wheels
+      }
+      sim_gray[y * SIM_W + x] = (uint8_t)v;
+    }
+  }
+}
+
+static ei_impulse_result_t cam_infer() {
+  const uint64_t now = now_sim_time_us();
+  bool present = scene_car_present(now);
+  float conf = present ? 0.84f + (now_sim_randf() - 0.5f) * 0.24f
+                       : 0.08f + now_sim_randf() * 0.30f;
+
+  uint32_t x = 40;
+  int idx = scene_current_event(now);
+  if (idx >= 0) {
+    uint64_t since_ms = (now - scene[idx].t_us) / 1000;
+    uint32_t span_ms = scene[idx].arrive ? PARK_MS : LEAVE_MS;
+    if (since_ms < span_ms) {
+      float f = (float)since_ms / span_ms;
+      x = (uint32_t)(scene[idx].arrive ? 88 - 48 * f : 40 + 48 * f);
+    }
+  }
+
+  sim_bb = { "car", x, 40, 8, 8, conf };
+  sim_render_frame(present ? (int)x : -1);
+  ei_impulse_result_t result = {};
+  result.bounding_boxes = &sim_bb;
+  result.bounding_boxes_count = (conf >= 0.5f) ? 1 : 0;
+  return result;
+}
+
+// Direct triggers land in onNowRecv, rendezvous ones when loop() takes the answer
+static void note_trigger_rx(uint32_t until_before) {
+  if (g_trigger_until_ms == until_before) return;   // no trigger taken
+  int idx = scene_current_event(now_sim_time_us());
+  if (idx >= 0 && scene[idx].trig_tx_us && scene[idx].trig_rx_us == 0) {
+    scene[idx].trig_rx_us = now_sim_time_us();
+  }
+}
+
+static void cam_recv(const uint8_t* mac, const uint8_t* data, int len) {
+  const uint32_t until = g_trigger_until_ms;
+  onNowRecv(mac, data, len);
+  note_trigger_rx(until);
+}
+
+static void cam_loop();
+
+static void cam_next(uint32_t cost_ms) {
+  now_sim_at(cam_node, now_sim_time_us() + (uint64_t)cost_ms * 1000, cam_loop);
+}
+
+// Light sleep between rendezvous slots: radio off, loop() resumes on wake
+static uint32_t sim_sleep_ms = 0;
+
+static void cam_wake() {
+  now_sim_set_radio(cam_node, true);
+  now_rdv_slept(sim_sleep_ms);
+  cam_loop();
+}
+
+// Deep sleep: RAM is gone, setup() runs again on the timer wake
+static bool sim_cam_up = false;          // setup() done since the last boot
+static uint64_t sim_wake_us = 0;
+static std::vector<double> warm_ready_ms;
+static double cold_ready_ms = 0;
+static uint32_t resume_state_errors = 0;
+static bool sim_present_at_sleep = false;
+
+static void cam_boot();
+
+static void cam_deep_wake() {
+  sim_wake_us = now_sim_time_us();
+  now_sim_set_radio(cam_node, true);
+  now_sim_at(cam_node, sim_wake_us + CAM_WAKE_BOOT_MS * 1000ULL, [] {
+    now_sim_reboot(cam_node, ESP_SLEEP_WAKEUP_TIMER);
+    cam_boot();
+  });
+}
+
+static bool cam_sleep() {
+  sim_sleep_ms = now_rdv_sleep_ms();
+  if (opt_deep && sim_sleep_ms >= DEEP_SLEEP_MIN_MS && !evidence_busy()) {
+    const uint32_t ms = sim_sleep_ms - DEEP_SLEEP_WAKE_MS;
+    fast_resume_save(ms);
+    sim_present_at_sleep = is_car_present();
+    sim_cam_up = false;
+    now_sim_set_radio(cam_node, false);
+    now_sim_at(cam_node, now_sim_time_us() + (uint64_t)ms * 1000, cam_deep_wake);
+    return true;
+  }
+  if (sim_sleep_ms < RDV_MIN_SLEEP_MS || evidence_busy()) return false;
+  now_sim_set_radio(cam_node, false);
+  now_sim_at(cam_node, now_sim_time_us() + (uint64_t)sim_sleep_ms * 1000, cam_wake);
+  return true;
+}
+
+// One pass of esp32_cam_project/src/main.cpp loop(); camera work is charged
+// as virtual time instead of blocking in delay().
+static void cam_loop() {
+  const uint32_t now = millis();
+  now_channel_poll();
+  now_sync_poll();
+  const uint32_t until = g_trigger_until_ms;
+  now_rdv_poll();
+  note_trigger_rx(until);
+  evidence_poll();
+  memt_poll();
+  now_heartbeat_poll();
+  if ((int32_t)(g_trigger_until_ms - now) > 0) {
+    if (!sim_cam_on) {
+      sim_cam_on = true;
+      sim_cam_since_us = now_sim_time_us();
+      Serial.println("Camera ON");
+      now_rdv_report();
+      active_window_begin();
+      occupancy_begin();
+      cam_next(CAM_INIT_MS);
+      return;
+    }
+    sim_frames++;
+    ei_impulse_result_t result = cam_infer();
+    const bool was_present = is_car_present();
+    update_car_detection(occupancy_update(result));
+    if (!was_present && is_car_present()) evidence_begin(sim_gray, SIM_W, SIM_H);
+    active_window_update(result);
+    cam_next(CAM_FRAME_MS);
+  } else {
+    if (sim_cam_on) {
+      sim_cam_on = false;
+      sim_cam_on_us += now_sim_time_us() - sim_cam_since_us;
+      Serial.println("Camera OFF");
+      active_window_end();
+      occupancy_end();
+    }
+    if (!cam_sleep()) cam_next(CAM_IDLE_MS);
+  }
+}
+
+// esp32_cam_project/src/main.cpp setup(), cold or resuming from deep sleep
+static void cam_boot() {
+  const bool warm = fast_resume_begin();
+  if (!warm) delay(100 + 3000);
+  init_mem_telemetry();
+  init_car_detection();
+  delay(CAM_WIFI_START_MS);
+  if (!init_now_rx_tx(fast_resume_link())) {
+    Serial.println("WARN: ESP-NOW RX/TX not initialized");
+  }
+  init_evidence();
+  fast_resume_restore();
+  fast_resume_ready();
+  esp_now_register_recv_cb(cam_recv);
+
+  if (warm) {
+    warm_ready_ms.push_back((now_sim_time_us() - sim_wake_us) / 1000.0);
+    if (is_car_present() != sim_present_at_sleep) resume_state_errors++;
+  } else {
+    cold_ready_ms = (now_sim_time_us() - sim_wake_us) / 1000.0;
+  }
+  sim_cam_up = true;
+  cam_next(0);
+}
+
+// =================== CLOCK SYNC PROBE ===================
+static std::vector<double> sync_err_us;
+static std::vector<double> sync_acc_us;
+static uint32_t sync_bound_misses = 0;
+
+static void cam_sync_probe() {
+  if (!sim_cam_up || !g_time_sync.synced) return;
+  int64_t local = time_sync_local_us();
+  int64_t est = time_sync_to_master(g_time_sync, local);
+  int64_t truth = (int64_t)now_sim_node_local_us(emf_node);
+  double err = fabs((double)(est - truth));
+  uint32_t acc = time_sync_accuracy_us(g_time_sync, local);
+  sync_err_us.push_back(err);
+  sync_acc_us.push_back(acc);
+  if (err > acc) sync_bound_misses++;
+}
+
+// =================== CHANNEL HOPS ===================
+static std::vector<double> reconnect_ms;
+static uint64_t hop_us = 0;            // pending hop not yet followed
+static uint32_t hops = 0;
+
+static void emf_hop_channel() {
+  uint8_t ch = now_sim_channel(emf_node);
+  uint8_t next = (uint8_t)(1 + (ch + now_sim_rand() % 12) % 13);   // any other channel
+  esp_wifi_set_channel(next, WIFI_SECOND_CHAN_NONE);
+  Serial.printf("EMF moved ch %u -> %u\n", (unsigned)ch, (unsigned)next);
+  if (hop_us == 0) hop_us = now_sim_time_us();
+  hops++;
+}
+
+static void cam_hop_probe() {
+  if (hop_us == 0 || now_channel_scanning()) return;
+  if (g_now_channel == now_sim_channel(emf_node) && now_sim_channel(cam_node) == g_now_channel) {
+    reconnect_ms.push_back((now_sim_time_us() - hop_us) / 1000.0);
+    hop_us = 0;
+  }
+}
+
+// =================== REPORT ===================
+static void print_percentiles(const char* name, std::vector<double> v, const char* unit = "ms") {
+  if (v.empty()) {
+    printf("  %-22s n=0\n", name);
+    return;
+  }
+  std::sort(v.begin(), v.end());
+  auto pct = [&](double p) { return v[(size_t)(p * (v.size() - 1) + 0.5)]; };
+  printf("  %-22s n=%-4zu p50=%8.1f  p90=%8.1f  p99=%8.1f  max=%8.1f %s\n",
+         name, v.size(), pct(0.50), pct(0.90), pct(0.99), v.back(), unit);
+}
+
+static void report() {
+  std::vector<double> tx_rx, rx_status, e2e;
+  int missed = 0, untriggered = 0;
+  for (const auto& e : scene) {
+    if (e.trig_tx_us == 0) { untriggered++; continue; }
+    if (e.trig_rx_us) tx_rx.push_back((e.trig_rx_us - e.trig_tx_us) / 1000.0);
+    if (e.trig_rx_us && e.status_us) rx_status.push_back((e.status_us - e.trig_rx_us) / 1000.0);
+    if (e.status_us) e2e.push_back((e.status_us - e.t_us) / 1000.0);
+    else missed++;
+  }
+
+  const now_sim_stats_t& st = now_sim_stats();
+  double sim_s = now_sim_time_us() / 1e6;
+  printf("\n=== ESP-NOW scenario: %d events, %.0f s simulated ===\n", opt_events, sim_s);
+  printf("link: loss=%.2f latency=%uus jitter=%uus retries=%d  channels emf=%d cam=%d  trigger=%s\n",
+         opt_loss, (unsigned)opt_latency, (unsigned)opt_jitter, opt_retries,
+         opt_emf_ch, opt_cam_ch, opt_rf ? "rf" : "manual");
+  print_percentiles("trigger TX -> CAM RX", tx_rx);
+  print_percentiles("CAM RX -> status RX", rx_status);
+  print_percentiles("event -> status RX", e2e);
+  printf("  events without trigger: %d   triggered but no status: %d   rf triggers: %u\n",
+         untriggered, missed, (unsigned)rf_triggers);
+  printf("  camera on: %.1f s total, %.1f s/event, %.1f s/decision, %u frames, window=%s\n",
+         sim_cam_on_us / 1e6, opt_events ? sim_cam_on_us / 1e6 / opt_events : 0.0,
+         window_decisions ? window_cam_on_ms / 1000.0 / window_decisions : 0.0,
+         (unsigned)sim_frames, window_adaptive ? "adaptive" : "fixed");
+  printf("  clock sync: samples=%u rejected=%u drift est=%.1fppm (true %.1fppm)\n",
+         (unsigned)g_time_sync.samples, (unsigned)g_time_sync.rejected, g_time_sync.drift_ppm,
+         ((1.0 + EMF_DRIFT_PPM * 1e-6) / (1.0 + CAM_DRIFT_PPM * 1e-6) - 1.0) * 1e6);
+  print_percentiles("|cam - emf| clock err", sync_err_us, "us");
+  print_percentiles("reported accuracy", sync_acc_us, "us");
+  printf("  error within reported accuracy: %.1f%%\n",
+         sync_err_us.empty() ? 0.0 : 100.0 * (sync_err_us.size() - sync_bound_misses) / sync_err_us.size());
+  printf("  evidence: delivered=%u failed=%u (emf: images=%u dropped=%u)  %.0f B/image  %.1f frames/image  airtime %.1f ms/image\n",
+         (unsigned)evidence_sent, (unsigned)evidence_failed,
+         (unsigned)evidence_images, (unsigned)evidence_dropped,
+         evidence_sent ? (double)evidence_bytes / evidence_sent : 0.0,
+         evidence_sent ? (double)evidence_frames / evidence_sent : 0.0,
+         evidence_sent ? evidence_airtime_us / 1000.0 / evidence_sent : 0.0);
+  if (opt_hop_s) {
+    printf("  channel hops: %u every %u s, scan=%s, sweeps=%u, not followed by the end: %d\n",
+           (unsigned)hops, (unsigned)opt_hop_s, now_channel_scan ? "on" : "off",
+           (unsigned)g_now_scans, hop_us ? 1 : 0);
+    print_percentiles("hop -> camera follows", reconnect_ms);
+  }
+  if (now_rdv_enabled) {
+    printf("  rendezvous: slot every %u ms, bound %u ms, camera radio on %.1f%%, polls=%u missed=%u, "
+           "emf held=%u max hold=%u ms\n",
+           (unsigned)now_rdv_period_ms, (unsigned)(now_rdv_period_ms + RDV_SLOT_MS),
+           100.0 * now_sim_radio_on_us(cam_node) / now_sim_time_us(), (unsigned)g_rdv_polls,
+           (unsigned)g_rdv_missed, (unsigned)rdv_held, (unsigned)rdv_hold_max_ms);
+  } else {
+    printf("  rendezvous: off, camera radio on %.1f%%\n",
+           100.0 * now_sim_radio_on_us(cam_node) / now_sim_time_us());
+  }
+  if (opt_deep) {
+    printf("  deep sleep: %u warm wakes, %u cold boots, state mismatches after resume: %u\n",
+           (unsigned)resume_warm_boots, (unsigned)resume_cold_boots, (unsigned)resume_state_errors);
+    printf("  %-22s %.1f ms\n", "cold boot -> ready", cold_ready_ms);
+    print_percentiles("warm wake -> ready", warm_ready_ms);
+  }
+  memt_summary_t cam_mem = {};
+  uint32_t cam_mem_recv_ms;
+  cam_mem_get(cam_mem, cam_mem_recv_ms);
+  printf("  heartbeats: sent=%u received=%u, last: internal min free %u B, largest block min %u B, "
+         "loop stack never used %u B\n",
+         (unsigned)g_heartbeats, (unsigned)cam_heartbeats, (unsigned)cam_mem.heap_min[0],
+         (unsigned)cam_mem.heap_largest_min[0], (unsigned)cam_mem.stack_min[MEMT_TASK_LOOP]);
+  printf("  medium: tx=%u attempts=%u delivered=%u lost=%u unheard=%u airtime=%.1f ms\n",
+         (unsigned)st.tx_frames, (unsigned)st.tx_attempts, (unsigned)st.delivered,
+         (unsigned)st.lost, (unsigned)st.chan_mismatch, st.airtime_us / 1000.0);
+}
+
+// Last thumbnail as reassembled by the EMF node (what /evidence/0.jpg serves)
+static void save_evidence() {
+  const uint8_t* jpg;
+  size_t len;
+  if (!opt_save_evidence || !emf_evidence_get(0, &jpg, &len, nullptr)) return;
+  FILE* f = fopen(opt_save_evidence, "wb");
+  if (!f) return;
+  fwrite(jpg, 1, len, f);
+  fclose(f);
+  printf("  evidence saved to %s (%u B)\n", opt_save_evidence, (unsigned)len);
+}
+
+// =================== MAIN ===================
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() { return (i + 1 < argc) ? argv[++i] : "0"; };
+    if      (a == "--events")     opt_events  = atoi(next());
+    else if (a == "--loss")       opt_loss    = (float)atof(next());
+    else if (a == "--latency-us") opt_latency = (uint32_t)atoi(next());
+    else if (a == "--jitter-us")  opt_jitter  = (uint32_t)atoi(next());
+    else if (a == "--retries")    opt_retries = atoi(next());
+    else if (a == "--emf-ch")     opt_emf_ch  = atoi(next());
+    else if (a == "--cam-ch")     opt_cam_ch  = atoi(next());
+    else if (a == "--trigger")    opt_rf      = (std::string(next()) == "rf");
+    else if (a == "--fixed-window") window_adaptive = false;
+    else if (a == "--save-evidence") opt_save_evidence = next();
+    else if (a == "--hop-every")  opt_hop_s   = (uint32_t)atoi(next());
+    else if (a == "--no-scan")    now_channel_scan = false;
+    else if (a == "--no-rdv")     now_rdv_enabled = false;
+    else if (a == "--rdv-period") now_rdv_period_ms = (uint32_t)atoi(next());
+    else if (a == "--deep-sleep") opt_deep    = true;
+    else if (a == "--seed")       opt_seed    = (uint32_t)atoi(next());
+    else if (a == "-v")           now_sim_set_verbose(true);
+    else {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_seed(opt_seed);
+
+  now_sim_link_t link = now_sim_default_link();
+  link.loss = opt_loss;
+  link.latency_us = opt_latency;
+  link.jitter_us = opt_jitter;
+  link.retries = (uint8_t)opt_retries;
+  now_sim_set_default_link(link);
+
+  const uint8_t emf_mac[6] = { 0x24, 0x6F, 0x28, 0x01, 0x02, 0x03 };
+  const uint8_t cam_mac[6] = { 0x78, 0x42, 0x1C, 0x6D, 0xBD, 0x68 };
+  emf_node = now_sim_add_node("emf", emf_mac, (uint8_t)opt_emf_ch);
+  cam_node = now_sim_add_node("cam", cam_mac, (uint8_t)opt_cam_ch);
+  memcpy(EMF_SENSOR_MAC, emf_mac, 6);   // camera's status target
+  memcpy(CAM_MAC, cam_mac, 6);          // EMF's trigger target
+
+  // Clocks: independent boot offsets and crystal error
+  now_sim_set_clock(emf_node, 0, EMF_DRIFT_PPM);
+  now_sim_set_clock(cam_node, 7300000, CAM_DRIFT_PPM);
+  now_sim_set_rtc_drift(cam_node, CAM_RTC_DRIFT_PPM);
+  now_sim_set_analog(emf_node, emf_analog);
+
+  build_scene();
+
+  now_sim_at(emf_node, 3100 * 1000ULL, emf_setup);   // after its boot delay
+  now_sim_at(cam_node, 100 * 1000ULL, cam_boot);
+  now_sim_every(emf_node, 4000 * 1000ULL, PERIOD_MS * 1000ULL, emf_loop);
+  now_sim_every(cam_node, 5000 * 1000ULL, 1000 * 1000ULL, cam_sync_probe);
+  now_sim_every(emf_node, 4000 * 1000ULL, 10 * 1000ULL, emf_evidence_poll);
+  now_sim_every(emf_node, 4000 * 1000ULL, 10 * 1000ULL, emf_now_poll);
+  if (opt_hop_s) {
+    now_sim_every(emf_node, opt_hop_s * 1000000ULL, opt_hop_s * 1000000ULL, emf_hop_channel);
+    now_sim_every(cam_node, opt_hop_s * 1000000ULL, 10 * 1000ULL, cam_hop_probe);
+  }
+  if (!opt_rf) {
+    for (const auto& e : scene) {
+      now_sim_at(emf_node, e.t_us + 1500 * 1000ULL, emf_manual_trigger);
+    }
+  }
+
+  uint64_t end_us = scene.empty() ? 0 : scene.back().t_us + EVENT_TIMEOUT_MS * 1000ULL;
+  now_sim_run_until(end_us);
+
+  report();
+  save_evidence();
+  return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * Memory placement: where the camera's EI buffers land, and inference per placement
+ *
+ * Builds the camera's real mem_place.cpp against a simulated heap with two
+ * pools (esp_now_sim/heap_caps_sim.cpp): internal SRAM and PSRAM at the sizes
+ * given. As in main.cpp, the tensor arena goes through
+ * run_classifier_set_arena_allocator() and the EI heap (ei_malloc family)
+ * through the placement policy. Per scenario it prints the firmware's own
+ * [MEM] lines: mem_place_bench() with every arena / EI heap / input
+ * placement, then mem_place_report(). After the last scenario the
+ * [MEMT] report shows the heap the EI stages (DSP, NN, postprocessing)
+ * held at most, counted through the same stage hook as on the board.
+ *
+ * Host memory is one pool, so the ms/inf column is host time and does not
+ * separate SRAM from PSRAM; the board prints the same table with
+ * MEM_BENCH_RUNS. What the host run checks is where each buffer lands for
+ * given pool sizes, the fallbacks, that nothing leaks, and that every
+ * placement gives the same FOMO output.
+ *
+ * Scenarios: WiFi up with the tiled stem (EI_CLASSIFIER_TILED_STEM=1), the
+ * node-by-node arena (the default build), and a board without PSRAM.
+ *
+ * Usage: placement_bench [--runs N] [--internal B] [--largest B] [--psram B]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "tflite-model/tflite_learn_3_compiled.h"
+#include "mem_place.h"
+#include "mem_telemetry.h"
+#include "camera_ei.h"
+#include "esp_heap_caps.h"
+
+// =================== CONFIGURATION ===================
+static int    opt_runs     = 20;
+static size_t opt_internal = 170000;    // free internal SRAM with WiFi and the camera driver up
+static size_t opt_largest  = 113792;    // its largest block
+static size_t opt_psram    = 4u << 20;
+
+// =================== EI HEAP ===================
+// As in main.cpp
+void* ei_malloc(size_t size) { return mem_place_alloc(MEM_BUF_EI_HEAP, size, 4, false); }
+void* ei_calloc(size_t nitems, size_t size) {
+  if (size && nitems > SIZE_MAX / size) return nullptr;
+  return mem_place_alloc(MEM_BUF_EI_HEAP, nitems * size);
+}
+void ei_free(void* ptr) { mem_place_free(ptr); }
+
+static void ei_stage(ei_impulse_stage_t stage) {
+  static const memt_sys_t sys[] = { MEMT_DSP, MEMT_NN, MEMT_POST };
+  memt_stage = sys[stage];
+}
+
+// =================== BENCH OPS ===================
+static std::vector<float> ref_out;   // FOMO output of the first placement
+static uint32_t out_differ = 0;
+
+static bool bench_open() { return run_classifier_session_open() == EI_IMPULSE_OK; }
+static void bench_close() { run_classifier_session_close(); }
+
+// One inference; the virtual clock advances by its host time, so the
+// firmware's micros() timing reports it
+static bool bench_infer() {
+  ei::signal_t signal;
+  signal.total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
+  signal.get_data = &ei_camera_get_data;
+  signal.gray_u8 = ei_input_gray;
+  ei_impulse_result_t result = { 0 };
+  const uint64_t t0 = ei_read_timer_us();
+  const bool ok = run_classifier(&signal, &result, false) == EI_IMPULSE_OK;
+  memt_stage = MEMT_NONE;
+  now_sim_delay_us(ei_read_timer_us() - t0);
+  if (!ok) return false;
+
+  std::vector<float> out;
+  for (uint32_t i = 0; i < result.bounding_boxes_count; i++) {
+    const ei_impulse_result_bounding_box_t& bb = result.bounding_boxes[i];
+    out.insert(out.end(), { bb.value, (float)bb.x, (float)bb.y, (float)bb.width, (float)bb.height });
+  }
+  if (ref_out.empty() && !out.empty()) {
+    ref_out = out;
+  } else if (out != ref_out) {
+    out_differ++;
+  }
+  return true;
+}
+
+// A car-like striped block on a dark bay, so FOMO reports a box
+static void fill_input() {
+  const int w = EI_CLASSIFIER_INPUT_WIDTH, h = EI_CLASSIFIER_INPUT_HEIGHT;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      const bool car = x >= 32 && x < 64 && y >= 60 && y < 70;
+      ei_input_gray[y * w + x] = (uint8_t)(car ? 8 + ((x - 32 + y) % 7) * 14 : 8 + (x * 7 + y * 3) % 5);
+    }
+  }
+}
+
+// =================== SCENARIOS ===================
+typedef struct {
+  const char* name;
+  bool tiled;
+  bool psram;
+} scenario_t;
+
+static bool run_scenario(const scenario_t& sc) {
+  printf("\n== %s: internal %u B free (largest %u B), psram %u B, %s stem\n", sc.name,
+         (unsigned)opt_internal, (unsigned)opt_largest, sc.psram ? (unsigned)opt_psram : 0u,
+         sc.tiled ? "tiled" : "node-by-node");
+  heap_sim_set_pool(false, opt_internal, opt_largest);
+  heap_sim_set_pool(true, sc.psram ? opt_psram : 0, sc.psram ? opt_psram : 0);
+  tflite_learn_3_set_tiled_stem(sc.tiled);
+
+  init_mem_place();
+  for (int buf = 0; buf < MEM_BUF_COUNT; buf++) {   // per-scenario counters; live bytes carry over
+    mem_buf_stats_t& s = mem_stats[buf];
+    s.peak = s.live[MEM_POOL_INTERNAL] + s.live[MEM_POOL_PSRAM];
+    s.allocs = s.fallbacks = s.failures = 0;
+  }
+  const size_t free0 = heap_caps_get_free_size(MALLOC_CAP_INTERNAL) + heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  run_classifier_set_arena_allocator(mem_place_arena_alloc, mem_place_arena_free);
+  const size_t sz = (size_t)EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
+  ei_input_gray = (uint8_t*)mem_place_alloc(MEM_BUF_EI_INPUT, sz);
+  if (!ei_input_gray) {
+    printf("EI input allocation failed\n");
+    return false;
+  }
+  fill_input();
+  ref_out.clear();
+  out_differ = 0;
+
+  now_sim_set_verbose(true);
+  mem_place_bench(opt_runs, { bench_open, bench_close, bench_infer });
+  mem_place_report();
+  now_sim_set_verbose(false);
+
+  mem_place_free(ei_input_gray);
+  ei_input_gray = nullptr;
+  // The SDK's static impulse state stays allocated across scenarios
+  const bool leak = heap_caps_get_free_size(MALLOC_CAP_INTERNAL) + heap_caps_get_free_size(MALLOC_CAP_SPIRAM) != free0;
+  printf("  outputs differing from the first placement: %u; %s\n", (unsigned)out_differ,
+         leak ? "LEAK: buffers still held after the bench" : "all buffers released");
+  return !leak && out_differ == 0;
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--runs" && i + 1 < argc) {
+      opt_runs = std::max(1, atoi(argv[++i]));
+    } else if (a == "--internal" && i + 1 < argc) {
+      opt_internal = (size_t)atol(argv[++i]);
+    } else if (a == "--largest" && i + 1 < argc) {
+      opt_largest = (size_t)atol(argv[++i]);
+    } else if (a == "--psram" && i + 1 < argc) {
+      opt_psram = (size_t)atol(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: placement_bench [--runs N] [--internal B] [--largest B] [--psram B]\n");
+      exit(2);
+    }
+  }
+  opt_largest = std::min(opt_largest, opt_internal);
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_set_verbose(false);
+  const uint8_t mac[6] = { 0x24, 0x6f, 0x28, 0, 0, 2 };
+  now_sim_set_current(now_sim_add_node("cam", mac, 1));
+  init_mem_telemetry();
+  run_classifier_set_stage_hook(ei_stage);
+
+  const scenario_t scenarios[] = {
+    { "WiFi up", true, true },
+    { "node-by-node arena", false, true },
+    { "no PSRAM", true, false },
+  };
+  bool ok = true;
+  for (const scenario_t& sc : scenarios) ok &= run_scenario(sc);
+
+  printf("\n== memory telemetry, all scenarios\n");
+  now_sim_set_verbose(true);
+  memt_sample();
+  memt_report();
+  now_sim_set_verbose(false);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,381 @@
+/*
+ * ULP RF sampling: wake decisions against the float chain
+ *
+ * Builds the EMF node's real emf_ulp.cpp (ULP program, sample ring, wake
+ * logic) and emf_sensor.cpp (float chain) against the simulator, which
+ * interprets the ULP program instruction by instruction
+ * (esp_now_sim/ulp_sim.cpp). One synthetic AD8317 trace runs through:
+ *
+ *   reference  the main CPU reads 64 ADC samples every PERIOD_MS
+ *              (read_dbm_median) and runs the float chain at once, as with
+ *              ULP_SAMPLING off
+ *   ULP        the ULP program samples into RTC memory; the modelled cores
+ *              sleep while ulp_stay_awake() is false and, once the ULP wakes
+ *              them, run the same chain on every waiting sample in order
+ *
+ * Both see the same ADC reads (noise is a function of sample and read
+ * index). Per sample the chain is processed as in main.cpp process_sample():
+ * the trigger check, then the CSV's trigger_ready check, which advances the
+ * streak again. The minute summary's extra check is left out of both.
+ *
+ * Per ULP wake level: wakes on a rise and for a full batch, rise wakes with
+ * the chain never above its threshold ("false"), time the cores are awake,
+ * reference onsets above the threshold and triggers the cores handled in the
+ * same period or only later (at the next batch), reference triggers the ULP
+ * pass did not send, samples where the chain on ULP samples decides
+ * differently, and the ULP's run time per sample from the interpreter's
+ * cycle count.
+ *
+ * The trace: -62 dBm floor with a slow temperature drift, car arrivals,
+ * weak 2 dB steps, short 6 dB blips and single-sample interference spikes;
+ * ADC read noise on top. A car's emitters close in on the antenna at a
+ * steady speed, so the level follows free-space path loss and rises faster
+ * every second: the stock chain (K_NOISE 7, N_ON 5) fires only on onsets
+ * like that, a linear ramp never reaches its streak.
+ *
+ * The cores round their 64 reads in the ULP's four steps, so both passes
+ * feed the chain the same codes. Fails (exit 1) when the trace sends no
+ * reference trigger, when a reference trigger is not sent on the ULP path
+ * ("missed"), or when the passes decide differently on any sample.
+ *
+ * Usage: ulp_check [--hours H] [--seed S] [--wake-db DB] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+
+#include "emf_sensor.h"
+#include "emf_ulp.h"
+#include "esp32/ulp.h"
+
+// =================== CONFIGURATION ===================
+static float    opt_hours   = 24.0f;
+static uint32_t opt_seed    = 1;
+static float    opt_wake_db = -1.0f;   // < 0 = sweep
+static bool     opt_verbose = false;
+
+static const float ADC_NOISE = 4.0f;    // codes per read (sigma)
+static const uint32_t ULP_CLOCK_HZ = 8000000;
+static const float CAR_FAR_M = 40.0f;          // emitters first heard here
+static const float CAR_NEAR_M = 0.5f;          // closest to the antenna
+static const float CAR_SPEED_MPS = 10.0f;
+static const float CAR_STAY_MS = 5000.0f;      // emitters on after arriving
+
+// =================== TRACE ===================
+typedef enum { EV_CAR, EV_WEAK, EV_BLIP, EV_SPIKE } event_kind_t;
+typedef struct {
+  uint32_t k;          // first sample
+  event_kind_t kind;
+} trace_event_t;
+
+static const char* const EVENT_NAMES[] = { "car", "weak", "blip", "spike" };
+static std::vector<trace_event_t> events;
+static uint32_t n_samples = 0;
+
+static uint32_t hash32(uint32_t a, uint32_t b, uint32_t c) {
+  uint32_t h = opt_seed * 0x9E3779B9u ^ a * 0x85EBCA6Bu ^ b * 0xC2B2AE35u ^ c * 0x27D4EB2Fu;
+  h ^= h >> 15;
+  h *= 0x2C1B3C6Du;
+  h ^= h >> 12;
+  h *= 0x297A2D39u;
+  h ^= h >> 15;
+  return h;
+}
+
+static float uniform(uint32_t a, uint32_t b, uint32_t c) {
+  return (hash32(a, b, c) >> 8) / 16777216.0f - 0.5f;
+}
+
+static void make_trace() {
+  n_samples = (uint32_t)(opt_hours * 3600000.0f / PERIOD_MS);
+  now_sim_seed(opt_seed);
+  const uint32_t per_min = 60000 / PERIOD_MS;
+  // Cars every 3-20 min, each kind of disturbance on its own schedule
+  const struct { event_kind_t kind; uint32_t min_gap, max_gap; } schedules[] = {
+    { EV_CAR, 3 * per_min, 20 * per_min },
+    { EV_WEAK, 10 * per_min, 40 * per_min },
+    { EV_BLIP, 5 * per_min, 30 * per_min },
+    { EV_SPIKE, 2 * per_min, 10 * per_min },
+  };
+  for (const auto& s : schedules) {
+    for (uint32_t k = s.min_gap; k < n_samples; k += s.min_gap + now_sim_rand() % (s.max_gap - s.min_gap)) {
+      events.push_back({ k, s.kind });
+    }
+  }
+}
+
+// RF level of sample k
+static float trace_dbm(uint32_t k) {
+  const float hours = k * (float)PERIOD_MS / 3600000.0f;
+  float dbm = -62.0f + 1.5f * sinf(hours * 2.0f * 3.14159f / 6.0f) + uniform(k, 0, 1) * 0.6f;
+  for (const trace_event_t& ev : events) {
+    if (k < ev.k) continue;
+    const uint32_t since = k - ev.k;
+    const float since_ms = (float)since * PERIOD_MS;
+    switch (ev.kind) {
+      case EV_CAR: {
+        // Arrivals are not aligned with the sampling: random phase
+        const float t = since_ms / 1000.0f + uniform(ev.k, 3, 4) + 0.5f;
+        const float d = max(CAR_NEAR_M, CAR_FAR_M - CAR_SPEED_MPS * t);
+        if (t * 1000.0f < CAR_FAR_M / CAR_SPEED_MPS * 1000.0f + CAR_STAY_MS) {
+          dbm += 20.0f * log10f(CAR_FAR_M / d) + uniform(k, 0, 2) * 0.6f;
+        }
+        break;
+      }
+      case EV_WEAK:
+        if (since_ms < 30000) dbm += 2.0f;
+        break;
+      case EV_BLIP:
+        if (since_ms < 3000) dbm += 6.0f;
+        break;
+      case EV_SPIKE:
+        if (since == 0) dbm += 8.0f;
+        break;
+    }
+  }
+  return dbm;
+}
+
+// =================== ADC ===================
+static uint32_t cur_sample = 0;
+static int cur_read = 0;
+static float cur_code = 0.0f;
+
+static void begin_sample(uint32_t k) {
+  cur_sample = k;
+  cur_read = 0;
+  const float v = (trace_dbm(k) - intercept_dBm) * slope_V_per_dB;
+  cur_code = v * ADC_MAX / VREF;
+}
+
+// Same read sequence for the main CPU and the ULP
+static int adc_read() {
+  float noise = 0.0f;
+  for (int i = 0; i < 4; i++) noise += uniform(cur_sample, cur_read, 10 + i);
+  cur_read++;
+  const int code = (int)lroundf(cur_code + noise * 1.732f * ADC_NOISE);
+  return max(0, min(ADC_MAX, code));
+}
+
+// =================== FLOAT CHAIN ===================
+typedef struct {
+  std::vector<uint8_t> above;      // delta_db >= dyn_thr after the sample
+  std::vector<uint8_t> trigger;    // trigger sent on this sample
+  std::vector<uint32_t> done_k;    // period in which the cores processed it
+} chain_log_t;
+
+static void reset_chain() {
+  emaV = NAN;
+  dbm_fast = dbm_slow = NAN;
+  delta_db = 0.0f;
+  mad_est = 0.0f;
+  dyn_thr = MIN_FLOOR_DB;
+  on_streak = 0;
+  last_now_ms = 0;
+  ring_i = 0;
+  ring_full = false;
+}
+
+// main.cpp process_sample(); a sent trigger as in send_camera_trigger()
+static void process(float dbm_median, uint32_t k, uint32_t now_k, chain_log_t& log) {
+  update_signal_processing(dbm_median);
+  bool trig = check_trigger_condition();
+  check_trigger_condition();   // the CSV's trigger_ready
+  if (trig && millis() - last_now_ms < NOW_COOLDOWN_MS) trig = false;
+  if (trig) last_now_ms = millis();
+  log.above[k] = delta_db >= dyn_thr;
+  log.trigger[k] = trig;
+  log.done_k[k] = now_k;
+}
+
+static uint64_t sample_us(uint64_t t0, uint32_t k) {
+  return t0 + (uint64_t)k * PERIOD_MS * 1000;
+}
+
+static void run_reference(chain_log_t& log) {
+  reset_chain();
+  const uint64_t t0 = now_sim_time_us();
+  for (uint32_t k = 0; k < n_samples; k++) {
+    now_sim_run_until(sample_us(t0, k));
+    begin_sample(k);
+    process(read_dbm_median(), k, k, log);
+  }
+}
+
+// =================== ULP PASS ===================
+typedef struct {
+  uint32_t awake_periods;
+  uint32_t rise_wakes, batch_wakes, false_rises;
+  double run_us;
+} ulp_result_t;
+
+static void run_ulp(float wake_db, chain_log_t& log, ulp_result_t& res) {
+  reset_chain();
+  memset(&res, 0, sizeof(res));
+  ulp_wake_db = wake_db;
+  ulp_rise_wakes = ulp_batch_wakes = ulp_timer_wakes = 0;
+  ulp_rise_ms = 0;
+
+  const uint64_t t0 = now_sim_time_us() + PERIOD_MS * 1000;
+  now_sim_run_until(t0);
+  begin_sample(0);
+  if (!init_ulp_sampling()) exit(1);
+
+  bool asleep = false;
+  bool rise_episode = false, above_in_episode = false;
+  uint32_t next_k = 0;
+  uint64_t cycles = 0;
+  for (uint32_t k = 0; k < n_samples; k++) {
+    now_sim_run_until(sample_us(t0, k));
+    begin_sample(k);
+    const bool wake = ulp_sim_run();
+    cycles += ulp_sim_last_cycles();
+    if (asleep) {
+      if (!wake) continue;
+      const uint32_t rises = ulp_rise_wakes;
+      ulp_woke();
+      asleep = false;
+      if (ulp_rise_wakes != rises) {
+        if (rise_episode && !above_in_episode) res.false_rises++;
+        rise_episode = true;
+        above_in_episode = false;
+      }
+      if (opt_verbose) {
+        printf("    %7.1f min  woke (%s), %u samples waiting, delta %u/%u\n", k * PERIOD_MS / 60000.0,
+               ulp_rise_wakes != rises ? "rise" : "batch", (unsigned)ulp_pending(), ulp_var(ULP_V_DELTA), ulp_var(ULP_V_THR));
+      }
+    }
+    res.awake_periods++;
+    int adc;
+    while (ulp_take_sample(&adc)) {
+      process(dbm_median_from_adc(adc), next_k, k, log);
+      above_in_episode |= log.above[next_k] != 0;
+      next_k++;
+    }
+    if (!ulp_stay_awake()) {
+      ulp_arm();
+      asleep = true;
+    }
+  }
+  if (rise_episode && !above_in_episode) res.false_rises++;
+  res.rise_wakes = ulp_rise_wakes;
+  res.batch_wakes = ulp_batch_wakes;
+  res.run_us = (double)cycles / n_samples * 1e6 / ULP_CLOCK_HZ;
+  // Samples still in the ring at the end count as handled at the end
+  for (uint32_t k = next_k; k < n_samples; k++) log.done_k[k] = n_samples;
+}
+
+// =================== REPORT ===================
+typedef struct {
+  uint32_t n, on_time, late;
+  uint32_t max_late_ms;
+} handled_t;
+
+static void count_handled(const chain_log_t& ref, const chain_log_t& ulp, bool onsets, handled_t& h) {
+  memset(&h, 0, sizeof(h));
+  for (uint32_t k = 0; k < n_samples; k++) {
+    const bool hit = onsets ? ref.above[k] && (k == 0 || !ref.above[k - 1]) : ref.trigger[k] != 0;
+    if (!hit) continue;
+    h.n++;
+    const uint32_t late = ulp.done_k[k] - k;
+    if (late == 0) {
+      h.on_time++;
+    } else {
+      h.late++;
+      h.max_late_ms = max(h.max_late_ms, late * PERIOD_MS);
+    }
+  }
+}
+
+static void parse_args(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--hours" && i + 1 < argc) {
+      opt_hours = std::max(0.1f, (float)atof(argv[++i]));
+    } else if (a == "--seed" && i + 1 < argc) {
+      opt_seed = (uint32_t)atoi(argv[++i]);
+    } else if (a == "--wake-db" && i + 1 < argc) {
+      opt_wake_db = std::max(0.05f, (float)atof(argv[++i]));
+    } else if (a == "-v") {
+      opt_verbose = true;
+    } else {
+      fprintf(stderr, "usage: ulp_check [--hours H] [--seed S] [--wake-db DB] [-v]\n");
+      exit(2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  parse_args(argc, argv);
+  now_sim_set_verbose(false);
+  const uint8_t mac[6] = { 0x24, 0x6f, 0x28, 0, 0, 1 };
+  now_sim_set_current(now_sim_add_node("emf", mac, 1));
+  now_sim_set_analog(now_sim_current(), [](int) { return adc_read(); });
+  ulp_sim_set_adc([](int, int) { return adc_read(); });
+  make_trace();
+
+  int counts[4] = { 0, 0, 0, 0 };
+  for (const trace_event_t& ev : events) counts[ev.kind]++;
+  printf("trace: %.1f h, %u samples every %u ms;", opt_hours, n_samples, (unsigned)PERIOD_MS);
+  for (int i = 0; i < 4; i++) printf(" %d %s%s", counts[i], EVENT_NAMES[i], i < 3 ? "," : "\n");
+
+  chain_log_t ref;
+  ref.above.assign(n_samples, 0);
+  ref.trigger.assign(n_samples, 0);
+  ref.done_k.assign(n_samples, 0);
+  run_reference(ref);
+  uint32_t ref_above = 0, ref_trig = 0;
+  for (uint32_t k = 0; k < n_samples; k++) {
+    ref_above += ref.above[k];
+    ref_trig += ref.trigger[k];
+  }
+  printf("reference chain: %u samples above dyn_thr, %u triggers sent\n", ref_above, ref_trig);
+
+  std::vector<float> levels;
+  if (opt_wake_db > 0) {
+    levels.push_back(opt_wake_db);
+  } else {
+    levels = { 0.2f, 0.35f, 0.5f, 0.7f, 1.0f };
+  }
+  bool header = false, failed = false;
+  for (float db : levels) {
+    chain_log_t ulp = ref;
+    ulp_result_t res;
+    run_ulp(db, ulp, res);
+    if (!header) {
+      printf("ULP program %u words, batch %d, %.0f us per sample\n", (unsigned)ulp_sim_program_words(),
+             ULP_BATCH, res.run_us);
+      printf("  %7s %6s %6s %6s %7s  %-22s %-22s %6s %6s\n", "wake dB", "rises", "false", "batch", "awake",
+             "onsets: now/late/max", "triggers: now/late/max", "missed", "differ");
+      header = true;
+    }
+    handled_t on, tr;
+    count_handled(ref, ulp, true, on);
+    count_handled(ref, ulp, false, tr);
+    uint32_t differ = 0, missed = 0;
+    for (uint32_t k = 0; k < n_samples; k++) {
+      differ += ulp.above[k] != ref.above[k] || ulp.trigger[k] != ref.trigger[k];
+      missed += ref.trigger[k] && !ulp.trigger[k];
+    }
+    char on_s[32], tr_s[32];
+    snprintf(on_s, sizeof(on_s), "%u: %u/%u/%.0fs", on.n, on.on_time, on.late, on.max_late_ms / 1000.0);
+    snprintf(tr_s, sizeof(tr_s), "%u: %u/%u/%.0fs", tr.n, tr.on_time, tr.late, tr.max_late_ms / 1000.0);
+    printf("  %7.2f %6u %6u %6u %6.1f%%  %-22s %-22s %6u %6u\n", db, res.rise_wakes, res.false_rises,
+           res.batch_wakes, 100.0 * res.awake_periods / n_samples, on_s, tr_s, missed, differ);
+    failed |= missed || differ;
+  }
+  if (!ref_trig) {
+    printf("FAIL: no reference trigger, the trace does not exercise the trigger path\n");
+    return 1;
+  }
+  if (failed) {
+    printf("FAIL: the ULP pass missed a trigger or decided differently\n");
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -5,45 +5,465 @@
   #include "config.h"  // ESP32-CAM config
 #elif defined(EMF_SENSOR)
   #include "emf_config.h"  // EMF sensor config
-#else
-  // Default config values
+#endif
+
+// Default config values (camera-side settings the EMF config does not define)
+#ifndef NOW_CHANNEL
   #define NOW_CHANNEL 0
+#endif
+#ifndef ACTIVE_WINDOW_MS
   #define ACTIVE_WINDOW_MS 20000
+#endif
+#ifndef LED_PIN
   #define LED_PIN 4
   #define LED_ACTIVE_HIGH 1
 #endif
+#ifndef SYNC_PERIOD_MS
+  #define SYNC_PERIOD_MS 300000
+  #define SYNC_RETRY_MS 2000
+#endif
+#ifndef NOW_CHANNEL_SCAN
+  #define NOW_CHANNEL_SCAN 0
+  #define NOW_REPROBE_FAILS 3
+  #define NOW_PROBE_RETRY_MS 1000
+  #define NOW_SCAN_DWELL_MS 30
+  #define NOW_SCAN_BACKOFF_MS 5000
+  #define NOW_LINK_CHECK_MS 60000
+#endif
+
+#ifndef MEMT_HEARTBEAT_MS
+  #define MEMT_HEARTBEAT_MS 0
+#endif
+
+#ifndef RDV_ENABLE
+  #define RDV_ENABLE 0
+  #define RDV_PERIOD_MS 1000
+  #define RDV_SLOT_MS 20
+  #define RDV_GUARD_MS 5
+  #define RDV_MISS_MAX 3
+#endif
+
+static const uint8_t NOW_CHANNEL_MAX = 13;
 
 // =================== GLOBAL VARIABLES ===================
 volatile uint32_t g_trigger_until_ms = 0;
+// Triggers (RX callback) and the window controller (loop) both move the
+// deadline; every read-modify-write of it is one g_trigger_mux section
+static portMUX_TYPE g_trigger_mux = portMUX_INITIALIZER_UNLOCKED;
 bool g_peer_added = false;
 // EMF RF Sensor MAC - must match CAM_MAC in EMF.ino
 uint8_t EMF_SENSOR_MAC[6] = { 0x78, 0x42, 0x1C, 0x6D, 0xBD, 0x68 };
+uint32_t g_heartbeats = 0;
+static uint8_t  g_heartbeat_seq = 0;
+static uint32_t g_heartbeat_last_ms = 0;  // first one a period after boot
+
+// Clock sync state
+time_sync_t g_time_sync = {};
+int64_t g_epoch_base_ms = 0;              // from the master, 0 = unknown
+static uint8_t  g_sync_seq = 0;
+static int64_t  g_sync_req_t1 = 0;        // t1 of the last SYNC_REQ
+static int64_t  g_sync_status_t1 = 0;     // t1 of the last STATUS_V2
+static uint32_t g_sync_last_req_ms = 0;
+static uint32_t g_sync_last_sample_ms = 0;
+static now_rx_hook_t g_now_rx_hook = nullptr;
+
+// Stamps received by onNowRecv (WiFi task), applied by now_sync_poll() so
+// that g_time_sync and the t1 bookkeeping are only written from loop()
+#define SYNC_QUEUE_LEN 4
+typedef struct {
+  sync_stamp_t st;
+  int64_t t4;
+} sync_sample_t;
+static portMUX_TYPE  g_sync_mux = portMUX_INITIALIZER_UNLOCKED;
+static sync_sample_t g_sync_queue[SYNC_QUEUE_LEN];
+static uint8_t       g_sync_queued = 0;
+
+// Channel discovery state
+bool     now_channel_scan = NOW_CHANNEL_SCAN;
+uint8_t  g_now_channel    = 0;
+uint32_t g_now_scans      = 0;
+RTC_DATA_ATTR uint8_t g_now_rtc_channel = 0;     // survives deep sleep
+static volatile uint8_t  g_tx_fail_streak = 0;   // consecutive FAILs towards the EMF node
+static volatile uint32_t g_link_ok_count = 0;    // MAC ACKs + frames heard from the EMF node
+static volatile uint32_t g_link_ok_ms = 0;
+static volatile bool     g_probe_failed = false;
+static uint8_t  g_probe_seq = 0;
+static uint32_t g_probe_sent_ms = 0;
+static bool     g_scanning = false;
+static uint8_t  g_scan_ch = 0;
+static uint8_t  g_scan_left = 0;
+static uint32_t g_scan_mark = 0;                 // g_link_ok_count when this channel was probed
+static uint32_t g_scan_started_ms = 0;
+static uint32_t g_scan_outage_ms = 0;            // last good contact before the scan
+static uint32_t g_scan_backoff_ms = 0;
+
+// Rendezvous state
+bool     now_rdv_enabled = RDV_ENABLE;
+uint32_t now_rdv_period_ms = RDV_PERIOD_MS;
+bool     g_rdv_joined    = false;
+uint32_t g_rdv_polls     = 0;
+uint32_t g_rdv_missed    = 0;
+uint32_t g_rdv_triggers  = 0;
+uint32_t g_rdv_slept_ms  = 0;
+static uint32_t g_rdv_slot_ms     = 0;    // local millis() of the next slot
+static uint32_t g_rdv_poll_ms     = 0;
+static bool     g_rdv_waiting     = false;
+static uint8_t  g_rdv_seq         = 0;
+static int64_t  g_rdv_t1          = 0;
+static uint8_t  g_rdv_miss_streak = 0;
+// Last RDV answer from onNowRecv (WiFi task), taken by now_rdv_poll() so
+// that the g_rdv_* state above is only written from loop()
+static portMUX_TYPE g_rdv_mux = portMUX_INITIALIZER_UNLOCKED;
+static rdv_msg_t    g_rdv_reply;
+static uint32_t     g_rdv_reply_ms = 0;   // millis() when it arrived
+static bool         g_rdv_reply_full = false;
+
+// Last status, resent after a rescan if it went out during the outage
+static status_v2_msg_t g_last_status = {};
+static uint32_t g_last_status_ms = 0;
+
+// =================== CLOCK SYNC ===================
+// RX callback side: queue the stamp (dropped if loop() is 4 behind)
+static void now_queue_stamp(const sync_stamp_t& st, int64_t t4) {
+  portENTER_CRITICAL(&g_sync_mux);
+  if (g_sync_queued < SYNC_QUEUE_LEN) g_sync_queue[g_sync_queued++] = { st, t4 };
+  portEXIT_CRITICAL(&g_sync_mux);
+}
+
+static void now_apply_stamp(const sync_stamp_t& st, int64_t t4) {
+  if (st.epoch_base_ms) g_epoch_base_ms = st.epoch_base_ms;
+  if (st.t1_echo == 0) return;
+  if (st.t1_echo != g_sync_req_t1 && st.t1_echo != g_sync_status_t1 &&
+      st.t1_echo != g_rdv_t1) return;  // stale echo
+
+  if (time_sync_add_sample(g_time_sync, st.t1_echo, st.t2, st.t3, t4)) {
+    g_sync_last_sample_ms = millis();
+  }
+  if (st.t1_echo == g_sync_req_t1) {
+    g_sync_req_t1 = 0;
+    Serial.printf("[SYNC] offset=%lldus delay=%uus drift=%.1fppm\n",
+                  (long long)g_time_sync.ref_offset_us, (unsigned)g_time_sync.delay_us,
+                  g_time_sync.drift_ppm);
+  }
+  if (st.t1_echo == g_sync_status_t1) g_sync_status_t1 = 0;
+  if (st.t1_echo == g_rdv_t1) g_rdv_t1 = 0;
+}
+
+void now_sync_request() {
+  if (!g_peer_added && !now_add_peer_if_needed(EMF_SENSOR_MAC)) return;
+
+  sync_req_msg_t m{ NOW_MSG_MAGIC, NOW_MSG_SYNC_REQ, ++g_sync_seq, 0 };
+  g_sync_last_req_ms = millis();
+  m.t1 = time_sync_local_us();
+  g_sync_req_t1 = m.t1;
+  esp_err_t rc = esp_now_send(EMF_SENSOR_MAC, (const uint8_t*)&m, sizeof(m));
+  if (rc != ESP_OK) {
+    Serial.printf("[SYNC] req rc=%d\n", (int)rc);
+  }
+}
+
+// Apply the queued stamps, then resync explicitly only when piggybacked
+// stamps have not kept us fresh
+void now_sync_poll() {
+  sync_sample_t q[SYNC_QUEUE_LEN];
+  portENTER_CRITICAL(&g_sync_mux);
+  const uint8_t n = g_sync_queued;
+  memcpy(q, g_sync_queue, n * sizeof(q[0]));
+  g_sync_queued = 0;
+  portEXIT_CRITICAL(&g_sync_mux);
+  for (uint8_t i = 0; i < n; i++) now_apply_stamp(q[i].st, q[i].t4);
+
+  const uint32_t now = millis();
+  const uint32_t interval = g_time_sync.synced ? SYNC_PERIOD_MS : SYNC_RETRY_MS;
+  if (now - g_sync_last_req_ms >= interval && now - g_sync_last_sample_ms >= interval) {
+    now_sync_request();
+  }
+}
 
 // =================== ESP-NOW CALLBACKS ===================
-void onNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
-  if (len < (int)sizeof(trigger_msg_t)) return;
-  trigger_msg_t m;
-  memcpy(&m, data, sizeof(m));
+static void now_on_trigger(float delta_db) {
+  portENTER_CRITICAL(&g_trigger_mux);
   g_trigger_until_ms = millis() + ACTIVE_WINDOW_MS;
+  portEXIT_CRITICAL(&g_trigger_mux);
 
   // LED visual acknowledgment
   digitalWrite(LED_PIN, LED_ACTIVE_HIGH ? HIGH : LOW);
-  Serial.printf("[NOW] Trigger delta_db=%.3f\n", m.delta_db);
+  Serial.printf("[NOW] Trigger delta_db=%.3f\n", delta_db);
+}
+
+bool now_trigger_window_replace(uint32_t seen_until, uint32_t until) {
+  portENTER_CRITICAL(&g_trigger_mux);
+  const bool same = g_trigger_until_ms == seen_until;
+  if (same) g_trigger_until_ms = until;
+  portEXIT_CRITICAL(&g_trigger_mux);
+  return same;
+}
+
+// RX callback side: keep the newest answer for loop()
+static void now_post_rdv(const rdv_msg_t& m) {
+  const uint32_t now = millis();
+  portENTER_CRITICAL(&g_rdv_mux);
+  g_rdv_reply = m;
+  g_rdv_reply_ms = now;
+  g_rdv_reply_full = true;
+  portEXIT_CRITICAL(&g_rdv_mux);
+}
+
+static void now_on_rdv(const rdv_msg_t& m, uint32_t recv_ms) {
+  if (!g_rdv_waiting || m.seq != g_rdv_seq) return;
+  g_rdv_waiting = false;
+  g_rdv_miss_streak = 0;
+  if (!g_rdv_joined) {
+    Serial.printf("[RDV] joined: slot every %u ms\n", (unsigned)m.period_ms);
+  }
+  g_rdv_joined = true;
+  g_rdv_slot_ms = recv_ms + m.next_slot_ms;
+  if (m.trigger) {
+    g_rdv_triggers++;
+    Serial.printf("[RDV] trigger held %u ms\n", (unsigned)m.held_ms);
+    now_on_trigger(m.delta_db);
+  }
+}
+
+static void now_link_ok() {
+  g_tx_fail_streak = 0;
+  g_link_ok_count++;
+  g_link_ok_ms = millis();
+}
+
+void onNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
+  const int64_t t4 = time_sync_local_us();
+  if (memcmp(mac, EMF_SENSOR_MAC, 6) == 0) now_link_ok();
+
+  if (len >= 2 && data[0] == NOW_MSG_MAGIC) {
+    if (data[1] == NOW_MSG_PROBE_ACK && len == (int)sizeof(probe_msg_t)) {
+      // now_link_ok() above already marked the channel as good
+    } else if (data[1] == NOW_MSG_SYNC_RESP && len == (int)sizeof(sync_resp_msg_t)) {
+      sync_resp_msg_t m;
+      memcpy(&m, data, sizeof(m));
+      now_queue_stamp(m.sync, t4);
+    } else if (data[1] == NOW_MSG_RDV && len == (int)sizeof(rdv_msg_t)) {
+      rdv_msg_t m;
+      memcpy(&m, data, sizeof(m));
+      now_queue_stamp(m.sync, t4);
+      now_post_rdv(m);
+    } else if (data[1] == NOW_MSG_TRIGGER_V2 && len == (int)sizeof(trigger_v2_msg_t)) {
+      trigger_v2_msg_t m;
+      memcpy(&m, data, sizeof(m));
+      now_queue_stamp(m.sync, t4);
+      now_on_trigger(m.delta_db);
+    } else if (g_now_rx_hook) {
+      g_now_rx_hook(mac, data, len);
+    }
+    return;
+  }
+
+  if (len < (int)sizeof(trigger_msg_t)) return;
+  trigger_msg_t m;
+  memcpy(&m, data, sizeof(m));
+  now_on_trigger(m.delta_db);
 }
 
 void now_on_send(const uint8_t* mac_addr, esp_now_send_status_t status) {
+  if (memcmp(mac_addr, EMF_SENSOR_MAC, 6) == 0) {
+    if (status == ESP_NOW_SEND_SUCCESS) {
+      now_link_ok();
+    } else {
+      if (g_tx_fail_streak < 255) g_tx_fail_streak++;
+      g_probe_failed = true;
+    }
+  }
   Serial.printf("[NOW] TX → %02X:%02X:%02X:%02X:%02X:%02X  %s\n",
     mac_addr[0], mac_addr[1], mac_addr[2], mac_addr[3], mac_addr[4], mac_addr[5],
     status == ESP_NOW_SEND_SUCCESS ? "OK" : "FAIL");
 }
 
+void now_set_rx_hook(now_rx_hook_t hook) {
+  g_now_rx_hook = hook;
+}
+
+// On-air time of one attempt at the 1 Mbps ESP-NOW default rate:
+// 192 us long preamble + ~43 B MAC header/vendor IE/FCS + payload
+uint32_t now_airtime_us(size_t len) {
+  return 192 + (uint32_t)(len + 43) * 8;
+}
+
+// =================== CHANNEL DISCOVERY ===================
+static void now_send_probe() {
+  uint8_t ch = 0;
+  wifi_second_chan_t sec;
+  esp_wifi_get_channel(&ch, &sec);
+  probe_msg_t m{ NOW_MSG_MAGIC, NOW_MSG_PROBE, ++g_probe_seq, ch };
+  g_probe_failed = false;
+  g_probe_sent_ms = millis();
+  esp_now_send(EMF_SENSOR_MAC, (const uint8_t*)&m, sizeof(m));
+}
+
+static void now_scan_step() {
+  g_scan_ch = (g_scan_ch % NOW_CHANNEL_MAX) + 1;
+  g_scan_left--;
+  esp_wifi_set_channel(g_scan_ch, WIFI_SECOND_CHAN_NONE);
+  g_scan_mark = g_link_ok_count;
+  now_send_probe();
+}
+
+static void now_scan_start(const char* why) {
+  uint8_t ch = 0;
+  wifi_second_chan_t sec;
+  esp_wifi_get_channel(&ch, &sec);
+  Serial.printf("[NOW] channel scan (%s), was ch=%u\n", why, (unsigned)ch);
+  g_scanning = true;
+  g_now_scans++;
+  g_scan_started_ms = millis();
+  g_scan_outage_ms = g_link_ok_ms;
+  g_scan_ch = ch;                        // sweep starts at the next channel,
+  g_scan_left = NOW_CHANNEL_MAX;         // the old one is tried last
+  now_scan_step();
+}
+
+static void now_scan_found() {
+  uint8_t ch = g_scan_ch;
+  g_scanning = false;
+  g_tx_fail_streak = 0;
+  g_now_channel = ch;
+  g_now_rtc_channel = ch;
+  Serial.printf("[NOW] EMF node found on ch=%u after %u ms\n",
+                (unsigned)ch, (unsigned)(millis() - g_scan_started_ms));
+
+  // A status sent into the outage never arrived: send it again (original event time)
+  if (g_last_status_ms && (int32_t)(g_last_status_ms - g_scan_outage_ms) >= 0) {
+    g_last_status.t1 = time_sync_local_us();
+    g_sync_status_t1 = g_last_status.t1;
+    esp_now_send(EMF_SENSOR_MAC, (const uint8_t*)&g_last_status, sizeof(g_last_status));
+  }
+  now_sync_request();   // re-anchor the clock over the new path
+}
+
+// Keep the EMF node reachable: probe when sends fail or the link has been
+// quiet, rescan all channels after NOW_REPROBE_FAILS failures. Call from loop().
+void now_channel_poll() {
+  if (!now_channel_scan) return;
+  const uint32_t now = millis();
+
+  if (g_scanning) {
+    if (g_link_ok_count != g_scan_mark) {
+      now_scan_found();
+    } else if (g_probe_failed || now - g_probe_sent_ms >= NOW_SCAN_DWELL_MS) {
+      if (g_scan_left > 0) {
+        now_scan_step();
+      } else {
+        g_scanning = false;
+        g_scan_backoff_ms = now;
+        Serial.println("[NOW] channel scan: no answer");
+      }
+    }
+    return;
+  }
+
+  if (g_scan_backoff_ms && now - g_scan_backoff_ms < NOW_SCAN_BACKOFF_MS) return;
+  if (g_scan_backoff_ms) {
+    g_scan_backoff_ms = 0;
+    now_scan_start("retry");
+    return;
+  }
+
+  if (g_tx_fail_streak >= NOW_REPROBE_FAILS) {
+    now_scan_start("send failures");
+  } else if (g_tx_fail_streak > 0 ? now - g_probe_sent_ms >= NOW_PROBE_RETRY_MS
+                                   : (now - g_link_ok_ms >= NOW_LINK_CHECK_MS &&
+                                      now - g_probe_sent_ms >= NOW_LINK_CHECK_MS)) {
+    now_send_probe();
+  }
+}
+
+bool now_channel_scanning() {
+  return g_scanning;
+}
+
+// =================== RENDEZVOUS ===================
+// Between slots the radio may sleep: the EMF node holds triggers for the
+// next poll, so trigger latency is bounded by the period (plus one period
+// per missed poll). Until the first answer, and after RDV_MISS_MAX missed
+// ones, the camera listens all the time and the EMF node sends at once.
+static void now_rdv_send_poll() {
+  if (!g_peer_added && !now_add_peer_if_needed(EMF_SENSOR_MAC)) return;
+  rdv_poll_msg_t m{ NOW_MSG_MAGIC, NOW_MSG_RDV_POLL, ++g_rdv_seq, now_rdv_period_ms, RDV_SLOT_MS, 0 };
+  g_rdv_poll_ms = millis();
+  g_rdv_waiting = true;
+  g_rdv_polls++;
+  m.t1 = time_sync_local_us();
+  g_rdv_t1 = m.t1;
+  esp_now_send(EMF_SENSOR_MAC, (const uint8_t*)&m, sizeof(m));
+}
+
+// Poll at each slot start; call from loop()
+void now_rdv_poll() {
+  rdv_msg_t reply;
+  uint32_t reply_ms = 0;
+  portENTER_CRITICAL(&g_rdv_mux);
+  const bool got = g_rdv_reply_full;
+  if (got) {
+    reply = g_rdv_reply;
+    reply_ms = g_rdv_reply_ms;
+    g_rdv_reply_full = false;
+  }
+  portEXIT_CRITICAL(&g_rdv_mux);
+  if (got) now_on_rdv(reply, reply_ms);
+
+  if (!now_rdv_enabled || g_scanning) return;
+  const uint32_t now = millis();
+
+  if (g_rdv_waiting) {
+    if (now - g_rdv_poll_ms < RDV_SLOT_MS) return;
+    g_rdv_waiting = false;
+    g_rdv_missed++;
+    if (g_rdv_joined && ++g_rdv_miss_streak >= RDV_MISS_MAX) {
+      g_rdv_joined = false;
+      Serial.printf("[RDV] %u slots missed, listening all the time\n", (unsigned)g_rdv_miss_streak);
+    }
+    // Next slot on the old schedule; the EMF node keeps holding triggers
+    if (g_rdv_joined) g_rdv_slot_ms += now_rdv_period_ms;
+    return;
+  }
+
+  if (g_rdv_joined ? (int32_t)(now - g_rdv_slot_ms) >= 0 : now - g_rdv_poll_ms >= now_rdv_period_ms) {
+    now_rdv_send_poll();
+  }
+}
+
+// How long the radio may be off from now (0 = keep listening)
+uint32_t now_rdv_sleep_ms() {
+  if (!now_rdv_enabled || !g_rdv_joined || g_rdv_waiting || g_scanning) return 0;
+  const uint32_t now = millis();
+  if ((int32_t)(g_trigger_until_ms - now) > 0) return 0;
+  if (g_tx_fail_streak > 0) return 0;      // probe retry pending
+  const int32_t left = (int32_t)(g_rdv_slot_ms - now) - RDV_GUARD_MS;
+  return left > 0 ? (uint32_t)left : 0;
+}
+
+void now_rdv_slept(uint32_t ms) {
+  g_rdv_slept_ms += ms;
+}
+
+void now_rdv_report() {
+  if (!now_rdv_enabled) return;
+  const uint32_t up = millis();
+  Serial.printf("[RDV] %s, slot every %u ms (trigger latency <= %u ms), radio on %.1f%%, "
+                "%lu polls, %lu missed, %lu triggers in slots\n",
+                g_rdv_joined ? "joined" : "listening", (unsigned)now_rdv_period_ms,
+                (unsigned)(now_rdv_period_ms + RDV_SLOT_MS),
+                up ? 100.0f * (up - min(up, g_rdv_slept_ms)) / up : 100.0f,
+                (unsigned long)g_rdv_polls, (unsigned long)g_rdv_missed,
+                (unsigned long)g_rdv_triggers);
+}
+
 // =================== PEER MANAGEMENT ===================
 bool now_add_peer_if_needed(const uint8_t peer_mac[6]) {
   if (g_peer_added) return true;
 
   esp_now_peer_info_t peer{};
   memcpy(peer.peer_addr, peer_mac, 6);
-  peer.channel = NOW_CHANNEL;     // must match channel
+  peer.channel = now_channel_scan ? 0 : NOW_CHANNEL;   // 0 = whatever channel we are on
   peer.encrypt = false;
 
   if (esp_now_add_peer(&peer) == ESP_OK) {
@@ -60,16 +480,110 @@ bool now_add_peer_if_needed(const uint8_t peer_mac[6]) {
 void now_send_status(uint8_t occupied, float conf) {
   if (!g_peer_added && !now_add_peer_if_needed(EMF_SENSOR_MAC)) return;
 
-  status_msg_t m{1, occupied, conf, millis()};
+  const int64_t now_us = time_sync_local_us();
+  status_v2_msg_t m{};
+  m.magic    = NOW_MSG_MAGIC;
+  m.type     = NOW_MSG_STATUS_V2;
+  m.occupied = occupied;
+  m.synced   = g_time_sync.synced ? 1 : 0;
+  m.car_conf = conf;
+  m.ms       = millis();
+  if (g_time_sync.synced) {
+    m.event_us    = time_sync_to_master(g_time_sync, now_us);
+    m.epoch_ms    = g_epoch_base_ms ? g_epoch_base_ms + m.event_us / 1000 : 0;
+    m.accuracy_us = time_sync_accuracy_us(g_time_sync, now_us);
+  } else {
+    m.event_us    = now_us;
+    m.accuracy_us = UINT32_MAX;
+  }
+  m.t1 = time_sync_local_us();
+  g_sync_status_t1 = m.t1;
+  g_last_status = m;
+  g_last_status_ms = millis();
   esp_err_t rc = esp_now_send(EMF_SENSOR_MAC, (const uint8_t*)&m, sizeof(m));
   if (rc != ESP_OK) {
     Serial.printf("[NOW] send rc=%d\n", (int)rc);
   }
 }
 
+// =================== HEARTBEAT ===================
+void now_heartbeat_poll() {
+  if (!MEMT_HEARTBEAT_MS || g_scanning) return;
+  const uint32_t now = millis();
+  if (now - g_heartbeat_last_ms < MEMT_HEARTBEAT_MS) return;
+  g_heartbeat_last_ms = now;
+  if (!g_peer_added && !now_add_peer_if_needed(EMF_SENSOR_MAC)) return;
+
+  heartbeat_msg_t m{};
+  m.magic = NOW_MSG_MAGIC;
+  m.type  = NOW_MSG_HEARTBEAT;
+  m.seq   = ++g_heartbeat_seq;
+  memt_fill(m.mem);
+  if (esp_now_send(EMF_SENSOR_MAC, (const uint8_t*)&m, sizeof(m)) == ESP_OK) g_heartbeats++;
+}
+
+// =================== DEEP SLEEP RESUME ===================
+void now_resume_save(now_resume_t& st) {
+  const uint32_t now = millis();
+  const int64_t now_us = time_sync_local_us();
+  memset(&st, 0, sizeof(st));
+  st.channel       = g_now_channel;
+  st.sync_seq      = g_sync_seq;
+  st.probe_seq     = g_probe_seq;
+  st.rdv_seq       = g_rdv_seq;
+  st.rdv_joined    = g_rdv_joined && !g_rdv_waiting;
+  st.rdv_period_ms = now_rdv_period_ms;
+  st.rdv_slot_in_ms = (int32_t)(g_rdv_slot_ms - now);
+  st.sync          = g_time_sync;
+  if (g_time_sync.synced) {
+    st.master_us   = time_sync_to_master(g_time_sync, now_us);
+    st.accuracy_us = time_sync_accuracy_us(g_time_sync, now_us);
+  }
+  st.epoch_base_ms = g_epoch_base_ms;
+}
+
+// The local clock restarted at boot: re-anchor the estimate on the master
+// time carried over the sleep, widened by the RTC clock's error
+static void now_resume_restore(const now_resume_t& st) {
+  const uint32_t now = millis();
+  g_now_channel   = st.channel;
+  g_sync_seq      = st.sync_seq;
+  g_probe_seq     = st.probe_seq;
+  g_rdv_seq       = st.rdv_seq;
+  g_rdv_joined    = st.rdv_joined;
+  g_rdv_slot_ms   = (uint32_t)(st.rdv_slot_in_ms - (int32_t)(st.asleep_us / 1000));
+  g_rdv_poll_ms   = now;
+  g_epoch_base_ms = st.epoch_base_ms;
+  if (!st.sync.synced) return;
+
+  const int64_t local = time_sync_local_us();
+  const uint64_t acc = (uint64_t)st.accuracy_us + st.asleep_err_us;
+  g_time_sync = st.sync;
+  g_time_sync.ref_local_us     = local;
+  g_time_sync.ref_offset_us    = st.master_us + st.asleep_us;   // master at local time 0
+  g_time_sync.anchor_local_us  = local;
+  g_time_sync.anchor_offset_us = g_time_sync.ref_offset_us;
+  g_time_sync.delay_us         = (uint32_t)min<uint64_t>(2 * acc, UINT32_MAX);
+  g_sync_last_sample_ms = now;
+}
+
 // =================== INITIALIZATION ===================
-bool init_now_rx_tx() {
-  delay(3000);  // settle delay
+bool init_now_rx_tx(const now_resume_t* resume) {
+  if (!resume) delay(3000);  // settle delay
+  // Link state starts over (the host simulator re-inits without a reset)
+  g_trigger_until_ms = 0;
+  g_peer_added = false;
+  g_scanning = false;
+  g_tx_fail_streak = 0;
+  g_scan_backoff_ms = 0;
+  g_last_status_ms = 0;
+  g_probe_sent_ms = g_rdv_poll_ms = 0;
+  g_sync_last_req_ms = g_sync_last_sample_ms = 0;
+  g_sync_req_t1 = g_sync_status_t1 = g_rdv_t1 = 0;
+  g_sync_queued = 0;
+  g_rdv_joined = g_rdv_waiting = false;
+  g_rdv_miss_streak = 0;
+  g_rdv_reply_full = false;
   WiFi.mode(WIFI_STA);
 
   // Channel configuration (0 = follow STA channel to match EMF sensor)
@@ -83,6 +597,18 @@ bool init_now_rx_tx() {
     Serial.println("[NOW] Following STA channel (matches EMF sensor)");
   }
 
+  // Start on the channel that worked before deep sleep
+  if (resume && resume->channel >= 1 && resume->channel <= NOW_CHANNEL_MAX) {
+    g_now_rtc_channel = resume->channel;
+  }
+  if (now_channel_scan && g_now_rtc_channel >= 1 && g_now_rtc_channel <= NOW_CHANNEL_MAX) {
+    esp_wifi_set_channel(g_now_rtc_channel, WIFI_SECOND_CHAN_NONE);
+    Serial.printf("[NOW] cached ch=%u\n", (unsigned)g_now_rtc_channel);
+  }
+  wifi_second_chan_t sec;
+  esp_wifi_get_channel(&g_now_channel, &sec);
+  g_link_ok_ms = millis();
+
   if (esp_now_init() != ESP_OK) {
     Serial.println("[NOW] init fail");
     return false;
@@ -98,6 +624,14 @@ bool init_now_rx_tx() {
   esp_now_register_send_cb(now_on_send);
   now_add_peer_if_needed(EMF_SENSOR_MAC);
 
+  // First clock sync; now_sync_poll() retries until it lands
+  time_sync_reset(g_time_sync);
+  if (resume) {
+    now_resume_restore(*resume);
+  } else {
+    now_sync_request();
+  }
+
   Serial.println("[NOW] RX+TX ready");
   return true;
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <WiFi.h>
 #include <esp_now.h>
 #include <esp_wifi.h>
+#include "time_sync.h"
+#include "mem_telemetry.h"
 
 // =================== MESSAGE STRUCTURES ===================
 // Trigger packet (must match sender)
@@ -21,16 +23,214 @@ typedef struct {
   uint32_t ms;          // millis() at state change
 } status_msg_t;
 
+// =================== TYPED FRAMES ===================
+// Newer frames start with NOW_MSG_MAGIC + a type byte. The legacy frames
+// above are told apart by length (8/10/12 B), so typed frames never use those.
+#define NOW_MSG_MAGIC         0xE5
+#define NOW_MSG_SYNC_REQ      0x01   // CAM → EMF
+#define NOW_MSG_SYNC_RESP     0x02   // EMF → CAM
+#define NOW_MSG_TRIGGER_V2    0x03   // EMF → CAM
+#define NOW_MSG_STATUS_V2     0x04   // CAM → EMF
+#define NOW_MSG_EVIDENCE      0x05   // CAM → EMF, one thumbnail fragment
+#define NOW_MSG_EVIDENCE_ACK  0x06   // EMF → CAM, done flag / missing fragments
+#define NOW_MSG_PROBE         0x07   // CAM → EMF, channel discovery
+#define NOW_MSG_PROBE_ACK     0x08   // EMF → CAM
+#define NOW_MSG_RDV_POLL      0x09   // CAM → EMF, listening now
+#define NOW_MSG_RDV           0x0A   // EMF → CAM, held trigger + next listen slot
+#define NOW_MSG_HEARTBEAT     0x0B   // CAM → EMF, memory telemetry
+
+// Time-transfer stamps carried by every EMF (time master) → CAM frame
+typedef struct __attribute__((packed)) {
+  int64_t  t1_echo;        // CAM TX time being answered (0 = none)
+  int64_t  t2;             // master RX time of that frame
+  int64_t  t3;             // master TX time of this frame
+  int64_t  epoch_base_ms;  // epoch ms at master time 0 (0 = master has no wall clock)
+} sync_stamp_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  seq;
+  int64_t  t1;             // CAM TX time
+} sync_req_msg_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  seq;
+  sync_stamp_t sync;
+} sync_resp_msg_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  float    delta_db;
+  uint32_t ms;             // EMF millis() at trigger
+  sync_stamp_t sync;
+} trigger_v2_msg_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  occupied;       // 1 = OCCUPIED, 0 = VACANT
+  uint8_t  synced;         // 1 = event_us is in master time
+  float    car_conf;
+  uint32_t ms;             // CAM millis() at state change
+  int64_t  event_us;       // state change, master timebase (EMF esp_timer)
+  int64_t  epoch_ms;       // state change, epoch ms (0 = unknown)
+  uint32_t accuracy_us;    // expected |error| of event_us (UINT32_MAX = unsynced)
+  int64_t  t1;             // CAM TX time, answered by the next EMF frame
+} status_v2_msg_t;
+
+// Evidence thumbnail: JPEG split into fragments of up to EVIDENCE_FRAG_PAYLOAD
+// bytes; the EMF node NACKs missing fragments with a bitmap.
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint16_t img_id;
+  uint8_t  bay;
+  uint8_t  frag_idx;
+  uint8_t  frag_count;
+  uint16_t total_len;      // JPEG bytes; payload follows the header
+} evidence_hdr_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint16_t img_id;
+  uint8_t  bay;
+  uint8_t  frag_count;
+  uint8_t  done;           // 1 = image complete
+  uint32_t missing;        // bit i = fragment i not received
+} evidence_ack_msg_t;
+
+// Channel discovery: the camera probes the EMF node on each channel until
+// a PROBE_ACK (or MAC-level ACK) comes back
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  seq;            // echoed in the ACK
+  uint8_t  channel;        // sender's home channel
+} probe_msg_t;
+
+// Rendezvous: a duty-cycled camera polls at the start of each listen slot;
+// the EMF node holds triggers until then and answers with the time to the
+// next slot on its schedule
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  seq;            // echoed in the answer
+  uint32_t period_ms;      // slot period the camera wants
+  uint16_t slot_ms;        // how long it listens per slot
+  int64_t  t1;             // CAM TX time
+} rdv_poll_msg_t;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  seq;
+  uint8_t  trigger;        // 1 = a held trigger is delivered
+  float    delta_db;
+  uint32_t held_ms;        // how long the trigger waited for this slot
+  uint32_t next_slot_ms;   // from this frame's TX to the next slot
+  uint32_t period_ms;      // granted slot period
+  sync_stamp_t sync;
+} rdv_msg_t;
+
+// Every MEMT_HEARTBEAT_MS: the camera's memory summary, shown on the EMF /json
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;
+  uint8_t  type;
+  uint8_t  seq;
+  memt_summary_t mem;
+} heartbeat_msg_t;
+
+#define EVIDENCE_MAX_FRAGS     32
+#define EVIDENCE_FRAG_PAYLOAD  (ESP_NOW_MAX_DATA_LEN - sizeof(evidence_hdr_t))
+#define EVIDENCE_MAX_BYTES     (EVIDENCE_MAX_FRAGS * EVIDENCE_FRAG_PAYLOAD)
+#define EVIDENCE_FRAG_MIN_LEN  13     // short last fragments are padded past legacy lengths
+
+#define NOW_IS_LEGACY_LEN(n)  ((n) == 8 || (n) == 10 || (n) == 12)
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(sync_req_msg_t)),   "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(sync_resp_msg_t)),  "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(trigger_v2_msg_t)), "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(status_v2_msg_t)),  "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(evidence_ack_msg_t)), "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(probe_msg_t)),      "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(rdv_poll_msg_t)),   "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(rdv_msg_t)),        "typed frame collides with legacy length");
+static_assert(!NOW_IS_LEGACY_LEN(sizeof(heartbeat_msg_t)),  "typed frame collides with legacy length");
+static_assert(sizeof(heartbeat_msg_t) <= ESP_NOW_MAX_DATA_LEN, "heartbeat exceeds one ESP-NOW frame");
+static_assert(EVIDENCE_MAX_FRAGS <= 32, "missing bitmap is 32 bits");
+
+// Link state carried across camera deep sleep (kept in RTC memory by the
+// caller). now_resume_save() fills it before sleeping; on wake the caller
+// sets asleep_us / asleep_err_us from the RTC clock and passes it to
+// init_now_rx_tx(), which then skips the settle delay, channel search and
+// first clock sync.
+typedef struct {
+  uint8_t  channel;        // channel the EMF node was reached on
+  uint8_t  sync_seq;
+  uint8_t  probe_seq;
+  uint8_t  rdv_seq;
+  uint8_t  rdv_joined;
+  uint32_t rdv_period_ms;
+  int32_t  rdv_slot_in_ms; // next slot, from the save
+  time_sync_t sync;
+  int64_t  master_us;      // master time at the save
+  uint32_t accuracy_us;    // its accuracy
+  int64_t  epoch_base_ms;
+  int64_t  asleep_us;      // save to this boot's local time 0, RTC clock
+  uint32_t asleep_err_us;  // RTC clock error over that time
+} now_resume_t;
+
+// Receives typed frames esp_now_comm does not handle itself (e.g. evidence ACKs)
+typedef void (*now_rx_hook_t)(const uint8_t* mac, const uint8_t* data, int len);
+
 // =================== FUNCTION DECLARATIONS ===================
-bool init_now_rx_tx();
+bool init_now_rx_tx(const now_resume_t* resume = nullptr);   // nullptr = cold boot
+void now_resume_save(now_resume_t& st);
 void now_send_status(uint8_t occupied, float conf);
+void now_heartbeat_poll();
 void onNowRecv(const uint8_t* mac, const uint8_t* data, int len);
 void now_on_send(const uint8_t* mac_addr, esp_now_send_status_t status);
 bool now_add_peer_if_needed(const uint8_t peer_mac[6]);
+void now_sync_request();
+void now_sync_poll();
+void now_channel_poll();
+bool now_channel_scanning();
+void now_set_rx_hook(now_rx_hook_t hook);
+void now_rdv_poll();
+// Move the active-window deadline from seen_until to until, unless a trigger
+// changed it meanwhile (false)
+bool now_trigger_window_replace(uint32_t seen_until, uint32_t until);
+uint32_t now_rdv_sleep_ms();
+void now_rdv_slept(uint32_t ms);
+void now_rdv_report();
+uint32_t now_airtime_us(size_t len);
 
 // =================== GLOBAL VARIABLES ===================
 extern volatile uint32_t g_trigger_until_ms;
 extern bool g_peer_added;
 extern uint8_t EMF_SENSOR_MAC[6];
+extern uint32_t g_heartbeats;         // heartbeats sent
+
+// Channel discovery
+extern bool     now_channel_scan;     // runtime switch, starts at NOW_CHANNEL_SCAN
+extern uint8_t  g_now_channel;        // channel the EMF node was last reached on
+extern uint32_t g_now_scans;          // channel sweeps started
+
+// Rendezvous listening
+extern bool     now_rdv_enabled;      // runtime switch, starts at RDV_ENABLE
+extern uint32_t now_rdv_period_ms;    // slot period asked for, starts at RDV_PERIOD_MS
+extern bool     g_rdv_joined;         // following the EMF node's slot schedule
+extern uint32_t g_rdv_polls;          // polls sent
+extern uint32_t g_rdv_missed;         // polls the EMF node did not answer in the slot
+extern uint32_t g_rdv_triggers;       // triggers delivered in a slot
+extern uint32_t g_rdv_slept_ms;       // radio off between slots since boot
+
+// Clock sync toward the EMF node (time master)
+extern time_sync_t g_time_sync;
+extern int64_t g_epoch_base_ms;
 
 #endif // ESP_NOW_COMM_H
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "time_sync.h"
+#include <math.h>
+
+// =================== ESTIMATOR TUNING ===================
+static const int64_t  MAX_HOLD_NO_DRIFT_US = 1000000;   // master hold accepted before drift is known
+static const int64_t  MIN_DRIFT_SPAN_US    = 60000000;  // 60 s between drift anchor samples
+static const float    DRIFT_GAIN           = 0.5f;
+static const float    DRIFT_UNKNOWN_PPM    = 60.0f;     // two ±30 ppm crystals
+static const float    DRIFT_FLOOR_PPM      = 2.0f;
+static const float    MIN_DELAY_DECAY      = 1.02f;     // best RTT forgets 2% per sample
+static const uint32_t OUTLIER_SLACK_US     = 2000;
+
+// =================== ESTIMATOR ===================
+void time_sync_reset(time_sync_t& ts) {
+  memset(&ts, 0, sizeof(ts));
+}
+
+bool time_sync_add_sample(time_sync_t& ts, int64_t t1, int64_t t2, int64_t t3, int64_t t4) {
+  const int64_t hold = t3 - t2;
+  if (t4 <= t1 || hold < 0 || (!ts.drift_valid && hold > MAX_HOLD_NO_DRIFT_US)) {
+    ts.rejected++;
+    return false;
+  }
+
+  // Round trip in local units, master hold converted at the estimated rate
+  const double rate = 1.0 + (ts.drift_valid ? ts.drift_ppm * 1e-6 : 0.0);
+  int64_t delay = (t4 - t1) - (int64_t)(hold / rate);
+  if (delay < 0) delay = 0;
+
+  // A much slower exchange than the recent best was queued somewhere
+  if (ts.samples && delay > 2 * (int64_t)ts.min_delay_us + OUTLIER_SLACK_US) {
+    ts.min_delay_us = (uint32_t)(ts.min_delay_us * MIN_DELAY_DECAY) + 1;
+    ts.rejected++;
+    return false;
+  }
+  ts.min_delay_us = ts.samples ? min((uint32_t)(ts.min_delay_us * MIN_DELAY_DECAY) + 1, (uint32_t)delay)
+                               : (uint32_t)delay;
+
+  const int64_t offset = t3 + delay / 2 - t4;
+
+  // Drift from the offset slope over a long enough span
+  if (!ts.synced) {
+    ts.anchor_local_us = t4;
+    ts.anchor_offset_us = offset;
+  } else if (t4 - ts.anchor_local_us >= MIN_DRIFT_SPAN_US) {
+    float slope = (float)((double)(offset - ts.anchor_offset_us) * 1e6 / (double)(t4 - ts.anchor_local_us));
+    if (ts.drift_valid) {
+      ts.drift_resid_ppm = fabsf(slope - ts.drift_ppm);
+      ts.drift_ppm += DRIFT_GAIN * (slope - ts.drift_ppm);
+    } else {
+      ts.drift_ppm = slope;
+      ts.drift_resid_ppm = DRIFT_FLOOR_PPM;
+      ts.drift_valid = true;
+    }
+    ts.anchor_local_us = t4;
+    ts.anchor_offset_us = offset;
+  }
+
+  ts.ref_local_us = t4;
+  ts.ref_offset_us = offset;
+  ts.delay_us = (uint32_t)delay;
+  ts.synced = true;
+  ts.samples++;
+  return true;
+}
+
+int64_t time_sync_to_master(const time_sync_t& ts, int64_t local_us) {
+  int64_t master = local_us + ts.ref_offset_us;
+  if (ts.drift_valid) master += (int64_t)((double)(local_us - ts.ref_local_us) * ts.drift_ppm * 1e-6);
+  return master;
+}
+
+// Half the round trip bounds the offset error; drift uncertainty grows with age
+uint32_t time_sync_accuracy_us(const time_sync_t& ts, int64_t local_us) {
+  if (!ts.synced) return UINT32_MAX;
+  float ppm = ts.drift_valid ? DRIFT_FLOOR_PPM + ts.drift_resid_ppm : DRIFT_UNKNOWN_PPM;
+  double age_us = fabs((double)(local_us - ts.ref_local_us));
+  double acc = ts.delay_us / 2.0 + age_us * ppm * 1e-6;
+  return acc >= (double)UINT32_MAX ? UINT32_MAX : (uint32_t)acc;
+}
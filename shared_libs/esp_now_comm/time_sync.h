@@ -0,0 +1,38 @@
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// =================== TWO-WAY TIME TRANSFER ===================
+// NTP-style exchange toward a master clock:
+//   t1 = slave TX, t2 = master RX, t3 = master TX, t4 = slave RX
+//   delay  = (t4 - t1) - (t3 - t2)
+//   offset = t3 + delay/2 - t4          (master - local, at t4)
+// The master's hold time (t3 - t2) is rescaled by the drift estimate, so
+// stamps piggybacked on frames sent long after the request stay usable.
+
+typedef struct {
+  bool     synced;
+  bool     drift_valid;
+  int64_t  ref_local_us;      // local time of the last accepted sample
+  int64_t  ref_offset_us;     // master - local at ref_local_us
+  float    drift_ppm;         // master rate vs local (+ = master runs fast)
+  float    drift_resid_ppm;   // last |slope - estimate|, for the error bound
+  int64_t  anchor_local_us;   // start of the current drift span
+  int64_t  anchor_offset_us;
+  uint32_t delay_us;          // round trip of the last accepted sample
+  uint32_t min_delay_us;      // decaying best round trip, for outlier rejection
+  uint32_t samples;
+  uint32_t rejected;
+} time_sync_t;
+
+void     time_sync_reset(time_sync_t& ts);
+bool     time_sync_add_sample(time_sync_t& ts, int64_t t1, int64_t t2, int64_t t3, int64_t t4);
+int64_t  time_sync_to_master(const time_sync_t& ts, int64_t local_us);
+uint32_t time_sync_accuracy_us(const time_sync_t& ts, int64_t local_us);
+
+// Local timestamp used for all stamps (64-bit, does not wrap like micros())
+static inline int64_t time_sync_local_us() { return esp_timer_get_time(); }
+
+#endif // TIME_SYNC_H
@@ -0,0 +1,182 @@
+#include "mem_telemetry.h"
+#include <esp_heap_caps.h>
+#include <stdarg.h>
+
+// Include config from the specific project
+#ifdef ESP32_CAM
+  #include "config.h"  // ESP32-CAM config
+#elif defined(EMF_SENSOR)
+  #include "emf_config.h"  // EMF sensor config
+#endif
+
+// Defaults (the EMF config does not define these)
+#ifndef MEMT_SAMPLE_MS
+  #define MEMT_SAMPLE_MS 10000
+#endif
+#ifndef MEMT_REPORT_MS
+  #define MEMT_REPORT_MS 600000
+#endif
+
+// =================== GLOBAL VARIABLES ===================
+memt_sys_t memt_stage = MEMT_NONE;
+const char* const memt_sys_names[MEMT_SYS_COUNT] = { "dsp", "nn", "post", "web", "log" };
+const char* const memt_task_names[MEMT_TASK_COUNT] = { "loop", "wifi", "tcpip", "timer" };
+
+static const uint32_t pool_caps[2] = {
+  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+  MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+};
+// FreeRTOS names of the watched tasks; the loop task is taken at init
+static const char* const task_rtos_names[MEMT_TASK_COUNT] = { nullptr, "wifi", "tiT", "esp_timer" };
+static TaskHandle_t task_handles[MEMT_TASK_COUNT];
+
+static memt_summary_t memt = {};
+static uint32_t last_sample_ms = 0;
+static uint32_t last_report_ms = 0;
+
+// Open scopes: free internal heap at begin
+static bool     scope_open[MEMT_SYS_COUNT];
+static uint32_t scope_base[MEMT_SYS_COUNT];
+
+// =================== SAMPLING ===================
+void init_mem_telemetry() {
+  task_handles[MEMT_TASK_LOOP] = xTaskGetCurrentTaskHandle();
+  for (int t = 0; t < MEMT_TASK_COUNT; t++) memt.stack_min[t] = 0xFFFF;
+  for (int p = 0; p < 2; p++) memt.heap_largest_min[p] = UINT32_MAX;
+  memt_sample();
+  last_report_ms = millis();
+}
+
+void memt_sample() {
+  memt.samples++;
+  memt.uptime_s = millis() / 1000;
+  for (int p = 0; p < 2; p++) {
+    memt.heap_free[p] = heap_caps_get_free_size(pool_caps[p]);
+    memt.heap_min[p] = heap_caps_get_minimum_free_size(pool_caps[p]);
+    memt.heap_largest[p] = heap_caps_get_largest_free_block(pool_caps[p]);
+    if (memt.heap_largest[p] < memt.heap_largest_min[p]) memt.heap_largest_min[p] = memt.heap_largest[p];
+  }
+  // Tasks started after init (WiFi) are looked up until found
+  for (int t = 0; t < MEMT_TASK_COUNT; t++) {
+    if (!task_handles[t] && task_rtos_names[t]) task_handles[t] = xTaskGetHandle(task_rtos_names[t]);
+    if (task_handles[t]) {
+      memt.stack_min[t] = (uint16_t)min((uint32_t)uxTaskGetStackHighWaterMark(task_handles[t]), (uint32_t)0xFFFE);
+    }
+  }
+}
+
+void memt_poll() {
+  const uint32_t now = millis();
+  if (now - last_sample_ms < MEMT_SAMPLE_MS) return;
+  last_sample_ms = now;
+  memt_sample();
+  if (MEMT_REPORT_MS && now - last_report_ms >= MEMT_REPORT_MS) {
+    last_report_ms = now;
+    memt_report();
+  }
+}
+
+// =================== SUBSYSTEMS ===================
+static void hold(memt_sys_t sys, int32_t bytes) {
+  const uint32_t live = memt.sys_live[sys];
+  memt.sys_live[sys] = bytes < 0 && (uint32_t)-bytes > live ? 0 : live + bytes;
+  if (memt.sys_live[sys] > memt.sys_peak[sys]) memt.sys_peak[sys] = memt.sys_live[sys];
+}
+
+void memt_account(memt_sys_t sys, int32_t bytes) {
+  if (sys >= MEMT_SYS_COUNT) return;
+  if (bytes > 0) memt.sys_allocs[sys]++;
+  hold(sys, bytes);
+}
+
+static uint32_t internal_free() {
+  return heap_caps_get_free_size(pool_caps[0]);
+}
+
+void memt_scope_begin(memt_sys_t sys) {
+  if (sys >= MEMT_SYS_COUNT || scope_open[sys]) return;
+  scope_open[sys] = true;
+  scope_base[sys] = internal_free();
+}
+
+void memt_scope_mark(memt_sys_t sys) {
+  if (sys >= MEMT_SYS_COUNT || !scope_open[sys]) return;
+  const uint32_t now_free = internal_free();
+  const uint32_t held = memt.sys_live[sys] + (now_free < scope_base[sys] ? scope_base[sys] - now_free : 0);
+  if (held > memt.sys_peak[sys]) memt.sys_peak[sys] = held;
+}
+
+void memt_scope_end(memt_sys_t sys) {
+  if (sys >= MEMT_SYS_COUNT || !scope_open[sys]) return;
+  memt_scope_mark(sys);
+  scope_open[sys] = false;
+  memt.sys_allocs[sys]++;
+  hold(sys, (int32_t)(scope_base[sys] - internal_free()));
+}
+
+// =================== EXPORT ===================
+void memt_fill(memt_summary_t& s) {
+  memt_sample();
+  s = memt;
+}
+
+void memt_report() {
+  static const char* const pools[2] = { "internal", "psram" };
+  Serial.printf("[MEMT] up %lu s, %lu samples\n", (unsigned long)memt.uptime_s, (unsigned long)memt.samples);
+  Serial.println("[MEMT] pool          free  min free   largest  min largest");
+  for (int p = 0; p < 2; p++) {
+    Serial.printf("[MEMT] %-9s %9u %9u %9u %12u\n", pools[p], (unsigned)memt.heap_free[p],
+                  (unsigned)memt.heap_min[p], (unsigned)memt.heap_largest[p],
+                  (unsigned)(memt.heap_largest_min[p] == UINT32_MAX ? 0 : memt.heap_largest_min[p]));
+  }
+  char line[96];
+  int n = snprintf(line, sizeof(line), "[MEMT] stack never used:");
+  for (int t = 0; t < MEMT_TASK_COUNT && n < (int)sizeof(line); t++) {
+    n += memt.stack_min[t] == 0xFFFF ? snprintf(line + n, sizeof(line) - n, " %s -", memt_task_names[t])
+                                     : snprintf(line + n, sizeof(line) - n, " %s %u B", memt_task_names[t],
+                                                (unsigned)memt.stack_min[t]);
+  }
+  Serial.println(line);
+  Serial.println("[MEMT] subsystem     live      peak    allocs");
+  for (int sys = 0; sys < MEMT_SYS_COUNT; sys++) {
+    Serial.printf("[MEMT] %-9s %9u %9u %9u\n", memt_sys_names[sys], (unsigned)memt.sys_live[sys],
+                  (unsigned)memt.sys_peak[sys], (unsigned)memt.sys_allocs[sys]);
+  }
+}
+
+static void append(char* buf, size_t len, size_t& n, const char* fmt, ...) {
+  if (n + 1 >= len) return;
+  va_list ap;
+  va_start(ap, fmt);
+  const int w = vsnprintf(buf + n, len - n, fmt, ap);
+  va_end(ap);
+  if (w > 0) n = min(n + (size_t)w, len - 1);
+}
+
+size_t memt_json(const memt_summary_t& s, char* buf, size_t len) {
+  static const char* const pools[2] = { "internal", "psram" };
+  size_t n = 0;
+  if (!len) return 0;
+  buf[0] = '\0';
+  append(buf, len, n, "{\"uptime_s\":%u,\"samples\":%u", (unsigned)s.uptime_s, (unsigned)s.samples);
+  for (int p = 0; p < 2; p++) {
+    append(buf, len, n, ",\"%s\":{\"free\":%u,\"min\":%u,\"largest\":%u,\"largest_min\":%u}", pools[p],
+           (unsigned)s.heap_free[p], (unsigned)s.heap_min[p], (unsigned)s.heap_largest[p],
+           (unsigned)(s.heap_largest_min[p] == UINT32_MAX ? 0 : s.heap_largest_min[p]));
+  }
+  append(buf, len, n, ",\"stack_min\":{");
+  for (int t = 0; t < MEMT_TASK_COUNT; t++) {
+    if (s.stack_min[t] == 0xFFFF) {
+      append(buf, len, n, "%s\"%s\":null", t ? "," : "", memt_task_names[t]);
+    } else {
+      append(buf, len, n, "%s\"%s\":%u", t ? "," : "", memt_task_names[t], (unsigned)s.stack_min[t]);
+    }
+  }
+  append(buf, len, n, "}");
+  for (int sys = 0; sys < MEMT_SYS_COUNT; sys++) {
+    append(buf, len, n, ",\"%s\":{\"live\":%u,\"peak\":%u,\"allocs\":%u}", memt_sys_names[sys],
+           (unsigned)s.sys_live[sys], (unsigned)s.sys_peak[sys], (unsigned)s.sys_allocs[sys]);
+  }
+  append(buf, len, n, "}");
+  return n;
+}
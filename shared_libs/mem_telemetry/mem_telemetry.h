@@ -0,0 +1,70 @@
+#ifndef MEM_TELEMETRY_H
+#define MEM_TELEMETRY_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// =================== MEMORY TELEMETRY ===================
+// Low-water marks sampled every MEMT_SAMPLE_MS: free heap and largest free
+// block per pool (fragmentation shows as a largest block that keeps
+// shrinking while the free total does not) and the stack a task never used.
+// Subsystems count the heap they hold: exactly where the allocator is ours
+// (memt_account: EI heap and arena), else as the drop in free internal heap
+// across a scope (memt_scope_*: web handlers, log writes), which also
+// catches what other tasks allocate meanwhile.
+typedef enum {
+  MEMT_DSP = 0,            // EI feature extraction
+  MEMT_NN,                 // tensor arena, model setup and invoke
+  MEMT_POST,               // FOMO output decoding
+  MEMT_WEB,                // HTTP handlers
+  MEMT_LOG,                // CSV log on SPIFFS
+  MEMT_SYS_COUNT,
+  MEMT_NONE = MEMT_SYS_COUNT
+} memt_sys_t;
+
+typedef enum {
+  MEMT_TASK_LOOP = 0,      // Arduino loopTask (setup / loop)
+  MEMT_TASK_WIFI,          // "wifi"
+  MEMT_TASK_TCPIP,         // "tiT" (lwIP)
+  MEMT_TASK_TIMER,         // "esp_timer"
+  MEMT_TASK_COUNT
+} memt_task_t;
+
+// Heartbeat payload and /json object; pools are internal, PSRAM
+typedef struct __attribute__((packed)) {
+  uint32_t uptime_s;
+  uint32_t samples;
+  uint32_t heap_free[2];
+  uint32_t heap_min[2];            // lowest free since boot
+  uint32_t heap_largest[2];        // largest free block now
+  uint32_t heap_largest_min[2];    // lowest largest block sampled
+  uint16_t stack_min[MEMT_TASK_COUNT];   // bytes never used, 0xFFFF = task not found
+  uint32_t sys_live[MEMT_SYS_COUNT];     // bytes held now
+  uint32_t sys_peak[MEMT_SYS_COUNT];     // most bytes held at once
+  uint32_t sys_allocs[MEMT_SYS_COUNT];   // allocations (scopes for measured subsystems)
+} memt_summary_t;
+
+void init_mem_telemetry();   // from setup(): the calling task is the loop task
+void memt_poll();            // sample when due, report every MEMT_REPORT_MS; call from loop()
+void memt_sample();
+void memt_report();
+
+// Exact: bytes allocated (> 0) or freed (< 0) on behalf of sys
+void memt_account(memt_sys_t sys, int32_t bytes);
+// Measured: the internal heap sys holds changes by the drop in free heap
+// from begin to end; mark at the heaviest point in between for the peak
+void memt_scope_begin(memt_sys_t sys);
+void memt_scope_mark(memt_sys_t sys);
+void memt_scope_end(memt_sys_t sys);
+
+void memt_fill(memt_summary_t& s);
+// JSON object of s into buf; length written (truncated to len - 1)
+size_t memt_json(const memt_summary_t& s, char* buf, size_t len);
+
+// =================== GLOBAL VARIABLES ===================
+extern memt_sys_t memt_stage;    // subsystem allocations are counted to (EI stage)
+extern const char* const memt_sys_names[MEMT_SYS_COUNT];
+extern const char* const memt_task_names[MEMT_TASK_COUNT];
+
+#endif // MEM_TELEMETRY_H